@@ -0,0 +1,142 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+// Round a target cache blocksize (in elements) down to a positive multiple
+// of the register blocksize mr.
+static dim_t bli_armsve_mc( dim_t mr, dim_t mc_target )
+{
+	return bli_max( mr, ( mc_target / mr ) * mr );
+}
+
+void bli_cntx_init_armsve( cntx_t* cntx )
+{
+	blksz_t blkszs[ BLIS_NUM_BLKSZS ];
+
+	// Set default kernel blocksizes and functions.
+	bli_cntx_init_armsve_ref( cntx );
+
+	// -------------------------------------------------------------------------
+
+	// The SVE vector length is implementation-defined (128 to 2048 bits), so
+	// the register blocksize MR of the vector-length agnostic micro-kernels
+	// is only known at runtime. Each micro-kernel queries the vector length
+	// itself; here we mirror that computation so that the blocksizes stored
+	// in the context agree with what the kernels actually compute.
+	const dim_t vl_s = svcntw();
+	const dim_t vl_d = svcntd();
+
+	const dim_t mr_s = 2 * vl_s;
+	const dim_t mr_d = 2 * vl_d;
+	const dim_t mr_c = vl_s;
+	const dim_t mr_z = vl_d;
+
+	// Update the context with optimized native gemm micro-kernels and
+	// their storage preferences.
+	bli_cntx_set_l3_nat_ukrs
+	(
+	  4,
+	  BLIS_GEMM_UKR, BLIS_FLOAT,    bli_sgemm_armsve_int_2vx8, FALSE,
+	  BLIS_GEMM_UKR, BLIS_DOUBLE,   bli_dgemm_armsve_int_2vx8, FALSE,
+	  BLIS_GEMM_UKR, BLIS_SCOMPLEX, bli_cgemm_armsve_int_2vx8, FALSE,
+	  BLIS_GEMM_UKR, BLIS_DCOMPLEX, bli_zgemm_armsve_int_2vx8, FALSE,
+	  cntx
+	);
+
+	// Update the context with optimized packm kernels. The packm kernel id
+	// is the panel dimension, and ids are only defined up to
+	// BLIS_NUM_PACKM_KERS-1, so for long vector lengths we leave the
+	// default (scal2m-based) packing in place for the affected datatypes.
+	if ( mr_s < BLIS_NUM_PACKM_KERS )
+		bli_cntx_set_packm_kers
+		(
+		  1,
+		  ( l1mkr_t )mr_s, BLIS_FLOAT,    bli_spackm_armsve_int_2vxk,
+		  cntx
+		);
+	if ( mr_d < BLIS_NUM_PACKM_KERS )
+		bli_cntx_set_packm_kers
+		(
+		  1,
+		  ( l1mkr_t )mr_d, BLIS_DOUBLE,   bli_dpackm_armsve_int_2vxk,
+		  cntx
+		);
+	if ( mr_c < BLIS_NUM_PACKM_KERS )
+		bli_cntx_set_packm_kers
+		(
+		  1,
+		  ( l1mkr_t )mr_c, BLIS_SCOMPLEX, bli_cpackm_armsve_int_2vxk,
+		  cntx
+		);
+	if ( mr_z < BLIS_NUM_PACKM_KERS )
+		bli_cntx_set_packm_kers
+		(
+		  1,
+		  ( l1mkr_t )mr_z, BLIS_DCOMPLEX, bli_zpackm_armsve_int_2vxk,
+		  cntx
+		);
+
+	// Initialize level-3 blocksize objects with architecture-specific values.
+	// MC targets a packed block of A of roughly 256KB at the chosen KC.
+	//                                           s      d      c      z
+	bli_blksz_init_easy( &blkszs[ BLIS_MR ],  mr_s,  mr_d,  mr_c,  mr_z );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],     8,     8,     8,     8 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ], bli_armsve_mc( mr_s, 256 ),
+	                                         bli_armsve_mc( mr_d, 128 ),
+	                                         bli_armsve_mc( mr_c, 128 ),
+	                                         bli_armsve_mc( mr_z,  64 ) );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC ],   256,   256,   256,   256 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  4080,  4080,  4080,  4080 );
+
+	// Update the context with the current architecture's register and cache
+	// blocksizes (and multiples) for native execution.
+	bli_cntx_set_blkszs
+	(
+	  BLIS_NAT, 5,
+	  BLIS_NC, &blkszs[ BLIS_NC ], BLIS_NR,
+	  BLIS_KC, &blkszs[ BLIS_KC ], BLIS_KR,
+	  BLIS_MC, &blkszs[ BLIS_MC ], BLIS_MR,
+	  BLIS_NR, &blkszs[ BLIS_NR ], BLIS_NR,
+	  BLIS_MR, &blkszs[ BLIS_MR ], BLIS_MR,
+	  cntx
+	);
+}
+
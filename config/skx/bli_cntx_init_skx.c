@@ -37,6 +37,7 @@
 void bli_cntx_init_skx( cntx_t* cntx )
 {
 	blksz_t blkszs[ BLIS_NUM_BLKSZS ];
+	blksz_t thresh[ BLIS_NUM_THRESH ];
 
 	// Set default kernel blocksizes and functions.
 	bli_cntx_init_skx_ref( cntx );
@@ -54,16 +55,50 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  cntx
 	);
 
+	// Update the context with optimized integer gemm micro-kernels and
+	// their blocksizes.
+	bli_cntx_set_l3_gemmi_ukr
+	(
+	  BLIS_GEMMI_U8S8S32,   bli_gemmi_u8s8s32_haswell_int_6x16,   6, 16, 144, 1024, 4080,
+	  cntx
+	);
+	bli_cntx_set_l3_gemmi_ukr
+	(
+	  BLIS_GEMMI_S16S16S32, bli_gemmi_s16s16s32_haswell_int_6x16, 6, 16, 144,  512, 4080,
+	  cntx
+	);
+
+	// Update the context with optimized spmm micro-kernels.
+	bli_cntx_set_l3_spmm_ukr( BLIS_FLOAT,  bli_sspmm_haswell_int_16, 16, cntx );
+	bli_cntx_set_l3_spmm_ukr( BLIS_DOUBLE, bli_dspmm_haswell_int_8,   8, cntx );
+
+	// Update the context with optimized multi-target gemm micro-kernels.
+	bli_cntx_set_l3_gemmsum_ukr( BLIS_FLOAT,  bli_sgemmsum_skx_int_32x12, cntx );
+	bli_cntx_set_l3_gemmsum_ukr( BLIS_DOUBLE, bli_dgemmsum_skx_int_16x14, cntx );
+
+	// Update the context with optimized half-precision packm kernels.
+	bli_cntx_set_packm_half_ker( BLIS_HALF_BF16, bli_packm_bf16_skx_int, cntx );
+	bli_cntx_set_packm_half_ker( BLIS_HALF_FP16, bli_packm_fp16_skx_int, cntx );
+
 	// Update the context with optimized level-1f kernels.
 	bli_cntx_set_l1f_kers
 	(
-	  4,
+	  10,
+	  // axpy2v
+	  BLIS_AXPY2V_KER,    BLIS_FLOAT,  bli_saxpy2v_skx_int,
+	  BLIS_AXPY2V_KER,    BLIS_DOUBLE, bli_daxpy2v_skx_int,
+	  // dotaxpyv
+	  BLIS_DOTAXPYV_KER,  BLIS_FLOAT,  bli_sdotaxpyv_skx_int,
+	  BLIS_DOTAXPYV_KER,  BLIS_DOUBLE, bli_ddotaxpyv_skx_int,
 	  // axpyf
-	  BLIS_AXPYF_KER,     BLIS_FLOAT,  bli_saxpyf_zen_int_8,
-	  BLIS_AXPYF_KER,     BLIS_DOUBLE, bli_daxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_FLOAT,  bli_saxpyf_skx_int_16,
+	  BLIS_AXPYF_KER,     BLIS_DOUBLE, bli_daxpyf_skx_int_16,
 	  // dotxf
-	  BLIS_DOTXF_KER,     BLIS_FLOAT,  bli_sdotxf_zen_int_8,
-	  BLIS_DOTXF_KER,     BLIS_DOUBLE, bli_ddotxf_zen_int_8,
+	  BLIS_DOTXF_KER,     BLIS_FLOAT,  bli_sdotxf_skx_int_16,
+	  BLIS_DOTXF_KER,     BLIS_DOUBLE, bli_ddotxf_skx_int_16,
+	  // dotxaxpyf
+	  BLIS_DOTXAXPYF_KER, BLIS_FLOAT,  bli_sdotxaxpyf_skx_int_8,
+	  BLIS_DOTXAXPYF_KER, BLIS_DOUBLE, bli_ddotxaxpyf_skx_int_8,
 	  cntx
 	);
 
@@ -71,33 +106,21 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	bli_cntx_set_l1v_kers
 	(
 	  10,
-#if 1
 	  // amaxv
 	  BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
 	  BLIS_AMAXV_KER,  BLIS_DOUBLE, bli_damaxv_zen_int,
-#endif
 	  // axpyv
-#if 0
-	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int,
-	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int,
-#else
-	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int10,
-	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_zen_int10,
-#endif
+	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_skx_int,
+	  BLIS_AXPYV_KER,  BLIS_DOUBLE, bli_daxpyv_skx_int,
 	  // dotv
-	  BLIS_DOTV_KER,   BLIS_FLOAT,  bli_sdotv_zen_int,
-	  BLIS_DOTV_KER,   BLIS_DOUBLE, bli_ddotv_zen_int,
+	  BLIS_DOTV_KER,   BLIS_FLOAT,  bli_sdotv_skx_int,
+	  BLIS_DOTV_KER,   BLIS_DOUBLE, bli_ddotv_skx_int,
 	  // dotxv
-	  BLIS_DOTXV_KER,  BLIS_FLOAT,  bli_sdotxv_zen_int,
-	  BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_zen_int,
+	  BLIS_DOTXV_KER,  BLIS_FLOAT,  bli_sdotxv_skx_int,
+	  BLIS_DOTXV_KER,  BLIS_DOUBLE, bli_ddotxv_skx_int,
 	  // scalv
-#if 0
-	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int,
-	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int,
-#else
-	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
-	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
-#endif
+	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_skx_int,
+	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_skx_int,
 	  cntx
 	);
 
@@ -109,14 +132,15 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	bli_blksz_init     ( &blkszs[ BLIS_KC ],   384,   384,    -1,    -1,
 	                                           480,   480,    -1,    -1 );
 	bli_blksz_init_easy( &blkszs[ BLIS_NC ],  3072,  3752,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,    -1,    -1 );
-	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_AF ],    16,    16,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_DF ],    16,    16,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_XF ],     8,     8,    -1,    -1 );
 
 	// Update the context with the current architecture's register and cache
 	// blocksizes (and multiples) for native execution.
 	bli_cntx_set_blkszs
 	(
-	  BLIS_NAT, 7,
+	  BLIS_NAT, 8,
 	  // level-3
 	  BLIS_NC, &blkszs[ BLIS_NC ], BLIS_NR,
 	  BLIS_KC, &blkszs[ BLIS_KC ], BLIS_KR,
@@ -126,6 +150,68 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  // level-1f
 	  BLIS_AF, &blkszs[ BLIS_AF ], BLIS_AF,
 	  BLIS_DF, &blkszs[ BLIS_DF ], BLIS_DF,
+	  BLIS_XF, &blkszs[ BLIS_XF ], BLIS_XF,
+	  cntx
+	);
+
+	// -------------------------------------------------------------------------
+
+	// Initialize sup thresholds with architecture-appropriate values. Only
+	// double precision has optimized sup kernels on skx (see below), so the
+	// sup path remains disabled for the other datatypes.
+	//                                          s     d     c     z
+	bli_blksz_init_easy( &thresh[ BLIS_MT ],   -1,  201,   -1,   -1 );
+	bli_blksz_init_easy( &thresh[ BLIS_NT ],   -1,  201,   -1,   -1 );
+	bli_blksz_init_easy( &thresh[ BLIS_KT ],   -1,  201,   -1,   -1 );
+
+	// Initialize the context with the sup thresholds.
+	bli_cntx_set_l3_sup_thresh
+	(
+	  3,
+	  BLIS_MT, &thresh[ BLIS_MT ],
+	  BLIS_NT, &thresh[ BLIS_NT ],
+	  BLIS_KT, &thresh[ BLIS_KT ],
+	  cntx
+	);
+
+	// Update the context with optimized small/unpacked gemm kernels. There
+	// are no skx-specific sup kernels yet, so we borrow the haswell kernels,
+	// which are part of the skx kernel set.
+	bli_cntx_set_l3_sup_kers
+	(
+	  8,
+	  BLIS_RRR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
+	  BLIS_RRC, BLIS_DOUBLE, bli_dgemmsup_rd_haswell_asm_6x8m, TRUE,
+	  BLIS_RCR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
+	  BLIS_RCC, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
+	  BLIS_CRR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8m, TRUE,
+	  BLIS_CRC, BLIS_DOUBLE, bli_dgemmsup_rd_haswell_asm_6x8n, TRUE,
+	  BLIS_CCR, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
+	  BLIS_CCC, BLIS_DOUBLE, bli_dgemmsup_rv_haswell_asm_6x8n, TRUE,
+	  cntx
+	);
+
+	// Initialize level-3 sup blocksize objects. These are the haswell values
+	// that go with the borrowed haswell kernels; they have not been retuned
+	// for skx.
+	//                                           s      d      c      z
+	bli_blksz_init     ( &blkszs[ BLIS_MR ],    -1,     6,    -1,    -1,
+	                                            -1,     9,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NR ],    -1,     8,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_MC ],    -1,    72,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_KC ],    -1,   256,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_NC ],    -1,  4080,    -1,    -1 );
+
+	// Update the context with the current architecture's register and cache
+	// blocksizes for small/unpacked level-3 problems.
+	bli_cntx_set_l3_sup_blkszs
+	(
+	  5,
+	  BLIS_NC, &blkszs[ BLIS_NC ],
+	  BLIS_KC, &blkszs[ BLIS_KC ],
+	  BLIS_MC, &blkszs[ BLIS_MC ],
+	  BLIS_NR, &blkszs[ BLIS_NR ],
+	  BLIS_MR, &blkszs[ BLIS_MR ],
 	  cntx
 	);
 }
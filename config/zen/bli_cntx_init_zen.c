@@ -66,16 +66,50 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  cntx
 	);
 
+	// Update the context with optimized integer gemm micro-kernels and
+	// their blocksizes.
+	bli_cntx_set_l3_gemmi_ukr
+	(
+	  BLIS_GEMMI_U8S8S32,   bli_gemmi_u8s8s32_haswell_int_6x16,   6, 16, 144, 1024, 4080,
+	  cntx
+	);
+	bli_cntx_set_l3_gemmi_ukr
+	(
+	  BLIS_GEMMI_S16S16S32, bli_gemmi_s16s16s32_haswell_int_6x16, 6, 16, 144,  512, 4080,
+	  cntx
+	);
+
+	// Update the context with optimized spmm micro-kernels.
+	bli_cntx_set_l3_spmm_ukr( BLIS_FLOAT,  bli_sspmm_haswell_int_16, 16, cntx );
+	bli_cntx_set_l3_spmm_ukr( BLIS_DOUBLE, bli_dspmm_haswell_int_8,   8, cntx );
+
+	// Update the context with optimized multi-target gemm micro-kernels.
+	bli_cntx_set_l3_gemmsum_ukr( BLIS_FLOAT,  bli_sgemmsum_haswell_int_6x16, cntx );
+	bli_cntx_set_l3_gemmsum_ukr( BLIS_DOUBLE, bli_dgemmsum_haswell_int_6x8,  cntx );
+
+	// Update the context with optimized half-precision packm kernels.
+	bli_cntx_set_packm_half_ker( BLIS_HALF_BF16, bli_packm_bf16_haswell_int, cntx );
+	bli_cntx_set_packm_half_ker( BLIS_HALF_FP16, bli_packm_fp16_haswell_int, cntx );
+
 	// Update the context with optimized level-1f kernels.
 	bli_cntx_set_l1f_kers
 	(
-	  4,
+	  10,
+	  // axpy2v
+	  BLIS_AXPY2V_KER,    BLIS_FLOAT,  bli_saxpy2v_zen_int,
+	  BLIS_AXPY2V_KER,    BLIS_DOUBLE, bli_daxpy2v_zen_int,
+	  // dotaxpyv
+	  BLIS_DOTAXPYV_KER,  BLIS_FLOAT,  bli_sdotaxpyv_zen_int,
+	  BLIS_DOTAXPYV_KER,  BLIS_DOUBLE, bli_ddotaxpyv_zen_int,
 	  // axpyf
 	  BLIS_AXPYF_KER,     BLIS_FLOAT,  bli_saxpyf_zen_int_8,
 	  BLIS_AXPYF_KER,     BLIS_DOUBLE, bli_daxpyf_zen_int_8,
 	  // dotxf
 	  BLIS_DOTXF_KER,     BLIS_FLOAT,  bli_sdotxf_zen_int_8,
 	  BLIS_DOTXF_KER,     BLIS_DOUBLE, bli_ddotxf_zen_int_8,
+	  // dotxaxpyf
+	  BLIS_DOTXAXPYF_KER, BLIS_FLOAT,  bli_sdotxaxpyf_zen_int_4,
+	  BLIS_DOTXAXPYF_KER, BLIS_DOUBLE, bli_ddotxaxpyf_zen_int_4,
 	  cntx
 	);
 
@@ -150,12 +184,13 @@ void bli_cntx_init_zen( cntx_t* cntx )
 #endif
 	bli_blksz_init_easy( &blkszs[ BLIS_AF ],     8,     8,    -1,    -1 );
 	bli_blksz_init_easy( &blkszs[ BLIS_DF ],     8,     8,    -1,    -1 );
+	bli_blksz_init_easy( &blkszs[ BLIS_XF ],     4,     4,    -1,    -1 );
 
 	// Update the context with the current architecture's register and cache
 	// blocksizes (and multiples) for native execution.
 	bli_cntx_set_blkszs
 	(
-	  BLIS_NAT, 7,
+	  BLIS_NAT, 8,
 	  // level-3
 	  BLIS_NC, &blkszs[ BLIS_NC ], BLIS_NR,
 	  BLIS_KC, &blkszs[ BLIS_KC ], BLIS_KR,
@@ -165,6 +200,7 @@ void bli_cntx_init_zen( cntx_t* cntx )
 	  // level-1f
 	  BLIS_AF, &blkszs[ BLIS_AF ], BLIS_AF,
 	  BLIS_DF, &blkszs[ BLIS_DF ], BLIS_DF,
+	  BLIS_XF, &blkszs[ BLIS_XF ], BLIS_XF,
 	  cntx
 	);
 
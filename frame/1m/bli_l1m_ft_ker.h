@@ -115,6 +115,20 @@ typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
 
 INSERT_GENTDEF( unpackm_cxk )
 
+// packm_half_ker
+
+// NOTE: Half-precision values are only a storage format, so there is one
+// function type for the kernels that widen either format to float.
+
+typedef void (*packm_half_ker_ft)
+     (
+       dim_t            cdim,
+       dim_t            n,
+       void*   restrict a, inc_t inca, inc_t lda,
+       float*  restrict p,             inc_t ldp,
+       cntx_t* restrict cntx
+     );
+
 // packm_3mis_ker
 // packm_4mi_ker
 
@@ -55,6 +55,20 @@ void PASTEMAC(ch,varname) \
      );
 
 
+// half-precision packm kernels
+
+#define PACKM_HALF_KER_PROT( opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       dim_t            cdim, \
+       dim_t            n, \
+       void*   restrict a, inc_t inca, inc_t lda, \
+       float*  restrict p,             inc_t ldp, \
+       cntx_t* restrict cntx  \
+     );
+
+
 // native unpackm kernels
 
 #define UNPACKM_KER_PROT( ctype, ch, varname ) \
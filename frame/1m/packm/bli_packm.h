@@ -41,6 +41,8 @@
 #include "bli_packm_part.h"
 
 #include "bli_packm_var.h"
+#include "bli_packm_blk_var1_sum.h"
+#include "bli_packm_zero_blks.h"
 
 #include "bli_packm_struc_cxk.h"
 #include "bli_packm_struc_cxk_4mi.h"
@@ -120,6 +120,14 @@ void bli_packm_blk_var1
 	}
 #endif
 
+	// Call a different packm implementation when C carries a list of terms
+	// whose linear combination is to be packed (see bli_gemmstrassen()).
+	if ( bli_obj_has_terms( c ) )
+	{
+		bli_packm_blk_var1_sum( c, p, cntx, cntl, t );
+		return;
+	}
+
 	num_t     dt_p       = bli_obj_dt( p );
 
 	struc_t   strucc     = bli_obj_struc( c );
@@ -0,0 +1,345 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#define FUNCPTR_T packm_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       trans_t     transc,
+       pack_t      schema,
+       dim_t       m,
+       dim_t       n,
+       dim_t       m_max,
+       dim_t       n_max,
+       sumterms_t* terms,
+       void*       c, inc_t rs_c, inc_t cs_c,
+       void*       p, inc_t rs_p, inc_t cs_p,
+                      dim_t pd_p, inc_t ps_p,
+       cntx_t*     cntx,
+       thrinfo_t*  thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes,packm_blk_var1_sum);
+
+
+void bli_packm_blk_var1_sum
+     (
+       obj_t*   c,
+       obj_t*   p,
+       cntx_t*  cntx,
+       cntl_t*  cntl,
+       thrinfo_t* t
+     )
+{
+	num_t       dt_p       = bli_obj_dt( p );
+
+	trans_t     transc     = bli_obj_conjtrans_status( c );
+	pack_t      schema     = bli_obj_pack_schema( p );
+
+	dim_t       m_p        = bli_obj_length( p );
+	dim_t       n_p        = bli_obj_width( p );
+	dim_t       m_max_p    = bli_obj_padded_length( p );
+	dim_t       n_max_p    = bli_obj_padded_width( p );
+
+	sumterms_t* terms      = bli_obj_terms( c );
+
+	void*       buf_c      = bli_obj_buffer_at_off( c );
+	inc_t       rs_c       = bli_obj_row_stride( c );
+	inc_t       cs_c       = bli_obj_col_stride( c );
+
+	void*       buf_p      = bli_obj_buffer_at_off( p );
+	inc_t       rs_p       = bli_obj_row_stride( p );
+	inc_t       cs_p       = bli_obj_col_stride( p );
+	dim_t       pd_p       = bli_obj_panel_dim( p );
+	inc_t       ps_p       = bli_obj_panel_stride( p );
+
+	FUNCPTR_T   f;
+
+	// Only general matrices, the storage datatype, and native packing are
+	// supported when packing a linear combination of submatrices. Since
+	// the micro-kernel applies alpha in native execution, no scaling is
+	// needed beyond the coefficients of the terms.
+	if ( bli_obj_dt( c ) != dt_p ||
+	     !bli_obj_is_general( c ) ||
+	     !bli_is_nat_packed( schema ) )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	f = ftypes[dt_p];
+
+	// Invoke the function.
+	f(
+	   transc,
+	   schema,
+	   m_p,
+	   n_p,
+	   m_max_p,
+	   n_max_p,
+	   terms,
+	   buf_c, rs_c, cs_c,
+	   buf_p, rs_p, cs_p,
+	          pd_p, ps_p,
+	   cntx,
+	   t );
+}
+
+
+//
+// Pack one micro-panel of the linear combination sum_t( coef_t * C_t ),
+// where C_t is located at c + off[t] and each C_t is a panel_dim x
+// panel_len matrix with strides incc and ldc. The micro-panel is zero-padded
+// out to panel_dim_max x panel_len_max. Each term is accumulated into the
+// micro-panel while it is still in cache.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       conj_t           conjc, \
+       dim_t            panel_dim, \
+       dim_t            panel_dim_max, \
+       dim_t            panel_len, \
+       dim_t            panel_len_max, \
+       dim_t            nterm, \
+       inc_t*           off, \
+       ctype*           coef, \
+       ctype*           c, inc_t incc, inc_t ldc, \
+       ctype*  restrict p,             inc_t ldp  \
+     ) \
+{ \
+	for ( dim_t t = 0; t < nterm; ++t ) \
+	{ \
+		ctype* restrict ct = c + off[ t ]; \
+		ctype           s  = coef[ t ]; \
+\
+		if ( incc == 1 ) \
+		{ \
+			/* Walk down the panel dimension in the inner loop so that
+			   both the source and the micro-panel are read contiguously. */ \
+			for ( dim_t l = 0; l < panel_len; ++l ) \
+			{ \
+				ctype* restrict cl = ct + l*ldc; \
+				ctype* restrict pl = p  + l*ldp; \
+\
+				if ( t == 0 ) \
+				{ \
+					for ( dim_t d = 0; d < panel_dim; ++d ) \
+						PASTEMAC(ch,scal2s)( s, cl[ d ], pl[ d ] ); \
+				} \
+				else \
+				{ \
+					for ( dim_t d = 0; d < panel_dim; ++d ) \
+						PASTEMAC(ch,axpys)( s, cl[ d ], pl[ d ] ); \
+				} \
+			} \
+		} \
+		else \
+		{ \
+			/* Walk along the panel in the inner loop so that the source
+			   is read contiguously when it is stored the other way. */ \
+			for ( dim_t d = 0; d < panel_dim; ++d ) \
+			{ \
+				ctype* restrict cd = ct + d*incc; \
+				ctype* restrict pd = p  + d; \
+\
+				if ( t == 0 ) \
+				{ \
+					for ( dim_t l = 0; l < panel_len; ++l ) \
+						PASTEMAC(ch,scal2s)( s, cd[ l*ldc ], pd[ l*ldp ] ); \
+				} \
+				else \
+				{ \
+					for ( dim_t l = 0; l < panel_len; ++l ) \
+						PASTEMAC(ch,axpys)( s, cd[ l*ldc ], pd[ l*ldp ] ); \
+				} \
+			} \
+		} \
+	} \
+\
+	/* Since the coefficients are real, conjugating the sum is the same as
+	   summing the conjugated terms. */ \
+	if ( bli_is_conj( conjc ) ) \
+	{ \
+		for ( dim_t l = 0; l < panel_len; ++l ) \
+		for ( dim_t d = 0; d < panel_dim; ++d ) \
+			PASTEMAC(ch,conjs)( p[ d + l*ldp ] ); \
+	} \
+\
+	/* Zero the edges of the micro-panel that lie beyond the matrix. */ \
+	for ( dim_t l = 0; l < panel_len; ++l ) \
+	for ( dim_t d = panel_dim; d < panel_dim_max; ++d ) \
+		PASTEMAC(ch,set0s)( p[ d + l*ldp ] ); \
+\
+	for ( dim_t l = panel_len; l < panel_len_max; ++l ) \
+	for ( dim_t d = 0; d < panel_dim_max; ++d ) \
+		PASTEMAC(ch,set0s)( p[ d + l*ldp ] ); \
+}
+
+INSERT_GENTFUNC_BASIC0( packm_sum_cxk )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       trans_t     transc, \
+       pack_t      schema, \
+       dim_t       m, \
+       dim_t       n, \
+       dim_t       m_max, \
+       dim_t       n_max, \
+       sumterms_t* terms, \
+       void*       c, inc_t rs_c, inc_t cs_c, \
+       void*       p, inc_t rs_p, inc_t cs_p, \
+                      dim_t pd_p, inc_t ps_p, \
+       cntx_t*     cntx, \
+       thrinfo_t*  thread  \
+     ) \
+{ \
+	ctype* restrict c_cast = c; \
+	ctype* restrict p_cast = p; \
+	ctype* restrict p_begin; \
+\
+	const dim_t     nterm  = terms->n; \
+	ctype           coef[ BLIS_MAX_SUM_TERMS ]; \
+\
+	dim_t           iter_dim; \
+	dim_t           n_iter; \
+	dim_t           it, ic; \
+	dim_t           panel_len; \
+	dim_t           panel_len_max; \
+	dim_t           panel_dim_i; \
+	dim_t           panel_dim_max; \
+	inc_t           incc, ldc; \
+	inc_t           ldp; \
+	conj_t          conjc; \
+\
+	/* Extract the conjugation bit from the transposition argument. */ \
+	conjc = bli_extract_conj( transc ); \
+\
+	/* If c needs a transposition, induce it so that we can more simply
+	   express the remaining parameters and code. The offsets of the terms
+	   are unaffected since they do not depend on the strides. */ \
+	if ( bli_does_trans( transc ) ) \
+	{ \
+		bli_swap_incs( &rs_c, &cs_c ); \
+		bli_toggle_trans( &transc ); \
+	} \
+\
+	/* If the schema indicates column panels, we are packing to row-stored
+	   column panels; otherwise, we are packing to column-stored row
+	   panels. */ \
+	if ( bli_is_col_packed( schema ) ) \
+	{ \
+		iter_dim      = n; \
+		panel_len     = m; \
+		panel_len_max = m_max; \
+		incc          = cs_c; \
+		ldc           = rs_c; \
+		ldp           = rs_p; \
+	} \
+	else /* if ( bli_is_row_packed( schema ) ) */ \
+	{ \
+		iter_dim      = m; \
+		panel_len     = n; \
+		panel_len_max = n_max; \
+		incc          = rs_c; \
+		ldc           = cs_c; \
+		ldp           = cs_p; \
+	} \
+\
+	panel_dim_max = pd_p; \
+\
+	/* Typecast the coefficients of the terms. */ \
+	for ( dim_t t = 0; t < nterm; ++t ) \
+		PASTEMAC2(d,ch,copys)( terms->coef[ t ], coef[ t ] ); \
+\
+	/* Compute the total number of iterations we'll need. */ \
+	n_iter = iter_dim / panel_dim_max + ( iter_dim % panel_dim_max ? 1 : 0 ); \
+\
+	p_begin = p_cast; \
+\
+	/* Query the number of threads and thread ids from the current thread's
+	   packm thrinfo_t node. */ \
+	const dim_t nt  = bli_thread_n_way( thread ); \
+	const dim_t tid = bli_thread_work_id( thread ); \
+\
+	/* Suppress unused variable warnings when slab partitioning is enabled,
+	   since the slab-based definition of bli_packm_my_iter() does not
+	   actually use tid or nt. */ \
+	( void )nt; ( void )tid; \
+\
+	dim_t it_start, it_end, it_inc; \
+\
+	/* Determine the thread range and increment using the current thread's
+	   packm thrinfo_t node. NOTE: The definition of bli_thread_range_jrir()
+	   will depend on whether slab or round-robin partitioning was requested
+	   at configure-time. */ \
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc ); \
+\
+	for ( ic = 0, it = 0; it < n_iter; \
+	      ic += panel_dim_max, it += 1 ) \
+	{ \
+		panel_dim_i = bli_min( panel_dim_max, iter_dim - ic ); \
+\
+		if ( bli_packm_my_iter( it, it_start, it_end, tid, nt ) ) \
+		{ \
+			PASTEMAC(ch,packm_sum_cxk) \
+			( \
+			  conjc, \
+			  panel_dim_i, \
+			  panel_dim_max, \
+			  panel_len, \
+			  panel_len_max, \
+			  nterm, \
+			  terms->off, \
+			  coef, \
+			  c_cast + ic*incc, incc, ldc, \
+			  p_begin,                ldp  \
+			); \
+		} \
+\
+		p_begin += ps_p; \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( packm_blk_var1_sum )
+
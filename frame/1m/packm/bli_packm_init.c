@@ -272,8 +272,26 @@ siz_t bli_packm_init_pack
 		bli_obj_set_uplo( BLIS_DENSE, p );
 	}
 
-	// Reset the view offsets to (0,0).
+	// Reset the view offsets to (0,0). If A carries a block map, P keeps
+	// track of where its elements lie within the map (reflecting any
+	// transposition of A) so that the zero blocks can be identified after
+	// packing.
+	dim_t     blkoffm      = bli_obj_blkmap_row_off( a );
+	dim_t     blkoffn      = bli_obj_blkmap_col_off( a );
+	bool      blktrans     = bli_obj_blkmap_is_trans( a );
+
+	if ( bli_does_trans( transa ) )
+	{
+		bli_swap_dims( &blkoffm, &blkoffn );
+		blktrans = !blktrans;
+	}
+
 	bli_obj_set_offs( 0, 0, p );
+	bli_obj_set_blkmap_offs( blkoffm, blkoffn, blktrans, p );
+
+	// If A carries a term list, P holds the packed linear combination of
+	// its submatrices, so P itself has no terms.
+	bli_obj_set_terms( NULL, p );
 
 	// Set the invert diagonal field.
 	bli_obj_set_invert_diag( invert_diag, p );
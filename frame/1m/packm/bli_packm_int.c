@@ -102,5 +102,12 @@ void bli_packm_int
 	  cntl,
 	  thread
 	);
+
+	// If A carries a block map, the elements of its zero blocks were packed
+	// as they were stored, so they must now be zeroed.
+	if ( bli_obj_is_block_sparse( a ) && bli_obj_is_general( a ) )
+	{
+		bli_packm_zero_blks( p, thread );
+	}
 }
 
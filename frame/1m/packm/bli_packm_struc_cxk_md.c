@@ -100,62 +100,16 @@ void PASTEMAC2(chc,chp,varname) \
 		   (unit row stride). */ \
 \
 		/* NOTE: We ignore kappa for now, since it should be 1.0. */ \
-		PASTEMAC2(chc,chp,castm) \
+		PASTEMAC2(chc,chp,packm_cxk_nat_md) \
 		( \
-		  ( trans_t )conjc, \
+		  conjc, \
 		  panel_dim, \
+		  panel_dim_max, \
 		  panel_len, \
+		  panel_len_max, \
 		  c, incc, ldc, \
-		  p,    1, ldp  \
+		  p,       ldp  \
 		); \
-\
-		/* If panel_dim < panel_dim_max, then we zero those unused rows. */ \
-		if ( panel_dim < panel_dim_max ) \
-		{ \
-			ctype_p* restrict zero   = PASTEMAC(chp,0); \
-			const dim_t       i      = panel_dim; \
-			const dim_t       m_edge = panel_dim_max - i; \
-			const dim_t       n_edge = panel_len_max; \
-			ctype_p*          p_edge = p + (i  )*1; \
-\
-			PASTEMAC2(chp,setm,BLIS_TAPI_EX_SUF) \
-			( \
-			  BLIS_NO_CONJUGATE, \
-			  0, \
-			  BLIS_NONUNIT_DIAG, \
-			  BLIS_DENSE, \
-			  m_edge, \
-			  n_edge, \
-			  zero, \
-			  p_edge, 1, ldp, \
-			  cntx, \
-			  NULL  \
-			); \
-		} \
-\
-		/* If panel_len < panel_len_max, then we zero those unused columns. */ \
-		if ( panel_len < panel_len_max ) \
-		{ \
-			ctype_p* restrict zero   = PASTEMAC(chp,0); \
-			const dim_t       j      = panel_len; \
-			const dim_t       m_edge = panel_dim_max; \
-			const dim_t       n_edge = panel_len_max - j; \
-			ctype_p*          p_edge = p + (j  )*ldp; \
-\
-			PASTEMAC2(chp,setm,BLIS_TAPI_EX_SUF) \
-			( \
-			  BLIS_NO_CONJUGATE, \
-			  0, \
-			  BLIS_NONUNIT_DIAG, \
-			  BLIS_DENSE, \
-			  m_edge, \
-			  n_edge, \
-			  zero, \
-			  p_edge, 1, ldp, \
-			  cntx, \
-			  NULL  \
-			); \
-		} \
 	} \
 	else if ( bli_is_1r_packed( schema ) ) \
 	{ \
@@ -308,6 +262,138 @@ INSERT_GENTFUNC2_BASIC0( packm_struc_cxk_md )
 INSERT_GENTFUNC2_MIXDP0( packm_struc_cxk_md )
 
 
+// -----------------------------------------------------------------------------
+
+// Cast a micro-panel into a natively-packed buffer of a different datatype,
+// zero-filling any unused rows and columns along the way. The statements in
+// each of the unrolled loops below operate on four contiguous elements so
+// that the compiler may fuse them into a vector load, conversion, and store;
+// one unrolled case handles micro-panels that are contiguous along their
+// short dimension and the other handles those contiguous along their long
+// dimension (ie: micro-panels that are transposed during packing).
+
+#undef  GENTFUNC2
+#define GENTFUNC2( ctype_a, ctype_p, cha, chp, opname ) \
+\
+void PASTEMAC2(cha,chp,opname) \
+     ( \
+       conj_t            conja, \
+       dim_t             panel_dim, \
+       dim_t             panel_dim_max, \
+       dim_t             panel_len, \
+       dim_t             panel_len_max, \
+       ctype_a* restrict a, inc_t inca, inc_t lda, \
+       ctype_p* restrict p,             inc_t ldp  \
+     ) \
+{ \
+	ctype_a* restrict alpha1 = a; \
+	ctype_p* restrict pi1    = p; \
+	dim_t             j      = 0; \
+\
+	if ( bli_is_conj( conja ) ) \
+	{ \
+		for ( ; j < panel_len; ++j ) \
+		{ \
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+				PASTEMAC2(cha,chp,copyjs)( *(alpha1 + i*inca), *(pi1 + i) ); \
+			for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+				PASTEMAC(chp,set0s)( *(pi1 + i) ); \
+\
+			alpha1 += lda; \
+			pi1    += ldp; \
+		} \
+	} \
+	else if ( inca == 1 ) \
+	{ \
+		const dim_t dim_iter = panel_dim / 4; \
+		const dim_t dim_left = panel_dim % 4; \
+\
+		for ( ; j < panel_len; ++j ) \
+		{ \
+			ctype_a* restrict alpha11 = alpha1; \
+			ctype_p* restrict pi11    = pi1; \
+\
+			for ( dim_t i = dim_iter; i != 0; --i ) \
+			{ \
+				PASTEMAC2(cha,chp,copys)( *(alpha11 + 0), *(pi11 + 0) ); \
+				PASTEMAC2(cha,chp,copys)( *(alpha11 + 1), *(pi11 + 1) ); \
+				PASTEMAC2(cha,chp,copys)( *(alpha11 + 2), *(pi11 + 2) ); \
+				PASTEMAC2(cha,chp,copys)( *(alpha11 + 3), *(pi11 + 3) ); \
+\
+				alpha11 += 4; \
+				pi11    += 4; \
+			} \
+			for ( dim_t i = 0; i < dim_left; ++i ) \
+				PASTEMAC2(cha,chp,copys)( *(alpha11 + i), *(pi11 + i) ); \
+			for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+				PASTEMAC(chp,set0s)( *(pi1 + i) ); \
+\
+			alpha1 += lda; \
+			pi1    += ldp; \
+		} \
+	} \
+	else \
+	{ \
+		if ( lda == 1 ) \
+		{ \
+			for ( ; j + 4 <= panel_len; j += 4 ) \
+			{ \
+				ctype_a* restrict alpha11 = alpha1; \
+				ctype_p* restrict pi11    = pi1; \
+\
+				for ( dim_t i = 0; i < panel_dim; ++i ) \
+				{ \
+					PASTEMAC2(cha,chp,copys)( *(alpha11 + 0), *(pi11 + 0*ldp) ); \
+					PASTEMAC2(cha,chp,copys)( *(alpha11 + 1), *(pi11 + 1*ldp) ); \
+					PASTEMAC2(cha,chp,copys)( *(alpha11 + 2), *(pi11 + 2*ldp) ); \
+					PASTEMAC2(cha,chp,copys)( *(alpha11 + 3), *(pi11 + 3*ldp) ); \
+\
+					alpha11 += inca; \
+					pi11    += 1; \
+				} \
+				for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+				{ \
+					PASTEMAC(chp,set0s)( *(pi11 + 0*ldp) ); \
+					PASTEMAC(chp,set0s)( *(pi11 + 1*ldp) ); \
+					PASTEMAC(chp,set0s)( *(pi11 + 2*ldp) ); \
+					PASTEMAC(chp,set0s)( *(pi11 + 3*ldp) ); \
+\
+					pi11    += 1; \
+				} \
+\
+				alpha1 += 4; \
+				pi1    += 4*ldp; \
+			} \
+		} \
+\
+		/* Handle the general stride case, as well as any columns left over
+		   from the unrolled loop above. */ \
+		for ( ; j < panel_len; ++j ) \
+		{ \
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+				PASTEMAC2(cha,chp,copys)( *(alpha1 + i*inca), *(pi1 + i) ); \
+			for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+				PASTEMAC(chp,set0s)( *(pi1 + i) ); \
+\
+			alpha1 += lda; \
+			pi1    += ldp; \
+		} \
+	} \
+\
+	/* Zero the columns beyond panel_len. */ \
+	for ( ; j < panel_len_max; ++j ) \
+	{ \
+		for ( dim_t i = 0; i < panel_dim_max; ++i ) \
+			PASTEMAC(chp,set0s)( *(pi1 + i) ); \
+\
+		pi1    += ldp; \
+	} \
+}
+
+INSERT_GENTFUNC2_BASIC0( packm_cxk_nat_md )
+INSERT_GENTFUNC2_MIXDP0( packm_cxk_nat_md )
+
+
 // -----------------------------------------------------------------------------
 
 #undef  GENTFUNC2
@@ -54,6 +54,24 @@ INSERT_GENTPROT2_BASIC0( packm_struc_cxk_md )
 INSERT_GENTPROT2_MIXDP0( packm_struc_cxk_md )
 
 
+#undef  GENTPROT2
+#define GENTPROT2( ctype_a, ctype_p, cha, chp, opname ) \
+\
+void PASTEMAC2(cha,chp,opname) \
+     ( \
+       conj_t            conja, \
+       dim_t             panel_dim, \
+       dim_t             panel_dim_max, \
+       dim_t             panel_len, \
+       dim_t             panel_len_max, \
+       ctype_a* restrict a, inc_t inca, inc_t lda, \
+       ctype_p* restrict p,             inc_t ldp  \
+     );
+
+INSERT_GENTPROT2_BASIC0( packm_cxk_nat_md )
+INSERT_GENTPROT2_MIXDP0( packm_cxk_nat_md )
+
+
 #undef  GENTPROT2
 #define GENTPROT2( ctype_a, ctype_p, cha, chp, opname ) \
 \
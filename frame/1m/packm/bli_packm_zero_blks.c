@@ -0,0 +1,111 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+void bli_packm_zero_blks
+     (
+       obj_t*     p,
+       thrinfo_t* thread
+     )
+{
+	blkmap_t* map        = bli_obj_blkmap( p );
+	pack_t    schema     = bli_obj_pack_schema( p );
+	siz_t     elem_size  = bli_obj_elem_size( p );
+	char*     buf_p      = bli_obj_buffer_at_off( p );
+	dim_t     pd_p       = bli_obj_panel_dim( p );
+	inc_t     ps_p       = bli_obj_panel_stride( p );
+
+	// Only micro-panels in the native format are handled here. Row panels
+	// (of A) are stored by columns and column panels (of B) by rows, so
+	// each micro-panel is a pd_p x panel_len matrix with leading dimension
+	// ldp along its length.
+	if ( !bli_is_nat_packed( schema ) ) return;
+
+	const bool  row_panels = bli_is_row_packed( schema );
+
+	const dim_t iter_dim   = ( row_panels ? bli_obj_length( p ) : bli_obj_width( p ) );
+	const dim_t panel_len  = ( row_panels ? bli_obj_width( p ) : bli_obj_length( p ) );
+	const inc_t ldp        = ( row_panels ? bli_obj_col_stride( p ) : bli_obj_row_stride( p ) );
+
+	// Element (d,l) of the micro-panels is element (off_d+d,off_l+l) of the
+	// matrix described by the map, or element (off_l+l,off_d+d) if trans.
+	const dim_t off_d      = ( row_panels ? bli_obj_blkmap_row_off( p ) : bli_obj_blkmap_col_off( p ) );
+	const dim_t off_l      = ( row_panels ? bli_obj_blkmap_col_off( p ) : bli_obj_blkmap_row_off( p ) );
+	const bool  trans      = ( row_panels ? bli_obj_blkmap_is_trans( p ) : !bli_obj_blkmap_is_trans( p ) );
+
+	const dim_t bd         = ( trans ? bli_blkmap_blk_width( map ) : bli_blkmap_blk_length( map ) );
+	const dim_t bl         = ( trans ? bli_blkmap_blk_length( map ) : bli_blkmap_blk_width( map ) );
+
+	const dim_t n_iter     = ( iter_dim + pd_p - 1 ) / pd_p;
+
+	if ( panel_len == 0 ) return;
+
+	// Visit the micro-panels in the same way as bli_packm_blk_var1().
+	const dim_t nt  = bli_thread_n_way( thread );
+	const dim_t tid = bli_thread_work_id( thread );
+
+	dim_t it_start, it_end, it_inc;
+
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &it_start, &it_end, &it_inc );
+
+	for ( dim_t it = 0; it < n_iter; ++it )
+	{
+		if ( !bli_packm_my_iter( it, it_start, it_end, tid, nt ) ) continue;
+
+		const dim_t d0  = it * pd_p;
+		const dim_t d1  = bli_min( d0 + pd_p, iter_dim );
+		char*       p1  = buf_p + it * ps_p * elem_size;
+
+		for ( dim_t db = ( off_d + d0 ) / bd; db <= ( off_d + d1 - 1 ) / bd; ++db )
+		for ( dim_t lb = off_l / bl; lb <= ( off_l + panel_len - 1 ) / bl; ++lb )
+		{
+			const bool nz = ( trans ? bli_blkmap_is_nonzero( lb, db, map )
+			                        : bli_blkmap_is_nonzero( db, lb, map ) );
+
+			if ( nz ) continue;
+
+			// The part of the micro-panel that lies within the zero block.
+			const dim_t i0 = bli_max( db * bd - off_d, d0 ) - d0;
+			const dim_t i1 = bli_min( ( db + 1 ) * bd - off_d, d1 ) - d0;
+			const dim_t l0 = bli_max( lb * bl - off_l, 0 );
+			const dim_t l1 = bli_min( ( lb + 1 ) * bl - off_l, panel_len );
+
+			for ( dim_t l = l0; l < l1; ++l )
+				memset( p1 + ( i0 + l * ldp ) * elem_size, 0,
+				        ( i1 - i0 ) * elem_size );
+		}
+	}
+}
+
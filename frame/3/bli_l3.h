@@ -97,4 +97,6 @@
 #include "bli_trmm.h"
 #include "bli_trmm3.h"
 #include "bli_trsm.h"
+#include "bli_spmm.h"
+#include "bli_tcontract.h"
 
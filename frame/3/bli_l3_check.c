@@ -44,12 +44,20 @@ void bli_gemm_check
        cntx_t* cntx
      )
 {
-	//err_t e_val;
+	err_t e_val;
 
 	// Check basic properties of the operation.
 
 	bli_gemm_basic_check( alpha, a, b, beta, c, cntx );
 
+	// Check that the block maps of A and B, if any, cover them.
+
+	e_val = bli_check_blkmap_dims( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_blkmap_dims( b );
+	bli_check_error_code( e_val );
+
 	// Check object structure.
 
 	// NOTE: Can't perform these checks as long as bli_gemm_check() is called
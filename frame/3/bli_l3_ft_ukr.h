@@ -98,5 +98,72 @@ typedef void (*PASTECH3(ch,opname,_ukr,tsuf)) \
 INSERT_GENTDEF( trsm )
 
 
+// gemmi
+
+#undef  GENTDEFI
+#define GENTDEFI( ctype_a, ctype_b, opname ) \
+\
+typedef void (*PASTECH2(opname,_ukr,_ft)) \
+     ( \
+       dim_t               k, \
+       int32_t*   restrict alpha, \
+       ctype_a*   restrict a, \
+       ctype_b*   restrict b, \
+       int32_t*   restrict beta, \
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c, \
+       int32_t*   restrict ra, \
+       int32_t*   restrict cb, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
+GENTDEFI( uint8_t, int8_t,  gemmi_u8s8s32 )
+GENTDEFI( int16_t, int16_t, gemmi_s16s16s32 )
+
+
+// spmm
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ukr,tsuf)) \
+     ( \
+       dim_t               n, \
+       dim_t               nnz, \
+       ctype*     restrict alpha, \
+       gint_t*    restrict col_ind, \
+       ctype*     restrict val, \
+       ctype*     restrict b, inc_t rs_b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
+INSERT_GENTDEF( spmm )
+
+
+// gemmsum
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ukr,tsuf)) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       dim_t               nterm, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype**    restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
+INSERT_GENTDEF( gemmsum )
+
+
 #endif
 
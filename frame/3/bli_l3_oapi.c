@@ -57,13 +57,59 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* Members of an SPMD team share the work of the operation only when it
+	   reaches a level-3 thread decorator in one piece. Otherwise (e.g. when
+	   alpha is zero and C is only scaled by beta), thread 0 executes the
+	   operation alone while the rest of the team waits. */ \
+	if ( bli_rntm_is_spmd( rntm ) && \
+	     ( !bli_spmd_shares_work() || \
+	       bli_obj_equals( alpha, &BLIS_ZERO ) || \
+	       bli_obj_is_half( a ) || bli_obj_is_half( b ) || bli_obj_is_half( c ) || \
+	       bli_rntm_strassen_levels( rntm ) > 0 || \
+	       bli_obj_dt( a ) != bli_obj_dt( c ) || \
+	       bli_obj_dt( b ) != bli_obj_dt( c ) || \
+	       bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) ) \
+	{ \
+		rntm_t rntm_s; \
+		if ( bli_rntm_spmd_solo( rntm, &rntm_s ) ) \
+			PASTEMAC(opname,_ex)( alpha, a, b, beta, c, cntx, &rntm_s ); \
+		bli_rntm_spmd_barrier( rntm ); \
+		return; \
+	} \
+\
+	/* Half-precision operands are handled by a separate implementation that
+	   converts them to single precision while packing. */ \
+	if ( bli_obj_is_half( a ) || \
+	     bli_obj_is_half( b ) || \
+	     bli_obj_is_half( c ) ) \
+	{ \
+		PASTEMAC(opname,hp)( alpha, a, b, beta, c, cntx, rntm ); \
+		return; \
+	} \
+\
+	/* A block map attached to A or B is honored by packm and the macro-
+	   kernel of the conventional implementation, which skips the zero
+	   blocks (see bli_obj_set_blkmap()). Block-sparse problems therefore
+	   bypass Strassen's algorithm, sup and the induced methods. */ \
+	bool is_bs = ( bli_obj_is_block_sparse( a ) || \
+	               bli_obj_is_block_sparse( b ) ); \
+\
+	/* If the rntm requests it, use Strassen's algorithm. If the problem
+	   is not one that the Strassen implementation handles, it returns with
+	   BLIS_FAILURE and execution proceeds with conventional gemm. */ \
+	if ( !is_bs && rntm != NULL && bli_rntm_strassen_levels( rntm ) > 0 ) \
+	{ \
+		err_t result = PASTEMAC(opname,strassen)( alpha, a, b, beta, c, cntx, rntm ); \
+		if ( result == BLIS_SUCCESS ) return; \
+	} \
 \
 	/* If the rntm is non-NULL, it may indicate that we should forgo sup
 	   handling altogether. */ \
 	bool enable_sup = TRUE; \
 	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
 \
-	if ( enable_sup ) \
+	if ( enable_sup && !is_bs ) \
 	{ \
 		/* Execute the small/unpacked oapi handler. If it finds that the problem
 		   does not fall within the thresholds that define "small", or for some
@@ -81,7 +127,8 @@ void PASTEMAC(opname,EX_SUF) \
 	   ignore the computation precision). If any operands are real, skip the
 	   induced method chooser function and proceed directly with native
 	   execution. */ \
-	if ( bli_obj_is_complex( c ) && \
+	if ( !is_bs && \
+	     bli_obj_is_complex( c ) && \
 	     bli_obj_is_complex( a ) && \
 	     bli_obj_is_complex( b ) ) \
 	{ \
@@ -117,6 +164,19 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* If the work of an SPMD team can't be shared, thread 0 executes the
+	   operation alone (see the gemm front-end above). */ \
+	if ( bli_rntm_is_spmd( rntm ) && \
+	     ( !bli_spmd_shares_work() || \
+	       bli_obj_equals( alpha, &BLIS_ZERO ) ) ) \
+	{ \
+		rntm_t rntm_s; \
+		if ( bli_rntm_spmd_solo( rntm, &rntm_s ) ) \
+			PASTEMAC(opname,_ex)( alpha, a, b, beta, c, cntx, &rntm_s ); \
+		bli_rntm_spmd_barrier( rntm ); \
+		return; \
+	} \
 \
 	/* Only proceed with an induced method if each of the operands have a
 	   complex storage datatype. NOTE: Allowing precisions to vary while
@@ -163,6 +223,19 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* If the work of an SPMD team can't be shared, thread 0 executes the
+	   operation alone (see the gemm front-end above). */ \
+	if ( bli_rntm_is_spmd( rntm ) && \
+	     ( !bli_spmd_shares_work() || \
+	       bli_obj_equals( alpha, &BLIS_ZERO ) ) ) \
+	{ \
+		rntm_t rntm_s; \
+		if ( bli_rntm_spmd_solo( rntm, &rntm_s ) ) \
+			PASTEMAC(opname,_ex)( side, alpha, a, b, beta, c, cntx, &rntm_s ); \
+		bli_rntm_spmd_barrier( rntm ); \
+		return; \
+	} \
 \
 	/* Only proceed with an induced method if all operands have the same
 	   (complex) datatype. If any datatypes differ, skip the induced method
@@ -205,6 +278,35 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* If the work of an SPMD team can't be shared, thread 0 executes the
+	   operation alone (see the gemm front-end above). */ \
+	if ( bli_rntm_is_spmd( rntm ) && \
+	     ( !bli_spmd_shares_work() || \
+	       bli_obj_equals( alpha, &BLIS_ZERO ) ) ) \
+	{ \
+		rntm_t rntm_s; \
+		if ( bli_rntm_spmd_solo( rntm, &rntm_s ) ) \
+			PASTEMAC(opname,_ex)( alpha, a, beta, c, cntx, &rntm_s ); \
+		bli_rntm_spmd_barrier( rntm ); \
+		return; \
+	} \
+\
+	/* If the rntm is non-NULL, it may indicate that we should forgo sup
+	   handling altogether. */ \
+	bool enable_sup = TRUE; \
+	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
+\
+	if ( enable_sup ) \
+	{ \
+		/* Execute the small/unpacked oapi handler. If it finds that the problem
+		   does not fall within the thresholds that define "small", or for some
+		   other reason decides not to use the small/unpacked implementation,
+		   the function returns with BLIS_FAILURE, which causes execution to
+		   proceed towards the conventional implementation. */ \
+		err_t result = PASTEMAC(opname,sup)( alpha, a, beta, c, cntx, rntm ); \
+		if ( result == BLIS_SUCCESS ) return; \
+	} \
 \
 	/* Only proceed with an induced method if all operands have the same
 	   (complex) datatype. If any datatypes differ, skip the induced method
@@ -245,6 +347,19 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* If the work of an SPMD team can't be shared, thread 0 executes the
+	   operation alone (see the gemm front-end above). */ \
+	if ( bli_rntm_is_spmd( rntm ) && \
+	     ( !bli_spmd_shares_work() || \
+	       bli_obj_equals( alpha, &BLIS_ZERO ) ) ) \
+	{ \
+		rntm_t rntm_s; \
+		if ( bli_rntm_spmd_solo( rntm, &rntm_s ) ) \
+			PASTEMAC(opname,_ex)( side, alpha, a, b, cntx, &rntm_s ); \
+		bli_rntm_spmd_barrier( rntm ); \
+		return; \
+	} \
 \
 	/* Only proceed with an induced method if all operands have the same
 	   (complex) datatype. If any datatypes differ, skip the induced method
@@ -267,6 +382,73 @@ void PASTEMAC(opname,EX_SUF) \
 }
 
 GENFRONT( trmm )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       side_t  side, \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  b  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	/* If the work of an SPMD team can't be shared, thread 0 executes the
+	   operation alone (see the gemm front-end above). */ \
+	if ( bli_rntm_is_spmd( rntm ) && \
+	     ( !bli_spmd_shares_work() || \
+	       bli_obj_equals( alpha, &BLIS_ZERO ) ) ) \
+	{ \
+		rntm_t rntm_s; \
+		if ( bli_rntm_spmd_solo( rntm, &rntm_s ) ) \
+			PASTEMAC(opname,_ex)( side, alpha, a, b, cntx, &rntm_s ); \
+		bli_rntm_spmd_barrier( rntm ); \
+		return; \
+	} \
+\
+	/* If the rntm is non-NULL, it may indicate that we should forgo sup
+	   handling altogether. */ \
+	bool enable_sup = TRUE; \
+	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
+\
+	if ( enable_sup ) \
+	{ \
+		/* Execute the small/unpacked oapi handler. If it finds that the problem
+		   does not fall within the thresholds that define "small", or for some
+		   other reason decides not to use the small/unpacked implementation,
+		   the function returns with BLIS_FAILURE, which causes execution to
+		   proceed towards the conventional implementation. */ \
+		err_t result = PASTEMAC(opname,sup)( side, alpha, a, b, cntx, rntm ); \
+		if ( result == BLIS_SUCCESS ) return; \
+	} \
+\
+	/* Only proceed with an induced method if all operands have the same
+	   (complex) datatype. If any datatypes differ, skip the induced method
+	   chooser function and proceed directly with native execution, which is
+	   where mixed datatype support will be implemented (if at all). */ \
+	if ( bli_obj_dt( a ) == bli_obj_dt( b ) && \
+	     bli_obj_is_complex( b ) ) \
+	{ \
+		/* Invoke the operation's "ind" function--its induced method front-end.
+		   For complex problems, it calls the highest priority induced method
+		   that is available (ie: implemented and enabled), and if none are
+		   enabled, it calls native execution. (For real problems, it calls
+		   the operation's native execution interface.) */ \
+		PASTEMAC(opname,ind)( side, alpha, a, b, cntx, rntm ); \
+	} \
+	else \
+	{ \
+		PASTEMAC(opname,nat)( side, alpha, a, b, cntx, rntm ); \
+	} \
+}
+
 GENFRONT( trsm )
 
 
@@ -132,3 +132,320 @@ printf( "dims: %d %d %d (threshs: %d %d %d)\n",
 }
 
 
+
+err_t bli_gemmtsup
+     (
+       opid_t  family,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	// Only a square C whose stored triangle begins at the diagonal is
+	// handled here.
+	if ( bli_obj_length( c ) != bli_obj_width( c ) ||
+	     bli_obj_diag_offset( c ) != 0 ||
+	     !( bli_obj_is_lower( c ) || bli_obj_is_upper( c ) ) )
+		return BLIS_FAILURE;
+
+	// Don't use the small/unpacked implementation if one of the matrices
+	// uses general stride.
+	if ( bli_obj_stor3_from_strides( c, a, b ) == BLIS_XXX )
+		return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Since m == n, a microkernel preference-induced transposition would not
+	// change which dimensions are compared against the thresholds.
+	{
+		const num_t dt = bli_obj_dt( c );
+		const dim_t m  = bli_obj_length( c );
+		const dim_t k  = bli_obj_width_after_trans( a );
+
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, m, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+
+	// Query the small/unpacked handler registered for the operation family.
+	// Return early if none was registered.
+	gemmtsup_oft gemmtsup_fp = bli_cntx_get_l3_sup_handler( family, cntx );
+
+	if ( gemmtsup_fp == NULL ) return BLIS_FAILURE;
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// The handlers read alpha and beta as scalars of the same datatype as C,
+	// but herk passes them in as real scalars. Create local copies of alpha
+	// and beta cast to the datatype of C.
+	obj_t alpha_local;
+	obj_t beta_local;
+
+	bli_obj_scalar_init_detached_copy_of( bli_obj_dt( c ), BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+	bli_obj_scalar_init_detached_copy_of( bli_obj_dt( c ), BLIS_NO_CONJUGATE,
+	                                      beta,  &beta_local );
+
+	return
+	gemmtsup_fp
+	(
+	  &alpha_local,
+	  a,
+	  b,
+	  &beta_local,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+err_t bli_herksup
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_herk_check( alpha, a, beta, c, cntx );
+
+	// For herk, the right-hand "B" operand is simply A'.
+	obj_t ah;
+	bli_obj_alias_to( a, &ah );
+	bli_obj_induce_trans( &ah );
+	bli_obj_toggle_conj( &ah );
+
+	err_t r_val = bli_gemmtsup( BLIS_HERK, alpha, a, &ah, beta, c, cntx, rntm );
+
+	// As with the conventional implementation, explicitly zero the imaginary
+	// components of the diagonal elements.
+	if ( r_val == BLIS_SUCCESS ) bli_setid( &BLIS_ZERO, c );
+
+	return r_val;
+}
+
+err_t bli_syrksup
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_syrk_check( alpha, a, beta, c, cntx );
+
+	// For syrk, the right-hand "B" operand is simply A^T.
+	obj_t at;
+	bli_obj_alias_to( a, &at );
+	bli_obj_induce_trans( &at );
+
+	return bli_gemmtsup( BLIS_SYRK, alpha, a, &at, beta, c, cntx, rntm );
+}
+
+err_t bli_trsmsup
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( b ) != bli_obj_dt( a ) ||
+	     bli_obj_comp_prec( b ) != bli_obj_prec( b ) ) return BLIS_FAILURE;
+
+	// Only a triangular A whose stored triangle begins at the diagonal is
+	// handled here.
+	if ( !bli_obj_is_triangular( a ) ||
+	     bli_obj_diag_offset( a ) != 0 ) return BLIS_FAILURE;
+
+	// Don't use the small/unpacked implementation if one of the matrices
+	// uses general stride.
+	if ( bli_obj_is_gen_stored( a ) ||
+	     bli_obj_is_gen_stored( b ) ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	// NOTE: This must be done before calling the _check() function, since
+	// that function assumes the context pointer is valid.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_trsm_check( side, alpha, a, b, &BLIS_ZERO, b, cntx );
+
+	// The dimension of the triangle plays the role of k, since that is the
+	// dimension over which the updates of B accumulate.
+	{
+		const num_t dt = bli_obj_dt( b );
+		const dim_t m  = bli_obj_length( b );
+		const dim_t n  = bli_obj_width( b );
+		const dim_t k  = ( bli_is_left( side ) ? m : n );
+
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+
+	// Query the small/unpacked handler registered for trsm. Return early if
+	// none was registered.
+	trsmsup_oft trsmsup_fp = bli_cntx_get_l3_sup_handler( BLIS_TRSM, cntx );
+
+	if ( trsmsup_fp == NULL ) return BLIS_FAILURE;
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	return
+	trsmsup_fp
+	(
+	  side,
+	  alpha,
+	  a,
+	  b,
+	  cntx,
+	  rntm
+	);
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Return early if small matrix handling is disabled at configure-time. */ \
+	if ( !bli_gemmsup_is_enabled() ) return BLIS_FAILURE; \
+\
+	cntx_t* cntx = bli_gks_query_cntx(); \
+\
+	/* Only take this path if the context still uses the reference sup
+	   handler; a custom handler expects to be given objects. */ \
+	if ( bli_cntx_get_l3_sup_handler( BLIS_GEMM, cntx ) != \
+	     ( void* )bli_gemmsup_ref ) return BLIS_FAILURE; \
+\
+	/* Apply the same threshold test as bli_gemmsup(), taking into account
+	   a microkernel preference-induced transposition of the operation. */ \
+	const bool ukr_prefers_rows \
+	           = bli_cntx_l3_vir_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const bool ukr_prefers_c \
+	           = ( ukr_prefers_rows ? bli_is_row_stored( rs_c, cs_c ) \
+	                                : bli_is_col_stored( rs_c, cs_c ) ); \
+\
+	if ( ukr_prefers_c ) \
+	{ \
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx ) ) \
+			return BLIS_FAILURE; \
+	} \
+	else \
+	{ \
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx ) ) \
+			return BLIS_FAILURE; \
+	} \
+\
+	/* Absorb any transposition of A and B into their strides. */ \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	/* Don't use the small/unpacked implementation if one of the matrices
+	   uses general stride. */ \
+	if ( bli_stor3_from_strides( rs_c, cs_c, \
+	                             rs_a, cs_a, \
+	                             rs_b, cs_b  ) == BLIS_XXX ) return BLIS_FAILURE; \
+\
+	rntm_t rntm_l; \
+	rntm_t* rntm = &rntm_l; \
+	bli_rntm_init_from_global( rntm ); \
+	bli_rntm_set_ways_from_rntm_sup( m, n, k, rntm ); \
+\
+	/* Multithreaded execution needs the thread decorator, which operates on
+	   objects, so leave that case to the object-based path. */ \
+	if ( bli_rntm_num_threads( rntm ) > 1 ) return BLIS_FAILURE; \
+\
+	/* Set up the small block allocator and memory broker in the same way
+	   as the single-threaded sup decorator. */ \
+	array_t* restrict array = bli_sba_checkout_array( 1, rntm ); \
+	bli_sba_rntm_set_pool( 0, array, rntm ); \
+	bli_membrk_rntm_set_membrk( rntm ); \
+\
+	PASTEMAC(ch,gemmsup_int) \
+	( \
+	  bli_extract_conj( transa ), \
+	  bli_extract_conj( transb ), \
+	  m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  cntx, \
+	  rntm, \
+	  &BLIS_GEMM_SINGLE_THREADED  \
+	); \
+\
+	bli_sba_checkin_array( array ); \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemmsup )
+
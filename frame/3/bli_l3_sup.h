@@ -43,3 +43,89 @@ err_t bli_gemmsup
        rntm_t* rntm
      );
 
+// Small/unpacked handling for operations whose output is one triangle of a
+// square C = A * B, such as herk and syrk. The family id selects the sup
+// handler that is registered in the context.
+err_t bli_gemmtsup
+     (
+       opid_t  family,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+err_t bli_herksup
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+err_t bli_syrksup
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+err_t bli_trsmsup
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+
+// Query whether small/unpacked handling was enabled at configure-time. (This
+// is a function rather than a bare #ifdef so that it may be used from within
+// macro-generated code.)
+BLIS_INLINE bool bli_gemmsup_is_enabled( void )
+{
+#ifdef BLIS_DISABLE_SUP_HANDLING
+	return FALSE;
+#else
+	return TRUE;
+#endif
+}
+
+//
+// Prototype object-free (typed) sup entry points. These are intended for the
+// BLAS compatibility layer, which already has raw buffers and strides in hand
+// and would otherwise build obj_t's only to have bli_gemmsup() take them
+// apart again. They return BLIS_FAILURE, without touching C, whenever the
+// object-based path should be used instead (eg: the problem is not small,
+// a matrix is general-stored, or multithreading was requested).
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemmsup )
+
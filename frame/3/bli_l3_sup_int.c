@@ -240,3 +240,171 @@ err_t bli_gemmsup_int
 	return BLIS_SUCCESS;
 }
 
+// -----------------------------------------------------------------------------
+
+err_t bli_gemmtsup_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     )
+{
+	// The caller, bli_gemmtsup(), has already ruled out general stride, so
+	// the only remaining decision (between var2m and var1n, and whether
+	// to transpose) is made separately for each block of C within the
+	// variant.
+	bli_gemmtsup_ref_var2m( alpha, a, b, beta, c, cntx, rntm, thread );
+
+	return BLIS_SUCCESS;
+}
+
+err_t bli_trsmsup_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     )
+{
+	// The caller, bli_trsmsup_ref(), passes B as both the "B" and "C"
+	// operands of the decorator and has already reduced the problem to a
+	// left-side solve with no transposition, so beta and c are unused.
+	bli_trsmsup_ref_var1( alpha, a, b, cntx, rntm, thread );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+// The typed sup variants share one signature across datatypes since all of
+// their scalar and matrix operands are passed as void pointers.
+typedef void (*gemmsup_var_ft)
+     (
+       bool             packa,
+       bool             packb,
+       conj_t           conja,
+       conj_t           conjb,
+       dim_t            m,
+       dim_t            n,
+       dim_t            k,
+       void*   restrict alpha,
+       void*   restrict a, inc_t rs_a, inc_t cs_a,
+       void*   restrict b, inc_t rs_b, inc_t cs_b,
+       void*   restrict beta,
+       void*   restrict c, inc_t rs_c, inc_t cs_c,
+       stor3_t          eff_id,
+       cntx_t* restrict cntx,
+       rntm_t* restrict rntm,
+       thrinfo_t* restrict thread
+     );
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       conj_t     conja, \
+       conj_t     conjb, \
+       dim_t      m, \
+       dim_t      n, \
+       dim_t      k, \
+       ctype*     alpha, \
+       ctype*     a, inc_t rs_a, inc_t cs_a, \
+       ctype*     b, inc_t rs_b, inc_t cs_b, \
+       ctype*     beta, \
+       ctype*     c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	stor3_t stor_id = bli_stor3_from_strides( rs_c, cs_c, \
+	                                          rs_a, cs_a, \
+	                                          rs_b, cs_b  ); \
+\
+	/* Don't use the small/unpacked implementation if one of the matrices
+	   uses general stride. */ \
+	if ( stor_id == BLIS_XXX ) return BLIS_FAILURE; \
+\
+	const bool is_rrr_rrc_rcr_crr = ( stor_id == BLIS_RRR || \
+	                                  stor_id == BLIS_RRC || \
+	                                  stor_id == BLIS_RCR || \
+	                                  stor_id == BLIS_CRR ); \
+	const bool row_pref   = bli_cntx_l3_sup_ker_prefers_rows_dt( dt, stor_id, cntx ); \
+	const bool is_primary = ( row_pref ? is_rrr_rrc_rcr_crr \
+	                                   : !is_rrr_rrc_rcr_crr ); \
+\
+	const dim_t MR = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+\
+	/* Choose between the block-panel (var2m) and panel-block (var1n)
+	   algorithms exactly as bli_gemmsup_int() does. */ \
+	const dim_t mu     = ( is_primary ? m : n ) / MR; \
+	const dim_t nu     = ( is_primary ? n : m ) / NR; \
+	const bool  use_bp = ( mu >= nu ); \
+\
+	/* Optimize some storage/packing cases by transforming them into others.
+	   Non-primary cases are executed as a transposed operation. */ \
+	trans_t     trans  = ( is_primary ? BLIS_NO_TRANSPOSE : BLIS_TRANSPOSE ); \
+	const bool  packa  = bli_rntm_pack_a( rntm ); \
+	const bool  packb  = bli_rntm_pack_b( rntm ); \
+\
+	bli_gemmsup_ref_var1n2m_opt_cases( dt, &trans, packa, packb, &stor_id, cntx ); \
+\
+	gemmsup_var_ft var; \
+	if ( use_bp ) var = PASTEMAC(ch,gemmsup_ref_var2m); \
+	else          var = PASTEMAC(ch,gemmsup_ref_var1n); \
+\
+	if ( bli_is_notrans( trans ) ) \
+	{ \
+		var \
+		( \
+		  packa, packb, \
+		  conja, conjb, \
+		  m, n, k, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  b, rs_b, cs_b, \
+		  beta, \
+		  c, rs_c, cs_c, \
+		  stor_id, \
+		  cntx, \
+		  rntm, \
+		  thread  \
+		); \
+	} \
+	else \
+	{ \
+		var \
+		( \
+		  packb, packa, \
+		  conjb, conja, \
+		  n, m, k, \
+		  alpha, \
+		  b, cs_b, rs_b, \
+		  a, cs_a, rs_a, \
+		  beta, \
+		  c, cs_c, rs_c, \
+		  bli_stor3_trans( stor_id ), \
+		  cntx, \
+		  rntm, \
+		  thread  \
+		); \
+	} \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemmsup_int )
+
@@ -43,3 +43,57 @@ err_t bli_gemmsup_int
        rntm_t* rntm,
        thrinfo_t* thread
      );
+
+err_t bli_gemmtsup_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     );
+
+err_t bli_trsmsup_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     );
+
+//
+// Prototype the typed counterpart of bli_gemmsup_int(), which chooses and
+// invokes a sup variant for raw buffers and strides. Unlike the object
+// version, it does not refactor the ways of parallelism, and so it should
+// be given a single-threaded thrinfo_t.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       conj_t     conja, \
+       conj_t     conjb, \
+       dim_t      m, \
+       dim_t      n, \
+       dim_t      k, \
+       ctype*     alpha, \
+       ctype*     a, inc_t rs_a, inc_t cs_a, \
+       ctype*     b, inc_t rs_b, inc_t cs_b, \
+       ctype*     beta, \
+       ctype*     c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemmsup_int )
+
@@ -40,7 +40,7 @@
 // -- Level-3 small/unpacked object function types -----------------------------
 //
 
-// gemm
+// gemm, gemmt
 
 #undef  GENTDEF
 #define GENTDEF( opname ) \
@@ -57,6 +57,25 @@ typedef err_t (*PASTECH(opname,_oft)) \
 );
 
 GENTDEF( gemmsup )
+GENTDEF( gemmtsup )
+
+
+// trsm
+
+#undef  GENTDEF
+#define GENTDEF( opname ) \
+\
+typedef err_t (*PASTECH(opname,_oft)) \
+( \
+  side_t  side, \
+  obj_t*  alpha, \
+  obj_t*  a, \
+  obj_t*  b, \
+  cntx_t* cntx, \
+  rntm_t* rntm  \
+);
+
+GENTDEF( trsmsup )
 
 #endif
 
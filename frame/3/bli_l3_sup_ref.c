@@ -106,3 +106,110 @@ err_t bli_gemmsup_ref
 	);
 }
 
+err_t bli_gemmtsup_ref
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// This function implements the default sup handler for operations that
+	// update only one triangle of C (herk, syrk). Parameter checking is
+	// performed by the operation-specific caller.
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism for each loop.
+	bli_rntm_set_ways_from_rntm_sup
+	(
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width_after_trans( a ),
+	  rntm
+	);
+
+	return
+	bli_l3_sup_thread_decorator
+	(
+	  bli_gemmtsup_int,
+	  BLIS_HERK, // operation family id
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+
+err_t bli_trsmsup_ref
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// This function implements the default trsm sup handler. Parameter
+	// checking is performed by the caller, bli_trsmsup().
+
+	obj_t a_local;
+	obj_t b_local;
+
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+
+	// Absorb any transposition of A into its strides and uplo field (this
+	// toggles between lower and upper), leaving only its conjugation. Do
+	// the same for B, which is both an input and the output.
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+	if ( bli_obj_has_trans( &b_local ) )
+	{
+		bli_obj_induce_trans( &b_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &b_local );
+	}
+
+	// A right-side solve, X * A = alpha * B, is performed as the left-side
+	// solve A^T * X^T = alpha * B^T, so that the variant only ever has to
+	// partition the columns (right-hand sides) of B among threads.
+	if ( bli_is_right( side ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+	}
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism for each loop.
+	bli_rntm_set_ways_from_rntm_sup
+	(
+	  bli_obj_length( &b_local ),
+	  bli_obj_width( &b_local ),
+	  bli_obj_length( &b_local ),
+	  rntm
+	);
+
+	return
+	bli_l3_sup_thread_decorator
+	(
+	  bli_trsmsup_int,
+	  BLIS_TRSM, // operation family id
+	  alpha,
+	  &a_local,
+	  &b_local,
+	  &BLIS_ZERO,
+	  &b_local,
+	  cntx,
+	  rntm
+	);
+}
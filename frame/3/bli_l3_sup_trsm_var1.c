@@ -0,0 +1,439 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+typedef void (*FUNCPTR_T)
+     (
+       uplo_t           uploa,
+       conj_t           conja,
+       diag_t           diaga,
+       dim_t            m,
+       dim_t            n,
+       void*   restrict alpha,
+       void*   restrict a, inc_t rs_a, inc_t cs_a,
+       void*   restrict b, inc_t rs_b, inc_t cs_b,
+       cntx_t* restrict cntx,
+       rntm_t* restrict rntm,
+       thrinfo_t* restrict thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes,trsmsup_ref_var1);
+
+void bli_trsmsup_ref_var1
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     )
+{
+	const num_t    dt        = bli_obj_dt( b );
+
+	const uplo_t   uploa     = bli_obj_uplo( a );
+	const conj_t   conja     = bli_obj_conj_status( a );
+	const diag_t   diaga     = bli_obj_diag( a );
+
+	const dim_t    m         = bli_obj_length( b );
+	const dim_t    n         = bli_obj_width( b );
+
+	void* restrict buf_a     = bli_obj_buffer_at_off( a );
+	const inc_t    rs_a      = bli_obj_row_stride( a );
+	const inc_t    cs_a      = bli_obj_col_stride( a );
+
+	void* restrict buf_b     = bli_obj_buffer_at_off( b );
+	const inc_t    rs_b      = bli_obj_row_stride( b );
+	const inc_t    cs_b      = bli_obj_col_stride( b );
+
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f
+	(
+	  uploa,
+	  conja,
+	  diaga,
+	  m,
+	  n,
+	  buf_alpha,
+	  buf_a, rs_a, cs_a,
+	  buf_b, rs_b, cs_b,
+	  cntx,
+	  rntm,
+	  thread
+	);
+}
+
+
+//
+// Pack an m x m triangular diagonal block of A into micro-panels of height
+// MR in the format expected by the gemmtrsm micro-kernels: each micro-panel
+// holds the part of its rows that lies within the stored triangle, with the
+// diagonal inverted (or set to one if A has a unit diagonal) and the rest of
+// its diagonal block zeroed. Rows beyond m are padded with an identity so
+// that the micro-kernels may always operate on full MR x MR blocks.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t           uploa, \
+       conj_t           conja, \
+       diag_t           diaga, \
+       dim_t            m, \
+       dim_t            mr, \
+       dim_t            packmr, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict p, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	ctype* restrict one   = PASTEMAC(ch,1); \
+\
+	const dim_t     n_sub = ( m + mr - 1 ) / mr; \
+	const dim_t     m_pad = n_sub * mr; \
+\
+	for ( dim_t s = 0; s < n_sub; ++s ) \
+	{ \
+		const dim_t i0     = s * mr; \
+		const dim_t mr_cur = bli_min( mr, m - i0 ); \
+\
+		/* Lower micro-panels span the columns to the left of and including
+		   their diagonal block; upper micro-panels begin at their diagonal
+		   block and span the remaining columns. */ \
+		const dim_t j0      = ( bli_is_lower( uploa ) ? 0           : i0 ); \
+		const dim_t len     = ( bli_is_lower( uploa ) ? i0 + mr_cur : m - i0 ); \
+		const dim_t len_max = ( bli_is_lower( uploa ) ? i0 + mr     : m_pad - i0 ); \
+\
+		ctype* restrict p_s = p + s * packmr * m_pad; \
+\
+		/* Copy the micro-panel with the packm kernel, which also zero-fills
+		   the rows and columns beyond the edge of A. */ \
+		PASTEMAC(ch,packm_cxk) \
+		( \
+		  conja, \
+		  BLIS_PACKED_ROW_PANELS, \
+		  mr_cur, \
+		  mr, \
+		  len, \
+		  len_max, \
+		  one, \
+		  a + i0*rs_a + j0*cs_a, rs_a, cs_a, \
+		  p_s,                   packmr, \
+		  cntx  \
+		); \
+\
+		/* Prepare the diagonal block for the trsm micro-kernel. */ \
+		ctype* restrict p11 = p_s + ( i0 - j0 ) * packmr; \
+\
+		for ( dim_t j = 0; j < mr; ++j ) \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		{ \
+			ctype* restrict pij = p11 + i + j*packmr; \
+\
+			if ( i == j ) \
+			{ \
+				if ( i < mr_cur && bli_is_nonunit_diag( diaga ) ) \
+				{ \
+					PASTEMAC(ch,inverts)( *pij ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,set1s)( *pij ); \
+				} \
+			} \
+			else if ( bli_is_lower( uploa ) ? i < j : j < i ) \
+			{ \
+				PASTEMAC(ch,set0s)( *pij ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( trsmsup_packa )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t           uploa, \
+       conj_t           conja, \
+       diag_t           diaga, \
+       dim_t            m, \
+       dim_t            n, \
+       void*   restrict alpha, \
+       void*   restrict a, inc_t rs_a, inc_t cs_a, \
+       void*   restrict b, inc_t rs_b, inc_t cs_b, \
+       cntx_t* restrict cntx, \
+       rntm_t* restrict rntm, \
+       thrinfo_t* restrict thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* If either dimension is zero, return immediately. */ \
+	if ( m == 0 || n == 0 ) return; \
+\
+	ctype* restrict a_cast     = a; \
+	ctype* restrict b_cast     = b; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype* restrict minus_one  = PASTEMAC(ch,m1); \
+\
+	/* The diagonal blocks are solved with the native gemmtrsm micro-kernels
+	   and so use the native register blocksizes and packing format. */ \
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	PASTECH(ch,gemmtrsm_ukr_ft) \
+	            gemmtrsm_ukr = bli_cntx_get_l3_vir_ukr_dt( dt, \
+	                             ( bli_is_lower( uploa ) ? BLIS_GEMMTRSM_L_UKR \
+	                                                     : BLIS_GEMMTRSM_U_UKR ), \
+	                             cntx ); \
+\
+	/* The right-hand sides are independent, so partition the columns of B
+	   among all of the threads in multiples of NR. Each thread then solves
+	   its own slice without any further communication. */ \
+	const dim_t nt  = bli_thread_num_threads( thread ); \
+	const dim_t tid = bli_thread_ocomm_id( thread ); \
+\
+	const dim_t n_blk    = ( n + NR - 1 ) / NR; \
+	const dim_t n_blk_t  = n_blk / nt; \
+	const dim_t n_blk_lo = n_blk % nt; \
+	const dim_t blk_s    = tid * n_blk_t + bli_min( tid, n_blk_lo ); \
+	const dim_t blk_e    = blk_s + n_blk_t + ( tid < n_blk_lo ? 1 : 0 ); \
+\
+	const dim_t js = bli_min( blk_s * NR, n ); \
+	const dim_t ns = bli_min( blk_e * NR, n ) - js; \
+\
+	if ( ns == 0 ) return; \
+\
+	ctype* restrict b_j = b_cast + js*cs_b; \
+\
+	/* B := alpha * B (for this thread's slice). */ \
+	PASTEMAC2(ch,scalm,BLIS_TAPI_EX_SUF) \
+	( \
+	  BLIS_NO_CONJUGATE, \
+	  0, \
+	  BLIS_NONUNIT_DIAG, \
+	  BLIS_DENSE, \
+	  m, ns, \
+	  alpha_cast, \
+	  b_j, rs_b, cs_b, \
+	  cntx, \
+	  NULL  \
+	); \
+\
+	if ( PASTEMAC(ch,eq0)( *alpha_cast ) ) return; \
+\
+	/* Step through A in diagonal blocks whose size is the sup MC blocksize
+	   rounded down to a multiple of MR. For each block, first subtract the
+	   contribution of the rows of X that were already solved with a single
+	   sup gemm whose k dimension spans all of them, and then solve with the
+	   diagonal block, one NR-wide column panel at a time, in the same way
+	   as the conventional trsm macro-kernel. Lower triangles are traversed
+	   top-down and upper triangles bottom-up. */ \
+	const dim_t MC = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t BS = bli_max( ( MC / MR ) * MR, MR ); \
+\
+	/* Acquire a block of memory for the packed diagonal block of A and a
+	   packed MC x NR column panel of B. */ \
+	const dim_t len_bp = bli_align_dim_to_mult( BS * PACKNR, \
+	                                            BLIS_SIMD_ALIGN_SIZE / sizeof( ctype ) ); \
+	const dim_t len_ap = ( BS / MR ) * PACKMR * BS; \
+	mem_t       mem; \
+\
+	bli_membrk_acquire_m \
+	( \
+	  rntm, \
+	  sizeof( ctype ) * ( len_bp + len_ap ), \
+	  BLIS_BUFFER_FOR_A_BLOCK, \
+	  &mem  \
+	); \
+\
+	ctype* restrict bp = bli_mem_buffer( &mem ); \
+	ctype* restrict ap = bp + len_bp; \
+\
+	/* A temporary buffer for micro-tiles of B along the edges. */ \
+	ctype           ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t     rs_ct = NR; \
+	const inc_t     cs_ct = 1; \
+\
+	auxinfo_t       aux; \
+\
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+	bli_auxinfo_set_is_a( 1, &aux ); \
+	bli_auxinfo_set_is_b( 1, &aux ); \
+\
+	const dim_t n_iter = ( m + BS - 1 ) / BS; \
+\
+	for ( dim_t iter = 0; iter < n_iter; ++iter ) \
+	{ \
+		const dim_t ib    = ( bli_is_lower( uploa ) ? iter : n_iter - iter - 1 ) * BS; \
+		const dim_t mb    = bli_min( BS, m - ib ); \
+		const dim_t n_sub = ( mb + MR - 1 ) / MR; \
+		const dim_t m_pad = n_sub * MR; \
+\
+		/* The solved rows of X are those above (lower) or below (upper)
+		   the current block. */ \
+		const dim_t kb = ( bli_is_lower( uploa ) ? 0  : ib + mb ); \
+		const dim_t nk = ( bli_is_lower( uploa ) ? ib : m - kb ); \
+\
+		ctype* restrict b_i = b_j + ib*rs_b; \
+\
+		if ( nk > 0 ) \
+		PASTEMAC(ch,gemmsup_int) \
+		( \
+		  conja, BLIS_NO_CONJUGATE, \
+		  mb, ns, nk, \
+		  minus_one, \
+		  a_cast + ib*rs_a + kb*cs_a, rs_a, cs_a, \
+		  b_j    + kb*rs_b,           rs_b, cs_b, \
+		  one, \
+		  b_i,                        rs_b, cs_b, \
+		  cntx, \
+		  rntm, \
+		  &BLIS_GEMM_SINGLE_THREADED  \
+		); \
+\
+		PASTEMAC(ch,trsmsup_packa) \
+		( \
+		  uploa, conja, diaga, \
+		  mb, MR, PACKMR, \
+		  a_cast + ib*rs_a + ib*cs_a, rs_a, cs_a, \
+		  ap, \
+		  cntx  \
+		); \
+\
+		for ( dim_t jb = 0; jb < ns; jb += NR ) \
+		{ \
+			const dim_t nb = bli_min( NR, ns - jb ); \
+\
+			ctype* restrict b_ij = b_i + jb*cs_b; \
+\
+			/* Pack the column panel of B, padding it with zeros. */ \
+			for ( dim_t i = 0; i < m_pad; ++i ) \
+			for ( dim_t j = 0; j < NR; ++j ) \
+			{ \
+				if ( i < mb && j < nb ) \
+				{ \
+					PASTEMAC(ch,copys)( *(b_ij + i*rs_b + j*cs_b), *(bp + i*PACKNR + j) ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,set0s)( *(bp + i*PACKNR + j) ); \
+				} \
+			} \
+\
+			for ( dim_t sub = 0; sub < n_sub; ++sub ) \
+			{ \
+				const dim_t s  = ( bli_is_lower( uploa ) ? sub : n_sub - sub - 1 ); \
+				const dim_t mr_cur = bli_min( MR, mb - s * MR ); \
+\
+				/* Locate the micro-panels of A and B that are involved in the
+				   update of, and solve with, the current MR x MR diagonal
+				   block. */ \
+				ctype* restrict a_s  = ap + s * PACKMR * m_pad; \
+				ctype* restrict b11  = bp + s * MR * PACKNR; \
+				const dim_t     k    = ( bli_is_lower( uploa ) ? s * MR \
+				                                               : m_pad - ( s + 1 ) * MR ); \
+				ctype* restrict a11  = ( bli_is_lower( uploa ) ? a_s + k * PACKMR : a_s ); \
+				ctype* restrict a1x  = ( bli_is_lower( uploa ) ? a_s : a_s + MR * PACKMR ); \
+				ctype* restrict bx1  = ( bli_is_lower( uploa ) ? bp  : b11 + MR * PACKNR ); \
+				ctype* restrict c11  = b_ij + s * MR * rs_b; \
+\
+				bli_auxinfo_set_next_a( a_s, &aux ); \
+				bli_auxinfo_set_next_b( bp, &aux ); \
+\
+				if ( mr_cur == MR && nb == NR ) \
+				{ \
+					gemmtrsm_ukr \
+					( \
+					  k, \
+					  one, \
+					  a1x, \
+					  a11, \
+					  bx1, \
+					  b11, \
+					  c11, rs_b, cs_b, \
+					  &aux, \
+					  cntx  \
+					); \
+				} \
+				else \
+				{ \
+					gemmtrsm_ukr \
+					( \
+					  k, \
+					  one, \
+					  a1x, \
+					  a11, \
+					  bx1, \
+					  b11, \
+					  ct,  rs_ct, cs_ct, \
+					  &aux, \
+					  cntx  \
+					); \
+\
+					PASTEMAC(ch,copys_mxn) \
+					( \
+					  mr_cur, nb, \
+					  ct,  rs_ct, cs_ct, \
+					  c11, rs_b,  cs_b  \
+					); \
+				} \
+			} \
+		} \
+	} \
+\
+	bli_membrk_release( rntm, &mem ); \
+}
+
+INSERT_GENTFUNC_BASIC0( trsmsup_ref_var1 )
+
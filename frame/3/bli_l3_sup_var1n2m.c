@@ -1321,3 +1321,255 @@ PASTEMAC(ch,fprintm)( stdout, "gemmsup_ref_var2: c ", mr_cur, nr_cur, c_ir, rs_c
 
 INSERT_GENTFUNC_BASIC0( gemmsup_ref_var2m )
 
+
+
+//
+// -- gemmt var2m --------------------------------------------------------------
+//
+
+// The maximum dimension of the diagonal blocks of C that are computed into
+// a local buffer by bli_?gemmtsup_ref_var2m().
+#define BLIS_GEMMTSUP_DIAG_MAX 24
+
+typedef void (*FUNCPTR_TT)
+     (
+       uplo_t           uploc,
+       conj_t           conja,
+       conj_t           conjb,
+       dim_t            m,
+       dim_t            k,
+       void*   restrict alpha,
+       void*   restrict a, inc_t rs_a, inc_t cs_a,
+       void*   restrict b, inc_t rs_b, inc_t cs_b,
+       void*   restrict beta,
+       void*   restrict c, inc_t rs_c, inc_t cs_c,
+       cntx_t* restrict cntx,
+       rntm_t* restrict rntm,
+       thrinfo_t* restrict thread
+     );
+
+static FUNCPTR_TT GENARRAY(ftypes_gemmt_var2m,gemmtsup_ref_var2m);
+
+void bli_gemmtsup_ref_var2m
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       thrinfo_t* thread
+     )
+{
+	const num_t    dt        = bli_obj_dt( c );
+
+	const uplo_t   uploc     = bli_obj_uplo( c );
+
+	const conj_t   conja     = bli_obj_conj_status( a );
+	const conj_t   conjb     = bli_obj_conj_status( b );
+
+	const dim_t    m         = bli_obj_length( c );
+	const dim_t    k         = bli_obj_width_after_trans( a );
+
+	void* restrict buf_a     = bli_obj_buffer_at_off( a );
+	      inc_t    rs_a      = bli_obj_row_stride( a );
+	      inc_t    cs_a      = bli_obj_col_stride( a );
+
+	void* restrict buf_b     = bli_obj_buffer_at_off( b );
+	      inc_t    rs_b      = bli_obj_row_stride( b );
+	      inc_t    cs_b      = bli_obj_col_stride( b );
+
+	void* restrict buf_c     = bli_obj_buffer_at_off( c );
+	const inc_t    rs_c      = bli_obj_row_stride( c );
+	const inc_t    cs_c      = bli_obj_col_stride( c );
+
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+	void* restrict buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
+
+	// Assign the strides with an implicit transposition, if needed.
+	if ( bli_obj_has_trans( a ) ) bli_swap_incs( &rs_a, &cs_a );
+	if ( bli_obj_has_trans( b ) ) bli_swap_incs( &rs_b, &cs_b );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	FUNCPTR_TT f = ftypes_gemmt_var2m[dt];
+
+	// Invoke the function.
+	f
+	(
+	  uploc,
+	  conja,
+	  conjb,
+	  m,
+	  k,
+	  buf_alpha,
+	  buf_a, rs_a, cs_a,
+	  buf_b, rs_b, cs_b,
+	  buf_beta,
+	  buf_c, rs_c, cs_c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       uplo_t           uploc, \
+       conj_t           conja, \
+       conj_t           conjb, \
+       dim_t            m, \
+       dim_t            k, \
+       void*   restrict alpha, \
+       void*   restrict a, inc_t rs_a, inc_t cs_a, \
+       void*   restrict b, inc_t rs_b, inc_t cs_b, \
+       void*   restrict beta, \
+       void*   restrict c, inc_t rs_c, inc_t cs_c, \
+       cntx_t* restrict cntx, \
+       rntm_t* restrict rntm, \
+       thrinfo_t* restrict thread  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* If m is zero, return immediately. */ \
+	if ( m == 0 ) return; \
+\
+	/* Choose the size of the diagonal blocks: a multiple of the smaller of
+	   the sup register blocksizes that is at least as large as the other,
+	   subject to the size of the local buffer. Larger blocks waste more
+	   flops in the unstored triangle; smaller blocks mean more (and more
+	   poorly shaped) calls into the sup variants. */ \
+	const dim_t MR = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t BS = bli_min( bli_align_dim_to_mult( bli_max( MR, NR ), \
+	                                                 bli_min( MR, NR ) ), \
+	                          BLIS_GEMMTSUP_DIAG_MAX ); \
+\
+	/* A local buffer for the diagonal blocks, stored the same way as C so
+	   that the same sup microkernels are used for both. */ \
+	ctype           ct[ BLIS_GEMMTSUP_DIAG_MAX * BLIS_GEMMTSUP_DIAG_MAX ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const bool      row_stored = bli_is_row_stored( rs_c, cs_c ); \
+\
+	ctype* restrict a_cast     = a; \
+	ctype* restrict b_cast     = b; \
+	ctype* restrict c_cast     = c; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict beta_cast  = beta; \
+	ctype* restrict zero       = PASTEMAC(ch,0); \
+\
+	/* Partition C into row panels whose height is a multiple of BS no
+	   larger than the sup MC blocksize (so that each panel of A is reused
+	   across the full width of the rectangular update), unless that would
+	   leave too few panels to keep every thread busy. */ \
+	const dim_t MC  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t nt  = bli_thread_num_threads( thread ); \
+	const dim_t tid = bli_thread_ocomm_id( thread ); \
+\
+	dim_t PH = bli_max( ( MC / BS ) * BS, BS ); \
+	if ( ( m + PH - 1 ) / PH < 2 * nt ) PH = BS; \
+\
+	const dim_t n_pan = ( m + PH - 1 ) / PH; \
+\
+	/* Assign row panels of C to threads in a round-robin fashion. Since the
+	   amount of the stored triangle within a row panel grows (lower) or
+	   shrinks (upper) linearly, this keeps the load reasonably balanced
+	   without any further communication. Each piece of a panel is then
+	   computed with a single-threaded call into the sup variants. */ \
+	for ( dim_t ip = tid; ip < n_pan; ip += nt ) \
+	{ \
+		const dim_t i  = ip * PH; \
+		const dim_t mp = bli_min( PH, m - i ); \
+\
+		/* The part of the row panel to the left (lower) or right (upper) of
+		   its diagonal block lies entirely within the stored triangle, so it
+		   is computed in place as an ordinary gemm. */ \
+		const dim_t j  = ( bli_is_lower( uploc ) ? 0 : i + mp ); \
+		const dim_t nj = ( bli_is_lower( uploc ) ? i : m - j ); \
+\
+		PASTEMAC(ch,gemmsup_int) \
+		( \
+		  conja, conjb, \
+		  mp, nj, k, \
+		  alpha_cast, \
+		  a_cast + i*rs_a,          rs_a, cs_a, \
+		  b_cast + j*cs_b,          rs_b, cs_b, \
+		  beta_cast, \
+		  c_cast + i*rs_c + j*cs_c, rs_c, cs_c, \
+		  cntx, \
+		  rntm, \
+		  &BLIS_GEMM_SINGLE_THREADED  \
+		); \
+\
+		/* Within the panel's diagonal block, repeat the same process with
+		   row blocks of height BS. */ \
+		for ( dim_t ib = i; ib < i + mp; ib += BS ) \
+		{ \
+			const dim_t mb = bli_min( BS, i + mp - ib ); \
+\
+			ctype* restrict a_i  = a_cast + ib*rs_a; \
+			ctype* restrict b_i  = b_cast + ib*cs_b; \
+			ctype* restrict c_ii = c_cast + ib*rs_c + ib*cs_c; \
+\
+			const dim_t jb  = ( bli_is_lower( uploc ) ? i      : ib + mb ); \
+			const dim_t njb = ( bli_is_lower( uploc ) ? ib - i : i + mp - jb ); \
+\
+			PASTEMAC(ch,gemmsup_int) \
+			( \
+			  conja, conjb, \
+			  mb, njb, k, \
+			  alpha_cast, \
+			  a_i,                        rs_a, cs_a, \
+			  b_cast + jb*cs_b,           rs_b, cs_b, \
+			  beta_cast, \
+			  c_cast + ib*rs_c + jb*cs_c, rs_c, cs_c, \
+			  cntx, \
+			  rntm, \
+			  &BLIS_GEMM_SINGLE_THREADED  \
+			); \
+\
+			/* The BS x BS diagonal block straddles the diagonal. Compute all
+			   of it into the local buffer and then update only the stored
+			   triangle of C. */ \
+			const inc_t rs_ct = ( row_stored ? mb : 1  ); \
+			const inc_t cs_ct = ( row_stored ? 1  : mb ); \
+\
+			PASTEMAC(ch,gemmsup_int) \
+			( \
+			  conja, conjb, \
+			  mb, mb, k, \
+			  alpha_cast, \
+			  a_i, rs_a,  cs_a, \
+			  b_i, rs_b,  cs_b, \
+			  zero, \
+			  ct,  rs_ct, cs_ct, \
+			  cntx, \
+			  rntm, \
+			  &BLIS_GEMM_SINGLE_THREADED  \
+			); \
+\
+			PASTEMAC2(ch,xpbym,BLIS_TAPI_EX_SUF) \
+			( \
+			  0, \
+			  BLIS_NONUNIT_DIAG, \
+			  uploc, \
+			  BLIS_NO_TRANSPOSE, \
+			  mb, mb, \
+			  ct,   rs_ct, cs_ct, \
+			  beta_cast, \
+			  c_ii, rs_c,  cs_c, \
+			  cntx, \
+			  NULL  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( gemmtsup_ref_var2m )
+
@@ -62,6 +62,43 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_TAPI_EX_DECLS \
+\
+	/* Handle problems that fit within the tiny gemm kernels without
+	   creating any objects. A non-NULL context or rntm_t
+	   is taken as a request to use the full implementation. */ \
+	if ( bli_gemm_tiny_is_enabled() && cntx == NULL && rntm == NULL ) \
+	{ \
+		err_t r_val = PASTEMAC(ch,gemm_tiny) \
+		( \
+		  transa, \
+		  transb, \
+		  m, n, k, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  b, rs_b, cs_b, \
+		  beta, \
+		  c, rs_c, cs_c  \
+		); \
+		if ( r_val == BLIS_SUCCESS ) return; \
+	} \
+\
+	/* Small problems may be handed directly to the sup code without
+	   building objects. */ \
+	if ( cntx == NULL && rntm == NULL ) \
+	{ \
+		err_t r_val = PASTEMAC(ch,gemmsup) \
+		( \
+		  transa, \
+		  transb, \
+		  m, n, k, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  b, rs_b, cs_b, \
+		  beta, \
+		  c, rs_c, cs_c  \
+		); \
+		if ( r_val == BLIS_SUCCESS ) return; \
+	} \
 \
 	const num_t dt = PASTEMAC(ch,type); \
 \
@@ -67,6 +67,57 @@ void PASTEMAC(ch,opname) \
      );
 
 
+#define GEMMI_UKR_PROT( ctype_a, ctype_b, opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       dim_t               k, \
+       int32_t*   restrict alpha, \
+       ctype_a*   restrict a, \
+       ctype_b*   restrict b, \
+       int32_t*   restrict beta, \
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c, \
+       int32_t*   restrict ra, \
+       int32_t*   restrict cb, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
+
+#define SPMM_UKR_PROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t               n, \
+       dim_t               nnz, \
+       ctype*     restrict alpha, \
+       gint_t*    restrict col_ind, \
+       ctype*     restrict val, \
+       ctype*     restrict b, inc_t rs_b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
+
+#define GEMMSUM_UKR_PROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       dim_t               nterm, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype**    restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
+
 #define TRSM_UKR_PROT( ctype, ch, opname ) \
 \
 void PASTEMAC(ch,opname) \
@@ -40,6 +40,21 @@
 
 #include "bli_gemm_ind_opt.h"
 
+// Tiny (compile-time specialized) gemm support.
+#include "bli_gemm_tiny.h"
+
+// Blocked loop nest for gemm operations outside of the control tree.
+#include "bli_gemm_nest.h"
+
+// Half-precision (bfloat16/float16) gemm support.
+#include "bli_gemm_hp.h"
+
+// Integer (u8s8s32/s16s16s32) gemm support.
+#include "bli_gemm_i.h"
+
+// Strassen gemm support.
+#include "bli_gemm_strassen.h"
+
 // Mixed datatype support.
 #ifdef BLIS_ENABLE_GEMM_MD
 #include "bli_gemm_md.h"
@@ -174,6 +174,23 @@ void bli_gemm_front
 	  rntm
 	);
 
+	// If a cap on packing memory is in effect (see bli_membrk_set_mem_cap()),
+	// the cache blocksizes may need to be reduced so that the blocks of A
+	// and panels of B packed at once fit within it. If so, cntx is adjusted
+	// to point to cntx_cap, a modified copy.
+	cntx_t cntx_cap;
+
+	cntx = bli_membrk_cap_cntx
+	(
+	  bli_obj_comp_dt( &c_local ),
+	  bli_obj_length( &c_local ),
+	  bli_obj_width( &c_local ),
+	  bli_obj_width( &a_local ),
+	  rntm,
+	  cntx,
+	  &cntx_cap
+	);
+
 	obj_t* cp    = &c_local;
 	obj_t* betap = beta;
 
@@ -0,0 +1,502 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Packing with conversion to single precision. An m x k submatrix (where m
+// is the panel dimension) is packed into contiguous micro-panels of mr x k,
+// each with a leading dimension of packmr. Half-precision micro-panels are
+// widened by the context's half-precision packm kernels; single-precision
+// micro-panels are packed by the native packm kernels.
+//
+
+static void bli_gemmhp_packm
+     (
+       num_t           dt,
+       pack_t          schema,
+       dim_t           m,
+       dim_t           k,
+       void*  restrict a, inc_t inca, inc_t lda,
+       dim_t           mr,
+       dim_t           packmr,
+       float* restrict p,
+       cntx_t*         cntx
+     )
+{
+	const siz_t       es     = bli_dt_size( dt );
+	packm_half_ker_ft f_half = NULL;
+
+	if ( bli_is_half( dt ) )
+		f_half = bli_cntx_get_packm_half_ker( bli_dt_half_type( dt ), cntx );
+
+	for ( dim_t i0 = 0; i0 < m; i0 += mr )
+	{
+		const dim_t mr_cur = bli_min( mr, m - i0 );
+		char*       a0     = ( char* )a + i0*inca*es;
+
+		if ( f_half != NULL )
+			f_half( mr_cur, k, a0, inca, lda, p, packmr, cntx );
+		else
+			bli_spackm_cxk( BLIS_NO_CONJUGATE, schema, mr_cur, mr, k, k,
+			                bli_s1, ( float* )a0, inca, lda, p, packmr, cntx );
+
+		p += packmr * k;
+	}
+}
+
+// Compute C := beta * C + W, where W is a single-precision workspace and C
+// is stored as bfloat16. If beta is zero, C is not read.
+static void bli_gemmhp_update_bf16
+     (
+       dim_t              m,
+       dim_t              n,
+       float*    restrict w, inc_t rs_w, inc_t cs_w,
+       float              beta,
+       bfloat16* restrict c, inc_t rs_c, inc_t cs_c
+     )
+{
+	if ( rs_w == 1 && rs_c == 1 )
+	{
+		// Keep the beta test out of the inner loop so that both branches
+		// reduce to straight-line code over contiguous columns.
+		if ( beta == 0.0f )
+		{
+			for ( dim_t j = 0; j < n; ++j )
+			{
+				float*    restrict wj = w + j*cs_w;
+				bfloat16* restrict cj = c + j*cs_c;
+
+				for ( dim_t i = 0; i < m; ++i )
+					cj[ i ] = bli_float_to_bf16( wj[ i ] );
+			}
+		}
+		else
+		{
+			for ( dim_t j = 0; j < n; ++j )
+			{
+				float*    restrict wj = w + j*cs_w;
+				bfloat16* restrict cj = c + j*cs_c;
+
+				for ( dim_t i = 0; i < m; ++i )
+					cj[ i ] = bli_float_to_bf16( wj[ i ] + beta * bli_bf16_to_float( cj[ i ] ) );
+			}
+		}
+		return;
+	}
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		float     wij = w[ i*rs_w + j*cs_w ];
+		bfloat16* cij = c + i*rs_c + j*cs_c;
+
+		if ( beta != 0.0f ) wij += beta * bli_bf16_to_float( *cij );
+
+		*cij = bli_float_to_bf16( wij );
+	}
+}
+
+// The operands and scalars of a half-precision gemm, as seen by the
+// callbacks of the blocked loop nest.
+typedef struct
+{
+	num_t    dt_a;
+	num_t    dt_b;
+	num_t    dt_c;
+	char*    a; inc_t rs_a; inc_t cs_a; siz_t es_a;
+	char*    b; inc_t rs_b; inc_t cs_b; siz_t es_b;
+	char*    c; inc_t rs_c; inc_t cs_c; siz_t es_c;
+	dim_t    k;
+	float    alpha;
+	float    beta;
+	float*   w; inc_t ld_w;
+	cntx_t*  cntx;
+} gemmhp_params_t;
+
+static void bli_gemmhp_packa
+     (
+       dim_t i, dim_t p, dim_t mc, dim_t kc, void* ap, void* extra, void* params
+     )
+{
+	gemmhp_params_t* hp     = params;
+	const dim_t      MR     = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MR, hp->cntx );
+	const dim_t      PACKMR = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_MR, hp->cntx );
+
+	bli_gemmhp_packm( hp->dt_a, BLIS_PACKED_ROW_PANELS, mc, kc,
+	                  hp->a + ( i*hp->rs_a + p*hp->cs_a ) * hp->es_a, hp->rs_a, hp->cs_a,
+	                  MR, PACKMR, ap, hp->cntx );
+}
+
+// B is packed as the transpose of an "A-like" operand.
+static void bli_gemmhp_packb
+     (
+       dim_t j, dim_t p, dim_t nc, dim_t kc, void* bp, void* extra, void* params
+     )
+{
+	gemmhp_params_t* hp     = params;
+	const dim_t      NR     = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NR, hp->cntx );
+	const dim_t      PACKNR = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_NR, hp->cntx );
+
+	bli_gemmhp_packm( hp->dt_b, BLIS_PACKED_COL_PANELS, nc, kc,
+	                  hp->b + ( p*hp->rs_b + j*hp->cs_b ) * hp->es_b, hp->cs_b, hp->rs_b,
+	                  NR, PACKNR, bp, hp->cntx );
+}
+
+// Compute one micro-tile. When C is stored in single precision, the
+// micro-tile of C is updated directly. When C is stored as bfloat16, the
+// micro-tile is accumulated in the workspace, and after the last block of k
+// it is used to update the micro-tile of C while it is still in cache.
+static void bli_gemmhp_ukr
+     (
+       dim_t ic, dim_t jc, dim_t pc, dim_t i, dim_t j,
+       dim_t mr_cur, dim_t nr_cur, dim_t kc,
+       void* a1, void* b1, void* a2, void* b2, void* params
+     )
+{
+	gemmhp_params_t* hp        = params;
+	cntx_t*          cntx      = hp->cntx;
+	const bool       c_is_half = bli_is_bfloat16( hp->dt_c );
+
+	const dim_t  MR = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MR, cntx );
+	const dim_t  NR = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NR, cntx );
+
+	sgemm_ukr_ft gemm_ukr = bli_cntx_get_l3_nat_ukr_dt( BLIS_FLOAT, BLIS_GEMM_UKR, cntx );
+
+	float        one  = 1.0f;
+	float        zero = 0.0f;
+	float*       beta = ( pc != 0 ? &one : c_is_half ? &zero : &hp->beta );
+	float*       c11;
+	inc_t        rs_c, cs_c;
+	auxinfo_t    aux;
+
+	if ( c_is_half )
+	{
+		c11  = hp->w + i + j*hp->ld_w;
+		rs_c = 1;
+		cs_c = hp->ld_w;
+	}
+	else
+	{
+		c11  = ( float* )hp->c + ( ic + i )*hp->rs_c + ( jc + j )*hp->cs_c;
+		rs_c = hp->rs_c;
+		cs_c = hp->cs_c;
+	}
+
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux );
+	bli_auxinfo_set_is_a( 1, &aux );
+	bli_auxinfo_set_is_b( 1, &aux );
+	bli_auxinfo_set_next_a( a2, &aux );
+	bli_auxinfo_set_next_b( b2, &aux );
+
+	if ( mr_cur == MR && nr_cur == NR )
+	{
+		gemm_ukr( kc, &hp->alpha, a1, b1, beta, c11, rs_c, cs_c, &aux, cntx );
+	}
+	else
+	{
+		// Edge cases are computed into a temporary micro-tile.
+		float ct[ BLIS_STACK_BUF_MAX_SIZE / sizeof( float ) ]
+		      __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+		gemm_ukr( kc, &hp->alpha, a1, b1, &zero, ct, NR, 1, &aux, cntx );
+
+		bli_sssxpbys_mxn( mr_cur, nr_cur, ct,  NR,   1,
+		                                  beta,
+		                                  c11, rs_c, cs_c );
+	}
+
+	if ( c_is_half && pc + kc == hp->k )
+		bli_gemmhp_update_bf16
+		(
+		  mr_cur, nr_cur,
+		  c11, rs_c, cs_c,
+		  hp->beta,
+		  ( bfloat16* )hp->c + ( ic + i )*hp->rs_c + ( jc + j )*hp->cs_c,
+		  hp->rs_c, hp->cs_c
+		);
+}
+
+// Scale C by beta (for when alpha or k is zero).
+static void bli_gemmhp_scalc
+     (
+       dim_t i0, dim_t j0, dim_t m, dim_t n, void* params
+     )
+{
+	gemmhp_params_t* hp   = params;
+	const float      beta = hp->beta;
+
+	for ( dim_t j = j0; j < j0 + n; ++j )
+	for ( dim_t i = i0; i < i0 + m; ++i )
+	{
+		if ( bli_is_bfloat16( hp->dt_c ) )
+		{
+			bfloat16* cij = ( bfloat16* )hp->c + i*hp->rs_c + j*hp->cs_c;
+
+			if ( beta == 0.0f ) *cij = 0;
+			else                *cij = bli_float_to_bf16( beta * bli_bf16_to_float( *cij ) );
+		}
+		else
+		{
+			float* cij = ( float* )hp->c + i*hp->rs_c + j*hp->cs_c;
+
+			if ( beta == 0.0f ) *cij = 0.0f;
+			else                *cij = beta * *cij;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemmhp
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemmhp_check( alpha, a, b, beta, c );
+
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// If C has a zero dimension, return early.
+	if ( m == 0 || n == 0 ) return;
+
+	// Obtain a valid (native) context from the gks if necessary. Only the
+	// single-precision blocksizes and gemm micro-kernel are used.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism. Only the total number of threads is
+	// used; each thread computes a disjoint block of C.
+	bli_rntm_set_ways_from_rntm_sup( m, n, k, rntm );
+
+	bli_l3_sup_thread_decorator
+	(
+	  bli_gemmhp_int,
+	  BLIS_GEMM,
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+err_t bli_gemmhp_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     )
+{
+	const dim_t     m = bli_obj_length( c );
+	const dim_t     n = bli_obj_width( c );
+	const dim_t     k = bli_obj_width_after_trans( a );
+
+	gemmhp_params_t hp;
+
+	hp.dt_a = bli_obj_dt( a );
+	hp.dt_b = bli_obj_dt( b );
+	hp.dt_c = bli_obj_dt( c );
+
+	hp.a    = bli_obj_buffer_at_off( a );
+	hp.rs_a = bli_obj_row_stride( a );
+	hp.cs_a = bli_obj_col_stride( a );
+	hp.es_a = bli_obj_elem_size( a );
+	hp.b    = bli_obj_buffer_at_off( b );
+	hp.rs_b = bli_obj_row_stride( b );
+	hp.cs_b = bli_obj_col_stride( b );
+	hp.es_b = bli_obj_elem_size( b );
+	hp.c    = bli_obj_buffer_at_off( c );
+	hp.rs_c = bli_obj_row_stride( c );
+	hp.cs_c = bli_obj_col_stride( c );
+	hp.es_c = bli_obj_elem_size( c );
+	hp.k    = k;
+	hp.cntx = cntx;
+
+	// Absorb any transpositions of A and B into their strides.
+	if ( bli_obj_has_trans( a ) ) bli_swap_incs( &hp.rs_a, &hp.cs_a );
+	if ( bli_obj_has_trans( b ) ) bli_swap_incs( &hp.rs_b, &hp.cs_b );
+
+	// Query the scalars as single-precision values.
+	double alpha_r, alpha_i, beta_r, beta_i;
+
+	bli_getsc( alpha, &alpha_r, &alpha_i );
+	bli_getsc( beta,  &beta_r,  &beta_i );
+
+	hp.alpha = ( float )alpha_r;
+	hp.beta  = ( float )beta_r;
+
+	const bool  c_is_half = bli_is_bfloat16( hp.dt_c );
+
+	const dim_t MR = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MR, cntx );
+	const dim_t MC = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_MC, cntx );
+	const dim_t NC = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NC, cntx );
+
+	// When C is stored in single precision, we follow the usual ordering of
+	// the loops around the micro-kernel. When C is stored as bfloat16, each
+	// MC x NC block of C is instead accumulated over all of k in a
+	// workspace.
+	gemmnest_t nest;
+
+	nest.mr            = MR;
+	nest.nr            = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_NR, cntx );
+	nest.kr            = 1;
+	nest.mc            = MC;
+	nest.kc            = bli_cntx_get_blksz_def_dt( BLIS_FLOAT, BLIS_KC, cntx );
+	nest.nc            = NC;
+	nest.packmr        = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_MR, cntx );
+	nest.packnr        = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_NR, cntx );
+	nest.es_a          = sizeof( float );
+	nest.es_b          = sizeof( float );
+	nest.extra_a       = 0;
+	nest.extra_b       = 0;
+	nest.k_inner       = c_is_half;
+	nest.alpha_is_zero = ( hp.alpha == 0.0f );
+	nest.packa         = bli_gemmhp_packa;
+	nest.packb         = bli_gemmhp_packb;
+	nest.ukr           = bli_gemmhp_ukr;
+	nest.scalc         = bli_gemmhp_scalc;
+	nest.params        = &hp;
+
+	mem_t mem_w;
+
+	hp.w    = NULL;
+	hp.ld_w = bli_gemm_nest_roundup( bli_min( MC, m ), MR );
+
+	if ( c_is_half && !nest.alpha_is_zero && k != 0 )
+	{
+		bli_membrk_acquire_m( rntm, sizeof( float ) * hp.ld_w * bli_min( NC, n ),
+		                      BLIS_BUFFER_FOR_GEN_USE, &mem_w );
+		hp.w = bli_mem_buffer( &mem_w );
+	}
+
+	bli_gemm_nest( m, n, k, &nest, rntm, thread );
+
+	if ( hp.w != NULL )
+		bli_membrk_release( rntm, &mem_w );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemmhp_check
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes. A and B may be stored in any of the half- or
+	// single-precision formats, while C must be stored as float or bfloat16.
+
+	e_val = bli_check_noninteger_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_noninteger_object( beta );
+	bli_check_error_code( e_val );
+
+	// The computation is real, so alpha and beta must be real-valued.
+	if ( !bli_obj_imag_is_zero( alpha ) || !bli_obj_imag_is_zero( beta ) )
+		bli_check_error_code( BLIS_EXPECTED_REAL_VALUED_OBJECT );
+
+	if ( ( !bli_obj_is_half( a ) && !bli_obj_is_float( a ) ) ||
+	     ( !bli_obj_is_half( b ) && !bli_obj_is_float( b ) ) ||
+	     ( !bli_obj_is_float( c ) && bli_obj_dt( c ) != BLIS_BFLOAT16 ) )
+		bli_check_error_code( BLIS_INVALID_DATATYPE );
+
+	// Check scalar/vector/matrix type.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( c );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_level3_dims( a, b, c );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( c );
+	bli_check_error_code( e_val );
+}
+
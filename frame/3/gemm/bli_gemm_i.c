@@ -0,0 +1,581 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Packing. Each routine packs an m x k submatrix (where m is the panel
+// dimension) into contiguous micro-panels of mr rows, storing each group of
+// kr consecutive elements along k together for each row (see the reference
+// micro-kernels in ref_kernels/3/bli_gemmi_ref.c). Each micro-panel is
+// zero-padded to mr rows and k to a multiple of kr. For each packed row,
+// shift + scale * ( the sum of the row over k ) is written to s.
+//
+
+#undef  GENPACK
+#define GENPACK( ctype, ch ) \
+\
+static void PASTEMAC(gemmi_packm_,ch) \
+     ( \
+       dim_t             m, \
+       dim_t             k, \
+       ctype*   restrict a, inc_t inca, inc_t lda, \
+       dim_t             mr, \
+       dim_t             kr, \
+       uint32_t          scale, \
+       uint32_t          shift, \
+       ctype*   restrict p, \
+       int32_t* restrict s  \
+     ) \
+{ \
+	const dim_t k_pad = ( ( k + kr - 1 ) / kr ) * kr; \
+	uint32_t    sum[ BLIS_STACK_BUF_MAX_SIZE / sizeof( uint32_t ) ]; \
+\
+	for ( dim_t i0 = 0; i0 < m; i0 += mr ) \
+	{ \
+		const dim_t       mr_cur = bli_min( mr, m - i0 ); \
+		ctype*   restrict a0     = a + i0*inca; \
+\
+		for ( dim_t i = 0; i < mr; ++i ) sum[ i ] = 0; \
+\
+		if ( inca == 1 ) \
+		{ \
+			/* Walk down each column of the micro-panel in the inner loop
+			   so that column-stored panels are read contiguously. */ \
+			for ( dim_t l = 0; l < k; ++l ) \
+			{ \
+				ctype* restrict pl = p + ( l / kr )*mr*kr + ( l % kr ); \
+\
+				for ( dim_t i = 0; i < mr_cur; ++i ) \
+				{ \
+					pl[ i*kr ] = a0[ i + l*lda ]; \
+					sum[ i ] += ( uint32_t )a0[ i + l*lda ]; \
+				} \
+				for ( dim_t i = mr_cur; i < mr; ++i ) \
+					pl[ i*kr ] = 0; \
+			} \
+		} \
+		else \
+		{ \
+			/* Walk along k in the inner loop so that row-stored panels are
+			   read contiguously. */ \
+			for ( dim_t i = 0; i < mr_cur; ++i ) \
+			{ \
+				ctype* restrict ai = a0 + i*inca; \
+				ctype* restrict pi = p + i*kr; \
+				uint32_t        si = 0; \
+\
+				for ( dim_t g = 0; g < k / kr; ++g ) \
+				for ( dim_t q = 0; q < kr; ++q ) \
+				{ \
+					pi[ g*mr*kr + q ] = ai[ ( g*kr + q )*lda ]; \
+					si += ( uint32_t )ai[ ( g*kr + q )*lda ]; \
+				} \
+				for ( dim_t l = ( k / kr ) * kr; l < k; ++l ) \
+				{ \
+					pi[ ( l / kr )*mr*kr + ( l % kr ) ] = ai[ l*lda ]; \
+					si += ( uint32_t )ai[ l*lda ]; \
+				} \
+\
+				sum[ i ] = si; \
+			} \
+			for ( dim_t l = 0; l < k; ++l ) \
+				for ( dim_t i = mr_cur; i < mr; ++i ) \
+					p[ ( l / kr )*mr*kr + i*kr + ( l % kr ) ] = 0; \
+		} \
+\
+		/* Zero-pad k to a multiple of kr. */ \
+		for ( dim_t l = k; l < k_pad; ++l ) \
+			for ( dim_t i = 0; i < mr; ++i ) \
+				p[ ( l / kr )*mr*kr + i*kr + ( l % kr ) ] = 0; \
+\
+		for ( dim_t i = 0; i < mr; ++i ) \
+			s[ i ] = ( i < mr_cur ? ( int32_t )( shift + scale * sum[ i ] ) : 0 ); \
+\
+		p += mr * k_pad; \
+		s += mr; \
+	} \
+}
+
+GENPACK( uint8_t, u8 )
+GENPACK( int8_t,  s8 )
+GENPACK( int16_t, s16 )
+
+// Return the number of consecutive elements along k that are interleaved by
+// the micro-kernels for the given type.
+BLIS_INLINE dim_t bli_gemmi_kr( gemmi_t type )
+{
+	return ( type == BLIS_GEMMI_U8S8S32 ? 4 : 2 );
+}
+
+// The operands and scalars of an integer gemm, as seen by the callbacks of
+// the blocked loop nest.
+typedef struct
+{
+	gemmi_t   type;
+	char*     a; inc_t rs_a; inc_t cs_a; int32_t a_zp;
+	char*     b; inc_t rs_b; inc_t cs_b; int32_t b_zp;
+	int32_t*  c; inc_t rs_c; inc_t cs_c;
+	int32_t   alpha;
+	int32_t   beta;
+	int32_t*  ra;
+	int32_t*  cb;
+	cntx_t*   cntx;
+} gemmi_params_t;
+
+// Pack a block of A along with the row offsets ra, which account for the
+// zero point of B as well as the product of the two zero points.
+static void bli_gemmi_packa
+     (
+       dim_t i, dim_t p, dim_t mc, dim_t kc, void* ap, void* extra, void* params
+     )
+{
+	gemmi_params_t* gi = params;
+	const dim_t     KR = bli_gemmi_kr( gi->type );
+	const dim_t     MR = bli_cntx_get_l3_gemmi_blksz( gi->type, BLIS_MR, gi->cntx );
+
+	const uint32_t  scale_a = -( uint32_t )gi->b_zp;
+	const uint32_t  shift_a = ( uint32_t )kc * ( uint32_t )gi->a_zp
+	                                         * ( uint32_t )gi->b_zp;
+
+	gi->ra = extra;
+
+	if ( gi->type == BLIS_GEMMI_U8S8S32 )
+		bli_gemmi_packm_u8( mc, kc,
+		                    ( uint8_t* )gi->a + i*gi->rs_a + p*gi->cs_a, gi->rs_a, gi->cs_a,
+		                    MR, KR, scale_a, shift_a, ap, gi->ra );
+	else
+		bli_gemmi_packm_s16( mc, kc,
+		                     ( int16_t* )gi->a + i*gi->rs_a + p*gi->cs_a, gi->rs_a, gi->cs_a,
+		                     MR, KR, scale_a, shift_a, ap, gi->ra );
+}
+
+// Pack a panel of B (as the transpose of an "A-like" operand) along with
+// the column offsets cb, which account for the zero point of A.
+static void bli_gemmi_packb
+     (
+       dim_t j, dim_t p, dim_t nc, dim_t kc, void* bp, void* extra, void* params
+     )
+{
+	gemmi_params_t* gi = params;
+	const dim_t     KR = bli_gemmi_kr( gi->type );
+	const dim_t     NR = bli_cntx_get_l3_gemmi_blksz( gi->type, BLIS_NR, gi->cntx );
+
+	const uint32_t  scale_b = -( uint32_t )gi->a_zp;
+
+	gi->cb = extra;
+
+	if ( gi->type == BLIS_GEMMI_U8S8S32 )
+		bli_gemmi_packm_s8( nc, kc,
+		                    ( int8_t* )gi->b + p*gi->rs_b + j*gi->cs_b, gi->cs_b, gi->rs_b,
+		                    NR, KR, scale_b, 0, bp, gi->cb );
+	else
+		bli_gemmi_packm_s16( nc, kc,
+		                     ( int16_t* )gi->b + p*gi->rs_b + j*gi->cs_b, gi->cs_b, gi->rs_b,
+		                     NR, KR, scale_b, 0, bp, gi->cb );
+}
+
+// Compute C := beta * C + alpha * ( A * B + ra * 1^T + 1 * cb^T ) for one
+// micro-tile.
+static void bli_gemmi_ukr
+     (
+       dim_t ic, dim_t jc, dim_t pc, dim_t i, dim_t j,
+       dim_t mr_cur, dim_t nr_cur, dim_t kc,
+       void* a1, void* b1, void* a2, void* b2, void* params
+     )
+{
+	gemmi_params_t* gi    = params;
+	const gemmi_t   type  = gi->type;
+	cntx_t*         cntx  = gi->cntx;
+
+	const dim_t     MR    = bli_cntx_get_l3_gemmi_blksz( type, BLIS_MR, cntx );
+	const dim_t     NR    = bli_cntx_get_l3_gemmi_blksz( type, BLIS_NR, cntx );
+	const dim_t     k_pad = bli_gemm_nest_roundup( kc, bli_gemmi_kr( type ) );
+
+	void_fp         ukr   = bli_cntx_get_l3_gemmi_ukr( type, cntx );
+
+	int32_t         one   = 1;
+	int32_t         zero  = 0;
+	int32_t*        beta  = ( pc == 0 ? &gi->beta : &one );
+	int32_t*        c11   = gi->c + ( ic + i )*gi->rs_c + ( jc + j )*gi->cs_c;
+	int32_t         ct[ BLIS_STACK_BUF_MAX_SIZE / sizeof( int32_t ) ]
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+	auxinfo_t       aux;
+
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux );
+	bli_auxinfo_set_next_a( a2, &aux );
+	bli_auxinfo_set_next_b( b2, &aux );
+
+	// Edge cases are computed into a temporary micro-tile.
+	const bool  full   = ( mr_cur == MR && nr_cur == NR );
+	int32_t*    beta_u = ( full ? beta : &zero );
+	int32_t*    c_u    = ( full ? c11  : ct );
+	const inc_t rs_u   = ( full ? gi->rs_c : NR );
+	const inc_t cs_u   = ( full ? gi->cs_c : 1 );
+
+	if ( type == BLIS_GEMMI_U8S8S32 )
+		( ( gemmi_u8s8s32_ukr_ft )ukr )
+		(
+		  k_pad, &gi->alpha,
+		  ( uint8_t* )a1, ( int8_t* )b1,
+		  beta_u, c_u, rs_u, cs_u,
+		  gi->ra + i, gi->cb + j,
+		  &aux, cntx
+		);
+	else
+		( ( gemmi_s16s16s32_ukr_ft )ukr )
+		(
+		  k_pad, &gi->alpha,
+		  ( int16_t* )a1, ( int16_t* )b1,
+		  beta_u, c_u, rs_u, cs_u,
+		  gi->ra + i, gi->cb + j,
+		  &aux, cntx
+		);
+
+	if ( !full )
+	{
+		const uint32_t beta_c = ( uint32_t )*beta;
+
+		for ( dim_t jj = 0; jj < nr_cur; ++jj )
+		for ( dim_t ii = 0; ii < mr_cur; ++ii )
+		{
+			int32_t* restrict cij = c11 + ii*gi->rs_c + jj*gi->cs_c;
+			uint32_t          tij = ( uint32_t )ct[ ii*NR + jj ];
+
+			if ( beta_c == 0 ) *cij = ( int32_t )tij;
+			else               *cij = ( int32_t )( beta_c * ( uint32_t )*cij + tij );
+		}
+	}
+}
+
+// Scale C by beta (for when alpha or k is zero).
+static void bli_gemmi_scalc
+     (
+       dim_t i0, dim_t j0, dim_t m, dim_t n, void* params
+     )
+{
+	gemmi_params_t* gi   = params;
+	const int32_t   beta = gi->beta;
+
+	for ( dim_t j = j0; j < j0 + n; ++j )
+	for ( dim_t i = i0; i < i0 + m; ++i )
+	{
+		int32_t* cij = gi->c + i*gi->rs_c + j*gi->cs_c;
+
+		if ( beta == 0 ) *cij = 0;
+		else             *cij = ( int32_t )( ( uint32_t )beta * ( uint32_t )*cij );
+	}
+}
+
+// Initialize an object that wraps an integer operand. The object is given
+// the BLIS_INT datatype, but its element size is that of the actual storage
+// type, and the zero point is stored in its internal scalar.
+static void bli_gemmi_obj_init
+     (
+       siz_t   elem_size,
+       dim_t   m,
+       dim_t   n,
+       void*   p, inc_t rs, inc_t cs,
+       int32_t zp,
+       obj_t*  obj
+     )
+{
+	bli_obj_init_finish( BLIS_INT, m, n, p, rs, cs, obj );
+	bli_obj_set_elem_size( elem_size, obj );
+
+	*( ( int32_t* )bli_obj_internal_scalar_buffer( obj ) ) = zp;
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype_a, ctype_b, opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       trans_t  transa, \
+       trans_t  transb, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       int32_t* alpha, \
+       ctype_a* a, inc_t rs_a, inc_t cs_a, int32_t a_zp, \
+       ctype_b* b, inc_t rs_b, inc_t cs_b, int32_t b_zp, \
+       int32_t* beta, \
+       int32_t* c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	PASTEMAC(opname,_ex) \
+	( \
+	  transa, transb, m, n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, a_zp, \
+	  b, rs_b, cs_b, b_zp, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, NULL \
+	); \
+} \
+\
+void PASTEMAC(opname,_ex) \
+     ( \
+       trans_t  transa, \
+       trans_t  transb, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       int32_t* alpha, \
+       ctype_a* a, inc_t rs_a, inc_t cs_a, int32_t a_zp, \
+       ctype_b* b, inc_t rs_b, inc_t cs_b, int32_t b_zp, \
+       int32_t* beta, \
+       int32_t* c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+\
+	dim_t       m_a, n_a; \
+	dim_t       m_b, n_b; \
+\
+	bli_set_dims_with_trans( transa, m, k, &m_a, &n_a ); \
+	bli_set_dims_with_trans( transb, k, n, &m_b, &n_b ); \
+\
+	bli_gemmi_obj_init( sizeof( int32_t ), 1,   1,   alpha, 1,    1,    0,    &alphao ); \
+	bli_gemmi_obj_init( sizeof( int32_t ), 1,   1,   beta,  1,    1,    0,    &betao  ); \
+	bli_gemmi_obj_init( sizeof( ctype_a ), m_a, n_a, a,     rs_a, cs_a, a_zp, &ao     ); \
+	bli_gemmi_obj_init( sizeof( ctype_b ), m_b, n_b, b,     rs_b, cs_b, b_zp, &bo     ); \
+	bli_gemmi_obj_init( sizeof( int32_t ), m,   n,   c,     rs_c, cs_c, 0,    &co     ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conjtrans( transb, &bo ); \
+\
+	bli_gemmi( &alphao, &ao, &bo, &betao, &co, cntx, rntm ); \
+}
+
+GENTFUNC( uint8_t, int8_t,  gemm_u8s8s32 )
+GENTFUNC( int16_t, int16_t, gemm_s16s16s32 )
+
+// -----------------------------------------------------------------------------
+
+void bli_gemmi
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemmi_check( alpha, a, b, beta, c );
+
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// If C has a zero dimension, return early.
+	if ( m == 0 || n == 0 ) return;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism. Only the total number of threads is
+	// used; each thread computes a disjoint block of C.
+	bli_rntm_set_ways_from_rntm_sup( m, n, k, rntm );
+
+	bli_l3_sup_thread_decorator
+	(
+	  bli_gemmi_int,
+	  BLIS_GEMM,
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+err_t bli_gemmi_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     )
+{
+	// The element size of A identifies the storage types of the operands.
+	const siz_t    es   = bli_obj_elem_size( a );
+	const gemmi_t  type = ( es == 1 ? BLIS_GEMMI_U8S8S32 : BLIS_GEMMI_S16S16S32 );
+
+	const dim_t    m    = bli_obj_length( c );
+	const dim_t    n    = bli_obj_width( c );
+	const dim_t    k    = bli_obj_width_after_trans( a );
+
+	gemmi_params_t gi;
+
+	gi.type  = type;
+	gi.a     = bli_obj_buffer_at_off( a );
+	gi.rs_a  = bli_obj_row_stride( a );
+	gi.cs_a  = bli_obj_col_stride( a );
+	gi.a_zp  = *( int32_t* )bli_obj_internal_scalar_buffer( a );
+	gi.b     = bli_obj_buffer_at_off( b );
+	gi.rs_b  = bli_obj_row_stride( b );
+	gi.cs_b  = bli_obj_col_stride( b );
+	gi.b_zp  = *( int32_t* )bli_obj_internal_scalar_buffer( b );
+	gi.c     = bli_obj_buffer_at_off( c );
+	gi.rs_c  = bli_obj_row_stride( c );
+	gi.cs_c  = bli_obj_col_stride( c );
+	gi.alpha = *( int32_t* )bli_obj_buffer( alpha );
+	gi.beta  = *( int32_t* )bli_obj_buffer( beta );
+	gi.ra    = NULL;
+	gi.cb    = NULL;
+	gi.cntx  = cntx;
+
+	// Absorb any transpositions of A and B into their strides.
+	if ( bli_obj_has_trans( a ) ) bli_swap_incs( &gi.rs_a, &gi.cs_a );
+	if ( bli_obj_has_trans( b ) ) bli_swap_incs( &gi.rs_b, &gi.cs_b );
+
+	const dim_t MR = bli_cntx_get_l3_gemmi_blksz( type, BLIS_MR, cntx );
+	const dim_t NR = bli_cntx_get_l3_gemmi_blksz( type, BLIS_NR, cntx );
+	const dim_t MC = bli_cntx_get_l3_gemmi_blksz( type, BLIS_MC, cntx );
+	const dim_t NC = bli_cntx_get_l3_gemmi_blksz( type, BLIS_NC, cntx );
+
+	// Each packed block is followed by the offset vector computed from the
+	// sums of its rows (A) or columns (B).
+	gemmnest_t nest;
+
+	nest.mr            = MR;
+	nest.nr            = NR;
+	nest.kr            = bli_gemmi_kr( type );
+	nest.mc            = MC;
+	nest.kc            = bli_cntx_get_l3_gemmi_blksz( type, BLIS_KC, cntx );
+	nest.nc            = NC;
+	nest.packmr        = MR;
+	nest.packnr        = NR;
+	nest.es_a          = es;
+	nest.es_b          = es;
+	nest.extra_a       = bli_gemm_nest_roundup( bli_min( MC, m ), MR ) * sizeof( int32_t );
+	nest.extra_b       = bli_gemm_nest_roundup( bli_min( NC, n ), NR ) * sizeof( int32_t );
+	nest.k_inner       = FALSE;
+	nest.alpha_is_zero = ( gi.alpha == 0 );
+	nest.packa         = bli_gemmi_packa;
+	nest.packb         = bli_gemmi_packb;
+	nest.ukr           = bli_gemmi_ukr;
+	nest.scalc         = bli_gemmi_scalc;
+	nest.params        = &gi;
+
+	bli_gemm_nest( m, n, k, &nest, rntm, thread );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemmi_check
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     )
+{
+	err_t e_val;
+
+	// Check scalar/vector/matrix type.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( c );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_level3_dims( a, b, c );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( c );
+	bli_check_error_code( e_val );
+}
+
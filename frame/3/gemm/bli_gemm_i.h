@@ -0,0 +1,155 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Integer gemm for quantized computation:
+//
+//   C := beta * C + alpha * ( A - a_zp ) * ( B - b_zp )
+//
+// where a_zp and b_zp are zero points (offsets) applied to every element of
+// A and B, respectively, and all products are accumulated in int32. Two
+// combinations of storage types are supported:
+//
+//   u8s8s32:   A is uint8_t, B is int8_t,  C is int32_t
+//   s16s16s32: A is int16_t, B is int16_t, C is int32_t
+//
+// The zero points are not subtracted from the elements themselves; instead,
+// the product of the stored values is corrected using the row sums of A and
+// the column sums of B, which are computed while A and B are packed. As with
+// the vpmaddubsw instruction on which the optimized u8s8s32 micro-kernels
+// are based, each pair of adjacent products of stored u8 and s8 values
+// along k is summed with saturation to int16 before being accumulated.
+// Saturation cannot occur when no element of A exceeds 127, so callers that
+// need exact results for every input should quantize A to 7 bits. All other
+// int32 arithmetic wraps modulo 2^32.
+//
+// Since the datatype field of obj_t has no room for these storage types,
+// only typed interfaces are provided. Internally, the operands are wrapped
+// in objects of type BLIS_INT whose element sizes identify the storage
+// types, with the zero point of A and B carried in the internal scalar of
+// each object.
+//
+
+BLIS_EXPORT_BLIS void bli_gemm_u8s8s32
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       int32_t* alpha,
+       uint8_t* a, inc_t rs_a, inc_t cs_a, int32_t a_zp,
+       int8_t*  b, inc_t rs_b, inc_t cs_b, int32_t b_zp,
+       int32_t* beta,
+       int32_t* c, inc_t rs_c, inc_t cs_c
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_u8s8s32_ex
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       int32_t* alpha,
+       uint8_t* a, inc_t rs_a, inc_t cs_a, int32_t a_zp,
+       int8_t*  b, inc_t rs_b, inc_t cs_b, int32_t b_zp,
+       int32_t* beta,
+       int32_t* c, inc_t rs_c, inc_t cs_c,
+       cntx_t*  cntx,
+       rntm_t*  rntm
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_s16s16s32
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       int32_t* alpha,
+       int16_t* a, inc_t rs_a, inc_t cs_a, int32_t a_zp,
+       int16_t* b, inc_t rs_b, inc_t cs_b, int32_t b_zp,
+       int32_t* beta,
+       int32_t* c, inc_t rs_c, inc_t cs_c
+     );
+
+BLIS_EXPORT_BLIS void bli_gemm_s16s16s32_ex
+     (
+       trans_t  transa,
+       trans_t  transb,
+       dim_t    m,
+       dim_t    n,
+       dim_t    k,
+       int32_t* alpha,
+       int16_t* a, inc_t rs_a, inc_t cs_a, int32_t a_zp,
+       int16_t* b, inc_t rs_b, inc_t cs_b, int32_t b_zp,
+       int32_t* beta,
+       int32_t* c, inc_t rs_c, inc_t cs_c,
+       cntx_t*  cntx,
+       rntm_t*  rntm
+     );
+
+void bli_gemmi
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+err_t bli_gemmi_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     );
+
+void bli_gemmi_check
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     );
+
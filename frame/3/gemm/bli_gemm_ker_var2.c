@@ -86,6 +86,27 @@ void bli_gemm_ker_var2
 	}
 #endif
 
+	// When C carries a list of submatrices, add the product to each of them
+	// with the multi-target micro-kernel (see bli_gemmstrassen()).
+	if ( bli_obj_has_terms( c ) )
+	{
+		bli_gemm_ker_var2_sum( a, b, c, cntx, rntm, cntl, thread );
+		return;
+	}
+
+	// When A or B carries a block map, pass only the ranges of k over which
+	// both micro-panels may be nonzero to the micro-kernel. This is limited
+	// to native execution with homogeneous datatypes; otherwise the zero
+	// blocks, which packm has zeroed, are simply computed with.
+	if ( ( bli_obj_is_block_sparse( a ) || bli_obj_is_block_sparse( b ) ) &&
+	     bli_cntx_method( cntx ) == BLIS_NAT &&
+	     bli_obj_dt( a ) == bli_obj_dt( c ) &&
+	     bli_obj_dt( b ) == bli_obj_dt( c ) )
+	{
+		bli_gemm_ker_var2_bs( a, b, c, cntx, rntm, cntl, thread );
+		return;
+	}
+
 	num_t     dt_exec   = bli_obj_exec_dt( c );
 
 	pack_t    schema_a  = bli_obj_pack_schema( a );
@@ -0,0 +1,318 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#define FUNCPTR_T gemm_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       pack_t      schema_a,
+       pack_t      schema_b,
+       dim_t       m,
+       dim_t       n,
+       dim_t       k,
+       void*       alpha,
+       void*       a, inc_t cs_a,
+                      dim_t pd_a, inc_t ps_a,
+       void*       b, inc_t rs_b,
+                      dim_t pd_b, inc_t ps_b,
+       sumterms_t* terms,
+       void*       c, inc_t rs_c, inc_t cs_c,
+       cntx_t*     cntx,
+       rntm_t*     rntm,
+       thrinfo_t*  thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes,gemm_ker_var2_sum);
+
+
+void bli_gemm_ker_var2_sum
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     )
+{
+	num_t       dt_exec   = bli_obj_exec_dt( c );
+
+	pack_t      schema_a  = bli_obj_pack_schema( a );
+	pack_t      schema_b  = bli_obj_pack_schema( b );
+
+	dim_t       m         = bli_obj_length( c );
+	dim_t       n         = bli_obj_width( c );
+	dim_t       k         = bli_obj_width( a );
+
+	void*       buf_a     = bli_obj_buffer_at_off( a );
+	inc_t       cs_a      = bli_obj_col_stride( a );
+	dim_t       pd_a      = bli_obj_panel_dim( a );
+	inc_t       ps_a      = bli_obj_panel_stride( a );
+
+	void*       buf_b     = bli_obj_buffer_at_off( b );
+	inc_t       rs_b      = bli_obj_row_stride( b );
+	dim_t       pd_b      = bli_obj_panel_dim( b );
+	inc_t       ps_b      = bli_obj_panel_stride( b );
+
+	sumterms_t* terms     = bli_obj_terms( c );
+
+	void*       buf_c     = bli_obj_buffer_at_off( c );
+	inc_t       rs_c      = bli_obj_row_stride( c );
+	inc_t       cs_c      = bli_obj_col_stride( c );
+
+	obj_t       scalar_a;
+	obj_t       scalar_b;
+
+	void*       buf_alpha;
+
+	FUNCPTR_T   f;
+
+	// The product is added to every submatrix in the list, so a beta other
+	// than one would be applied once per product rather than once overall.
+	// The caller is expected to scale C beforehand.
+	if ( dt_exec != bli_obj_dt( c ) ||
+	     !bli_obj_scalar_equals( c, &BLIS_ONE ) )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	// Detach and multiply the scalars attached to A and B.
+	bli_obj_scalar_detach( a, &scalar_a );
+	bli_obj_scalar_detach( b, &scalar_b );
+	bli_mulsc( &scalar_a, &scalar_b );
+
+	// Grab the address of the internal scalar buffer for the scalar
+	// merged above.
+	buf_alpha = bli_obj_internal_scalar_buffer( &scalar_b );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	f = ftypes[dt_exec];
+
+	// Invoke the function.
+	f( schema_a,
+	   schema_b,
+	   m,
+	   n,
+	   k,
+	   buf_alpha,
+	   buf_a, cs_a,
+	          pd_a, ps_a,
+	   buf_b, rs_b,
+	          pd_b, ps_b,
+	   terms,
+	   buf_c, rs_c, cs_c,
+	   cntx,
+	   rntm,
+	   thread );
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       pack_t      schema_a, \
+       pack_t      schema_b, \
+       dim_t       m, \
+       dim_t       n, \
+       dim_t       k, \
+       void*       alpha, \
+       void*       a, inc_t cs_a, \
+                      dim_t pd_a, inc_t ps_a, \
+       void*       b, inc_t rs_b, \
+                      dim_t pd_b, inc_t ps_b, \
+       sumterms_t* terms, \
+       void*       c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       thrinfo_t*  thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	/* Alias some constants to simpler names. */ \
+	const dim_t     MR         = pd_a; \
+	const dim_t     NR         = pd_b; \
+\
+	/* Query the context for the multi-target micro-kernel address and cast
+	   it to its function pointer type. */ \
+	PASTECH(ch,gemmsum_ukr_ft) \
+	                gemmsum_ukr = bli_cntx_get_l3_gemmsum_ukr_dt( dt, cntx ); \
+\
+	ctype* restrict a_cast     = a; \
+	ctype* restrict b_cast     = b; \
+	ctype* restrict c_cast     = c; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict b1; \
+	ctype* restrict c1; \
+\
+	const dim_t     nterm      = terms->n; \
+	ctype           alpha_t[ BLIS_MAX_SUM_TERMS ]; \
+	ctype*          c_t[ BLIS_MAX_SUM_TERMS ]; \
+\
+	dim_t           m_iter, m_left; \
+	dim_t           n_iter, n_left; \
+	dim_t           i, j; \
+	dim_t           m_cur; \
+	dim_t           n_cur; \
+	inc_t           rstep_a; \
+	inc_t           cstep_b; \
+	inc_t           rstep_c, cstep_c; \
+	auxinfo_t       aux; \
+\
+	( void )cs_a; ( void )rs_b; \
+\
+	/* If any dimension is zero, return immediately. */ \
+	if ( bli_zero_dim3( m, n, k ) ) return; \
+\
+	/* Fold alpha into the coefficient of each term. */ \
+	for ( dim_t t = 0; t < nterm; ++t ) \
+	{ \
+		PASTEMAC2(d,ch,copys)( terms->coef[ t ], alpha_t[ t ] ); \
+		PASTEMAC(ch,scals)( *alpha_cast, alpha_t[ t ] ); \
+	} \
+\
+	/* Compute number of primary and leftover components of the m and n
+	   dimensions. */ \
+	n_iter = n / NR; \
+	n_left = n % NR; \
+\
+	m_iter = m / MR; \
+	m_left = m % MR; \
+\
+	if ( n_left ) ++n_iter; \
+	if ( m_left ) ++m_iter; \
+\
+	/* Determine some increments used to step through A, B, and C. */ \
+	rstep_a = ps_a; \
+\
+	cstep_b = ps_b; \
+\
+	rstep_c = rs_c * MR; \
+	cstep_c = cs_c * NR; \
+\
+	/* Save the pack schemas of A and B to the auxinfo_t object. */ \
+	bli_auxinfo_set_schema_a( schema_a, &aux ); \
+	bli_auxinfo_set_schema_b( schema_b, &aux ); \
+\
+	/* The 'thread' argument points to the thrinfo_t node for the 2nd (jr)
+	   loop around the microkernel. Here we query the thrinfo_t node for the
+	   1st (ir) loop around the microkernel. */ \
+	thrinfo_t* caucus = bli_thrinfo_sub_node( thread ); \
+\
+	/* Query the number of threads and thread ids for each loop. */ \
+	dim_t jr_nt  = bli_thread_n_way( thread ); \
+	dim_t jr_tid = bli_thread_work_id( thread ); \
+	dim_t ir_nt  = bli_thread_n_way( caucus ); \
+	dim_t ir_tid = bli_thread_work_id( caucus ); \
+\
+	dim_t jr_start, jr_end; \
+	dim_t ir_start, ir_end; \
+	dim_t jr_inc,   ir_inc; \
+\
+	/* Determine the thread range and increment for the 2nd and 1st loops.
+	   NOTE: The definition of bli_thread_range_jrir() will depend on whether
+	   slab or round-robin partitioning was requested at configure-time. */ \
+	bli_thread_range_jrir( thread, n_iter, 1, FALSE, &jr_start, &jr_end, &jr_inc ); \
+	bli_thread_range_jrir( caucus, m_iter, 1, FALSE, &ir_start, &ir_end, &ir_inc ); \
+\
+	/* Loop over the n dimension (NR columns at a time). */ \
+	for ( j = jr_start; j < jr_end; j += jr_inc ) \
+	{ \
+		ctype* restrict a1; \
+		ctype* restrict c11; \
+		ctype* restrict b2; \
+\
+		b1 = b_cast + j * cstep_b; \
+		c1 = c_cast + j * cstep_c; \
+\
+		n_cur = ( bli_is_not_edge_f( j, n_iter, n_left ) ? NR : n_left ); \
+\
+		/* Initialize our next panel of B to be the current panel of B. */ \
+		b2 = b1; \
+\
+		/* Loop over the m dimension (MR rows at a time). */ \
+		for ( i = ir_start; i < ir_end; i += ir_inc ) \
+		{ \
+			ctype* restrict a2; \
+\
+			a1  = a_cast + i * rstep_a; \
+			c11 = c1     + i * rstep_c; \
+\
+			m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left ); \
+\
+			/* Compute the addresses of the next panels of A and B. */ \
+			a2 = bli_gemm_get_next_a_upanel( a1, rstep_a, ir_inc ); \
+			if ( bli_is_last_iter( i, ir_end, ir_tid, ir_nt ) ) \
+			{ \
+				a2 = a_cast; \
+				b2 = bli_gemm_get_next_b_upanel( b1, cstep_b, jr_inc ); \
+				if ( bli_is_last_iter( j, jr_end, jr_tid, jr_nt ) ) \
+					b2 = b_cast; \
+			} \
+\
+			/* Save addresses of next panels of A and B to the auxinfo_t
+			   object. */ \
+			bli_auxinfo_set_next_a( a2, &aux ); \
+			bli_auxinfo_set_next_b( b2, &aux ); \
+\
+			/* Locate the current micro-tile within each submatrix of C. */ \
+			for ( dim_t t = 0; t < nterm; ++t ) \
+				c_t[ t ] = c11 + terms->off[ t ]; \
+\
+			/* Invoke the multi-target micro-kernel, which handles edge
+			   cases itself. */ \
+			gemmsum_ukr \
+			( \
+			  m_cur, \
+			  n_cur, \
+			  k, \
+			  nterm, \
+			  alpha_t, \
+			  a1, \
+			  b1, \
+			  c_t, rs_c, cs_c, \
+			  &aux, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_ker_var2_sum )
+
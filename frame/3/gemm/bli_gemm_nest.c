@@ -0,0 +1,222 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Partition C among the threads along whichever dimension offers more
+// micro-tiles, in units of the micro-tile.
+static void bli_gemm_nest_part
+     (
+       dim_t      m,
+       dim_t      n,
+       dim_t      mr,
+       dim_t      nr,
+       thrinfo_t* thread,
+       dim_t*     m0,
+       dim_t*     m1,
+       dim_t*     n0,
+       dim_t*     n1
+     )
+{
+	const dim_t nt  = bli_thread_num_threads( thread );
+	const dim_t tid = bli_thread_ocomm_id( thread );
+
+	*m0 = 0; *m1 = m;
+	*n0 = 0; *n1 = n;
+
+	if ( nt == 1 ) return;
+
+	const bool  part_n = ( n / nr >= m / mr );
+	const dim_t bf     = ( part_n ? nr : mr );
+	const dim_t dim    = ( part_n ? n  : m  );
+	const dim_t n_blk  = ( dim + bf - 1 ) / bf;
+	const dim_t blk_t  = n_blk / nt;
+	const dim_t blk_lo = n_blk % nt;
+	const dim_t blk_s  = tid * blk_t + bli_min( tid, blk_lo );
+	const dim_t blk_e  = blk_s + blk_t + ( tid < blk_lo ? 1 : 0 );
+	const dim_t start  = bli_min( blk_s * bf, dim );
+	const dim_t end    = bli_min( blk_e * bf, dim );
+
+	if ( part_n ) { *n0 = start; *n1 = end; }
+	else          { *m0 = start; *m1 = end; }
+}
+
+// Iterate over the micro-tiles of one mc x nc block of C, given a packed
+// block of A and a packed panel of B.
+static void bli_gemm_nest_macro
+     (
+       dim_t       ic,
+       dim_t       jc,
+       dim_t       pc,
+       dim_t       mc,
+       dim_t       nc,
+       dim_t       kc,
+       char*       ap,
+       char*       bp,
+       gemmnest_t* nest
+     )
+{
+	const dim_t MR     = nest->mr;
+	const dim_t NR     = nest->nr;
+	const dim_t kc_pad = bli_gemm_nest_roundup( kc, nest->kr );
+	const inc_t ps_a   = nest->packmr * kc_pad * nest->es_a;
+	const inc_t ps_b   = nest->packnr * kc_pad * nest->es_b;
+
+	for ( dim_t j = 0; j < nc; j += NR )
+	{
+		const dim_t nr_cur = bli_min( NR, nc - j );
+		char*       b1     = bp + ( j / NR ) * ps_b;
+
+		for ( dim_t i = 0; i < mc; i += MR )
+		{
+			const dim_t mr_cur = bli_min( MR, mc - i );
+			char*       a1     = ap + ( i / MR ) * ps_a;
+
+			// Compute the addresses of the next micro-panels.
+			char*       a2     = ( i + MR < mc ? a1 + ps_a : ap );
+			char*       b2     = ( i + MR < mc ? b1 : b1 + ps_b );
+
+			nest->ukr( ic, jc, pc, i, j, mr_cur, nr_cur, kc,
+			           a1, b1, a2, b2, nest->params );
+		}
+	}
+}
+
+void bli_gemm_nest
+     (
+       dim_t       m,
+       dim_t       n,
+       dim_t       k,
+       gemmnest_t* nest,
+       rntm_t*     rntm,
+       thrinfo_t*  thread
+     )
+{
+	const dim_t MR = nest->mr;
+	const dim_t NR = nest->nr;
+	const dim_t MC = nest->mc;
+	const dim_t KC = nest->kc;
+	const dim_t NC = nest->nc;
+
+	dim_t m0, m1, n0, n1;
+
+	bli_gemm_nest_part( m, n, MR, NR, thread, &m0, &m1, &n0, &n1 );
+
+	if ( m1 <= m0 || n1 <= n0 ) return;
+
+	// If alpha or k is zero, we only need to scale C by beta.
+	if ( k == 0 || nest->alpha_is_zero )
+	{
+		nest->scalc( m0, n0, m1 - m0, n1 - n0, nest->params );
+		return;
+	}
+
+	// Size the packing buffers for the largest blocks that will be packed.
+	// Any extra data follows the packed micro-panels at an aligned offset.
+	const dim_t mc_max = bli_min( MC, m1 - m0 );
+	const dim_t nc_max = bli_min( NC, n1 - n0 );
+	const dim_t kc_max = bli_gemm_nest_roundup( bli_min( KC, k ), nest->kr );
+	const siz_t off_ap = bli_gemm_nest_roundup
+	(
+	  ( ( mc_max + MR - 1 ) / MR ) * nest->packmr * kc_max * nest->es_a,
+	  BLIS_SIMD_ALIGN_SIZE
+	);
+	const siz_t off_bp = bli_gemm_nest_roundup
+	(
+	  ( ( nc_max + NR - 1 ) / NR ) * nest->packnr * kc_max * nest->es_b,
+	  BLIS_SIMD_ALIGN_SIZE
+	);
+	mem_t       mem_a, mem_b;
+
+	bli_membrk_acquire_m( rntm, off_ap + nest->extra_a,
+	                      BLIS_BUFFER_FOR_A_BLOCK, &mem_a );
+	bli_membrk_acquire_m( rntm, off_bp + nest->extra_b,
+	                      BLIS_BUFFER_FOR_B_PANEL, &mem_b );
+
+	char* ap = bli_mem_buffer( &mem_a );
+	char* bp = bli_mem_buffer( &mem_b );
+	void* xa = ap + off_ap;
+	void* xb = bp + off_bp;
+
+	for ( dim_t jc = n0; jc < n1; jc += NC )
+	{
+		const dim_t nc_cur = bli_min( NC, n1 - jc );
+
+		if ( !nest->k_inner )
+		{
+			for ( dim_t pc = 0; pc < k; pc += KC )
+			{
+				const dim_t kc_cur = bli_min( KC, k - pc );
+
+				nest->packb( jc, pc, nc_cur, kc_cur, bp, xb, nest->params );
+
+				for ( dim_t ic = m0; ic < m1; ic += MC )
+				{
+					const dim_t mc_cur = bli_min( MC, m1 - ic );
+
+					nest->packa( ic, pc, mc_cur, kc_cur, ap, xa, nest->params );
+
+					bli_gemm_nest_macro( ic, jc, pc, mc_cur, nc_cur, kc_cur,
+					                     ap, bp, nest );
+				}
+			}
+		}
+		else
+		{
+			for ( dim_t ic = m0; ic < m1; ic += MC )
+			{
+				const dim_t mc_cur = bli_min( MC, m1 - ic );
+
+				for ( dim_t pc = 0; pc < k; pc += KC )
+				{
+					const dim_t kc_cur = bli_min( KC, k - pc );
+
+					// The packed panel of B may be reused across blocks of A
+					// only if it spans all of k.
+					if ( ic == m0 || k > KC )
+						nest->packb( jc, pc, nc_cur, kc_cur, bp, xb, nest->params );
+
+					nest->packa( ic, pc, mc_cur, kc_cur, ap, xa, nest->params );
+
+					bli_gemm_nest_macro( ic, jc, pc, mc_cur, nc_cur, kc_cur,
+					                     ap, bp, nest );
+				}
+			}
+		}
+	}
+
+	bli_membrk_release( rntm, &mem_a );
+	bli_membrk_release( rntm, &mem_b );
+}
+
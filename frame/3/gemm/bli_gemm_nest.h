@@ -0,0 +1,134 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// A blocked loop nest for gemm operations whose operands cannot be expressed
+// as objects of a floating-point datatype (and thus cannot be handled by the
+// control tree, which queries blocksizes and packm kernels by datatype). The
+// nest owns the partitioning of C among threads, the alpha == 0 / k == 0
+// early-out, the packing buffers, and the five loops around the micro-kernel.
+// The caller supplies callbacks that pack a block of A or a panel of B into
+// micro-panels, compute one micro-tile of C, and scale a block of C by beta.
+//
+
+// Pack the mn x kc submatrix of A (or the transpose of the kc x mn submatrix
+// of B) at offset (i,p) (or (p,i)) into micro-panels at buf. Each packed
+// block may be followed by extra_a (or extra_b) bytes of data at extra.
+typedef void (*gemmnest_pack_ft)
+     (
+       dim_t  i,
+       dim_t  p,
+       dim_t  mn,
+       dim_t  kc,
+       void*  buf,
+       void*  extra,
+       void*  params
+     );
+
+// Compute the mr_cur x nr_cur micro-tile at offset (i,j) within the block of
+// C at offset (ic,jc), given the micro-panels a1 and b1 for the k block at
+// offset pc, and the micro-panels a2 and b2 that will be used next.
+typedef void (*gemmnest_ukr_ft)
+     (
+       dim_t  ic,
+       dim_t  jc,
+       dim_t  pc,
+       dim_t  i,
+       dim_t  j,
+       dim_t  mr_cur,
+       dim_t  nr_cur,
+       dim_t  kc_cur,
+       void*  a1,
+       void*  b1,
+       void*  a2,
+       void*  b2,
+       void*  params
+     );
+
+// Scale the m x n submatrix of C at offset (i,j) by beta.
+typedef void (*gemmnest_scalc_ft)
+     (
+       dim_t  i,
+       dim_t  j,
+       dim_t  m,
+       dim_t  n,
+       void*  params
+     );
+
+typedef struct gemmnest_s
+{
+	// Register and cache blocksizes. Each block of k is zero-padded to a
+	// multiple of kr when packed.
+	dim_t             mr, nr, kr;
+	dim_t             mc, kc, nc;
+
+	// The leading dimensions and element sizes of the packed micro-panels.
+	dim_t             packmr, packnr;
+	siz_t             es_a, es_b;
+
+	// The number of bytes reserved after each packed block of A and panel
+	// of B (at an aligned offset) for use by the packing callbacks.
+	siz_t             extra_a, extra_b;
+
+	// If TRUE, each block of C is accumulated over all of k before the next
+	// block of A is packed, i.e., the ic loop is outside of the pc loop.
+	bool              k_inner;
+
+	// If TRUE, C is only scaled by beta.
+	bool              alpha_is_zero;
+
+	gemmnest_pack_ft  packa;
+	gemmnest_pack_ft  packb;
+	gemmnest_ukr_ft   ukr;
+	gemmnest_scalc_ft scalc;
+
+	void*             params;
+} gemmnest_t;
+
+// Round x up to a multiple of y.
+BLIS_INLINE dim_t bli_gemm_nest_roundup( dim_t x, dim_t y )
+{
+	return ( ( x + y - 1 ) / y ) * y;
+}
+
+void bli_gemm_nest
+     (
+       dim_t       m,
+       dim_t       n,
+       dim_t       k,
+       gemmnest_t* nest,
+       rntm_t*     rntm,
+       thrinfo_t*  thread
+     );
+
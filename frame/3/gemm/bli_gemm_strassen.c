@@ -0,0 +1,362 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// The coefficients of one level of Strassen's algorithm. Row p of each
+// table holds the coefficients with which the quadrants of A (U), B (V),
+// and C (W) take part in product M_p, with quadrant q located at block
+// row q / 2 and block column q % 2:
+//
+//   M0 = ( A00 + A11 )( B00 + B11 );  C00 += M0;  C11 += M0;
+//   M1 = ( A10 + A11 )  B00;          C10 += M1;  C11 -= M1;
+//   M2 =   A00        ( B01 - B11 );  C01 += M2;  C11 += M2;
+//   M3 =   A11        ( B10 - B00 );  C00 += M3;  C10 += M3;
+//   M4 = ( A00 + A01 )  B11;          C00 -= M4;  C01 += M4;
+//   M5 = ( A10 - A00 )( B00 + B01 );  C11 += M5;
+//   M6 = ( A01 - A11 )( B10 + B11 );  C00 += M6;
+//
+
+static const int bli_strassen_u[ 7 ][ 4 ] =
+{
+	{  1,  0,  0,  1 },
+	{  0,  0,  1,  1 },
+	{  1,  0,  0,  0 },
+	{  0,  0,  0,  1 },
+	{  1,  1,  0,  0 },
+	{ -1,  0,  1,  0 },
+	{  0,  1,  0, -1 },
+};
+
+static const int bli_strassen_v[ 7 ][ 4 ] =
+{
+	{  1,  0,  0,  1 },
+	{  1,  0,  0,  0 },
+	{  0,  1,  0, -1 },
+	{ -1,  0,  1,  0 },
+	{  0,  0,  0,  1 },
+	{  1,  1,  0,  0 },
+	{  0,  0,  1,  1 },
+};
+
+static const int bli_strassen_w[ 7 ][ 4 ] =
+{
+	{  1,  0,  0,  1 },
+	{  0,  0,  1, -1 },
+	{  0,  1,  0,  1 },
+	{  1,  0,  1,  0 },
+	{ -1,  1,  0,  0 },
+	{  0,  0,  0,  1 },
+	{  1,  0,  0,  0 },
+};
+
+// Find the submatrices (out of a 2^levels x 2^levels partitioning) that
+// take part in product p, along with their coefficients. With more than
+// one level, the tables are applied recursively: each base-7 digit of p
+// selects a product at one level, and each base-4 digit of the submatrix
+// index selects a quadrant at the same level.
+static dim_t bli_gemmstrassen_terms
+     (
+       dim_t     levels,
+       dim_t     p,
+       const int tab[ 7 ][ 4 ],
+       dim_t*    ri,
+       dim_t*    ci,
+       int*      coef
+     )
+{
+	const dim_t nq = ( dim_t )1 << ( 2 * levels );
+	dim_t       nt = 0;
+
+	for ( dim_t q = 0; q < nq; ++q )
+	{
+		int   s  = 1;
+		dim_t r  = 0;
+		dim_t c  = 0;
+		dim_t pl = p;
+		dim_t ql = q;
+
+		for ( dim_t l = 0; l < levels; ++l )
+		{
+			s  *= tab[ pl % 7 ][ ql % 4 ];
+			r  += ( ( ql % 4 ) / 2 ) << l;
+			c  += ( ( ql % 4 ) % 2 ) << l;
+			pl /= 7;
+			ql /= 4;
+		}
+
+		if ( s != 0 )
+		{
+			ri[ nt ]   = r;
+			ci[ nt ]   = c;
+			coef[ nt ] = s;
+			++nt;
+		}
+	}
+
+	return nt;
+}
+
+//
+// Set up one operand of a Strassen product. The operand is the sum of the
+// nt submatrices (of size mb x nb) at block row ri[t] and block column ci[t]
+// of x, weighted by coef[t]. The first submatrix is aliased by xp, and the
+// rest are described by the term list attached to xp, which causes packm
+// to form the sum (or, for C, the macro-kernel to update each submatrix).
+// A lone term needs no list; its coefficient is folded into *scale.
+//
+
+static void bli_gemmstrassen_operand
+     (
+       obj_t*      x,
+       dim_t       mb,
+       dim_t       nb,
+       dim_t       nt,
+       dim_t*      ri,
+       dim_t*      ci,
+       int*        coef,
+       obj_t*      xp,
+       sumterms_t* terms,
+       double*     scale
+     )
+{
+	const inc_t rs_x = bli_obj_row_stride( x );
+	const inc_t cs_x = bli_obj_col_stride( x );
+
+	bli_acquire_mpart( ri[ 0 ]*mb, ci[ 0 ]*nb, mb, nb, x, xp );
+
+	if ( nt == 1 )
+	{
+		*scale *= coef[ 0 ];
+		return;
+	}
+
+	terms->n = nt;
+
+	for ( dim_t t = 0; t < nt; ++t )
+	{
+		terms->off[ t ]  = ( ri[ t ] - ri[ 0 ] )*mb*rs_x +
+		                   ( ci[ t ] - ci[ 0 ] )*nb*cs_x;
+		terms->coef[ t ] = coef[ t ];
+	}
+
+	bli_obj_set_terms( terms, xp );
+}
+
+// -----------------------------------------------------------------------------
+
+err_t bli_gemmstrassen
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	obj_t a_local;
+	obj_t b_local;
+	obj_t c_local;
+
+	const num_t dt = bli_obj_dt( c );
+
+	// Only real, homogeneous-datatype problems are handled here.
+	if ( !( bli_is_float( dt ) || bli_is_double( dt ) ) ||
+	     bli_obj_dt( a ) != dt ||
+	     bli_obj_dt( b ) != dt ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	// Let conventional gemm handle trivial problems.
+	if ( bli_obj_has_zero_dim( c ) ||
+	     bli_obj_width_after_trans( a ) == 0 ||
+	     bli_obj_equals( alpha, &BLIS_ZERO ) ) return BLIS_FAILURE;
+
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// Apply no more levels than are supported, and no more than the
+	// smallest dimension allows.
+	dim_t levels = bli_min( bli_rntm_strassen_levels( rntm ),
+	                        BLIS_STRASSEN_MAX_LEVELS );
+
+	while ( levels > 0 &&
+	        ( m >> levels == 0 || n >> levels == 0 || k >> levels == 0 ) )
+		--levels;
+
+	if ( levels <= 0 ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_check( alpha, a, b, beta, c, cntx );
+
+	// Alias A, B, and C and apply any transpositions explicitly so that
+	// only the strides need to be consulted below.
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_alias_to( c, &c_local );
+
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+	if ( bli_obj_has_trans( &b_local ) )
+	{
+		bli_obj_induce_trans( &b_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &b_local );
+	}
+
+	const dim_t m_c = bli_obj_length( &c_local );
+	const dim_t n_c = bli_obj_width( &c_local );
+
+	// Peel off the rows, columns, and (inner) dimension that do not divide
+	// evenly into 2^levels submatrices, which are handled by conventional
+	// gemm.
+	const dim_t m_s = ( m_c >> levels ) << levels;
+	const dim_t n_s = ( n_c >> levels ) << levels;
+	const dim_t k_s = ( k   >> levels ) << levels;
+
+	// The dimensions of each submatrix.
+	const dim_t mb  = m_s >> levels;
+	const dim_t nb  = n_s >> levels;
+	const dim_t kb  = k_s >> levels;
+
+	// Initialize a local runtime for the individual products and the
+	// conventional parts, neither of which may recurse back into this
+	// function.
+	rntm_t rntm_c = *rntm;
+
+	bli_rntm_set_strassen_levels( 0, &rntm_c );
+
+	obj_t a_s, b_s, c_s;
+	obj_t a_f, b_f, c_f;
+
+	bli_acquire_mpart( 0, 0, m_s, k_s, &a_local, &a_s );
+	bli_acquire_mpart( 0, 0, k_s, n_s, &b_local, &b_s );
+	bli_acquire_mpart( 0, 0, m_s, n_s, &c_local, &c_s );
+
+	// Every product is accumulated into C, so apply beta up front.
+	if ( !bli_obj_equals( beta, &BLIS_ONE ) )
+		bli_scalm_ex( beta, &c_s, cntx, &rntm_c );
+
+	double alpha_r, alpha_i;
+
+	bli_getsc( alpha, &alpha_r, &alpha_i );
+
+	// Compute each product with the conventional (blocked) gemm. Operands
+	// that are sums of submatrices carry a term list, so the sums of
+	// submatrices of A and B are formed by packm and the macro-kernel
+	// updates every submatrix of C that the product contributes to as each
+	// micro-tile is computed. Each thread updates the same region of every
+	// submatrix of C, so the threads never write to the same elements.
+	dim_t n_prod = 1;
+
+	for ( dim_t l = 0; l < levels; ++l ) n_prod *= 7;
+
+	for ( dim_t p = 0; p < n_prod; ++p )
+	{
+		dim_t      ri[ BLIS_MAX_SUM_TERMS ];
+		dim_t      ci[ BLIS_MAX_SUM_TERMS ];
+		int        coef[ BLIS_MAX_SUM_TERMS ];
+		sumterms_t terms_a, terms_b, terms_c;
+		obj_t      a_p, b_p, c_p;
+		obj_t      alpha_p;
+		double     scale = 1.0;
+		dim_t      nt;
+
+		nt = bli_gemmstrassen_terms( levels, p, bli_strassen_u, ri, ci, coef );
+		bli_gemmstrassen_operand( &a_s, mb, kb, nt, ri, ci, coef,
+		                          &a_p, &terms_a, &scale );
+
+		nt = bli_gemmstrassen_terms( levels, p, bli_strassen_v, ri, ci, coef );
+		bli_gemmstrassen_operand( &b_s, kb, nb, nt, ri, ci, coef,
+		                          &b_p, &terms_b, &scale );
+
+		nt = bli_gemmstrassen_terms( levels, p, bli_strassen_w, ri, ci, coef );
+		bli_gemmstrassen_operand( &c_s, mb, nb, nt, ri, ci, coef,
+		                          &c_p, &terms_c, &scale );
+
+		bli_obj_scalar_init_detached( dt, &alpha_p );
+		bli_setsc( scale * alpha_r, 0.0, &alpha_p );
+
+		// bli_gemm_front() may modify the rntm_t, so give each product
+		// its own copy.
+		rntm_t rntm_p = rntm_c;
+
+		bli_gemm_front
+		(
+		  &alpha_p, &a_p, &b_p, &BLIS_ONE, &c_p, cntx, &rntm_p, NULL
+		);
+	}
+
+	// C(0:m_s,0:n_s) += alpha * A(0:m_s,k_s:k) * B(k_s:k,0:n_s)
+	if ( k_s < k )
+	{
+		bli_acquire_mpart( 0,   k_s, m_s, k - k_s, &a_local, &a_f );
+		bli_acquire_mpart( k_s, 0,   k - k_s, n_s, &b_local, &b_f );
+
+		bli_gemm_ex( alpha, &a_f, &b_f, &BLIS_ONE, &c_s, cntx, &rntm_c );
+	}
+
+	// C(m_s:m,0:n) := beta * C(m_s:m,0:n) + alpha * A(m_s:m,0:k) * B
+	if ( m_s < m_c )
+	{
+		bli_acquire_mpart( m_s, 0, m_c - m_s, k,   &a_local, &a_f );
+		bli_acquire_mpart( m_s, 0, m_c - m_s, n_c, &c_local, &c_f );
+
+		bli_gemm_ex( alpha, &a_f, &b_local, beta, &c_f, cntx, &rntm_c );
+	}
+
+	// C(0:m_s,n_s:n) := beta * C(0:m_s,n_s:n) + alpha * A(0:m_s,0:k) * B(0:k,n_s:n)
+	if ( n_s < n_c )
+	{
+		bli_acquire_mpart( 0, 0,   m_s, k,         &a_local, &a_f );
+		bli_acquire_mpart( 0, n_s, k,   n_c - n_s, &b_local, &b_f );
+		bli_acquire_mpart( 0, n_s, m_s, n_c - n_s, &c_local, &c_f );
+
+		bli_gemm_ex( alpha, &a_f, &b_f, beta, &c_f, cntx, &rntm_c );
+	}
+
+	return BLIS_SUCCESS;
+}
+
@@ -0,0 +1,233 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Define the tiny gemm kernels. Each kernel computes
+//
+//   C := beta * C + alpha * A * B
+//
+// where C is dim x n, A is dim x k, and B is k x n. The row count dim is a
+// compile-time constant while n and k are bounded by BLIS_GEMM_TINY_MAX, so
+// the innermost loop has a fixed trip count and the accumulator tile has a
+// fixed size. The kernels accumulate A*B into that local tile before
+// updating C, and they overwrite C (rather than scale it) when beta is zero.
+// Unit row stride in A is special-cased so that the innermost loop can be
+// vectorized.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, dim, suf ) \
+\
+static void PASTEMAC2(ch,opname,suf) \
+     ( \
+       dim_t           n, \
+       dim_t           k, \
+       ctype* restrict alpha, \
+       ctype* restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype* restrict b, inc_t rs_b, inc_t cs_b, \
+       ctype* restrict beta, \
+       ctype* restrict c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	ctype ab[ dim * BLIS_GEMM_TINY_MAX ]; \
+\
+	for ( dim_t i = 0; i < dim * n; ++i ) \
+		PASTEMAC(ch,set0s)( ab[ i ] ); \
+\
+	if ( rs_a == 1 ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t p = 0; p < k; ++p ) \
+		{ \
+			const ctype bpj = *( b + p*rs_b + j*cs_b ); \
+\
+			for ( dim_t i = 0; i < dim; ++i ) \
+				PASTEMAC(ch,axpys)( *( a + i + p*cs_a ), bpj, ab[ i + j*dim ] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t p = 0; p < k; ++p ) \
+		{ \
+			const ctype bpj = *( b + p*rs_b + j*cs_b ); \
+\
+			for ( dim_t i = 0; i < dim; ++i ) \
+				PASTEMAC(ch,axpys)( *( a + i*rs_a + p*cs_a ), bpj, ab[ i + j*dim ] ); \
+		} \
+	} \
+\
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < dim; ++i ) \
+			PASTEMAC(ch,scal2s)( *alpha, ab[ i + j*dim ], \
+			                     *( c + i*rs_c + j*cs_c ) ); \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < dim; ++i ) \
+		{ \
+			PASTEMAC(ch,scals)( *beta, *( c + i*rs_c + j*cs_c ) ); \
+			PASTEMAC(ch,axpys)( *alpha, ab[ i + j*dim ], \
+			                    *( c + i*rs_c + j*cs_c ) ); \
+		} \
+	} \
+}
+
+#define INSERT_GENTFUNC_TINY( opname, dim, suf ) \
+\
+GENTFUNC( float,    s, opname, dim, suf ) \
+GENTFUNC( double,   d, opname, dim, suf ) \
+GENTFUNC( scomplex, c, opname, dim, suf ) \
+GENTFUNC( dcomplex, z, opname, dim, suf )
+
+INSERT_GENTFUNC_TINY( gemm_tiny,  2, _m2 )
+INSERT_GENTFUNC_TINY( gemm_tiny,  3, _m3 )
+INSERT_GENTFUNC_TINY( gemm_tiny,  4, _m4 )
+INSERT_GENTFUNC_TINY( gemm_tiny,  5, _m5 )
+INSERT_GENTFUNC_TINY( gemm_tiny,  6, _m6 )
+INSERT_GENTFUNC_TINY( gemm_tiny,  7, _m7 )
+INSERT_GENTFUNC_TINY( gemm_tiny,  8, _m8 )
+INSERT_GENTFUNC_TINY( gemm_tiny,  9, _m9 )
+INSERT_GENTFUNC_TINY( gemm_tiny, 10, _m10 )
+INSERT_GENTFUNC_TINY( gemm_tiny, 11, _m11 )
+INSERT_GENTFUNC_TINY( gemm_tiny, 12, _m12 )
+INSERT_GENTFUNC_TINY( gemm_tiny, 13, _m13 )
+INSERT_GENTFUNC_TINY( gemm_tiny, 14, _m14 )
+INSERT_GENTFUNC_TINY( gemm_tiny, 15, _m15 )
+INSERT_GENTFUNC_TINY( gemm_tiny, 16, _m16 )
+
+
+//
+// Define the tiny gemm dispatcher, which indexes into a table of the kernels
+// above by the number of rows of C.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+typedef void (*PASTECH2(ch,opname,_ker_ft)) \
+     ( \
+       dim_t           n, \
+       dim_t           k, \
+       ctype* restrict alpha, \
+       ctype* restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype* restrict b, inc_t rs_b, inc_t cs_b, \
+       ctype* restrict beta, \
+       ctype* restrict c, inc_t rs_c, inc_t cs_c  \
+     ); \
+\
+static PASTECH2(ch,opname,_ker_ft) const PASTECH2(ch,opname,_kers)[ BLIS_GEMM_TINY_MAX + 1 ] = \
+{ \
+	NULL,                    NULL, \
+	PASTEMAC2(ch,opname,_m2),  PASTEMAC2(ch,opname,_m3), \
+	PASTEMAC2(ch,opname,_m4),  PASTEMAC2(ch,opname,_m5), \
+	PASTEMAC2(ch,opname,_m6),  PASTEMAC2(ch,opname,_m7), \
+	PASTEMAC2(ch,opname,_m8),  PASTEMAC2(ch,opname,_m9), \
+	PASTEMAC2(ch,opname,_m10), PASTEMAC2(ch,opname,_m11), \
+	PASTEMAC2(ch,opname,_m12), PASTEMAC2(ch,opname,_m13), \
+	PASTEMAC2(ch,opname,_m14), PASTEMAC2(ch,opname,_m15), \
+	PASTEMAC2(ch,opname,_m16) \
+}; \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Only problems that fit within the generated kernels are handled. */ \
+	if ( m < BLIS_GEMM_TINY_MIN || BLIS_GEMM_TINY_MAX < m ) return BLIS_FAILURE; \
+	if ( n < BLIS_GEMM_TINY_MIN || BLIS_GEMM_TINY_MAX < n ) return BLIS_FAILURE; \
+	if ( k < 0                  || BLIS_GEMM_TINY_MAX < k ) return BLIS_FAILURE; \
+\
+	/* If alpha is zero or k is zero, then A and B do not contribute, and
+	   we scale C by beta without ever reading A or B. As with the kernels
+	   above, C is overwritten (rather than scaled) when beta is zero. */ \
+	if ( k == 0 || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		if ( PASTEMAC(ch,eq0)( *beta ) ) \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				PASTEMAC(ch,set0s)( *( c + i*rs_c + j*cs_c ) ); \
+		} \
+		else if ( !PASTEMAC(ch,eq1)( *beta ) ) \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				PASTEMAC(ch,scals)( *beta, *( c + i*rs_c + j*cs_c ) ); \
+		} \
+\
+		return BLIS_SUCCESS; \
+	} \
+\
+	/* The kernels do not support conjugation. */ \
+	if ( bli_is_complex( dt ) && \
+	     ( bli_does_conj( transa ) || bli_does_conj( transb ) ) ) \
+		return BLIS_FAILURE; \
+\
+	/* Induce transposition by swapping strides. */ \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	PASTECH2(ch,opname,_kers)[ m ] \
+	( \
+	  n, k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c  \
+	); \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_tiny )
+
@@ -0,0 +1,81 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+//
+// Tiny gemm: specialized kernels for small problems.
+//
+// For each row count M (BLIS_GEMM_TINY_MIN <= M <= BLIS_GEMM_TINY_MAX), a
+// kernel with m = M fixed at compile time is generated from a macro
+// template. The kernel accepts any n in the same range and any k up to
+// BLIS_GEMM_TINY_MAX, so its innermost loop has a constant trip count and
+// its accumulator tile has a constant size. When alpha or k is zero, C is
+// scaled by beta without reading A or B. The dispatcher below returns
+// BLIS_FAILURE for any problem outside these bounds so that the caller can
+// fall back to the sup or conventional code paths.
+//
+
+#define BLIS_GEMM_TINY_MIN  2
+#define BLIS_GEMM_TINY_MAX 16
+
+// Query whether the tiny gemm path was enabled at compile time. (This is a
+// function rather than a bare #ifdef so that it may be used from within
+// macro-generated code.)
+BLIS_INLINE bool bli_gemm_tiny_is_enabled( void )
+{
+#ifdef BLIS_ENABLE_TINY_GEMM
+	return TRUE;
+#else
+	return FALSE;
+#endif
+}
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_tiny )
+
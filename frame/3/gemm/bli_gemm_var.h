@@ -61,6 +61,8 @@ GENPROT( gemm_packb )
 GENPROT( gemm_ker_var1 )
 
 GENPROT( gemm_ker_var2 )
+GENPROT( gemm_ker_var2_sum )
+GENPROT( gemm_ker_var2_bs )
 
 // Headers for induced algorithms:
 GENPROT( gemm4mb_ker_var2 ) // 4m1b
@@ -97,3 +99,53 @@ INSERT_GENTPROT_BASIC0( gemm_ker_var2 )
 // Headers for induced algorithms:
 INSERT_GENTPROT_BASIC0( gemm4mb_ker_var2 ) // 4m1b
 
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       pack_t      schema_a, \
+       pack_t      schema_b, \
+       dim_t       m, \
+       dim_t       n, \
+       dim_t       k, \
+       void*       alpha, \
+       void*       a, inc_t cs_a, \
+                      dim_t pd_a, inc_t ps_a, \
+       void*       b, inc_t rs_b, \
+                      dim_t pd_b, inc_t ps_b, \
+       sumterms_t* terms, \
+       void*       c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*     cntx, \
+       rntm_t*     rntm, \
+       thrinfo_t*  thread  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_ker_var2_sum )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       pack_t    schema_a, \
+       pack_t    schema_b, \
+       dim_t     m, \
+       dim_t     n, \
+       dim_t     k, \
+       void*     alpha, \
+       void*     a, inc_t cs_a, \
+                    dim_t pd_a, inc_t ps_a, \
+       blkmap_t* map_a, bool trans_a, dim_t offm_a, dim_t offk_a, \
+       void*     b, inc_t rs_b, \
+                    dim_t pd_b, inc_t ps_b, \
+       blkmap_t* map_b, bool trans_b, dim_t offn_b, dim_t offk_b, \
+       void*     beta, \
+       void*     c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*   cntx, \
+       rntm_t*   rntm, \
+       thrinfo_t* thread  \
+     );
+
+INSERT_GENTPROT_BASIC0( gemm_ker_var2_bs )
+
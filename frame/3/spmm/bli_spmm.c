@@ -0,0 +1,464 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#define FUNCPTR_T spmm_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       dim_t      m,
+       dim_t      n,
+       dim_t      k,
+       void*      alpha,
+       gint_t*    row_ptr,
+       gint_t*    col_ind,
+       void*      val,
+       void*      b, inc_t rs_b, inc_t cs_b,
+       void*      beta,
+       void*      c, inc_t rs_c, inc_t cs_c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     );
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t      m, \
+       dim_t      n, \
+       dim_t      k, \
+       void*      alpha, \
+       gint_t*    row_ptr, \
+       gint_t*    col_ind, \
+       void*      val, \
+       void*      b, inc_t rs_b, inc_t cs_b, \
+       void*      beta, \
+       void*      c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     );
+
+INSERT_GENTPROT_BASIC0( spmm_thr )
+
+static FUNCPTR_T GENARRAY(ftypes,spmm_thr);
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype*   alpha, \
+       gint_t*  row_ptr, \
+       gint_t*  col_ind, \
+       ctype*   val, \
+       ctype*   b, inc_t rs_b, inc_t cs_b, \
+       ctype*   beta, \
+       ctype*   c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	PASTEMAC2(ch,opname,_ex) \
+	( \
+	  m, n, k, \
+	  alpha, \
+	  row_ptr, col_ind, val, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  NULL, NULL \
+	); \
+} \
+\
+void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype*   alpha, \
+       gint_t*  row_ptr, \
+       gint_t*  col_ind, \
+       ctype*   val, \
+       ctype*   b, inc_t rs_b, inc_t cs_b, \
+       ctype*   beta, \
+       ctype*   c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt     = PASTEMAC(ch,type); \
+\
+	csr_t       csr    = { row_ptr, col_ind, val }; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       bo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       co     = BLIS_OBJECT_INITIALIZER; \
+\
+	bli_obj_init_finish_1x1( dt, alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, beta,  &betao  ); \
+\
+	/* The strides of A are never used; only its buffer (the csr_t) and
+	   dimensions are. */ \
+	bli_obj_init_finish( dt, m, k, &csr, 1, m, &ao ); \
+	bli_obj_init_finish( dt, k, n, b, rs_b, cs_b, &bo ); \
+	bli_obj_init_finish( dt, m, n, c, rs_c, cs_c, &co ); \
+\
+	bli_spmm( &alphao, &ao, &bo, &betao, &co, cntx, rntm ); \
+}
+
+INSERT_GENTFUNC_BASIC0( spmm )
+
+// -----------------------------------------------------------------------------
+
+void bli_spmm
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	bli_init_once();
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_spmm_check( alpha, a, b, beta, c );
+
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width( a );
+
+	// If C has a zero dimension, return early.
+	if ( m == 0 || n == 0 ) return;
+
+	// If alpha is zero or A has no columns, scale C by beta and return.
+	// (Within an SPMD team, only thread 0 scales C.)
+	if ( k == 0 || bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		if ( bli_rntm_spmd_am_chief( rntm ) ) bli_scalm( beta, c );
+		bli_rntm_spmd_barrier( rntm );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism. Only the total number of threads is
+	// used: all of the threads cooperate to pack B, and then partition the
+	// rows of A among themselves. Assigning all of the ways to the jc loop
+	// makes the root thrinfo_t node of each thread describe that partition.
+	bli_rntm_set_ways_from_rntm_sup( m, n, k, rntm );
+	bli_rntm_set_ways_only( bli_rntm_num_threads( rntm ), 1, 1, 1, 1, rntm );
+
+	bli_l3_sup_thread_decorator
+	(
+	  bli_spmm_int,
+	  BLIS_GEMM,
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+err_t bli_spmm_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     )
+{
+	const num_t dt  = bli_obj_dt( c );
+	csr_t*      csr = bli_obj_buffer( a );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f
+	(
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  bli_obj_width( a ),
+	  bli_obj_buffer_for_1x1( dt, alpha ),
+	  csr->row_ptr,
+	  csr->col_ind,
+	  csr->val,
+	  bli_obj_buffer_at_off( b ), bli_obj_row_stride( b ), bli_obj_col_stride( b ),
+	  bli_obj_buffer_for_1x1( dt, beta ),
+	  bli_obj_buffer_at_off( c ), bli_obj_row_stride( c ), bli_obj_col_stride( c ),
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+//
+// Compute the rows of C assigned to the current thread. For each block of
+// up to NC columns of C, the threads pack the corresponding columns of B
+// into a shared buffer of NR-wide micro-panels (where NR is the width of
+// the spmm micro-kernel). Each thread then visits its rows of A in blocks
+// of up to MC rows and streams each block through the micro-kernel once
+// per micro-panel of B, so that the block of A remains in cache while the
+// micro-panels are traversed.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t      m, \
+       dim_t      n, \
+       dim_t      k, \
+       void*      alpha, \
+       gint_t*    row_ptr, \
+       gint_t*    col_ind, \
+       void*      val, \
+       void*      b, inc_t rs_b, inc_t cs_b, \
+       void*      beta, \
+       void*      c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t dt     = PASTEMAC(ch,type); \
+\
+	const dim_t NR     = bli_cntx_get_l3_spmm_nr_dt( dt, cntx ); \
+	const dim_t MC     = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t NC     = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ); \
+\
+	PASTECH2(ch,spmm,_ukr_ft) \
+	            spmm_ukr = bli_cntx_get_l3_spmm_ukr_dt( dt, cntx ); \
+\
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype* restrict val_cast   = val; \
+	ctype* restrict b_cast     = b; \
+	ctype* restrict c_cast     = c; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict beta_cast  = beta; \
+\
+	mem_t           mem_b      = BLIS_MEM_INITIALIZER; \
+	auxinfo_t       aux; \
+\
+	/* Determine the rows of A (and C) to be computed by this thread. */ \
+	dim_t i_start, i_end; \
+\
+	bli_thread_range_nnz( thread, m, row_ptr, &i_start, &i_end ); \
+\
+	for ( dim_t jj = 0; jj < n; jj += NC ) \
+	{ \
+		const dim_t nc = bli_min( NC, n - jj ); \
+\
+		ctype*      bp; \
+		inc_t       rs_bp, cs_bp, ps_bp; \
+\
+		/* Pack the current block of B into micro-panels. The threads share
+		   the packed buffer and divide the micro-panels among themselves;
+		   the function returns only once all of them have been packed. */ \
+		PASTEMAC(ch,packm_sup_b) \
+		( \
+		  TRUE, \
+		  BLIS_BUFFER_FOR_B_PANEL, \
+		  BLIS_RRR, \
+		  BLIS_NO_TRANSPOSE, \
+		  k, nc, \
+		  k, nc, \
+		  NR, \
+		  one, \
+		  b_cast + jj*cs_b, rs_b,   cs_b, \
+		  &bp,              &rs_bp, &cs_bp, \
+		                            &ps_bp, \
+		  cntx, \
+		  rntm, \
+		  &mem_b, \
+		  thread  \
+		); \
+\
+		const dim_t n_iter = ( nc + NR - 1 ) / NR; \
+\
+		for ( dim_t ii = i_start; ii < i_end; ii += MC ) \
+		{ \
+			const dim_t i_last = bli_min( ii + MC, i_end ); \
+\
+			for ( dim_t j = 0; j < n_iter; ++j ) \
+			{ \
+				const dim_t     nr_cur = bli_min( NR, nc - j*NR ); \
+				ctype* restrict bp_j   = bp + j*ps_bp; \
+				ctype* restrict c_j    = c_cast + ( jj + j*NR )*cs_c; \
+\
+				for ( dim_t i = ii; i < i_last; ++i ) \
+				{ \
+					const gint_t p0 = row_ptr[ i ]; \
+\
+					spmm_ukr \
+					( \
+					  nr_cur, \
+					  row_ptr[ i + 1 ] - p0, \
+					  alpha_cast, \
+					  col_ind  + p0, \
+					  val_cast + p0, \
+					  bp_j, rs_bp, \
+					  beta_cast, \
+					  c_j + i*rs_c, cs_c, \
+					  &aux, \
+					  cntx  \
+					); \
+				} \
+			} \
+		} \
+	} \
+\
+	/* Make sure that no thread is still reading the packed B before the
+	   chief thread releases it. */ \
+	bli_thread_barrier( thread ); \
+\
+	PASTEMAC(ch,packm_sup_finalize_mem_b) \
+	( \
+	  TRUE, \
+	  rntm, \
+	  &mem_b, \
+	  thread  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( spmm_thr )
+
+// -----------------------------------------------------------------------------
+
+void bli_spmm_check
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes.
+
+	e_val = bli_check_floating_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( c, b );
+	bli_check_error_code( e_val );
+
+	// Check scalar/vector/matrix type.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( c );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_level3_dims( a, b, c );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( beta );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( c );
+	bli_check_error_code( e_val );
+
+	// Check the arrays that describe A. The row offsets are needed whenever
+	// A has rows, and the column indices and values whenever A has at least
+	// one nonzero.
+
+	csr_t* csr = bli_obj_buffer( a );
+
+	e_val = ( bli_obj_length( a ) > 0 && csr->row_ptr == NULL
+	          ? BLIS_EXPECTED_NONNULL_OBJECT_BUFFER : BLIS_SUCCESS );
+	bli_check_error_code( e_val );
+
+	if ( csr->row_ptr != NULL &&
+	     csr->row_ptr[ bli_obj_length( a ) ] > csr->row_ptr[ 0 ] )
+	{
+		e_val = ( csr->col_ind == NULL || csr->val == NULL
+		          ? BLIS_EXPECTED_NONNULL_OBJECT_BUFFER : BLIS_SUCCESS );
+		bli_check_error_code( e_val );
+	}
+}
+
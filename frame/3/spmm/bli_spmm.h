@@ -0,0 +1,130 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Sparse-times-dense matrix multiplication:
+//
+//   C := beta * C + alpha * A * B
+//
+// where A is an m x k sparse matrix in compressed sparse row (CSR) format
+// and B and C are dense. The nonzeros of row i of A are stored in elements
+// row_ptr[i] through row_ptr[i+1]-1 of val, and their (zero-based) column
+// indices in the same elements of col_ind. B is packed into micro-panels
+// that are nr columns wide, where nr is the width of the spmm micro-kernel
+// (see bli_cntx_set_l3_spmm_ukr()), and the rows of A are then streamed
+// through the micro-kernel once per micro-panel. The threads of the
+// operation share the packed copy of B and partition the rows of A so
+// that each thread receives roughly the same number of nonzeros.
+//
+// Since obj_t cannot describe a sparse matrix, only typed interfaces are
+// provided. Internally, A is wrapped in an object of the appropriate
+// datatype and dimensions whose buffer points to a csr_t.
+//
+
+typedef struct csr_s
+{
+	gint_t* row_ptr;
+	gint_t* col_ind;
+	void*   val;
+
+} csr_t;
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype*   alpha, \
+       gint_t*  row_ptr, \
+       gint_t*  col_ind, \
+       ctype*   val, \
+       ctype*   b, inc_t rs_b, inc_t cs_b, \
+       ctype*   beta, \
+       ctype*   c, inc_t rs_c, inc_t cs_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype*   alpha, \
+       gint_t*  row_ptr, \
+       gint_t*  col_ind, \
+       ctype*   val, \
+       ctype*   b, inc_t rs_b, inc_t cs_b, \
+       ctype*   beta, \
+       ctype*   c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     );
+
+INSERT_GENTPROT_BASIC0( spmm )
+
+void bli_spmm
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+err_t bli_spmm_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     );
+
+void bli_spmm_check
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c
+     );
+
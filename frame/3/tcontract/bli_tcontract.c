@@ -0,0 +1,874 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// A tensor viewed as a virtual matrix. The offsets (in elements) of the
+// rows and columns of the matrix within the tensor are given by the scatter
+// vectors rscat and cscat. The block-scatter vectors rbs and cbs give, for
+// each block of rows or columns, the constant stride between consecutive
+// offsets within the block, or zero if the offsets do not have a constant
+// stride. The rows of A and C are blocked by MR, the columns of B and C by
+// NR, and the columns of A and rows of B by KC.
+//
+
+typedef struct tcmat_s
+{
+	void*  buf;
+	inc_t* rscat;
+	inc_t* cscat;
+	inc_t* rbs;
+	inc_t* cbs;
+
+} tcmat_t;
+
+#define FUNCPTR_T tcontract_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       dim_t      m0, dim_t m1,
+       dim_t      n0, dim_t n1,
+       dim_t      k,
+       void*      alpha,
+       tcmat_t*   a,
+       tcmat_t*   b,
+       void*      beta,
+       tcmat_t*   c,
+       cntx_t*    cntx,
+       rntm_t*    rntm
+     );
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t      m0, dim_t m1, \
+       dim_t      n0, dim_t n1, \
+       dim_t      k, \
+       void*      alpha, \
+       tcmat_t*   a, \
+       tcmat_t*   b, \
+       void*      beta, \
+       tcmat_t*   c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm  \
+     );
+
+INSERT_GENTPROT_BASIC0( tcontract_blk )
+
+static FUNCPTR_T GENARRAY(ftypes,tcontract_blk);
+
+// -----------------------------------------------------------------------------
+
+// Return the position of the dimension labeled by the given character, or
+// -1 if there is no such dimension.
+static dim_t bli_tcontract_find( char label, dim_t ndim, char* idx )
+{
+	for ( dim_t i = 0; i < ndim; ++i )
+		if ( idx[ i ] == label ) return i;
+
+	return -1;
+}
+
+// Sort the dimensions of a bundle by increasing magnitude of their strides
+// in the first tensor (breaking ties by the strides in the second tensor),
+// so that the leading dimension of the bundle varies fastest.
+static void bli_tcontract_sort
+     (
+       dim_t  nd,
+       dim_t* len,
+       inc_t* st0,
+       inc_t* st1
+     )
+{
+	for ( dim_t i = 1; i < nd; ++i )
+	{
+		const dim_t l  = len[ i ];
+		const inc_t s0 = st0[ i ];
+		const inc_t s1 = st1[ i ];
+		dim_t       j  = i;
+
+		for ( ; j > 0; --j )
+		{
+			const inc_t t0 = bli_abs( st0[ j - 1 ] );
+			const inc_t t1 = bli_abs( st1[ j - 1 ] );
+
+			if ( t0 < bli_abs( s0 ) ||
+			     ( t0 == bli_abs( s0 ) && t1 <= bli_abs( s1 ) ) ) break;
+
+			len[ j ] = len[ j - 1 ];
+			st0[ j ] = st0[ j - 1 ];
+			st1[ j ] = st1[ j - 1 ];
+		}
+
+		len[ j ] = l;
+		st0[ j ] = s0;
+		st1[ j ] = s1;
+	}
+}
+
+// Compute the scatter vectors of a bundle of dimensions for the two tensors
+// in which it appears. The first dimension of the bundle varies fastest.
+static void bli_tcontract_scat
+     (
+       dim_t           nd,
+       dim_t* restrict len,
+       inc_t* restrict st0,
+       inc_t* restrict st1,
+       inc_t* restrict scat0,
+       inc_t* restrict scat1
+     )
+{
+	dim_t n = 1;
+
+	scat0[ 0 ] = 0;
+	scat1[ 0 ] = 0;
+
+	for ( dim_t d = 0; d < nd; ++d )
+	{
+		for ( dim_t q = 1; q < len[ d ]; ++q )
+		for ( dim_t e = 0; e < n; ++e )
+		{
+			scat0[ q*n + e ] = scat0[ e ] + q*st0[ d ];
+			scat1[ q*n + e ] = scat1[ e ] + q*st1[ d ];
+		}
+
+		n *= len[ d ];
+	}
+}
+
+// Compute the block-scatter vector of a scatter vector of length n for
+// blocks of bf elements. A block that consists of a single element is
+// assigned a unit stride.
+static void bli_tcontract_blkscat
+     (
+       dim_t           n,
+       inc_t* restrict scat,
+       dim_t           bf,
+       inc_t* restrict bs
+     )
+{
+	for ( dim_t i0 = 0; i0 < n; i0 += bf )
+	{
+		const dim_t nb = bli_min( bf, n - i0 );
+		inc_t       st = ( nb > 1 ? scat[ i0 + 1 ] - scat[ i0 ] : 1 );
+
+		for ( dim_t i = 2; i < nb && st != 0; ++i )
+			if ( scat[ i0 + i ] - scat[ i0 + i - 1 ] != st ) st = 0;
+
+		bs[ i0 / bf ] = st;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_tcontract_front
+     (
+       num_t   dt,
+       void*   alpha,
+       dim_t   ndim_a, dim_t* len_a, void* a, inc_t* stride_a, char* idx_a,
+       dim_t   ndim_b, dim_t* len_b, void* b, inc_t* stride_b, char* idx_b,
+       void*   beta,
+       dim_t   ndim_c, dim_t* len_c, void* c, inc_t* stride_c, char* idx_c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_tcontract_check( ndim_a, len_a, a, stride_a, idx_a,
+		                     ndim_b, len_b, b, stride_b, idx_b,
+		                     ndim_c, len_c, c, stride_c, idx_c );
+
+	// Gather the dimensions shared by A and C (which form m), by B and C
+	// (which form n), and by A and B (which form k). Each bundle records
+	// the lengths of its dimensions and their strides in the two tensors
+	// in which they appear, with A (for m and k) or B (for n) first.
+	const dim_t nd_max = ndim_a + ndim_b + ndim_c + 1;
+
+	dim_t* restrict len = bli_malloc_intl( sizeof( dim_t ) * nd_max );
+	inc_t* restrict st0 = bli_malloc_intl( sizeof( inc_t ) * 2 * nd_max );
+	inc_t* restrict st1 = st0 + nd_max;
+
+	dim_t nd_m = 0, nd_n = 0, nd_k = 0;
+
+	for ( dim_t i = 0; i < ndim_c; ++i )
+	{
+		const dim_t ia = bli_tcontract_find( idx_c[ i ], ndim_a, idx_a );
+
+		if ( ia < 0 ) continue;
+
+		len[ nd_m ] = len_c[ i ];
+		st0[ nd_m ] = stride_a[ ia ];
+		st1[ nd_m ] = stride_c[ i ];
+		++nd_m;
+	}
+
+	for ( dim_t i = 0; i < ndim_c; ++i )
+	{
+		const dim_t ib = bli_tcontract_find( idx_c[ i ], ndim_b, idx_b );
+		const dim_t p  = nd_m + nd_n;
+
+		if ( ib < 0 ) continue;
+
+		len[ p ] = len_c[ i ];
+		st0[ p ] = stride_b[ ib ];
+		st1[ p ] = stride_c[ i ];
+		++nd_n;
+	}
+
+	for ( dim_t i = 0; i < ndim_a; ++i )
+	{
+		const dim_t ib = bli_tcontract_find( idx_a[ i ], ndim_b, idx_b );
+		const dim_t p  = nd_m + nd_n + nd_k;
+
+		if ( ib < 0 ) continue;
+
+		len[ p ] = len_a[ i ];
+		st0[ p ] = stride_a[ i ];
+		st1[ p ] = stride_b[ ib ];
+		++nd_k;
+	}
+
+	dim_t* len_m = len;
+	dim_t* len_n = len + nd_m;
+	dim_t* len_k = len + nd_m + nd_n;
+
+	bli_tcontract_sort( nd_m, len_m, st0,               st1               );
+	bli_tcontract_sort( nd_n, len_n, st0 + nd_m,        st1 + nd_m        );
+	bli_tcontract_sort( nd_k, len_k, st0 + nd_m + nd_n, st1 + nd_m + nd_n );
+
+	dim_t m = 1, n = 1, k = 1;
+
+	for ( dim_t i = 0; i < nd_m; ++i ) m *= len_m[ i ];
+	for ( dim_t i = 0; i < nd_n; ++i ) n *= len_n[ i ];
+	for ( dim_t i = 0; i < nd_k; ++i ) k *= len_k[ i ];
+
+	// If C is empty, return early.
+	if ( m == 0 || n == 0 )
+	{
+		bli_free_intl( len );
+		bli_free_intl( st0 );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	const dim_t MR   = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NR   = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t KC   = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+
+	const dim_t nb_m = ( m + MR - 1 ) / MR;
+	const dim_t nb_n = ( n + NR - 1 ) / NR;
+	const dim_t nb_k = ( k + KC - 1 ) / KC;
+
+	// Compute the scatter and block-scatter vectors of the virtual matrices.
+	inc_t* restrict scat = bli_malloc_intl( sizeof( inc_t ) *
+	                                        ( 2*( m + n + k ) +
+	                                          2*( nb_m + nb_n + nb_k ) ) );
+
+	tcmat_t mat_a, mat_b, mat_c;
+
+	mat_a.buf   = a;
+	mat_b.buf   = b;
+	mat_c.buf   = c;
+
+	mat_a.rscat = scat;
+	mat_c.rscat = mat_a.rscat + m;
+	mat_b.cscat = mat_c.rscat + m;
+	mat_c.cscat = mat_b.cscat + n;
+	mat_a.cscat = mat_c.cscat + n;
+	mat_b.rscat = mat_a.cscat + k;
+
+	mat_a.rbs   = mat_b.rscat + k;
+	mat_c.rbs   = mat_a.rbs + nb_m;
+	mat_b.cbs   = mat_c.rbs + nb_m;
+	mat_c.cbs   = mat_b.cbs + nb_n;
+	mat_a.cbs   = mat_c.cbs + nb_n;
+	mat_b.rbs   = mat_a.cbs + nb_k;
+
+	bli_tcontract_scat( nd_m, len_m, st0,               st1,
+	                    mat_a.rscat, mat_c.rscat );
+	bli_tcontract_scat( nd_n, len_n, st0 + nd_m,        st1 + nd_m,
+	                    mat_b.cscat, mat_c.cscat );
+	if ( k > 0 )
+		bli_tcontract_scat( nd_k, len_k, st0 + nd_m + nd_n, st1 + nd_m + nd_n,
+		                    mat_a.cscat, mat_b.rscat );
+
+	bli_tcontract_blkscat( m, mat_a.rscat, MR, mat_a.rbs );
+	bli_tcontract_blkscat( m, mat_c.rscat, MR, mat_c.rbs );
+	bli_tcontract_blkscat( n, mat_b.cscat, NR, mat_b.cbs );
+	bli_tcontract_blkscat( n, mat_c.cscat, NR, mat_c.cbs );
+	bli_tcontract_blkscat( k, mat_a.cscat, KC, mat_a.cbs );
+	bli_tcontract_blkscat( k, mat_b.rscat, KC, mat_b.rbs );
+
+	bli_free_intl( len );
+	bli_free_intl( st0 );
+
+	// Wrap the virtual matrices in objects of the appropriate datatype and
+	// dimensions. Their strides are never used; only their buffers (the
+	// tcmat_t structs) and dimensions are.
+	obj_t alphao = BLIS_OBJECT_INITIALIZER_1X1;
+	obj_t ao     = BLIS_OBJECT_INITIALIZER;
+	obj_t bo     = BLIS_OBJECT_INITIALIZER;
+	obj_t betao  = BLIS_OBJECT_INITIALIZER_1X1;
+	obj_t co     = BLIS_OBJECT_INITIALIZER;
+
+	bli_obj_init_finish_1x1( dt, alpha, &alphao );
+	bli_obj_init_finish_1x1( dt, beta,  &betao  );
+
+	bli_obj_init_finish( dt, m, k, &mat_a, 1, m, &ao );
+	bli_obj_init_finish( dt, k, n, &mat_b, 1, k, &bo );
+	bli_obj_init_finish( dt, m, n, &mat_c, 1, m, &co );
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Parse and interpret the contents of the rntm_t object to properly
+	// set the ways of parallelism. Only the total number of threads is
+	// used; each thread computes a disjoint block of C.
+	bli_rntm_set_ways_from_rntm_sup( m, n, k, rntm );
+
+	bli_l3_sup_thread_decorator
+	(
+	  bli_tcontract_int,
+	  BLIS_GEMM,
+	  &alphao,
+	  &ao,
+	  &bo,
+	  &betao,
+	  &co,
+	  cntx,
+	  rntm
+	);
+
+	bli_free_intl( scat );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       ctype*   alpha, \
+       dim_t    ndim_a, dim_t* len_a, ctype* a, inc_t* stride_a, char* idx_a, \
+       dim_t    ndim_b, dim_t* len_b, ctype* b, inc_t* stride_b, char* idx_b, \
+       ctype*   beta, \
+       dim_t    ndim_c, dim_t* len_c, ctype* c, inc_t* stride_c, char* idx_c  \
+     ) \
+{ \
+	PASTEMAC2(ch,opname,_ex) \
+	( \
+	  alpha, \
+	  ndim_a, len_a, a, stride_a, idx_a, \
+	  ndim_b, len_b, b, stride_b, idx_b, \
+	  beta, \
+	  ndim_c, len_c, c, stride_c, idx_c, \
+	  NULL, NULL \
+	); \
+} \
+\
+void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       ctype*   alpha, \
+       dim_t    ndim_a, dim_t* len_a, ctype* a, inc_t* stride_a, char* idx_a, \
+       dim_t    ndim_b, dim_t* len_b, ctype* b, inc_t* stride_b, char* idx_b, \
+       ctype*   beta, \
+       dim_t    ndim_c, dim_t* len_c, ctype* c, inc_t* stride_c, char* idx_c, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	bli_tcontract_front \
+	( \
+	  PASTEMAC(ch,type), \
+	  alpha, \
+	  ndim_a, len_a, a, stride_a, idx_a, \
+	  ndim_b, len_b, b, stride_b, idx_b, \
+	  beta, \
+	  ndim_c, len_c, c, stride_c, idx_c, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( tcontract )
+
+// -----------------------------------------------------------------------------
+
+err_t bli_tcontract_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     )
+{
+	const num_t dt = bli_obj_dt( c );
+	const dim_t m  = bli_obj_length( c );
+	const dim_t n  = bli_obj_width( c );
+	const dim_t k  = bli_obj_width( a );
+
+	const dim_t MR = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NR = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+
+	// Partition C among the threads along whichever dimension offers more
+	// micro-tiles, in units of the micro-tile. This keeps the blocks of
+	// each thread aligned to those of the block-scatter vectors.
+	const dim_t nt  = bli_thread_num_threads( thread );
+	const dim_t tid = bli_thread_ocomm_id( thread );
+
+	dim_t m0 = 0, m1 = m;
+	dim_t n0 = 0, n1 = n;
+
+	if ( nt > 1 )
+	{
+		const bool  part_n  = ( n / NR >= m / MR );
+		const dim_t bf      = ( part_n ? NR : MR );
+		const dim_t n_blk   = ( ( part_n ? n : m ) + bf - 1 ) / bf;
+		const dim_t blk_t   = n_blk / nt;
+		const dim_t blk_lo  = n_blk % nt;
+		const dim_t blk_s   = tid * blk_t + bli_min( tid, blk_lo );
+		const dim_t blk_e   = blk_s + blk_t + ( tid < blk_lo ? 1 : 0 );
+		const dim_t dim     = ( part_n ? n : m );
+		const dim_t start   = bli_min( blk_s * bf, dim );
+		const dim_t end     = bli_min( blk_e * bf, dim );
+
+		if ( part_n ) { n0 = start; n1 = end; }
+		else          { m0 = start; m1 = end; }
+	}
+
+	if ( m1 <= m0 || n1 <= n0 ) return BLIS_SUCCESS;
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f
+	(
+	  m0, m1,
+	  n0, n1,
+	  k,
+	  bli_obj_buffer_for_1x1( dt, alpha ),
+	  bli_obj_buffer( a ),
+	  bli_obj_buffer( b ),
+	  bli_obj_buffer_for_1x1( dt, beta ),
+	  bli_obj_buffer( c ),
+	  cntx,
+	  rntm
+	);
+
+	return BLIS_SUCCESS;
+}
+
+//
+// Pack one micro-panel of a virtual matrix. The panel_dim rows (or columns)
+// of the micro-panel are located at offsets dscat[0..panel_dim-1] within x,
+// with constant stride dbs if dbs is nonzero, and its panel_len columns (or
+// rows) at offsets lscat[0..panel_len-1], with constant stride lbs if lbs
+// is nonzero. If both strides are constant, the micro-panel is an ordinary
+// strided submatrix and is packed by the conventional packm kernel.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       pack_t           schema, \
+       dim_t            panel_dim, \
+       dim_t            panel_dim_max, \
+       dim_t            panel_len, \
+       ctype*  restrict x, \
+       inc_t*  restrict dscat, inc_t dbs, \
+       inc_t*  restrict lscat, inc_t lbs, \
+       ctype*  restrict p,     inc_t ldp, \
+       cntx_t*          cntx  \
+     ) \
+{ \
+	if ( dbs != 0 && lbs != 0 ) \
+	{ \
+		PASTEMAC(ch,packm_cxk) \
+		( \
+		  BLIS_NO_CONJUGATE, \
+		  schema, \
+		  panel_dim, \
+		  panel_dim_max, \
+		  panel_len, \
+		  panel_len, \
+		  PASTEMAC(ch,1), \
+		  x + dscat[ 0 ] + lscat[ 0 ], dbs, lbs, \
+		  p,                                ldp, \
+		  cntx  \
+		); \
+		return; \
+	} \
+\
+	for ( dim_t l = 0; l < panel_len; ++l ) \
+	{ \
+		ctype* restrict xl = x + lscat[ l ]; \
+		ctype* restrict pl = p + l*ldp; \
+\
+		if ( dbs != 0 ) \
+		{ \
+			ctype* restrict x0 = xl + dscat[ 0 ]; \
+\
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+				PASTEMAC2(ch,ch,copys)( x0[ i*dbs ], pl[ i ] ); \
+		} \
+		else \
+		{ \
+			for ( dim_t i = 0; i < panel_dim; ++i ) \
+				PASTEMAC2(ch,ch,copys)( xl[ dscat[ i ] ], pl[ i ] ); \
+		} \
+\
+		for ( dim_t i = panel_dim; i < panel_dim_max; ++i ) \
+			PASTEMAC(ch,set0s)( pl[ i ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( tcontract_packm )
+
+//
+// Compute the rows m0..m1-1 and columns n0..n1-1 of the virtual matrix C.
+// The loops and packed formats are those of conventional gemm. Each
+// micro-tile of C whose rows and columns both have constant strides is
+// updated in place by the micro-kernel; all others are computed into a
+// temporary micro-tile and then added to C element by element.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname) \
+     ( \
+       dim_t      m0, dim_t m1, \
+       dim_t      n0, dim_t n1, \
+       dim_t      k, \
+       void*      alpha, \
+       tcmat_t*   a, \
+       tcmat_t*   b, \
+       void*      beta, \
+       tcmat_t*   c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm  \
+     ) \
+{ \
+	const num_t dt     = PASTEMAC(ch,type); \
+\
+	const dim_t MR     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t PACKMR = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t PACKNR = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+	const dim_t MC     = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t KC     = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ); \
+	const dim_t NC     = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ); \
+\
+	PASTECH2(ch,gemm,_ukr_ft) \
+	            gemm_ukr = bli_cntx_get_l3_nat_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Temporary C buffer for edge cases, stored according to the
+	   micro-kernel's preference. */ \
+	ctype       ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                / sizeof( ctype ) ] \
+	                __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const bool  col_pref = bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const inc_t rs_ct    = ( col_pref ? 1 : NR ); \
+	const inc_t cs_ct    = ( col_pref ? MR : 1 ); \
+\
+	ctype* restrict zero       = PASTEMAC(ch,0); \
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype* restrict a_cast     = a->buf; \
+	ctype* restrict b_cast     = b->buf; \
+	ctype* restrict c_cast     = c->buf; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict beta_cast  = beta; \
+\
+	/* If alpha or k is zero, we only need to scale C by beta. */ \
+	if ( k == 0 || PASTEMAC(ch,eq0)( *alpha_cast ) ) \
+	{ \
+		for ( dim_t j = n0; j < n1; ++j ) \
+		for ( dim_t i = m0; i < m1; ++i ) \
+		{ \
+			ctype* restrict cij = c_cast + c->rscat[ i ] + c->cscat[ j ]; \
+\
+			if ( PASTEMAC(ch,eq0)( *beta_cast ) ) { PASTEMAC(ch,set0s)( *cij ); } \
+			else                                  { PASTEMAC(ch,scals)( *beta_cast, *cij ); } \
+		} \
+		return; \
+	} \
+\
+	auxinfo_t       aux; \
+\
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+	bli_auxinfo_set_is_a( 1, &aux ); \
+	bli_auxinfo_set_is_b( 1, &aux ); \
+\
+	const dim_t mc_max = bli_min( MC, m1 - m0 ); \
+	const dim_t nc_max = bli_min( NC, n1 - n0 ); \
+	const dim_t kc_max = bli_min( KC, k ); \
+	const dim_t len_ap = ( ( mc_max + MR - 1 ) / MR ) * PACKMR * kc_max; \
+	const dim_t len_bp = ( ( nc_max + NR - 1 ) / NR ) * PACKNR * kc_max; \
+	mem_t       mem_a, mem_b; \
+\
+	bli_membrk_acquire_m( rntm, sizeof( ctype ) * len_ap, \
+	                      BLIS_BUFFER_FOR_A_BLOCK, &mem_a ); \
+	bli_membrk_acquire_m( rntm, sizeof( ctype ) * len_bp, \
+	                      BLIS_BUFFER_FOR_B_PANEL, &mem_b ); \
+\
+	ctype* restrict ap = bli_mem_buffer( &mem_a ); \
+	ctype* restrict bp = bli_mem_buffer( &mem_b ); \
+\
+	/* Since m0 and n0 are multiples of MR and NR, and MC and NC are
+	   multiples of MR and NR, each micro-panel below begins at a block
+	   boundary of the block-scatter vectors. */ \
+	for ( dim_t jc = n0; jc < n1; jc += NC ) \
+	{ \
+		const dim_t nc_cur = bli_min( NC, n1 - jc ); \
+\
+		for ( dim_t pc = 0; pc < k; pc += KC ) \
+		{ \
+			const dim_t kc_cur = bli_min( KC, k - pc ); \
+\
+			/* The first update of each element of C applies beta. */ \
+			ctype* restrict beta_use = ( pc == 0 ? beta_cast : one ); \
+\
+			for ( dim_t jr = 0; jr < nc_cur; jr += NR ) \
+			{ \
+				PASTEMAC(ch,tcontract_packm) \
+				( \
+				  BLIS_PACKED_COL_PANELS, \
+				  bli_min( NR, nc_cur - jr ), \
+				  NR, \
+				  kc_cur, \
+				  b_cast, \
+				  b->cscat + jc + jr, b->cbs[ ( jc + jr ) / NR ], \
+				  b->rscat + pc,      b->rbs[ pc / KC ], \
+				  bp + ( jr / NR )*PACKNR*kc_cur, PACKNR, \
+				  cntx  \
+				); \
+			} \
+\
+			for ( dim_t ic = m0; ic < m1; ic += MC ) \
+			{ \
+				const dim_t mc_cur = bli_min( MC, m1 - ic ); \
+\
+				for ( dim_t ir = 0; ir < mc_cur; ir += MR ) \
+				{ \
+					PASTEMAC(ch,tcontract_packm) \
+					( \
+					  BLIS_PACKED_ROW_PANELS, \
+					  bli_min( MR, mc_cur - ir ), \
+					  MR, \
+					  kc_cur, \
+					  a_cast, \
+					  a->rscat + ic + ir, a->rbs[ ( ic + ir ) / MR ], \
+					  a->cscat + pc,      a->cbs[ pc / KC ], \
+					  ap + ( ir / MR )*PACKMR*kc_cur, PACKMR, \
+					  cntx  \
+					); \
+				} \
+\
+				/* Loop over the n dimension (NR columns at a time). */ \
+				for ( dim_t jr = 0; jr < nc_cur; jr += NR ) \
+				{ \
+					const dim_t     nr_cur = bli_min( NR, nc_cur - jr ); \
+					const dim_t     j      = jc + jr; \
+					const inc_t     cs_u   = c->cbs[ j / NR ]; \
+					ctype* restrict b1     = bp + ( jr / NR )*PACKNR*kc_cur; \
+\
+					/* Loop over the m dimension (MR rows at a time). */ \
+					for ( dim_t ir = 0; ir < mc_cur; ir += MR ) \
+					{ \
+						const dim_t     mr_cur = bli_min( MR, mc_cur - ir ); \
+						const dim_t     i      = ic + ir; \
+						const inc_t     rs_u   = c->rbs[ i / MR ]; \
+						ctype* restrict a1     = ap + ( ir / MR )*PACKMR*kc_cur; \
+						ctype* restrict c11    = c_cast + c->rscat[ i ] + c->cscat[ j ]; \
+\
+						bli_auxinfo_set_next_a( a1, &aux ); \
+						bli_auxinfo_set_next_b( b1, &aux ); \
+\
+						if ( mr_cur == MR && nr_cur == NR && rs_u != 0 && cs_u != 0 ) \
+						{ \
+							gemm_ukr \
+							( \
+							  kc_cur, \
+							  alpha_cast, \
+							  a1, \
+							  b1, \
+							  beta_use, \
+							  c11, rs_u, cs_u, \
+							  &aux, \
+							  cntx  \
+							); \
+							continue; \
+						} \
+\
+						gemm_ukr \
+						( \
+						  kc_cur, \
+						  alpha_cast, \
+						  a1, \
+						  b1, \
+						  zero, \
+						  ct, rs_ct, cs_ct, \
+						  &aux, \
+						  cntx  \
+						); \
+\
+						/* Scale the micro-tile of C and add the result from
+						   above, scattering it if necessary. */ \
+						if ( rs_u != 0 && cs_u != 0 ) \
+						{ \
+							PASTEMAC(ch,xpbys_mxn)( mr_cur, nr_cur, \
+							                        ct,  rs_ct, cs_ct, \
+							                        beta_use, \
+							                        c11, rs_u,  cs_u ); \
+						} \
+						else \
+						{ \
+							for ( dim_t jj = 0; jj < nr_cur; ++jj ) \
+							for ( dim_t ii = 0; ii < mr_cur; ++ii ) \
+							{ \
+								ctype* restrict cij = c_cast + c->rscat[ i + ii ] \
+								                             + c->cscat[ j + jj ]; \
+								ctype* restrict tij = ct + ii*rs_ct + jj*cs_ct; \
+\
+								if ( PASTEMAC(ch,eq0)( *beta_use ) ) \
+								{ PASTEMAC2(ch,ch,copys)( *tij, *cij ); } \
+								else \
+								{ PASTEMAC3(ch,ch,ch,xpbys)( *tij, *beta_use, *cij ); } \
+							} \
+						} \
+					} \
+				} \
+			} \
+		} \
+	} \
+\
+	bli_membrk_release( rntm, &mem_a ); \
+	bli_membrk_release( rntm, &mem_b ); \
+}
+
+INSERT_GENTFUNC_BASIC0( tcontract_blk )
+
+// -----------------------------------------------------------------------------
+
+void bli_tcontract_check
+     (
+       dim_t   ndim_a, dim_t* len_a, void* a, inc_t* stride_a, char* idx_a,
+       dim_t   ndim_b, dim_t* len_b, void* b, inc_t* stride_b, char* idx_b,
+       dim_t   ndim_c, dim_t* len_c, void* c, inc_t* stride_c, char* idx_c
+     )
+{
+	err_t   e_val;
+
+	dim_t   ndim[ 3 ]   = { ndim_a,   ndim_b,   ndim_c   };
+	dim_t*  len[ 3 ]    = { len_a,    len_b,    len_c    };
+	void*   buf[ 3 ]    = { a,        b,        c        };
+	inc_t*  stride[ 3 ] = { stride_a, stride_b, stride_c };
+	char*   idx[ 3 ]    = { idx_a,    idx_b,    idx_c    };
+
+	// Check the dimensionality and lengths of each tensor, and the arrays
+	// that describe it (for non-NULLness).
+
+	for ( dim_t t = 0; t < 3; ++t )
+	{
+		e_val = ( ndim[ t ] < 0 ? BLIS_NEGATIVE_DIMENSION : BLIS_SUCCESS );
+		bli_check_error_code( e_val );
+
+		e_val = ( ndim[ t ] > 0 && ( len[ t ] == NULL || stride[ t ] == NULL ||
+		                             idx[ t ] == NULL )
+		          ? BLIS_NULL_POINTER : BLIS_SUCCESS );
+		bli_check_error_code( e_val );
+
+		dim_t size = 1;
+
+		for ( dim_t i = 0; i < ndim[ t ]; ++i )
+		{
+			e_val = ( len[ t ][ i ] < 0 ? BLIS_NEGATIVE_DIMENSION : BLIS_SUCCESS );
+			bli_check_error_code( e_val );
+
+			size *= len[ t ][ i ];
+		}
+
+		e_val = ( size > 0 && buf[ t ] == NULL
+		          ? BLIS_EXPECTED_NONNULL_OBJECT_BUFFER : BLIS_SUCCESS );
+		bli_check_error_code( e_val );
+	}
+
+	// Check that each index labels exactly one dimension in each of exactly
+	// two tensors, and that the lengths of those dimensions agree.
+
+	for ( dim_t t = 0; t < 3; ++t )
+	for ( dim_t i = 0; i < ndim[ t ]; ++i )
+	{
+		dim_t n_other = 0;
+
+		for ( dim_t u = 0; u < 3; ++u )
+		for ( dim_t j = 0; j < ndim[ u ]; ++j )
+		{
+			if ( idx[ u ][ j ] != idx[ t ][ i ] || ( u == t && j == i ) ) continue;
+
+			e_val = ( u == t ? BLIS_INVALID_TENSOR_INDEX : BLIS_SUCCESS );
+			bli_check_error_code( e_val );
+
+			e_val = ( len[ u ][ j ] != len[ t ][ i ]
+			          ? BLIS_NONCONFORMAL_DIMENSIONS : BLIS_SUCCESS );
+			bli_check_error_code( e_val );
+
+			++n_other;
+		}
+
+		e_val = ( n_other != 1 ? BLIS_INVALID_TENSOR_INDEX : BLIS_SUCCESS );
+		bli_check_error_code( e_val );
+	}
+}
+
@@ -0,0 +1,108 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Tensor contraction:
+//
+//   C := beta * C + alpha * A * B
+//
+// where A, B, and C are dense tensors of arbitrary dimensionality and
+// layout. Tensor X has ndim_x dimensions, where dimension i has length
+// len_x[i], stride stride_x[i] (in units of elements), and is labeled by
+// the character idx_x[i]. Each label must occur in exactly two of the
+// three tensors and no more than once in any one of them, and the lengths
+// of the dimensions that share a label must agree. The dimensions that
+// are shared by A and B are summed over.
+//
+// The contraction is computed as the gemm of a virtual m x k matrix with
+// a virtual k x n matrix, where m, n, and k are the products of the
+// lengths of the dimensions shared by A and C, B and C, and A and B,
+// respectively. Rather than permuting the tensors into matrices, the
+// offset of each row and column of the virtual matrices within its tensor
+// is recorded in a scatter vector, and for each block of MR or NR rows or
+// columns (or KC elements along k) a block-scatter vector records whether
+// the offsets within the block have a constant stride. Blocks with a
+// constant stride are packed (and, for C, updated) with the conventional
+// packm kernels and gemm micro-kernel, while the remaining blocks are
+// gathered from (or scattered to) their individual offsets.
+//
+// Since obj_t cannot describe a tensor, only typed interfaces are
+// provided.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(ch,opname) \
+     ( \
+       ctype*   alpha, \
+       dim_t    ndim_a, dim_t* len_a, ctype* a, inc_t* stride_a, char* idx_a, \
+       dim_t    ndim_b, dim_t* len_b, ctype* b, inc_t* stride_b, char* idx_b, \
+       ctype*   beta, \
+       dim_t    ndim_c, dim_t* len_c, ctype* c, inc_t* stride_c, char* idx_c  \
+     ); \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,_ex) \
+     ( \
+       ctype*   alpha, \
+       dim_t    ndim_a, dim_t* len_a, ctype* a, inc_t* stride_a, char* idx_a, \
+       dim_t    ndim_b, dim_t* len_b, ctype* b, inc_t* stride_b, char* idx_b, \
+       ctype*   beta, \
+       dim_t    ndim_c, dim_t* len_c, ctype* c, inc_t* stride_c, char* idx_c, \
+       cntx_t*  cntx, \
+       rntm_t*  rntm  \
+     );
+
+INSERT_GENTPROT_BASIC0( tcontract )
+
+err_t bli_tcontract_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     );
+
+void bli_tcontract_check
+     (
+       dim_t   ndim_a, dim_t* len_a, void* a, inc_t* stride_a, char* idx_a,
+       dim_t   ndim_b, dim_t* len_b, void* b, inc_t* stride_b, char* idx_b,
+       dim_t   ndim_c, dim_t* len_c, void* c, inc_t* stride_c, char* idx_c
+     );
+
@@ -136,6 +136,9 @@ void bli_arch_set_id( void )
 #ifdef BLIS_FAMILY_A64FX
 	id = BLIS_ARCH_A64FX;
 #endif
+#ifdef BLIS_FAMILY_ARMSVE
+	id = BLIS_ARCH_ARMSVE;
+#endif
 #ifdef BLIS_FAMILY_THUNDERX2
 	id = BLIS_ARCH_THUNDERX2;
 #endif
@@ -213,6 +216,7 @@ static char* config_name[ BLIS_NUM_ARCHS ] =
     "cortexa15",
     "cortexa9",
     "a64fx",
+    "armsve",
 
     "power9",
     "power8",
@@ -0,0 +1,259 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#define FUNCPTR_T blkmap_scan_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       dim_t     m,
+       dim_t     n,
+       void*     a, inc_t rs_a, inc_t cs_a,
+       blkmap_t* map
+     );
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t     m, \
+       dim_t     n, \
+       void*     a, inc_t rs_a, inc_t cs_a, \
+       blkmap_t* map  \
+     );
+
+INSERT_GENTPROT_BASIC0( blkmap_scan )
+
+static FUNCPTR_T GENARRAY(ftypes,blkmap_scan);
+
+
+void bli_blkmap_create
+     (
+       dim_t     m,
+       dim_t     n,
+       dim_t     blk_m,
+       dim_t     blk_n,
+       blkmap_t* map
+     )
+{
+	bli_init_once();
+
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val;
+
+		e_val = bli_check_null_pointer( map );
+		bli_check_error_code( e_val );
+
+		e_val = ( m < 0 || n < 0 || blk_m <= 0 || blk_n <= 0
+		          ? BLIS_NEGATIVE_DIMENSION : BLIS_SUCCESS );
+		bli_check_error_code( e_val );
+	}
+
+	const dim_t m_blk = ( m + blk_m - 1 ) / blk_m;
+	const dim_t n_blk = ( n + blk_n - 1 ) / blk_n;
+	const siz_t size  = ( siz_t )bli_max( m_blk * n_blk, 1 ) * sizeof( bool );
+
+	map->m     = m;
+	map->n     = n;
+	map->blk_m = blk_m;
+	map->blk_n = blk_n;
+	map->m_blk = m_blk;
+	map->n_blk = n_blk;
+
+	// Allocate the flags and mark every block as zero.
+	map->nz    = bli_malloc_user( size );
+
+	memset( map->nz, 0, size );
+}
+
+void bli_blkmap_create_from_obj
+     (
+       dim_t     blk_m,
+       dim_t     blk_n,
+       obj_t*    a,
+       blkmap_t* map
+     )
+{
+	bli_init_once();
+
+	const num_t dt   = bli_obj_dt( a );
+	const dim_t m    = bli_obj_length( a );
+	const dim_t n    = bli_obj_width( a );
+	void*       buf  = bli_obj_buffer_at_off( a );
+	const inc_t rs_a = bli_obj_row_stride( a );
+	const inc_t cs_a = bli_obj_col_stride( a );
+
+	if ( bli_error_checking_is_enabled() )
+	{
+		err_t e_val;
+
+		e_val = bli_check_floating_object( a );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_object_buffer( a );
+		bli_check_error_code( e_val );
+	}
+
+	bli_blkmap_create( m, n, blk_m, blk_n, map );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	FUNCPTR_T f = ftypes[dt];
+
+	// Invoke the function.
+	f( m, n, buf, rs_a, cs_a, map );
+}
+
+void bli_blkmap_free
+     (
+       blkmap_t* map
+     )
+{
+	bli_free_user( map->nz );
+
+	map->nz = NULL;
+}
+
+dim_t bli_blkmap_nnz_blks
+     (
+       blkmap_t* map
+     )
+{
+	const dim_t n_blk = bli_blkmap_num_blk_rows( map ) *
+	                    bli_blkmap_num_blk_cols( map );
+	dim_t       nnz   = 0;
+
+	for ( dim_t b = 0; b < n_blk; ++b )
+		if ( map->nz[ b ] ) ++nnz;
+
+	return nnz;
+}
+
+dim_t bli_blkmap_nz_runs
+     (
+       blkmap_t* map,
+       bool      trans,
+       dim_t     off_i,
+       dim_t     off_l,
+       dim_t     i0,
+       dim_t     i1,
+       dim_t     k,
+       dim_t*    runs
+     )
+{
+	const dim_t bi    = ( trans ? bli_blkmap_blk_width( map )
+	                            : bli_blkmap_blk_length( map ) );
+	const dim_t bl    = ( trans ? bli_blkmap_blk_length( map )
+	                            : bli_blkmap_blk_width( map ) );
+
+	const dim_t ib0   = ( off_i + i0 ) / bi;
+	const dim_t ib1   = ( off_i + i1 - 1 ) / bi;
+	const dim_t lb0   = ( off_l ) / bl;
+	const dim_t lb1   = ( off_l + k - 1 ) / bl;
+
+	dim_t       n_run = 0;
+
+	for ( dim_t lb = lb0; lb <= lb1; ++lb )
+	{
+		bool nz = FALSE;
+
+		for ( dim_t ib = ib0; ib <= ib1 && !nz; ++ib )
+			nz = ( trans ? bli_blkmap_is_nonzero( lb, ib, map )
+			             : bli_blkmap_is_nonzero( ib, lb, map ) );
+
+		if ( !nz ) continue;
+
+		const dim_t l0 = bli_max( lb * bl - off_l, 0 );
+		const dim_t l1 = bli_min( ( lb + 1 ) * bl - off_l, k );
+
+		// Extend the previous range if the current block adjoins it.
+		if ( n_run > 0 && runs[ 2*n_run - 1 ] == l0 )
+		{
+			runs[ 2*n_run - 1 ] = l1;
+		}
+		else
+		{
+			runs[ 2*n_run + 0 ] = l0;
+			runs[ 2*n_run + 1 ] = l1;
+			++n_run;
+		}
+	}
+
+	return n_run;
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t     m, \
+       dim_t     n, \
+       void*     a, inc_t rs_a, inc_t cs_a, \
+       blkmap_t* map  \
+     ) \
+{ \
+	ctype* restrict a_cast = a; \
+\
+	const dim_t     blk_m  = bli_blkmap_blk_length( map ); \
+	const dim_t     blk_n  = bli_blkmap_blk_width( map ); \
+\
+	for ( dim_t jb = 0; jb < bli_blkmap_num_blk_cols( map ); ++jb ) \
+	for ( dim_t ib = 0; ib < bli_blkmap_num_blk_rows( map ); ++ib ) \
+	{ \
+		const dim_t j0 = jb * blk_n; \
+		const dim_t j1 = bli_min( j0 + blk_n, n ); \
+		const dim_t i0 = ib * blk_m; \
+		const dim_t i1 = bli_min( i0 + blk_m, m ); \
+\
+		/* Stop scanning a block as soon as a nonzero element is found. */ \
+		bool nz = FALSE; \
+\
+		for ( dim_t j = j0; j < j1 && !nz; ++j ) \
+		for ( dim_t i = i0; i < i1 && !nz; ++i ) \
+		{ \
+			if ( !PASTEMAC(ch,eq0)( *( a_cast + i*rs_a + j*cs_a ) ) ) nz = TRUE; \
+		} \
+\
+		bli_blkmap_set_nonzero( ib, jb, nz, map ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( blkmap_scan )
+
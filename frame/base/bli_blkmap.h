@@ -0,0 +1,154 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_BLKMAP_H
+#define BLIS_BLKMAP_H
+
+// -- Block map type --
+
+/*
+typedef struct blkmap_s
+{
+	dim_t  m;
+	dim_t  n;
+	dim_t  blk_m;
+	dim_t  blk_n;
+	dim_t  m_blk;
+	dim_t  n_blk;
+
+	bool*  nz;
+
+} blkmap_t;
+*/
+
+
+// Block map query
+
+BLIS_INLINE dim_t bli_blkmap_length( blkmap_t* map )
+{
+	return map->m;
+}
+
+BLIS_INLINE dim_t bli_blkmap_width( blkmap_t* map )
+{
+	return map->n;
+}
+
+BLIS_INLINE dim_t bli_blkmap_blk_length( blkmap_t* map )
+{
+	return map->blk_m;
+}
+
+BLIS_INLINE dim_t bli_blkmap_blk_width( blkmap_t* map )
+{
+	return map->blk_n;
+}
+
+BLIS_INLINE dim_t bli_blkmap_num_blk_rows( blkmap_t* map )
+{
+	return map->m_blk;
+}
+
+BLIS_INLINE dim_t bli_blkmap_num_blk_cols( blkmap_t* map )
+{
+	return map->n_blk;
+}
+
+BLIS_INLINE bool bli_blkmap_is_nonzero( dim_t i, dim_t j, blkmap_t* map )
+{
+	return map->nz[ i + j * map->m_blk ];
+}
+
+// Block map modification
+
+BLIS_INLINE void bli_blkmap_set_nonzero( dim_t i, dim_t j, bool nz, blkmap_t* map )
+{
+	map->nz[ i + j * map->m_blk ] = nz;
+}
+
+// -----------------------------------------------------------------------------
+
+// Create a map for an m x n matrix partitioned into blk_m x blk_n blocks.
+// Initially, every block is marked as zero.
+BLIS_EXPORT_BLIS void bli_blkmap_create
+     (
+       dim_t     m,
+       dim_t     n,
+       dim_t     blk_m,
+       dim_t     blk_n,
+       blkmap_t* map
+     );
+
+// Create a map for the matrix referenced by a (ignoring any transposition)
+// in which each block that contains at least one nonzero element is marked
+// as nonzero.
+BLIS_EXPORT_BLIS void bli_blkmap_create_from_obj
+     (
+       dim_t     blk_m,
+       dim_t     blk_n,
+       obj_t*    a,
+       blkmap_t* map
+     );
+
+BLIS_EXPORT_BLIS void bli_blkmap_free
+     (
+       blkmap_t* map
+     );
+
+// Return the number of blocks that are marked as nonzero.
+BLIS_EXPORT_BLIS dim_t bli_blkmap_nnz_blks
+     (
+       blkmap_t* map
+     );
+
+// Find the ranges of columns [l0,l1) of rows i0:i1 of a matrix with k
+// columns that intersect at least one nonzero block, where element (i,l)
+// of the matrix is element (off_i+i,off_l+l) of the matrix described by the
+// map, or element (off_l+l,off_i+i) if trans is TRUE. The ranges are
+// written as pairs to runs, which must have room for k+2 elements, with
+// adjacent ranges merged, and the number of ranges is returned.
+dim_t bli_blkmap_nz_runs
+     (
+       blkmap_t* map,
+       bool      trans,
+       dim_t     off_i,
+       dim_t     off_l,
+       dim_t     i0,
+       dim_t     i1,
+       dim_t     k,
+       dim_t*    runs
+     );
+
+#endif
+
@@ -149,7 +149,9 @@ err_t bli_check_valid_datatype( num_t dt )
 	     dt != BLIS_SCOMPLEX &&
 	     dt != BLIS_DCOMPLEX &&
 	     dt != BLIS_INT &&
-	     dt != BLIS_CONSTANT )
+	     dt != BLIS_CONSTANT &&
+	     dt != BLIS_BFLOAT16 &&
+	     dt != BLIS_FLOAT16 )
 		e_val = BLIS_INVALID_DATATYPE;
 
 	return e_val;
@@ -396,6 +398,25 @@ err_t bli_check_conformal_dims( obj_t* a, obj_t* b )
 	return e_val;
 }
 
+err_t bli_check_blkmap_dims( obj_t* a )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( bli_obj_is_block_sparse( a ) )
+	{
+		blkmap_t* map = bli_obj_blkmap( a );
+		bool      tr  = bli_obj_blkmap_is_trans( a );
+		dim_t     m   = bli_obj_blkmap_row_off( a ) + bli_obj_length( a );
+		dim_t     n   = bli_obj_blkmap_col_off( a ) + bli_obj_width( a );
+
+		if ( m > ( tr ? bli_blkmap_width( map ) : bli_blkmap_length( map ) ) ||
+		     n > ( tr ? bli_blkmap_length( map ) : bli_blkmap_width( map ) ) )
+			e_val = BLIS_NONCONFORMAL_DIMENSIONS;
+	}
+
+	return e_val;
+}
+
 err_t bli_check_level3_dims( obj_t* a, obj_t* b, obj_t* c )
 {
 	err_t e_val = BLIS_SUCCESS;
@@ -67,6 +67,7 @@ err_t bli_check_consistent_precisions( num_t dt_a, num_t dt_b );
 err_t bli_check_consistent_object_precisions( obj_t* a, obj_t* b );
 
 err_t bli_check_conformal_dims( obj_t* a, obj_t* b );
+err_t bli_check_blkmap_dims( obj_t* a );
 err_t bli_check_level3_dims( obj_t* a, obj_t* b, obj_t* c );
 err_t bli_check_scalar_object( obj_t* a );
 err_t bli_check_vector_object( obj_t* a );
@@ -243,6 +243,46 @@ void bli_cntl_free_wo_thrinfo
 	bli_cntl_free_node( rntm, cntl );
 }
 
+void bli_cntl_release_mem
+     (
+       rntm_t*    rntm,
+       cntl_t*    cntl,
+       thrinfo_t* thread
+     )
+{
+	// Base case: simply return when asked to visit NULL nodes.
+	if ( cntl == NULL ) return;
+
+	cntl_t* cntl_sub_prenode = bli_cntl_sub_prenode( cntl );
+	cntl_t* cntl_sub_node    = bli_cntl_sub_node( cntl );
+	mem_t*  cntl_pack_mem    = bli_cntl_pack_mem( cntl );
+
+	// As in bli_cntl_free_w_thrinfo(), the thrinfo_t tree may not be built
+	// out all the way.
+	thrinfo_t* thread_sub_prenode = NULL;
+	thrinfo_t* thread_sub_node    = NULL;
+
+	if ( thread != NULL )
+	{
+		thread_sub_prenode = bli_thrinfo_sub_prenode( thread );
+		thread_sub_node    = bli_thrinfo_sub_node( thread );
+	}
+
+	bli_cntl_release_mem( rntm, cntl_sub_prenode, thread_sub_prenode );
+	bli_cntl_release_mem( rntm, cntl_sub_node,    thread_sub_node );
+
+	// Only the chief of each thread group releases the group's pack mem_t
+	// entry back to the memory broker, but every thread clears its copy so
+	// that the next operation that uses the tree acquires a new block.
+	if ( bli_mem_is_alloc( cntl_pack_mem ) )
+	{
+		if ( thread != NULL && bli_thread_am_ochief( thread ) )
+			bli_membrk_release( rntm, cntl_pack_mem );
+		else
+			bli_mem_clear( cntl_pack_mem );
+	}
+}
+
 // -----------------------------------------------------------------------------
 
 cntl_t* bli_cntl_copy
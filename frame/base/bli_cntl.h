@@ -103,6 +103,13 @@ BLIS_EXPORT_BLIS void bli_cntl_free_wo_thrinfo
        cntl_t*    cntl
      );
 
+BLIS_EXPORT_BLIS void bli_cntl_release_mem
+     (
+       rntm_t*    rntm,
+       cntl_t*    cntl,
+       thrinfo_t* thread
+     );
+
 BLIS_EXPORT_BLIS cntl_t* bli_cntl_copy
      (
        rntm_t* rntm,
@@ -1264,6 +1264,89 @@ void bli_cntx_set_l3_sup_kers( dim_t n_ukrs, ... )
 
 // -----------------------------------------------------------------------------
 
+void bli_cntx_set_l3_gemmi_ukr
+     (
+       gemmi_t type,
+       void_fp ukr,
+       dim_t   mr,
+       dim_t   nr,
+       dim_t   mc,
+       dim_t   kc,
+       dim_t   nc,
+       cntx_t* cntx
+     )
+{
+	// This function can be called from the bli_cntx_init_*() function for
+	// a particular architecture if the kernel developer wishes to use an
+	// optimized integer gemm micro-kernel. The blocksizes are specified
+	// alongside the micro-kernel since they apply only to it. The cache
+	// blocksizes must be multiples of the corresponding register
+	// blocksizes, and kc must also be a multiple of the number of k
+	// iterations interleaved by the micro-kernel (4 for u8s8s32 and 2
+	// for s16s16s32).
+
+	void_fp* cntx_l3_gemmi_ukrs = bli_cntx_l3_gemmi_ukrs_buf( cntx );
+	dim_t*   cntx_blkszs        = cntx->l3_gemmi_blkszs[ type ];
+
+	cntx_l3_gemmi_ukrs[ type ] = ukr;
+
+	cntx_blkszs[ BLIS_MR ] = mr;
+	cntx_blkszs[ BLIS_NR ] = nr;
+	cntx_blkszs[ BLIS_MC ] = mc;
+	cntx_blkszs[ BLIS_KC ] = kc;
+	cntx_blkszs[ BLIS_NC ] = nc;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cntx_set_l3_spmm_ukr
+     (
+       num_t   dt,
+       void_fp ukr,
+       dim_t   nr,
+       cntx_t* cntx
+     )
+{
+	// This function can be called from the bli_cntx_init_*() function for
+	// a particular architecture if the kernel developer wishes to use an
+	// optimized sparse-times-dense (spmm) micro-kernel. The micro-kernel
+	// updates nr columns of one row of C at a time, and so the dense
+	// operand is packed into micro-panels nr columns wide.
+
+	func_t*  cntx_l3_spmm_ukrs = bli_cntx_l3_spmm_ukrs_buf( cntx );
+	blksz_t* cntx_l3_spmm_nr   = bli_cntx_l3_spmm_nr_buf( cntx );
+
+	bli_func_set_dt( ukr, dt, cntx_l3_spmm_ukrs );
+
+	bli_blksz_set_def( nr, dt, cntx_l3_spmm_nr );
+	bli_blksz_set_max( nr, dt, cntx_l3_spmm_nr );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cntx_set_l3_gemmsum_ukr
+     (
+       num_t   dt,
+       void_fp ukr,
+       cntx_t* cntx
+     )
+{
+	// This function can be called from the bli_cntx_init_*() function for
+	// a particular architecture if the kernel developer wishes to use an
+	// optimized multi-target gemm micro-kernel, which adds one product of
+	// packed micro-panels to several micro-tiles of C, each with its own
+	// scalar. The micro-kernel must use the same register blocksizes,
+	// packing format, and storage preference as the native gemm
+	// micro-kernel for the same datatype, since it consumes micro-panels
+	// packed for the latter.
+
+	func_t* cntx_l3_gemmsum_ukrs = bli_cntx_l3_gemmsum_ukrs_buf( cntx );
+
+	bli_func_set_dt( ukr, dt, cntx_l3_gemmsum_ukrs );
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_cntx_set_l1f_kers( dim_t n_kers, ... )
 {
 	// This function can be called from the bli_cntx_init_*() function for
@@ -1618,6 +1701,25 @@ void bli_cntx_set_packm_kers( dim_t n_kers, ... )
 
 // -----------------------------------------------------------------------------
 
+void bli_cntx_set_packm_half_ker
+     (
+       half_t  type,
+       void_fp ker,
+       cntx_t* cntx
+     )
+{
+	// This function can be called from the bli_cntx_init_*() function for
+	// a particular architecture if the kernel developer wishes to use an
+	// optimized kernel for widening a micro-panel stored in the given
+	// half-precision format to single precision while packing it.
+
+	void_fp* cntx_packm_half_kers = bli_cntx_packm_half_kers_buf( cntx );
+
+	cntx_packm_half_kers[ type ] = ker;
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_cntx_print( cntx_t* cntx )
 {
 	dim_t i;
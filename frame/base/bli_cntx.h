@@ -56,11 +56,20 @@ typedef struct cntx_s
 	func_t*   l3_sup_kers;
 	mbool_t*  l3_sup_kers_prefs;
 
+	void_fp*  l3_gemmi_ukrs;
+	dim_t**   l3_gemmi_blkszs;
+
+	func_t*   l3_spmm_ukrs;
+	blksz_t*  l3_spmm_nr;
+
+	func_t*   l3_gemmsum_ukrs;
+
 	func_t*   l1f_kers;
 	func_t*   l1v_kers;
 
 	func_t*   packm_kers;
 	func_t*   unpackm_kers;
+	void_fp*  packm_half_kers;
 
 	ind_t     method;
 	pack_t    schema_a;
@@ -116,6 +125,22 @@ BLIS_INLINE mbool_t* bli_cntx_l3_sup_kers_prefs_buf( cntx_t* cntx )
 {
 	return cntx->l3_sup_kers_prefs;
 }
+BLIS_INLINE void_fp* bli_cntx_l3_gemmi_ukrs_buf( cntx_t* cntx )
+{
+	return cntx->l3_gemmi_ukrs;
+}
+BLIS_INLINE func_t* bli_cntx_l3_spmm_ukrs_buf( cntx_t* cntx )
+{
+	return &cntx->l3_spmm_ukrs;
+}
+BLIS_INLINE blksz_t* bli_cntx_l3_spmm_nr_buf( cntx_t* cntx )
+{
+	return &cntx->l3_spmm_nr;
+}
+BLIS_INLINE func_t* bli_cntx_l3_gemmsum_ukrs_buf( cntx_t* cntx )
+{
+	return &cntx->l3_gemmsum_ukrs;
+}
 BLIS_INLINE func_t* bli_cntx_l1f_kers_buf( cntx_t* cntx )
 {
 	return cntx->l1f_kers;
@@ -132,6 +157,10 @@ BLIS_INLINE func_t* bli_cntx_unpackm_kers_buf( cntx_t* cntx )
 {
 	return cntx->unpackm_kers;
 }
+BLIS_INLINE void_fp* bli_cntx_packm_half_kers_buf( cntx_t* cntx )
+{
+	return cntx->packm_half_kers;
+}
 BLIS_INLINE ind_t bli_cntx_method( cntx_t* cntx )
 {
 	return cntx->method;
@@ -387,6 +416,45 @@ BLIS_INLINE bool bli_cntx_get_l3_sup_ker_prefs_dt( num_t dt, stor3_t stor_id, cn
 
 // -----------------------------------------------------------------------------
 
+BLIS_INLINE void_fp bli_cntx_get_l3_gemmi_ukr( gemmi_t type, cntx_t* cntx )
+{
+	void_fp* funcs = bli_cntx_l3_gemmi_ukrs_buf( cntx );
+
+	return funcs[ type ];
+}
+
+BLIS_INLINE dim_t bli_cntx_get_l3_gemmi_blksz( gemmi_t type, bszid_t bs_id, cntx_t* cntx )
+{
+	return cntx->l3_gemmi_blkszs[ type ][ bs_id ];
+}
+
+// -----------------------------------------------------------------------------
+
+BLIS_INLINE void_fp bli_cntx_get_l3_spmm_ukr_dt( num_t dt, cntx_t* cntx )
+{
+	func_t* func = bli_cntx_l3_spmm_ukrs_buf( cntx );
+
+	return bli_func_get_dt( dt, func );
+}
+
+BLIS_INLINE dim_t bli_cntx_get_l3_spmm_nr_dt( num_t dt, cntx_t* cntx )
+{
+	blksz_t* blksz = bli_cntx_l3_spmm_nr_buf( cntx );
+
+	return bli_blksz_get_def( dt, blksz );
+}
+
+// -----------------------------------------------------------------------------
+
+BLIS_INLINE void_fp bli_cntx_get_l3_gemmsum_ukr_dt( num_t dt, cntx_t* cntx )
+{
+	func_t* func = bli_cntx_l3_gemmsum_ukrs_buf( cntx );
+
+	return bli_func_get_dt( dt, func );
+}
+
+// -----------------------------------------------------------------------------
+
 BLIS_INLINE func_t* bli_cntx_get_l1f_kers( l1fkr_t ker_id, cntx_t* cntx )
 {
 	func_t* funcs = bli_cntx_l1f_kers_buf( cntx );
@@ -491,6 +559,13 @@ BLIS_INLINE void_fp bli_cntx_get_unpackm_ker_dt( num_t dt, l1mkr_t ker_id, cntx_
 	return fp;
 }
 
+BLIS_INLINE void_fp bli_cntx_get_packm_half_ker( half_t type, cntx_t* cntx )
+{
+	void_fp* funcs = bli_cntx_packm_half_kers_buf( cntx );
+
+	return funcs[ type ];
+}
+
 // -----------------------------------------------------------------------------
 
 BLIS_INLINE bool bli_cntx_l3_nat_ukr_prefers_rows_dt( num_t dt, l3ukr_t ukr_id, cntx_t* cntx )
@@ -745,9 +820,14 @@ BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_handlers( dim_t n_ops, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_blkszs( dim_t n_bs, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_l3_sup_kers( dim_t n_ukrs, ... );
 
+BLIS_EXPORT_BLIS void bli_cntx_set_l3_gemmi_ukr( gemmi_t type, void_fp ukr, dim_t mr, dim_t nr, dim_t mc, dim_t kc, dim_t nc, cntx_t* cntx );
+BLIS_EXPORT_BLIS void bli_cntx_set_l3_spmm_ukr( num_t dt, void_fp ukr, dim_t nr, cntx_t* cntx );
+BLIS_EXPORT_BLIS void bli_cntx_set_l3_gemmsum_ukr( num_t dt, void_fp ukr, cntx_t* cntx );
+
 BLIS_EXPORT_BLIS void bli_cntx_set_l1f_kers( dim_t n_kers, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_l1v_kers( dim_t n_kers, ... );
 BLIS_EXPORT_BLIS void bli_cntx_set_packm_kers( dim_t n_kers, ... );
+BLIS_EXPORT_BLIS void bli_cntx_set_packm_half_ker( half_t type, void_fp ker, cntx_t* cntx );
 
 BLIS_EXPORT_BLIS void bli_cntx_print( cntx_t* cntx );
 
@@ -505,6 +505,10 @@ arch_t bli_cpuid_query_id( void )
 	uint32_t vendor, model, part, features;
 	arch_t envval = bli_env_check();
 
+#ifdef BLIS_CONFIG_ARMSVE
+			if ( BLIS_ARCH_ARMSVE == envval )
+				return BLIS_ARCH_ARMSVE;
+#endif
 #ifdef BLIS_CONFIG_THUNDERX2
 			if ( BLIS_ARCH_THUNDERX2 == envval )
 				return BLIS_ARCH_THUNDERX2;
@@ -549,6 +553,12 @@ arch_t bli_cpuid_query_id( void )
 			if ( bli_cpuid_is_a64fx( model, part, features ) )
 				return BLIS_ARCH_A64FX;
 #endif
+#ifdef BLIS_CONFIG_ARMSVE
+			// Any core that implements SVE (of any vector length) can use the
+			// vector-length agnostic armsve sub-configuration.
+			if ( bli_cpuid_is_armsve( model, part, features ) )
+				return BLIS_ARCH_ARMSVE;
+#endif
 #ifdef BLIS_CONFIG_THUNDERX2
 			if ( bli_cpuid_is_thunderx2( model, part, features ) )
 				return BLIS_ARCH_THUNDERX2;
@@ -600,6 +610,19 @@ bool bli_cpuid_is_a64fx
 	return model == BLIS_ARCH_A64FX;
 }
 
+bool bli_cpuid_is_armsve
+     (
+       uint32_t family,
+       uint32_t model,
+       uint32_t features
+     )
+{
+	// Check for expected CPU features.
+	const uint32_t expected = FEATURE_SVE;
+
+	return bli_cpuid_has_features( features, expected );
+}
+
 bool bli_cpuid_is_thunderx2
      (
        uint32_t family,
@@ -1101,15 +1124,6 @@ et al
 static uint32_t get_coretype(void) {
 	int implementer, part, midr_el1;
 
-// Fixme:  Presumably we should be checking the vector length as the
-// imlementation isn't length-agnostic.
-// #ifdef BLI_ARCH_ARMSVE          /* invented -- fixme */
-// 	if (!(getauxval(AT_HWCAP) & HWCAP_SVE)) {
-// 		/* Assuming no support for specific models */
-// 		return BLI_ARCH_ARMSVE;
-// 	}
-// #endif
-
 	if (!(getauxval(AT_HWCAP) & HWCAP_CPUID)) {
 		// Fixme:  We could try reading /sys and /proc here, as below.
 		// Find out if that could work when the HWCAP test fails.
@@ -1239,6 +1253,11 @@ uint32_t bli_cpuid_query
 	*features = 0;
 #if __linux__
 	*part	  = get_coretype();
+
+	// SVE is an optional extension of ARMv8.2+, so we record it as a
+	// feature rather than deducing it from the part number.
+	if ( getauxval( AT_HWCAP ) & HWCAP_SVE )
+		*features |= FEATURE_SVE;
 #endif
 
 	return VENDOR_ARM;
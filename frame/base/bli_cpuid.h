@@ -70,6 +70,7 @@ bool bli_cpuid_is_bulldozer( uint32_t family, uint32_t model, uint32_t features
 
 // ARM
 bool   bli_cpuid_is_a64fx( uint32_t model, uint32_t part, uint32_t features );
+bool   bli_cpuid_is_armsve( uint32_t model, uint32_t part, uint32_t features );
 bool   bli_cpuid_is_thunderx2( uint32_t model, uint32_t part, uint32_t features );
 bool   bli_cpuid_is_cortexa57( uint32_t model, uint32_t part, uint32_t features );
 bool   bli_cpuid_is_cortexa53( uint32_t model, uint32_t part, uint32_t features );
@@ -181,7 +182,8 @@ enum
 };
 enum
 {
-	FEATURE_NEON = 0x1
+	FEATURE_NEON = 0x1,
+	FEATURE_SVE  = 0x2
 };
 
 #elif defined __s390x__ ||  defined __s390x__ || defined __zarch__ || \
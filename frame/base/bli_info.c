@@ -148,6 +148,14 @@ gint_t bli_info_get_thread_part_jrir_rr( void )
 	return 0;
 #endif
 }
+gint_t bli_info_get_enable_hugepages( void )
+{
+#ifdef BLIS_ENABLE_HUGEPAGES
+	return 1;
+#else
+	return 0;
+#endif
+}
 gint_t bli_info_get_enable_memkind( void )
 {
 #ifdef BLIS_ENABLE_MEMKIND
@@ -72,6 +72,7 @@ BLIS_EXPORT_BLIS gint_t bli_info_get_enable_openmp( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_pthreads( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_thread_part_jrir_slab( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_thread_part_jrir_rr( void );
+BLIS_EXPORT_BLIS gint_t bli_info_get_enable_hugepages( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_memkind( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_sandbox( void );
 
@@ -33,8 +33,20 @@
 
 */
 
+// NOTE: MAP_ANONYMOUS, MAP_HUGETLB, and MADV_HUGEPAGE are not exposed by
+// glibc's headers when only _POSIX_C_SOURCE is defined (as it is in
+// bli_system.h), so we request the GNU extensions here, before any system
+// header gets included.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "blis.h"
 
+#ifndef BLIS_OS_WINDOWS
+#include <sys/mman.h>
+#endif
+
 //#define BLIS_ENABLE_MEM_TRACING
 
 // -----------------------------------------------------------------------------
@@ -134,6 +146,112 @@ void bli_free_intl( void* p )
 
 // -----------------------------------------------------------------------------
 
+// Each region returned by bli_malloc_hugepage() is preceded by a small
+// header that records the address and length of the underlying mapping so
+// that bli_free_hugepage() can munmap() it with only the pointer in hand.
+// The header is padded out to a full cache line so that the address
+// returned to the caller retains a reasonable alignment.
+typedef struct
+{
+	void*  map_addr;
+	size_t map_len;
+} hpghdr_t;
+
+void* bli_malloc_hugepage( size_t size )
+{
+#if defined(BLIS_OS_WINDOWS) || !defined(MAP_ANONYMOUS)
+
+	// No mmap(), so huge pages are not available; defer to the default
+	// pool allocator.
+	return BLIS_MALLOC_POOL( size );
+
+#else
+
+	const size_t hpg_size = BLIS_HUGEPAGE_SIZE;
+	const size_t hdr_size = BLIS_HUGEPAGE_HEADER_SIZE;
+
+	// Round the mapping up to a whole number of huge pages.
+	const size_t map_len  = ( ( size + hdr_size + hpg_size - 1 ) / hpg_size )
+	                        * hpg_size;
+	void*        map_addr = MAP_FAILED;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_malloc_hugepage(): size %ld, mapping length %ld\n",
+	        ( long )size, ( long )map_len );
+	fflush( stdout );
+	#endif
+
+	// First, try to map explicitly reserved huge pages. This fails unless
+	// the administrator has set aside pages via /proc/sys/vm/nr_hugepages.
+	#ifdef MAP_HUGETLB
+	map_addr = mmap( NULL, map_len, PROT_READ | PROT_WRITE,
+	                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+	#endif
+
+	if ( map_addr == MAP_FAILED )
+	{
+		// Fall back to an ordinary anonymous mapping. Over-allocate by one
+		// huge page so that we can trim the mapping to a huge-page boundary
+		// on both ends, which is a prerequisite for the kernel to back the
+		// region with transparent huge pages.
+		const size_t over_len  = map_len + hpg_size;
+		char*        over_addr = mmap( NULL, over_len, PROT_READ | PROT_WRITE,
+		                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+		if ( over_addr == MAP_FAILED ) return NULL;
+
+		const size_t head = ( hpg_size - ( ( uintptr_t )over_addr % hpg_size ) )
+		                    % hpg_size;
+		const size_t tail = over_len - head - map_len;
+
+		if ( head > 0 ) munmap( over_addr, head );
+		if ( tail > 0 ) munmap( over_addr + head + map_len, tail );
+
+		map_addr = over_addr + head;
+
+		// Ask for transparent huge pages. This is only advice; if THP is
+		// disabled system-wide the region is still usable as-is.
+		#ifdef MADV_HUGEPAGE
+		madvise( map_addr, map_len, MADV_HUGEPAGE );
+		#endif
+	}
+
+	hpghdr_t* hdr = map_addr;
+
+	hdr->map_addr = map_addr;
+	hdr->map_len  = map_len;
+
+	return ( char* )map_addr + hdr_size;
+
+#endif
+}
+
+void bli_free_hugepage( void* p )
+{
+#if defined(BLIS_OS_WINDOWS) || !defined(MAP_ANONYMOUS)
+
+	BLIS_FREE_POOL( p );
+
+#else
+
+	if ( p == NULL ) return;
+
+	hpghdr_t* hdr = ( hpghdr_t* )
+	                ( ( char* )p - BLIS_HUGEPAGE_HEADER_SIZE );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_free_hugepage(): unmapping length %ld\n",
+	        ( long )hdr->map_len );
+	fflush( stdout );
+	#endif
+
+	munmap( hdr->map_addr, hdr->map_len );
+
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
 void* bli_fmalloc_align
      (
        malloc_ft f,
@@ -51,6 +51,9 @@ void  bli_free_intl( void* p );
 BLIS_EXPORT_BLIS void* bli_malloc_user( size_t size );
 BLIS_EXPORT_BLIS void  bli_free_user( void* p );
 
+void* bli_malloc_hugepage( size_t size );
+void  bli_free_hugepage( void* p );
+
 // -----------------------------------------------------------------------------
 
 void* bli_fmalloc_align( malloc_ft f, size_t size, size_t align_size );
@@ -38,6 +38,28 @@
 
 static membrk_t global_membrk;
 
+static pool_t* bli_membrk_select_pool
+     (
+       dim_t     pool_index,
+       siz_t     req_size,
+       membrk_t* membrk
+     );
+static bool bli_membrk_cache_checkout
+     (
+       dim_t     pool_index,
+       siz_t     req_size,
+       pblk_t*   pblk,
+       pool_t**  pool,
+       membrk_t* membrk
+     );
+static bool bli_membrk_cache_checkin
+     (
+       dim_t     pool_index,
+       pblk_t*   pblk,
+       pool_t*   pool,
+       membrk_t* membrk
+     );
+
 // -----------------------------------------------------------------------------
 
 membrk_t* bli_membrk_query( void )
@@ -62,9 +84,17 @@ void bli_membrk_init
 	bli_membrk_set_malloc_fp( malloc_fp, membrk );
 	bli_membrk_set_free_fp( free_fp, membrk );
 
+	// An upper bound, in bytes, on the packing memory that an operation
+	// should require may be given via BLIS_POOL_MEM_CAP.
+	gint_t mem_cap = bli_env_get_var( "BLIS_POOL_MEM_CAP", 0 );
+
+	bli_membrk_set_mem_cap_of( bli_max( mem_cap, 0 ), membrk );
+
 	bli_membrk_init_mutex( membrk );
 #ifdef BLIS_ENABLE_PBA_POOLS
 	bli_membrk_init_pools( cntx, membrk );
+	bli_membrk_init_caches( membrk );
+	bli_membrk_apply_mem_cap( membrk );
 #endif
 }
 
@@ -79,6 +109,7 @@ void bli_membrk_finalize
 	bli_membrk_set_free_fp( NULL, membrk );
 
 #ifdef BLIS_ENABLE_PBA_POOLS
+	bli_membrk_flush_caches( membrk );
 	bli_membrk_finalize_pools( membrk );
 #endif
 	bli_membrk_finalize_mutex( membrk );
@@ -111,6 +142,41 @@ void bli_membrk_acquire_m
 	// Query the memory broker from the runtime.
 	membrk_t* membrk = bli_rntm_membrk( rntm );
 
+	// If the caller supplied a workspace, carve the block out of it rather
+	// than touching the pools or the heap. The block is aligned and offset
+	// in the same way as a block from the corresponding pool would be. If
+	// the workspace is exhausted, fall through to the usual code paths.
+	if ( bli_rntm_has_workspace( rntm ) )
+	{
+		siz_t align_size  = bli_membrk_align_size( membrk );
+		siz_t offset_size = 0;
+
+		if      ( buf_type == BLIS_BUFFER_FOR_A_BLOCK )
+		{ align_size  = BLIS_POOL_ADDR_ALIGN_SIZE_A;
+		  offset_size = BLIS_POOL_ADDR_OFFSET_SIZE_A; }
+		else if ( buf_type == BLIS_BUFFER_FOR_B_PANEL )
+		{ align_size  = BLIS_POOL_ADDR_ALIGN_SIZE_B;
+		  offset_size = BLIS_POOL_ADDR_OFFSET_SIZE_B; }
+		else if ( buf_type == BLIS_BUFFER_FOR_C_PANEL )
+		{ align_size  = BLIS_POOL_ADDR_ALIGN_SIZE_C;
+		  offset_size = BLIS_POOL_ADDR_OFFSET_SIZE_C; }
+
+		void* buf = bli_workspace_acquire( req_size, align_size,
+		                                   offset_size, rntm );
+
+		if ( buf != NULL )
+		{
+			// The pool field is NULL since this block did not come from a
+			// memory pool; bli_membrk_release() recognizes it by its
+			// address.
+			bli_mem_set_buffer( buf, mem );
+			bli_mem_set_buf_type( buf_type, mem );
+			bli_mem_set_pool( NULL, mem );
+			bli_mem_set_size( req_size, mem );
+
+			return;
+		}
+	}
 
 	if ( buf_type == BLIS_BUFFER_FOR_GEN_USE )
 	{
@@ -140,34 +206,43 @@ void bli_membrk_acquire_m
 		// and then recycled.
 
 		// Map the requested packed buffer type to a zero-based index, which
-		// we then use to select the corresponding memory pool.
+		// we then use to select the corresponding set of memory pools.
 		pi   = bli_packbuf_index( buf_type );
-		pool = bli_membrk_pool( pi, membrk );
 
 		// Extract the address of the pblk_t struct within the mem_t.
 		pblk = bli_mem_pblk( mem );
 
-		// Acquire the mutex associated with the membrk object.
-		bli_membrk_lock( membrk );
-
-		// BEGIN CRITICAL SECTION
+		// First try to reuse a block recently released by this thread, which
+		// avoids taking the membrk lock. If that fails, check out a block
+		// from the shared pools.
+		if ( !bli_membrk_cache_checkout( pi, req_size, pblk, &pool, membrk ) )
 		{
-
-			// Checkout a block from the pool. If the pool's blocks are too
-			// small, it will be reinitialized with blocks large enough to
-			// accommodate the requested block size. If the pool is exhausted,
-			// either because it is still empty or because all blocks have
-			// been checked out already, additional blocks will be allocated
-			// automatically, as-needed. Note that the addresses are stored
-			// directly into the mem_t struct since pblk is the address of
-			// the struct's pblk_t field.
-			bli_pool_checkout_block( req_size, pblk, pool );
-
+			// Acquire the mutex associated with the membrk object.
+			bli_membrk_lock( membrk );
+
+			// BEGIN CRITICAL SECTION
+			{
+
+				// Choose the size class (pool) from which to check out a block.
+				pool = bli_membrk_select_pool( pi, req_size, membrk );
+
+				// Checkout a block from the pool. If the pool's blocks are
+				// too small (which only happens when every size class was
+				// already in use), it will be reinitialized with blocks large
+				// enough to accommodate the requested block size. If the pool
+				// is exhausted, either because it is still empty or because
+				// all blocks have been checked out already, additional blocks
+				// will be allocated automatically, as-needed. Note that the
+				// addresses are stored directly into the mem_t struct since
+				// pblk is the address of the struct's pblk_t field.
+				bli_pool_checkout_block( req_size, pblk, pool );
+
+			}
+			// END CRITICAL SECTION
+
+			// Release the mutex associated with the membrk object.
+			bli_membrk_unlock( membrk );
 		}
-		// END CRITICAL SECTION
-
-		// Release the mutex associated with the membrk object.
-		bli_membrk_unlock( membrk );
 
 		// Query the block_size from the pblk_t. This will be at least
 		// req_size, perhaps larger.
@@ -211,7 +286,13 @@ void bli_membrk_release
 	#endif
 #endif
 
-	if ( buf_type == BLIS_BUFFER_FOR_GEN_USE )
+	if ( bli_workspace_owns( bli_mem_buffer( mem ), rntm ) )
+	{
+		// Blocks carved out of a caller-supplied workspace are reclaimed
+		// all at once, when the last live block is released.
+		bli_workspace_release( rntm );
+	}
+	else if ( buf_type == BLIS_BUFFER_FOR_GEN_USE )
 	{
 		free_ft free_fp = bli_membrk_free_fp( membrk );
 		void*   buf     = bli_mem_buffer( mem );
@@ -229,20 +310,27 @@ void bli_membrk_release
 		// Extract the address of the pblk_t struct within the mem_t struct.
 		pblk = bli_mem_pblk( mem );
 
-		// Acquire the mutex associated with the membrk object.
-		bli_membrk_lock( membrk );
-
-		// BEGIN CRITICAL SECTION
+		// Keep the block in this thread's cache, if there is room, so that
+		// the next checkout can avoid the membrk lock. Otherwise, return it
+		// to its pool.
+		if ( !bli_membrk_cache_checkin( bli_packbuf_index( buf_type ),
+		                                pblk, pool, membrk ) )
 		{
+			// Acquire the mutex associated with the membrk object.
+			bli_membrk_lock( membrk );
 
-			// Check the block back into the pool.
-			bli_pool_checkin_block( pblk, pool );
+			// BEGIN CRITICAL SECTION
+			{
 
-		}
-		// END CRITICAL SECTION
+				// Check the block back into the pool.
+				bli_pool_checkin_block( pblk, pool );
+
+			}
+			// END CRITICAL SECTION
 
-		// Release the mutex associated with the membrk object.
-		bli_membrk_unlock( membrk );
+			// Release the mutex associated with the membrk object.
+			bli_membrk_unlock( membrk );
+		}
 	}
 
 	// Clear the mem_t object so that it appears unallocated. This clears:
@@ -299,25 +387,404 @@ siz_t bli_membrk_pool_size
 	}
 	else
 	{
-		dim_t   pool_index;
-		pool_t* pool;
-
-		// Acquire the pointer to the pool corresponding to the buf_type
-		// provided.
-		pool_index = bli_packbuf_index( buf_type );
-		pool       = bli_membrk_pool( pool_index, membrk );
-
-		// Compute the pool "size" as the product of the block size
-		// and the number of blocks in the pool.
-		r_val = bli_pool_block_size( pool ) *
-		        bli_pool_num_blocks( pool );
+		dim_t pool_index = bli_packbuf_index( buf_type );
+		dim_t n_classes  = bli_membrk_num_size_classes_of( pool_index, membrk );
+
+		// Compute the pool "size" as the sum, over the size classes in use,
+		// of the product of the block size and the number of blocks.
+		r_val = 0;
+
+		for ( dim_t i = 0; i < n_classes; ++i )
+		{
+			pool_t* pool = bli_membrk_pool( pool_index, i, membrk );
+
+			r_val += bli_pool_block_size( pool ) *
+			         bli_pool_num_blocks( pool );
+		}
+	}
+
+	return r_val;
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_membrk_num_size_classes
+     (
+       packbuf_t buf_type
+     )
+{
+	membrk_t* membrk = bli_membrk_query();
+	dim_t     r_val;
+
+	bli_membrk_lock( membrk );
+	r_val = bli_membrk_num_size_classes_of( bli_packbuf_index( buf_type ),
+	                                        membrk );
+	bli_membrk_unlock( membrk );
+
+	return r_val;
+}
+
+siz_t bli_membrk_num_reinits
+     (
+       packbuf_t buf_type
+     )
+{
+	membrk_t* membrk = bli_membrk_query();
+	siz_t     r_val;
+
+	bli_membrk_lock( membrk );
+	r_val = bli_membrk_num_reinits_of( bli_packbuf_index( buf_type ),
+	                                   membrk );
+	bli_membrk_unlock( membrk );
+
+	return r_val;
+}
+
+void bli_membrk_reserve
+     (
+       num_t     dt,
+       dim_t     m,
+       dim_t     n,
+       dim_t     k,
+       dim_t     n_threads
+     )
+{
+	bli_init_once();
+
+#ifdef BLIS_ENABLE_PBA_POOLS
+	membrk_t* membrk = bli_membrk_query();
+
+	// Use the context that gemm would use for this datatype.
+	cntx_t*   cntx   = bli_gks_query_ind_cntx
+	                   (
+	                     bli_l3_ind_oper_find_avail( BLIS_GEMM, dt ), dt
+	                   );
+
+	// Determine how gemm would divide n_threads among its loops, and from
+	// that, how many blocks of A and panels of B would be packed at once.
+	rntm_t    rntm;
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( bli_max( n_threads, 1 ), &rntm );
+	bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT, m, n, k, &rntm );
+
+	const siz_t num_b = bli_rntm_jc_ways( &rntm ) *
+	                    bli_rntm_pc_ways( &rntm );
+	const siz_t num_a = num_b * bli_rntm_ic_ways( &rntm );
+
+	// Respect the cap on packing memory, if any, as gemm would.
+	cntx_t    cntx_cap;
+
+	cntx = bli_membrk_cap_cntx( dt, m, n, k, &rntm, cntx, &cntx_cap );
+
+	siz_t bs_a, bs_b, bs_c;
+
+	bli_membrk_compute_pool_block_sizes_dt_mnk( dt, m, n, k,
+	                                            &bs_a, &bs_b, &bs_c, cntx );
+
+	const dim_t index[2] = { bli_packbuf_index( BLIS_BUFFER_FOR_A_BLOCK ),
+	                         bli_packbuf_index( BLIS_BUFFER_FOR_B_PANEL ) };
+	const siz_t size[2]  = { bs_a,  bs_b  };
+	const siz_t num[2]   = { num_a, num_b };
+
+	bli_membrk_lock( membrk );
+
+	// Blocks sitting in the per-thread caches would not be counted as
+	// available below.
+	bli_membrk_flush_caches( membrk );
+
+	for ( dim_t i = 0; i < 2; ++i )
+	{
+		// Select the size class that a request of this size would be
+		// served from.
+		pool_t* pool = bli_membrk_select_pool( index[i], size[i], membrk );
+
+		const siz_t num_blocks = bli_pool_num_blocks( pool );
+		const siz_t num_avail  = num_blocks - bli_pool_top_index( pool );
+
+		if ( num_avail < num[i] )
+		{
+			bli_pool_grow( num[i] - num_avail, pool );
+
+			// Touch the new blocks so that the page faults happen now
+			// rather than during the first operations that use them.
+			pblk_t* block_ptrs = bli_pool_block_ptrs( pool );
+
+			for ( siz_t j = num_blocks; j < bli_pool_num_blocks( pool ); ++j )
+				memset( bli_pblk_buf( &block_ptrs[j] ), 0,
+				        bli_pblk_block_size( &block_ptrs[j] ) );
+		}
 	}
 
+	bli_membrk_unlock( membrk );
+#endif
+
+	// Also make room for the threads' small blocks.
+	bli_sba_reserve( n_threads );
+}
+
+void bli_membrk_trim
+     (
+       siz_t     target_size
+     )
+{
+	bli_init_once();
+
+	membrk_t* membrk = bli_membrk_query();
+
+	bli_membrk_lock( membrk );
+	bli_membrk_trim_pools( target_size, membrk );
+	bli_membrk_unlock( membrk );
+}
+
+siz_t bli_membrk_total_size( void )
+{
+	membrk_t* membrk = bli_membrk_query();
+	siz_t     r_val;
+
+	bli_membrk_lock( membrk );
+	r_val = bli_membrk_pool_size( membrk, BLIS_BUFFER_FOR_A_BLOCK ) +
+	        bli_membrk_pool_size( membrk, BLIS_BUFFER_FOR_B_PANEL ) +
+	        bli_membrk_pool_size( membrk, BLIS_BUFFER_FOR_C_PANEL );
+	bli_membrk_unlock( membrk );
+
 	return r_val;
 }
 
+void bli_membrk_set_mem_cap
+     (
+       siz_t     mem_cap
+     )
+{
+	bli_init_once();
+
+	membrk_t* membrk = bli_membrk_query();
+
+	bli_membrk_lock( membrk );
+	bli_membrk_set_mem_cap_of( mem_cap, membrk );
+	bli_membrk_apply_mem_cap( membrk );
+	bli_membrk_unlock( membrk );
+}
+
+siz_t bli_membrk_mem_cap( void )
+{
+	return bli_membrk_mem_cap_of( bli_membrk_query() );
+}
+
+cntx_t* bli_membrk_cap_cntx
+     (
+       num_t     dt,
+       dim_t     m,
+       dim_t     n,
+       dim_t     k,
+       rntm_t*   rntm,
+       cntx_t*   cntx,
+       cntx_t*   cntx_cap
+     )
+{
+	const siz_t mem_cap = bli_membrk_mem_cap_of( bli_membrk_query() );
+
+	// In the common case that no cap is in effect, use the context as-is.
+	if ( mem_cap == 0 ) return cntx;
+
+	// Count the blocks of A and panels of B that are packed at once.
+	const siz_t num_b   = bli_rntm_jc_ways( rntm ) * bli_rntm_pc_ways( rntm );
+	const siz_t num_a   = num_b * bli_rntm_ic_ways( rntm );
+
+	const dim_t mr      = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t nr      = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t kc_min  = bli_max( mr, nr );
+
+	cntx_t*     cntx_r  = cntx;
+
+	while ( TRUE )
+	{
+		siz_t bs_a, bs_b, bs_c;
+
+		bli_membrk_compute_pool_block_sizes_dt_mnk( dt, m, n, k,
+		                                            &bs_a, &bs_b, &bs_c, cntx_r );
+
+		if ( num_a * bs_a + num_b * bs_b <= mem_cap ) break;
+
+		// Only the part of each cache blocksize that the problem actually
+		// uses matters.
+		const dim_t mc_use = bli_min( bli_cntx_get_blksz_max_dt( dt, BLIS_MC, cntx_r ), m );
+		const dim_t kc_use = bli_min( bli_cntx_get_blksz_max_dt( dt, BLIS_KC, cntx_r ), k );
+		const dim_t nc_use = bli_min( bli_cntx_get_blksz_max_dt( dt, BLIS_NC, cntx_r ), n );
+
+		bszid_t bs_id;
+		dim_t   b_new;
+
+		// Halve NC or MC, depending on whether the panels of B or the
+		// blocks of A take up more space, keeping them multiples of the
+		// register blocksizes. Halve KC once neither can be reduced further.
+		if      ( bs_a <= bs_b && nr < nc_use )
+		{ bs_id = BLIS_NC; b_new = bli_max( nr, ( nc_use / 2 ) / nr * nr ); }
+		else if ( mr < mc_use )
+		{ bs_id = BLIS_MC; b_new = bli_max( mr, ( mc_use / 2 ) / mr * mr ); }
+		else if ( nr < nc_use )
+		{ bs_id = BLIS_NC; b_new = bli_max( nr, ( nc_use / 2 ) / nr * nr ); }
+		else if ( kc_min < kc_use )
+		{ bs_id = BLIS_KC; b_new = bli_max( kc_min, kc_use / 2 ); }
+		else
+		{
+			// The blocking cannot be reduced any further, so the operation
+			// will simply need more memory than the cap allows.
+			break;
+		}
+
+		// Modify a copy of the context, never the caller's.
+		if ( cntx_r == cntx )
+		{
+			*cntx_cap = *cntx;
+			cntx_r    = cntx_cap;
+		}
+
+		blksz_t* bs = bli_cntx_get_blksz( bs_id, cntx_r );
+
+		bli_blksz_set_def( b_new, dt, bs );
+		bli_blksz_set_max( b_new, dt, bs );
+	}
+
+	return cntx_r;
+}
+
 // -----------------------------------------------------------------------------
 
+// Records whether the packing block pools were initialized to use huge
+// pages.
+static bool membrk_hugepages = FALSE;
+
+bool bli_membrk_hugepages_enabled( void )
+{
+	return membrk_hugepages;
+}
+
+static bool bli_membrk_hugepages_init_from_env( void )
+{
+	// Try to read BLIS_HUGEPAGES, defaulting to -1 if it is unset.
+	gint_t hugepages_env = bli_env_get_var( "BLIS_HUGEPAGES", -1 );
+
+	// Enforce the default behavior first, then check for affirmative FALSE,
+	// and finally assume anything else is TRUE.
+	if      ( hugepages_env == -1 )
+	{
+		#ifdef BLIS_ENABLE_HUGEPAGES
+		return TRUE;
+		#else
+		return FALSE;
+		#endif
+	}
+	else if ( hugepages_env ==  0 ) return FALSE;
+	else                            return TRUE;
+}
+
+static siz_t bli_membrk_hugepage_block_size
+     (
+       siz_t block_size,
+       siz_t align_size,
+       siz_t offset_size
+     )
+{
+	// Empty pools stay empty.
+	if ( block_size == 0 ) return 0;
+
+	// Account for everything that bli_pool_alloc_block() and
+	// bli_fmalloc_align() add on top of the block itself, along with the
+	// header used by bli_malloc_hugepage(), and then round the total up to
+	// a multiple of the huge page size.
+	const siz_t overhead = offset_size + align_size + sizeof( void* ) +
+	                       BLIS_HUGEPAGE_HEADER_SIZE;
+	const siz_t hpg_size = BLIS_HUGEPAGE_SIZE;
+	const siz_t total    = ( ( block_size + overhead + hpg_size - 1 ) /
+	                         hpg_size ) * hpg_size;
+
+	return total - overhead;
+}
+
+static pool_t* bli_membrk_select_pool
+     (
+       dim_t     pool_index,
+       siz_t     req_size,
+       membrk_t* membrk
+     )
+{
+	const dim_t n_classes   = bli_membrk_num_size_classes_of( pool_index, membrk );
+	pool_t*     pool_fit    = NULL;
+	pool_t*     pool_max    = NULL;
+	pool_t*     pool_unused = NULL;
+
+	// Find the size class with the smallest blocks that can still hold
+	// req_size bytes. Along the way, note the class with the largest blocks
+	// and any class that has no blocks allocated.
+	for ( dim_t i = 0; i < n_classes; ++i )
+	{
+		pool_t* pool = bli_membrk_pool( pool_index, i, membrk );
+		siz_t   bs   = bli_pool_block_size( pool );
+
+		if ( req_size <= bs &&
+		     ( pool_fit == NULL || bs < bli_pool_block_size( pool_fit ) ) )
+			pool_fit = pool;
+
+		if ( pool_max == NULL || bli_pool_block_size( pool_max ) < bs )
+			pool_max = pool;
+
+		if ( pool_unused == NULL && bli_pool_num_blocks( pool ) == 0 )
+			pool_unused = pool;
+	}
+
+	if ( pool_fit != NULL ) return pool_fit;
+
+	// No size class is large enough. If possible, size a class that has no
+	// blocks yet (either one already in use or the next unused one) for this
+	// request, which costs nothing beyond allocating its blocks on demand.
+	if ( pool_unused == NULL && n_classes < bli_membrk_max_size_classes( membrk ) )
+	{
+		pool_unused = bli_membrk_pool( pool_index, n_classes, membrk );
+
+		bli_membrk_set_num_size_classes_of( n_classes + 1, pool_index, membrk );
+	}
+
+	// When huge pages are in use, grow the block size to fill the last huge
+	// page, as was done for the initial block sizes.
+	pool_t* pool_new   = ( pool_unused != NULL ? pool_unused : pool_max );
+	siz_t   block_size = req_size;
+
+	if ( membrk_hugepages )
+		block_size = bli_membrk_hugepage_block_size
+		             (
+		               block_size,
+		               bli_pool_align_size( pool_new ),
+		               bli_pool_offset_size( pool_new )
+		             );
+
+	if ( pool_unused != NULL )
+	{
+		bli_pool_set_block_size( block_size, pool_unused );
+
+		return pool_unused;
+	}
+
+	// Otherwise, every size class is in use and holds blocks. Sacrifice the
+	// class with the largest blocks by reinitializing it with larger blocks.
+	// Any of its blocks that are currently checked out will be freed when
+	// they are checked back in.
+	bli_pool_reinit
+	(
+	  bli_pool_num_blocks( pool_max ),
+	  bli_pool_block_ptrs_len( pool_max ),
+	  block_size,
+	  bli_pool_align_size( pool_max ),
+	  bli_pool_offset_size( pool_max ),
+	  pool_max
+	);
+
+	bli_membrk_set_num_reinits_of( bli_membrk_num_reinits_of( pool_index, membrk ) + 1,
+	                               pool_index, membrk );
+
+	return pool_max;
+}
+
 void bli_membrk_init_pools
      (
        cntx_t*   cntx,
@@ -329,11 +796,6 @@ void bli_membrk_init_pools
 	const dim_t index_b      = bli_packbuf_index( BLIS_BUFFER_FOR_B_PANEL );
 	const dim_t index_c      = bli_packbuf_index( BLIS_BUFFER_FOR_C_PANEL );
 
-	// Alias the pool addresses to convenient identifiers.
-	pool_t*     pool_a       = bli_membrk_pool( index_a, membrk );
-	pool_t*     pool_b       = bli_membrk_pool( index_b, membrk );
-	pool_t*     pool_c       = bli_membrk_pool( index_c, membrk );
-
 	// Start with empty pools.
 	const dim_t num_blocks_a = 0;
 	const dim_t num_blocks_b = 0;
@@ -369,13 +831,68 @@ void bli_membrk_init_pools
 	                                     &block_size_c,
 	                                     cntx );
 
-	// Initialize the memory pools for A, B, and C.
-	bli_pool_init( num_blocks_a, block_ptrs_len_a, block_size_a, align_size_a,
-	               offset_size_a, malloc_fp, free_fp, pool_a );
-	bli_pool_init( num_blocks_b, block_ptrs_len_b, block_size_b, align_size_b,
-	               offset_size_b, malloc_fp, free_fp, pool_b );
-	bli_pool_init( num_blocks_c, block_ptrs_len_c, block_size_c, align_size_c,
-	               offset_size_c, malloc_fp, free_fp, pool_c );
+	// Decide whether the pools should be backed by huge pages. The
+	// configure-time choice may be overridden via BLIS_HUGEPAGES.
+	membrk_hugepages = bli_membrk_hugepages_init_from_env();
+
+	if ( membrk_hugepages )
+	{
+		malloc_fp = bli_malloc_hugepage;
+		free_fp   = bli_free_hugepage;
+
+		// Every allocation is rounded up to a whole number of huge pages
+		// anyway, so grow each block to use the slack rather than waste it.
+		block_size_a = bli_membrk_hugepage_block_size( block_size_a,
+		                                               align_size_a,
+		                                               offset_size_a );
+		block_size_b = bli_membrk_hugepage_block_size( block_size_b,
+		                                               align_size_b,
+		                                               offset_size_b );
+		block_size_c = bli_membrk_hugepage_block_size( block_size_c,
+		                                               align_size_c,
+		                                               offset_size_c );
+	}
+
+	// Initialize the memory pools for A, B, and C. The first size class of
+	// each starts out with the block size implied by the context; the
+	// remaining classes start out empty (with a block size of zero) and are
+	// sized when they are first put into use.
+	for ( dim_t i = 0; i < BLIS_POOL_MAX_SIZE_CLASSES; ++i )
+	{
+		const siz_t bs_a = ( i == 0 ? block_size_a : 0 );
+		const siz_t bs_b = ( i == 0 ? block_size_b : 0 );
+		const siz_t bs_c = ( i == 0 ? block_size_c : 0 );
+
+		bli_pool_init( num_blocks_a, block_ptrs_len_a, bs_a, align_size_a,
+		               offset_size_a, malloc_fp, free_fp,
+		               bli_membrk_pool( index_a, i, membrk ) );
+		bli_pool_init( num_blocks_b, block_ptrs_len_b, bs_b, align_size_b,
+		               offset_size_b, malloc_fp, free_fp,
+		               bli_membrk_pool( index_b, i, membrk ) );
+		bli_pool_init( num_blocks_c, block_ptrs_len_c, bs_c, align_size_c,
+		               offset_size_c, malloc_fp, free_fp,
+		               bli_membrk_pool( index_c, i, membrk ) );
+	}
+
+	// Only the first size class is in use initially.
+	bli_membrk_set_num_size_classes_of( 1, index_a, membrk );
+	bli_membrk_set_num_size_classes_of( 1, index_b, membrk );
+	bli_membrk_set_num_size_classes_of( 1, index_c, membrk );
+
+	bli_membrk_set_num_reinits_of( 0, index_a, membrk );
+	bli_membrk_set_num_reinits_of( 0, index_b, membrk );
+	bli_membrk_set_num_reinits_of( 0, index_c, membrk );
+
+	// Determine how many size classes may be put into use. The default of
+	// BLIS_POOL_MAX_SIZE_CLASSES may be lowered via BLIS_POOL_SIZE_CLASSES;
+	// a value of 1 restores a single block size per pool, where larger
+	// requests cause the pool to be reinitialized.
+	gint_t max_classes = bli_env_get_var( "BLIS_POOL_SIZE_CLASSES", -1 );
+
+	if ( max_classes < 1 || BLIS_POOL_MAX_SIZE_CLASSES < max_classes )
+		max_classes = BLIS_POOL_MAX_SIZE_CLASSES;
+
+	bli_membrk_set_max_size_classes( max_classes, membrk );
 }
 
 void bli_membrk_finalize_pools
@@ -388,15 +905,190 @@ void bli_membrk_finalize_pools
 	dim_t   index_b = bli_packbuf_index( BLIS_BUFFER_FOR_B_PANEL );
 	dim_t   index_c = bli_packbuf_index( BLIS_BUFFER_FOR_C_PANEL );
 
-	// Alias the pool addresses to convenient identifiers.
-	pool_t* pool_a  = bli_membrk_pool( index_a, membrk );
-	pool_t* pool_b  = bli_membrk_pool( index_b, membrk );
-	pool_t* pool_c  = bli_membrk_pool( index_c, membrk );
+	// Finalize every size class of the memory pools for A, B, and C. (All
+	// of them were initialized, even those never put into use.)
+	for ( dim_t i = 0; i < BLIS_POOL_MAX_SIZE_CLASSES; ++i )
+	{
+		bli_pool_finalize( bli_membrk_pool( index_a, i, membrk ) );
+		bli_pool_finalize( bli_membrk_pool( index_b, i, membrk ) );
+		bli_pool_finalize( bli_membrk_pool( index_c, i, membrk ) );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_membrk_init_caches
+     (
+       membrk_t* membrk
+     )
+{
+	for ( dim_t i = 0; i < BLIS_POOL_CACHE_SLOTS; ++i )
+		bli_pcache_init( bli_membrk_cache( i, membrk ) );
+
+	// The per-thread caches are used unless BLIS_POOL_CACHE is set to 0.
+	gint_t cache_env = bli_env_get_var( "BLIS_POOL_CACHE", -1 );
+
+	bli_membrk_set_use_caches( cache_env != 0, membrk );
+}
+
+void bli_membrk_flush_caches
+     (
+       membrk_t* membrk
+     )
+{
+	pblk_t  pblk;
+	pool_t* pool;
+
+	// NOTE: This function checks blocks into the pools and therefore must
+	// be called either with the membrk lock held or while no other thread
+	// is using the membrk (ie: during finalization).
+
+	for ( dim_t i = 0; i < BLIS_POOL_CACHE_SLOTS; ++i )
+	{
+		pcache_t* cache = bli_membrk_cache( i, membrk );
+
+		// Caches are only ever held briefly (and never while waiting on the
+		// membrk lock), so spinning here is safe.
+		while ( !bli_pcache_trylock( cache ) ) ;
+
+		// Return every cached block to the pool from which it was checked
+		// out. Blocks from pools that have since been reinitialized are
+		// freed by bli_pool_checkin_block().
+		for ( dim_t p = 0; p < 3; ++p )
+		{
+			while ( bli_pcache_pop( p, 0, &pblk, &pool, cache ) )
+				bli_pool_checkin_block( &pblk, pool );
+		}
+
+		bli_pcache_unlock( cache );
+	}
+}
+
+void bli_membrk_trim_pools
+     (
+       siz_t     target_size,
+       membrk_t* membrk
+     )
+{
+	// NOTE: The caller must hold the membrk lock.
+
+	// Blocks sitting in the per-thread caches count as checked out, so
+	// return them to their pools first so that they can be freed.
+	bli_membrk_flush_caches( membrk );
+
+	siz_t total_size = 0;
+
+	for ( dim_t pi = 0; pi < 3; ++pi )
+		for ( dim_t i = 0; i < bli_membrk_num_size_classes_of( pi, membrk ); ++i )
+		{
+			pool_t* pool = bli_membrk_pool( pi, i, membrk );
+
+			total_size += bli_pool_block_size( pool ) * bli_pool_num_blocks( pool );
+		}
+
+	// Free available blocks, largest first, until the pools fit within
+	// target_size or only blocks that are checked out remain.
+	while ( target_size < total_size )
+	{
+		pool_t* pool_max = NULL;
+
+		for ( dim_t pi = 0; pi < 3; ++pi )
+			for ( dim_t i = 0; i < bli_membrk_num_size_classes_of( pi, membrk ); ++i )
+			{
+				pool_t* pool = bli_membrk_pool( pi, i, membrk );
+
+				if ( bli_pool_top_index( pool ) < bli_pool_num_blocks( pool ) &&
+				     ( pool_max == NULL ||
+				       bli_pool_block_size( pool_max ) < bli_pool_block_size( pool ) ) )
+					pool_max = pool;
+			}
+
+		if ( pool_max == NULL ) break;
+
+		bli_pool_shrink( 1, pool_max );
+
+		total_size -= bli_pool_block_size( pool_max );
+	}
+}
+
+void bli_membrk_apply_mem_cap
+     (
+       membrk_t* membrk
+     )
+{
+	// NOTE: The caller must hold the membrk lock (or be initializing the
+	// membrk).
+
+	const siz_t mem_cap = bli_membrk_mem_cap_of( membrk );
+
+	if ( mem_cap == 0 ) return;
 
-	// Finalize the memory pools for A, B, and C.
-	bli_pool_finalize( pool_a );
-	bli_pool_finalize( pool_b );
-	bli_pool_finalize( pool_c );
+	bli_membrk_trim_pools( mem_cap, membrk );
+
+	// The size classes are normally sized for the largest blocking of any
+	// datatype, so even operations whose blocking was reduced to respect
+	// the cap would receive (and allocate) blocks of that size. Instead,
+	// let each class that holds no blocks be sized by the first request
+	// that puts it back into use.
+	for ( dim_t pi = 0; pi < 3; ++pi )
+		for ( dim_t i = 0; i < bli_membrk_num_size_classes_of( pi, membrk ); ++i )
+		{
+			pool_t* pool = bli_membrk_pool( pi, i, membrk );
+
+			if ( bli_pool_num_blocks( pool ) == 0 )
+				bli_pool_set_block_size( 0, pool );
+		}
+}
+
+static bool bli_membrk_cache_checkout
+     (
+       dim_t     pool_index,
+       siz_t     req_size,
+       pblk_t*   pblk,
+       pool_t**  pool,
+       membrk_t* membrk
+     )
+{
+	bool r_val = FALSE;
+
+	if ( !bli_membrk_use_caches( membrk ) ) return r_val;
+
+	pcache_t* cache = bli_membrk_cache( bli_pcache_slot(), membrk );
+
+	// If another thread that shares our slot is using the cache, give up
+	// rather than wait; the caller will use the pools instead.
+	if ( bli_pcache_trylock( cache ) )
+	{
+		r_val = bli_pcache_pop( pool_index, req_size, pblk, pool, cache );
+
+		bli_pcache_unlock( cache );
+	}
+
+	return r_val;
+}
+
+static bool bli_membrk_cache_checkin
+     (
+       dim_t     pool_index,
+       pblk_t*   pblk,
+       pool_t*   pool,
+       membrk_t* membrk
+     )
+{
+	bool r_val = FALSE;
+
+	if ( !bli_membrk_use_caches( membrk ) ) return r_val;
+
+	pcache_t* cache = bli_membrk_cache( bli_pcache_slot(), membrk );
+
+	if ( bli_pcache_trylock( cache ) )
+	{
+		r_val = bli_pcache_push( pblk, pool, pool_index, cache );
+
+		bli_pcache_unlock( cache );
+	}
+
+	return r_val;
 }
 
 // -----------------------------------------------------------------------------
@@ -456,6 +1148,28 @@ void bli_membrk_compute_pool_block_sizes_dt
        siz_t*  bs_c,
        cntx_t* cntx
      )
+{
+	// Size the blocks for problems at least as large as the maximum cache
+	// blocksizes.
+	const dim_t mc_max_dt = bli_blksz_get_max( dt, bli_cntx_get_blksz( BLIS_MC, cntx ) );
+	const dim_t kc_max_dt = bli_blksz_get_max( dt, bli_cntx_get_blksz( BLIS_KC, cntx ) );
+	const dim_t nc_max_dt = bli_blksz_get_max( dt, bli_cntx_get_blksz( BLIS_NC, cntx ) );
+
+	bli_membrk_compute_pool_block_sizes_dt_mnk( dt, mc_max_dt, nc_max_dt, kc_max_dt,
+	                                            bs_a, bs_b, bs_c, cntx );
+}
+
+void bli_membrk_compute_pool_block_sizes_dt_mnk
+     (
+       num_t   dt,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       siz_t*  bs_a,
+       siz_t*  bs_b,
+       siz_t*  bs_c,
+       cntx_t* cntx
+     )
 {
 	siz_t    size_dt = bli_dt_size( dt );
 
@@ -516,6 +1230,11 @@ void bli_membrk_compute_pool_block_sizes_dt
 	kc_max_dt = bli_blksz_get_max( dt, kc );
 	nc_max_dt = bli_blksz_get_max( dt, nc );
 
+	// A problem of dimensions m x n x k never packs more than that.
+	mc_max_dt = bli_min( mc_max_dt, m );
+	kc_max_dt = bli_min( kc_max_dt, k );
+	nc_max_dt = bli_min( nc_max_dt, n );
+
 	// Add max(mr,nr) to kc to make room for the nudging of kc at
 	// runtime to be a multiple of mr or nr for triangular operations
 	// trmm, trmm3, and trsm.
@@ -51,9 +51,39 @@ BLIS_INLINE void bli_membrk_finalize_mutex( membrk_t* membrk )
 
 // membrk query
 
-BLIS_INLINE pool_t* bli_membrk_pool( dim_t pool_index, membrk_t* membrk )
+BLIS_INLINE pool_t* bli_membrk_pool( dim_t pool_index, dim_t class_index, membrk_t* membrk )
 {
-	return &(membrk->pools[ pool_index ]);
+	return &(membrk->pools[ pool_index ][ class_index ]);
+}
+
+BLIS_INLINE dim_t bli_membrk_num_size_classes_of( dim_t pool_index, membrk_t* membrk )
+{
+	return membrk->num_size_classes[ pool_index ];
+}
+
+BLIS_INLINE dim_t bli_membrk_max_size_classes( membrk_t* membrk )
+{
+	return membrk->max_size_classes;
+}
+
+BLIS_INLINE siz_t bli_membrk_num_reinits_of( dim_t pool_index, membrk_t* membrk )
+{
+	return membrk->num_reinits[ pool_index ];
+}
+
+BLIS_INLINE pcache_t* bli_membrk_cache( dim_t slot, membrk_t* membrk )
+{
+	return &(membrk->caches[ slot ]);
+}
+
+BLIS_INLINE bool bli_membrk_use_caches( membrk_t* membrk )
+{
+	return membrk->use_caches;
+}
+
+BLIS_INLINE siz_t bli_membrk_mem_cap_of( membrk_t* membrk )
+{
+	return membrk->mem_cap;
 }
 
 BLIS_INLINE siz_t bli_membrk_align_size( membrk_t* membrk )
@@ -73,6 +103,31 @@ BLIS_INLINE free_ft bli_membrk_free_fp( membrk_t* membrk )
 
 // membrk modification
 
+BLIS_INLINE void bli_membrk_set_num_size_classes_of( dim_t n, dim_t pool_index, membrk_t* membrk )
+{
+	membrk->num_size_classes[ pool_index ] = n;
+}
+
+BLIS_INLINE void bli_membrk_set_max_size_classes( dim_t n, membrk_t* membrk )
+{
+	membrk->max_size_classes = n;
+}
+
+BLIS_INLINE void bli_membrk_set_num_reinits_of( siz_t n, dim_t pool_index, membrk_t* membrk )
+{
+	membrk->num_reinits[ pool_index ] = n;
+}
+
+BLIS_INLINE void bli_membrk_set_use_caches( bool use_caches, membrk_t* membrk )
+{
+	membrk->use_caches = use_caches;
+}
+
+BLIS_INLINE void bli_membrk_set_mem_cap_of( siz_t mem_cap, membrk_t* membrk )
+{
+	membrk->mem_cap = mem_cap;
+}
+
 BLIS_INLINE void bli_membrk_set_align_size( siz_t align_size, membrk_t* membrk )
 {
 	membrk->align_size = align_size;
@@ -138,6 +193,39 @@ siz_t bli_membrk_pool_size
        packbuf_t buf_type
      );
 
+BLIS_EXPORT_BLIS bool bli_membrk_hugepages_enabled( void );
+
+BLIS_EXPORT_BLIS dim_t bli_membrk_num_size_classes( packbuf_t buf_type );
+BLIS_EXPORT_BLIS siz_t bli_membrk_num_reinits( packbuf_t buf_type );
+
+BLIS_EXPORT_BLIS void  bli_membrk_reserve
+     (
+       num_t     dt,
+       dim_t     m,
+       dim_t     n,
+       dim_t     k,
+       dim_t     n_threads
+     );
+BLIS_EXPORT_BLIS void  bli_membrk_trim
+     (
+       siz_t     target_size
+     );
+BLIS_EXPORT_BLIS siz_t bli_membrk_total_size( void );
+
+BLIS_EXPORT_BLIS void  bli_membrk_set_mem_cap( siz_t mem_cap );
+BLIS_EXPORT_BLIS siz_t bli_membrk_mem_cap( void );
+
+cntx_t* bli_membrk_cap_cntx
+     (
+       num_t     dt,
+       dim_t     m,
+       dim_t     n,
+       dim_t     k,
+       rntm_t*   rntm,
+       cntx_t*   cntx,
+       cntx_t*   cntx_cap
+     );
+
 // ----------------------------------------------------------------------------
 
 void bli_membrk_init_pools
@@ -150,6 +238,25 @@ void bli_membrk_finalize_pools
        membrk_t* membrk
      );
 
+void bli_membrk_init_caches
+     (
+       membrk_t* membrk
+     );
+void bli_membrk_flush_caches
+     (
+       membrk_t* membrk
+     );
+
+void bli_membrk_trim_pools
+     (
+       siz_t     target_size,
+       membrk_t* membrk
+     );
+void bli_membrk_apply_mem_cap
+     (
+       membrk_t* membrk
+     );
+
 void bli_membrk_compute_pool_block_sizes
      (
        siz_t*  bs_a,
@@ -165,6 +272,17 @@ void bli_membrk_compute_pool_block_sizes_dt
        siz_t*  bs_c,
        cntx_t* cntx
      );
+void bli_membrk_compute_pool_block_sizes_dt_mnk
+     (
+       num_t   dt,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       siz_t*  bs_a,
+       siz_t*  bs_b,
+       siz_t*  bs_c,
+       cntx_t* cntx
+     );
 
 #endif
 
@@ -109,6 +109,8 @@ void bli_obj_create_without_buffer
 
 	// Set individual fields.
 	bli_obj_set_buffer( NULL, obj );
+	bli_obj_set_blkmap( NULL, obj );
+	bli_obj_set_terms( NULL, obj );
 	bli_obj_set_dt( dt, obj );
 	bli_obj_set_elem_size( elem_size, obj );
 	bli_obj_set_target_dt( dt, obj );
@@ -516,14 +518,18 @@ void bli_adjust_strides
 	}
 }
 
-static siz_t dt_sizes[6] =
+// NOTE: BLIS_FLOAT16 carries the half format bit above the three bits of
+// the info datatype field, so these tables are indexed by the full num_t.
+static siz_t dt_sizes[ BLIS_BITVAL_FLOAT16_TYPE+1 ] =
 {
-	sizeof( float ),
-	sizeof( scomplex ),
-	sizeof( double ),
-	sizeof( dcomplex ),
-	sizeof( gint_t ),
-	sizeof( constdata_t )
+	[ BLIS_FLOAT    ] = sizeof( float ),
+	[ BLIS_SCOMPLEX ] = sizeof( scomplex ),
+	[ BLIS_DOUBLE   ] = sizeof( double ),
+	[ BLIS_DCOMPLEX ] = sizeof( dcomplex ),
+	[ BLIS_INT      ] = sizeof( gint_t ),
+	[ BLIS_CONSTANT ] = sizeof( constdata_t ),
+	[ BLIS_BFLOAT16 ] = sizeof( bfloat16 ),
+	[ BLIS_FLOAT16  ] = sizeof( float16 )
 };
 
 siz_t bli_dt_size
@@ -537,13 +543,16 @@ siz_t bli_dt_size
 	return dt_sizes[dt];
 }
 
-static char* dt_names[ BLIS_NUM_FP_TYPES+1 ] =
+static char* dt_names[ BLIS_BITVAL_FLOAT16_TYPE+1 ] =
 {
-	"float",
-	"scomplex",
-	"double",
-	"dcomplex",
-	"int"
+	[ BLIS_FLOAT    ] = "float",
+	[ BLIS_SCOMPLEX ] = "scomplex",
+	[ BLIS_DOUBLE   ] = "double",
+	[ BLIS_DCOMPLEX ] = "dcomplex",
+	[ BLIS_INT      ] = "int",
+	[ BLIS_CONSTANT ] = "constant",
+	[ BLIS_BFLOAT16 ] = "bfloat16",
+	[ BLIS_FLOAT16  ] = "float16"
 };
 
 char* bli_dt_string
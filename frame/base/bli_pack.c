@@ -38,10 +38,6 @@
 // The global rntm_t structure. (The definition resides in bli_rntm.c.)
 extern rntm_t global_rntm;
 
-// A mutex to allow synchronous access to global_rntm. (The definition
-// resides in bli_rntm.c.)
-extern bli_pthread_mutex_t global_rntm_mutex;
-
 // -----------------------------------------------------------------------------
 
 void bli_pack_init( void )
@@ -82,13 +78,13 @@ void bli_pack_set_pack_a( bool pack_a )
 	// We must ensure that global_rntm has been initialized.
 	bli_init_once();
 
-	// Acquire the mutex protecting global_rntm.
-	bli_pthread_mutex_lock( &global_rntm_mutex );
+	// Begin an update of global_rntm.
+	bli_rntm_global_update_begin();
 
 	bli_rntm_set_pack_a( pack_a, &global_rntm );
 
-	// Release the mutex protecting global_rntm.
-	bli_pthread_mutex_unlock( &global_rntm_mutex );
+	// Publish the update to global_rntm.
+	bli_rntm_global_update_end();
 }
 
 // ----------------------------------------------------------------------------
@@ -98,13 +94,13 @@ void bli_pack_set_pack_b( bool pack_b )
 	// We must ensure that global_rntm has been initialized.
 	bli_init_once();
 
-	// Acquire the mutex protecting global_rntm.
-	bli_pthread_mutex_lock( &global_rntm_mutex );
+	// Begin an update of global_rntm.
+	bli_rntm_global_update_begin();
 
 	bli_rntm_set_pack_a( pack_b, &global_rntm );
 
-	// Release the mutex protecting global_rntm.
-	bli_pthread_mutex_unlock( &global_rntm_mutex );
+	// Publish the update to global_rntm.
+	bli_rntm_global_update_end();
 }
 
 // ----------------------------------------------------------------------------
@@ -114,7 +110,7 @@ void bli_pack_init_rntm_from_env
        rntm_t* rntm
      )
 {
-	// NOTE: We don't need to acquire the global_rntm_mutex here because this
+	// NOTE: We don't need to guard the update of global_rntm here because this
 	// function is only called from bli_pack_init(), which is only called
 	// by bli_init_once().
 
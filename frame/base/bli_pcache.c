@@ -0,0 +1,129 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The cache slot assigned to the calling thread, or -1 if the thread has
+// not yet been assigned one.
+static BLIS_THREAD_LOCAL dim_t pcache_slot = -1;
+
+// The slot that will be assigned to the next thread.
+static dim_t pcache_next_slot = 0;
+
+dim_t bli_pcache_slot( void )
+{
+	// Assign slots to threads round-robin upon their first use. If more
+	// than BLIS_POOL_CACHE_SLOTS threads call BLIS, some share a slot, which
+	// only costs them an occasional fall back to the shared pools.
+	if ( pcache_slot < 0 )
+		pcache_slot = __sync_fetch_and_add( &pcache_next_slot, 1 ) %
+		              BLIS_POOL_CACHE_SLOTS;
+
+	return pcache_slot;
+}
+
+void bli_pcache_init
+     (
+       pcache_t* cache
+     )
+{
+	cache->busy       = 0;
+	cache->num_blocks = 0;
+}
+
+bool bli_pcache_push
+     (
+       pblk_t*   block,
+       pool_t*   pool,
+       dim_t     tag,
+       pcache_t* cache
+     )
+{
+	// NOTE: The caller must hold the cache (see bli_pcache_trylock()).
+
+	const dim_t n = cache->num_blocks;
+
+	if ( n == BLIS_POOL_CACHE_DEPTH ) return FALSE;
+
+	cache->blocks[ n ] = *block;
+	cache->pools[ n ]  = pool;
+	cache->tags[ n ]   = tag;
+
+	cache->num_blocks = n + 1;
+
+	return TRUE;
+}
+
+bool bli_pcache_pop
+     (
+       dim_t     tag,
+       siz_t     req_size,
+       pblk_t*   block,
+       pool_t**  pool,
+       pcache_t* cache
+     )
+{
+	// NOTE: The caller must hold the cache (see bli_pcache_trylock()).
+
+	const dim_t n   = cache->num_blocks;
+	dim_t       fit = -1;
+
+	// Find the smallest cached block with the given tag that can hold
+	// req_size bytes.
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		const siz_t bs = bli_pblk_block_size( &(cache->blocks[ i ]) );
+
+		if ( cache->tags[ i ] == tag && req_size <= bs &&
+		     ( fit < 0 ||
+		       bs < bli_pblk_block_size( &(cache->blocks[ fit ]) ) ) )
+			fit = i;
+	}
+
+	if ( fit < 0 ) return FALSE;
+
+	*block = cache->blocks[ fit ];
+	*pool  = cache->pools[ fit ];
+
+	// Fill the hole with the last entry.
+	cache->blocks[ fit ] = cache->blocks[ n - 1 ];
+	cache->pools[ fit ]  = cache->pools[ n - 1 ];
+	cache->tags[ fit ]   = cache->tags[ n - 1 ];
+
+	cache->num_blocks = n - 1;
+
+	return TRUE;
+}
+
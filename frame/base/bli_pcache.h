@@ -0,0 +1,105 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_PCACHE_H
+#define BLIS_PCACHE_H
+
+// -- Per-thread block cache type --
+
+/*
+typedef struct
+{
+	volatile int busy;
+
+	dim_t        num_blocks;
+	pblk_t       blocks[ BLIS_POOL_CACHE_DEPTH ];
+	pool_t*      pools[ BLIS_POOL_CACHE_DEPTH ];
+	dim_t        tags[ BLIS_POOL_CACHE_DEPTH ];
+
+	char         pad[ 64 ];
+
+} pcache_t;
+*/
+
+// A pcache_t holds a few blocks that were released by a thread so that the
+// same thread can check them out again without taking the lock of the
+// shared pool they came from. Each block is stored along with the pool_t to
+// which it ultimately belongs and a caller-defined tag (for example, the
+// packbuf_t index). A cache is claimed with a non-blocking try-lock; callers
+// that fail to claim it simply use the shared pool instead.
+
+// pcache query
+
+BLIS_INLINE dim_t bli_pcache_num_blocks( pcache_t* cache )
+{
+	return cache->num_blocks;
+}
+
+// pcache action
+
+BLIS_INLINE bool bli_pcache_trylock( pcache_t* cache )
+{
+	return __sync_bool_compare_and_swap( &(cache->busy), 0, 1 );
+}
+
+BLIS_INLINE void bli_pcache_unlock( pcache_t* cache )
+{
+	__sync_lock_release( &(cache->busy) );
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_pcache_slot( void );
+
+void  bli_pcache_init( pcache_t* cache );
+
+bool  bli_pcache_push
+     (
+       pblk_t*   block,
+       pool_t*   pool,
+       dim_t     tag,
+       pcache_t* cache
+     );
+bool  bli_pcache_pop
+     (
+       dim_t     tag,
+       siz_t     req_size,
+       pblk_t*   block,
+       pool_t**  pool,
+       pcache_t* cache
+     );
+
+#endif
+
@@ -195,13 +195,24 @@ void bli_pool_reinit
 	malloc_ft malloc_fp = bli_pool_malloc_fp( pool );
 	free_ft   free_fp   = bli_pool_free_fp( pool );
 
-	// Finalize the pool as it is currently configured. If some blocks
-	// are still checked out to threads, those blocks are not freed
-	// here, and instead will be freed when the threads attempt to check
-	// those blocks back into the pool. (This condition can be detected
-	// since the block size is encoded into each pblk, which is copied
-	// upon checkout.)
-	bli_pool_finalize( pool );
+	// Free the blocks that are currently available along with the
+	// block_ptrs array. If some blocks are still checked out to threads,
+	// those blocks are not freed here, and instead will be freed when the
+	// threads attempt to check those blocks back into the pool. (This
+	// condition can be detected since the block size is encoded into each
+	// pblk, which is copied upon checkout.) Note that we cannot simply call
+	// bli_pool_finalize(), which insists that all blocks were checked in.
+	pblk_t* restrict block_ptrs  = bli_pool_block_ptrs( pool );
+	const siz_t      num_blocks  = bli_pool_num_blocks( pool );
+	const siz_t      top_index   = bli_pool_top_index( pool );
+	const siz_t      offset_size = bli_pool_offset_size( pool );
+
+	for ( dim_t i = top_index; i < num_blocks; ++i )
+	{
+		bli_pool_free_block( offset_size, free_fp, &(block_ptrs[i]) );
+	}
+
+	bli_free_intl( block_ptrs );
 
 	// Reinitialize the pool with the new parameters, in particular,
 	// the new block size.
@@ -361,8 +372,10 @@ void bli_pool_grow
 	if ( block_ptrs_len_cur < num_blocks_new )
 	{
 		// To prevent this from happening often, we double the current
-		// length of the block_ptrs array.
-		const siz_t block_ptrs_len_new = 2 * block_ptrs_len_cur;
+		// length of the block_ptrs array (or more, if that is still not
+		// enough, as when the array starts out empty).
+		const siz_t block_ptrs_len_new = bli_max( 2 * block_ptrs_len_cur,
+		                                          num_blocks_new );
 
 		#ifdef BLIS_ENABLE_MEM_TRACING
 		printf( "bli_pool_grow(): growing block_ptrs_len (%d -> %d): ",
@@ -38,9 +38,28 @@
 // along with a few other key parameters.
 rntm_t global_rntm;
 
-// A mutex to allow synchronous access to global_rntm.
+// A mutex to serialize updates to global_rntm.
 bli_pthread_mutex_t global_rntm_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
 
+// A sequence counter that allows readers of global_rntm to take a consistent
+// snapshot without acquiring global_rntm_mutex. Writers increment it once
+// before and once after modifying global_rntm, so an odd value means that an
+// update is in progress.
+static volatile gint_t global_rntm_seq = 0;
+
+// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
+#ifndef __ATOMIC_RELAXED
+
+#define __ATOMIC_RELAXED
+#define __ATOMIC_ACQUIRE
+
+#define __atomic_load_n(ptr, constraint) \
+    __sync_fetch_and_add(ptr, 0)
+#define __atomic_thread_fence(constraint) \
+    __sync_synchronize()
+
+#endif
+
 // ----------------------------------------------------------------------------
 
 void bli_rntm_init_from_global( rntm_t* rntm )
@@ -48,12 +67,47 @@ void bli_rntm_init_from_global( rntm_t* rntm )
 	// We must ensure that global_rntm has been initialized.
 	bli_init_once();
 
-	// Acquire the mutex protecting global_rntm.
+	// Copy global_rntm without locking. If the sequence counter is odd, or
+	// if it changed while we were copying, a writer was active and the copy
+	// may be torn, so we try again. Since updates to global_rntm are rare
+	// (and brief), this almost never loops, and concurrent callers never
+	// serialize on each other.
+	while ( TRUE )
+	{
+		const gint_t seq0 = __atomic_load_n( &global_rntm_seq, __ATOMIC_ACQUIRE );
+
+		if ( seq0 & 1 ) continue;
+
+		*rntm = global_rntm;
+
+		__atomic_thread_fence( __ATOMIC_ACQUIRE );
+
+		const gint_t seq1 = __atomic_load_n( &global_rntm_seq, __ATOMIC_RELAXED );
+
+		if ( seq0 == seq1 ) break;
+	}
+
+	// If the calling thread has opened a thread region, use its team.
+	bli_thread_region_update_rntm( rntm );
+}
+
+void bli_rntm_global_update_begin( void )
+{
+	// Acquire the mutex that serializes writers of global_rntm.
 	bli_pthread_mutex_lock( &global_rntm_mutex );
 
-	*rntm = global_rntm;
+	// Mark the update as in progress. (__sync_add_and_fetch() acts as a full
+	// barrier, so the increment is visible before any change to global_rntm.)
+	__sync_add_and_fetch( &global_rntm_seq, 1 );
+}
+
+void bli_rntm_global_update_end( void )
+{
+	// Mark the update as complete, publishing the new contents of
+	// global_rntm to subsequent readers.
+	__sync_add_and_fetch( &global_rntm_seq, 1 );
 
-	// Release the mutex protecting global_rntm.
+	// Release the mutex that serializes writers of global_rntm.
 	bli_pthread_mutex_unlock( &global_rntm_mutex );
 }
 
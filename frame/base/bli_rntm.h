@@ -115,6 +115,41 @@ BLIS_INLINE bool bli_rntm_l3_sup( rntm_t* rntm )
 	return rntm->l3_sup;
 }
 
+BLIS_INLINE dim_t bli_rntm_strassen_levels( rntm_t* rntm )
+{
+	return rntm->strassen_levels;
+}
+
+BLIS_INLINE void* bli_rntm_workspace( rntm_t* rntm )
+{
+	return rntm->workspace;
+}
+BLIS_INLINE siz_t bli_rntm_workspace_size( rntm_t* rntm )
+{
+	return rntm->workspace_size;
+}
+BLIS_INLINE bool bli_rntm_has_workspace( rntm_t* rntm )
+{
+	return rntm->workspace != NULL;
+}
+
+BLIS_INLINE dim_t bli_rntm_spmd_tid( rntm_t* rntm )
+{
+	return rntm->spmd_tid;
+}
+BLIS_INLINE struct thrcomm_s* bli_rntm_spmd_comm( rntm_t* rntm )
+{
+	return rntm->spmd_comm;
+}
+BLIS_INLINE bool bli_rntm_is_spmd( rntm_t* rntm )
+{
+	return rntm != NULL && rntm->spmd_comm != NULL;
+}
+BLIS_INLINE bool bli_rntm_spmd_am_chief( rntm_t* rntm )
+{
+	return !bli_rntm_is_spmd( rntm ) || bli_rntm_spmd_tid( rntm ) == 0;
+}
+
 //
 // -- rntm_t query (internal use only) -----------------------------------------
 //
@@ -210,6 +245,18 @@ BLIS_INLINE void bli_rntm_set_membrk( membrk_t* membrk, rntm_t* rntm )
 	rntm->membrk = membrk;
 }
 
+BLIS_INLINE void bli_rntm_set_workspace_only( void* buf, siz_t size, rntm_t* rntm )
+{
+	rntm->workspace      = buf;
+	rntm->workspace_size = size;
+}
+
+BLIS_INLINE void bli_rntm_set_spmd_only( dim_t tid, struct thrcomm_s* comm, rntm_t* rntm )
+{
+	rntm->spmd_tid  = tid;
+	rntm->spmd_comm = comm;
+}
+
 BLIS_INLINE void bli_rntm_clear_num_threads_only( rntm_t* rntm )
 {
 	bli_rntm_set_num_threads_only( -1, rntm );
@@ -226,6 +273,14 @@ BLIS_INLINE void bli_rntm_clear_membrk( rntm_t* rntm )
 {
 	bli_rntm_set_membrk( NULL, rntm );
 }
+BLIS_INLINE void bli_rntm_clear_workspace( rntm_t* rntm )
+{
+	bli_rntm_set_workspace_only( NULL, 0, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_spmd( rntm_t* rntm )
+{
+	bli_rntm_set_spmd_only( 0, NULL, rntm );
+}
 
 //
 // -- rntm_t modification (public API) -----------------------------------------
@@ -279,6 +334,13 @@ BLIS_INLINE void bli_rntm_disable_l3_sup( rntm_t* rntm )
 	bli_rntm_set_l3_sup( FALSE, rntm );
 }
 
+BLIS_INLINE void bli_rntm_set_strassen_levels( dim_t levels, rntm_t* rntm )
+{
+	// Set the number of levels of Strassen's algorithm that gemm may apply.
+	// A value of zero selects conventional execution.
+	rntm->strassen_levels = levels;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -295,6 +357,10 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 {
 	bli_rntm_set_l3_sup( TRUE, rntm );
 }
+BLIS_INLINE void bli_rntm_clear_strassen_levels( rntm_t* rntm )
+{
+	bli_rntm_set_strassen_levels( 0, rntm );
+}
 
 //
 // -- rntm_t initialization ----------------------------------------------------
@@ -312,6 +378,11 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
           .pack_a      = FALSE, \
           .pack_b      = FALSE, \
           .l3_sup      = TRUE, \
+          .strassen_levels = 0, \
+          .workspace   = NULL, \
+          .workspace_size = 0, \
+          .spmd_tid    = 0, \
+          .spmd_comm   = NULL, \
           .sba_pool    = NULL, \
           .membrk      = NULL, \
         }  \
@@ -325,6 +396,9 @@ BLIS_INLINE void bli_rntm_init( rntm_t* rntm )
 	bli_rntm_clear_pack_a( rntm );
 	bli_rntm_clear_pack_b( rntm );
 	bli_rntm_clear_l3_sup( rntm );
+	bli_rntm_clear_strassen_levels( rntm );
+	bli_rntm_clear_workspace( rntm );
+	bli_rntm_clear_spmd( rntm );
 
 	bli_rntm_clear_sba_pool( rntm );
 	bli_rntm_clear_membrk( rntm );
@@ -354,6 +428,9 @@ BLIS_INLINE dim_t bli_rntm_calc_num_threads
 
 BLIS_EXPORT_BLIS void bli_rntm_init_from_global( rntm_t* rntm );
 
+void bli_rntm_global_update_begin( void );
+void bli_rntm_global_update_end( void );
+
 BLIS_EXPORT_BLIS void bli_rntm_set_ways_for_op
      (
        opid_t  l3_op,
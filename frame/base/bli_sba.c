@@ -37,6 +37,12 @@
 // The small block allocator: an apool_t of array_t of pool_t.
 static apool_t sba;
 
+// Per-thread caches of array_t that were recently checked in, which let
+// most calls to bli_sba_checkout_array() and bli_sba_checkin_array() avoid
+// the apool_t's mutex.
+static pcache_t sba_caches[ BLIS_POOL_CACHE_SLOTS ];
+static bool     sba_use_caches = FALSE;
+
 apool_t* bli_sba_query( void )
 {
 	return &sba;
@@ -47,10 +53,27 @@ apool_t* bli_sba_query( void )
 void bli_sba_init( void )
 {
 	bli_apool_init( &sba );
+
+	for ( dim_t i = 0; i < BLIS_POOL_CACHE_SLOTS; ++i )
+		bli_pcache_init( &sba_caches[ i ] );
+
+	// The per-thread caches are used unless BLIS_POOL_CACHE is set to 0.
+	sba_use_caches = ( bli_env_get_var( "BLIS_POOL_CACHE", -1 ) != 0 );
 }
 
 void bli_sba_finalize( void )
 {
+	pblk_t  pblk;
+	pool_t* pool;
+
+	// Return any cached array_t to the apool_t so that they are freed along
+	// with the rest.
+	for ( dim_t i = 0; i < BLIS_POOL_CACHE_SLOTS; ++i )
+	{
+		while ( bli_pcache_pop( 0, 0, &pblk, &pool, &sba_caches[ i ] ) )
+			bli_apool_checkin_array( bli_pblk_buf( &pblk ), &sba );
+	}
+
 	bli_apool_finalize( &sba );
 }
 
@@ -62,8 +85,20 @@ void* bli_sba_acquire
 {
 	void* block;
 
+	// If the caller supplied a workspace, carve the block out of it.
+	if ( rntm != NULL && bli_rntm_has_workspace( rntm ) )
+	{
+		block = bli_workspace_acquire( req_size,
+		                               BLIS_WORKSPACE_SMALL_ALIGN_SIZE, 0,
+		                               rntm );
+
+		if ( block != NULL ) return block;
+	}
+
 #ifdef BLIS_ENABLE_SBA_POOLS
-	if ( rntm == NULL )
+	// No small block pool is attached to the rntm_t when a workspace is in
+	// use, so blocks that do not fit in the workspace come from the heap.
+	if ( rntm == NULL || bli_rntm_sba_pool( rntm ) == NULL )
 	{
 		block = bli_malloc_intl( req_size );
 	}
@@ -109,8 +144,15 @@ void bli_sba_release
        void*   restrict block
      )
 {
+	// Blocks carved out of a workspace are reclaimed all at once.
+	if ( rntm != NULL && bli_workspace_owns( block, rntm ) )
+	{
+		bli_workspace_release( rntm );
+		return;
+	}
+
 #ifdef BLIS_ENABLE_SBA_POOLS
-	if ( rntm == NULL )
+	if ( rntm == NULL || bli_rntm_sba_pool( rntm ) == NULL )
 	{
 		bli_free_intl( block );
 	}
@@ -146,13 +188,45 @@ void bli_sba_release
 
 array_t* bli_sba_checkout_array
      (
-       const siz_t n_threads
+       const siz_t      n_threads,
+       rntm_t* restrict rntm
      )
 {
 	#ifndef BLIS_ENABLE_SBA_POOLS
 	return NULL;
 	#endif
 
+	// When the caller supplied a workspace, small blocks are carved from it
+	// instead, so no array_t (nor the apool_t's lock) is needed.
+	if ( rntm != NULL && bli_rntm_has_workspace( rntm ) ) return NULL;
+
+	if ( sba_use_caches )
+	{
+		pcache_t* cache = &sba_caches[ bli_pcache_slot() ];
+		pblk_t    pblk;
+		pool_t*   pool;
+		bool      found = FALSE;
+
+		// Try to reuse an array_t recently checked in by this thread. If
+		// the cache is busy or empty, fall back to the apool_t.
+		if ( bli_pcache_trylock( cache ) )
+		{
+			found = bli_pcache_pop( 0, 0, &pblk, &pool, cache );
+
+			bli_pcache_unlock( cache );
+		}
+
+		if ( found )
+		{
+			array_t* restrict array = bli_pblk_buf( &pblk );
+
+			// Resize the array_t as bli_apool_checkout_array() would.
+			bli_array_resize( n_threads, array );
+
+			return array;
+		}
+	}
+
 	return bli_apool_checkout_array( n_threads, &sba );
 }
 
@@ -165,9 +239,53 @@ void bli_sba_checkin_array
 	return;
 	#endif
 
+	if ( array == NULL ) return;
+
+	if ( sba_use_caches )
+	{
+		pcache_t* cache = &sba_caches[ bli_pcache_slot() ];
+		pblk_t    pblk;
+		bool      kept  = FALSE;
+
+		bli_pblk_set_buf( array, &pblk );
+		bli_pblk_set_block_size( 0, &pblk );
+
+		// Keep the array_t in this thread's cache if there is room.
+		if ( bli_pcache_trylock( cache ) )
+		{
+			kept = bli_pcache_push( &pblk, bli_apool_pool( &sba ), 0, cache );
+
+			bli_pcache_unlock( cache );
+		}
+
+		if ( kept ) return;
+	}
+
 	bli_apool_checkin_array( array, &sba );
 }
 
+void bli_sba_reserve
+     (
+       dim_t             n_threads
+     )
+{
+	#ifndef BLIS_ENABLE_SBA_POOLS
+	return;
+	#endif
+
+	bli_init_once();
+
+	// Check out an array_t large enough for n_threads and make sure that
+	// each of its elements refers to an allocated pool_t (which comes with
+	// its initial blocks), and then return it for the next operation to use.
+	array_t* restrict array = bli_sba_checkout_array( bli_max( n_threads, 1 ), NULL );
+
+	for ( dim_t i = 0; i < bli_max( n_threads, 1 ); ++i )
+		bli_apool_array_elem( i, array );
+
+	bli_sba_checkin_array( array );
+}
+
 void bli_sba_rntm_set_pool
      (
        siz_t             index,
@@ -180,6 +298,13 @@ void bli_sba_rntm_set_pool
 	return;
 	#endif
 
+	// No array_t was checked out if the rntm_t carries a workspace.
+	if ( array == NULL )
+	{
+		bli_rntm_set_sba_pool( NULL, rntm );
+		return;
+	}
+
 	// Query the pool_t* in the array_t corresponding to index.
 	pool_t* restrict pool = bli_apool_array_elem( index, array );
 
@@ -44,7 +44,8 @@ void bli_sba_finalize( void );
 
 array_t* bli_sba_checkout_array
      (
-       const siz_t n_threads
+       const siz_t      n_threads,
+       rntm_t* restrict rntm
      );
 
 void bli_sba_checkin_array
@@ -52,6 +53,11 @@ void bli_sba_checkin_array
        array_t* restrict array
      );
 
+BLIS_EXPORT_BLIS void bli_sba_reserve
+     (
+       dim_t             n_threads
+     );
+
 void bli_sba_rntm_set_pool
      (
        siz_t             index,
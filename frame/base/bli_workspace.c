@@ -0,0 +1,276 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The header stored at the start of a workspace. The offset of the first
+// free byte and the number of blocks currently checked out are kept
+// together in a single word, state, so that both can be updated with one
+// compare-and-swap: the low BLIS_WORKSPACE_LIVE_BITS bits hold the number
+// of blocks and the remaining bits hold the offset.
+typedef struct
+{
+	volatile siz_t state;
+
+	// The offset of the first byte following the header.
+	siz_t          start;
+
+	// The largest offset reached so far.
+	volatile siz_t peak;
+
+} wshdr_t;
+
+#define BLIS_WORKSPACE_HEADER_ALIGN_SIZE 64
+
+#define BLIS_WORKSPACE_LIVE_BITS 16
+#define BLIS_WORKSPACE_LIVE_MASK ( ( ( siz_t )1 << BLIS_WORKSPACE_LIVE_BITS ) - 1 )
+
+static wshdr_t* bli_workspace_header( void* buf )
+{
+	// Align the header within the caller's buffer.
+	const uintptr_t addr = ( uintptr_t )buf;
+
+	return ( wshdr_t* )( ( addr + BLIS_WORKSPACE_HEADER_ALIGN_SIZE - 1 ) &
+	                     ~( uintptr_t )( BLIS_WORKSPACE_HEADER_ALIGN_SIZE - 1 ) );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_rntm_set_workspace
+     (
+       void*   buf,
+       siz_t   size,
+       rntm_t* rntm
+     )
+{
+	// A NULL (or too small) buffer detaches any workspace from the rntm_t.
+	if ( buf == NULL || size < 2 * BLIS_WORKSPACE_HEADER_ALIGN_SIZE + sizeof( wshdr_t ) )
+	{
+		bli_rntm_clear_workspace( rntm );
+		return;
+	}
+
+	wshdr_t*    hdr   = bli_workspace_header( buf );
+	const siz_t start = ( siz_t )( ( char* )hdr - ( char* )buf ) +
+	                    sizeof( wshdr_t );
+
+	hdr->start = start;
+	hdr->state = start << BLIS_WORKSPACE_LIVE_BITS;
+	hdr->peak  = start;
+
+	bli_rntm_set_workspace_only( buf, size, rntm );
+}
+
+siz_t bli_workspace_size
+     (
+       opid_t  oper,
+       num_t   dt,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   n_threads
+     )
+{
+	bli_init_once();
+
+	// Use the context that the operation would use for this datatype.
+	cntx_t* cntx = bli_gks_query_ind_cntx
+	               (
+	                 bli_l3_ind_oper_find_avail( oper, dt ), dt
+	               );
+
+	// Determine how the operation would divide n_threads among its loops,
+	// and from that, how many blocks of A and panels of B would be packed
+	// at once.
+	rntm_t  rntm;
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( bli_max( n_threads, 1 ), &rntm );
+	bli_rntm_set_ways_for_op( oper, BLIS_LEFT, m, n, k, &rntm );
+
+	const siz_t num_b = bli_rntm_jc_ways( &rntm ) *
+	                    bli_rntm_pc_ways( &rntm );
+	const siz_t num_a = num_b * bli_rntm_ic_ways( &rntm );
+	const siz_t num_t = bli_rntm_num_threads( &rntm );
+
+	// Respect the cap on packing memory, if any.
+	cntx_t  cntx_cap;
+
+	cntx = bli_membrk_cap_cntx( dt, m, n, k, &rntm, cntx, &cntx_cap );
+
+	siz_t bs_a, bs_b, bs_c;
+
+	bli_membrk_compute_pool_block_sizes_dt_mnk( dt, m, n, k,
+	                                            &bs_a, &bs_b, &bs_c, cntx );
+
+	// The small/unpacked (sup) code path, if it is available for this
+	// datatype, may pack using different blocksizes.
+	if ( bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ) > 0 &&
+	     bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx ) > 0 )
+	{
+		cntx_t cntx_sup = *cntx;
+
+		const bszid_t bszids[ 5 ] = { BLIS_MR, BLIS_NR, BLIS_MC, BLIS_KC, BLIS_NC };
+
+		for ( dim_t i = 0; i < 5; ++i )
+			*bli_cntx_get_blksz( bszids[ i ], &cntx_sup ) =
+			*bli_cntx_get_l3_sup_blksz( bszids[ i ], cntx );
+
+		siz_t bs_sup_a, bs_sup_b, bs_sup_c;
+
+		bli_membrk_compute_pool_block_sizes_dt_mnk( dt, m, n, k,
+		                                            &bs_sup_a, &bs_sup_b, &bs_sup_c,
+		                                            &cntx_sup );
+
+		bs_a = bli_max( bs_a, bs_sup_a );
+		bs_b = bli_max( bs_b, bs_sup_b );
+	}
+
+	// The last iteration of the k loop may use a larger kc than the others,
+	// in which case each block is released and acquired again at the larger
+	// size. Since workspace memory is only reclaimed at the end of the
+	// operation, allow for two blocks of each, plus room for aligning them
+	// as the pools would.
+	bs_a = 2 * ( bs_a + BLIS_POOL_ADDR_ALIGN_SIZE_A + BLIS_POOL_ADDR_OFFSET_SIZE_A );
+	bs_b = 2 * ( bs_b + BLIS_POOL_ADDR_ALIGN_SIZE_B + BLIS_POOL_ADDR_OFFSET_SIZE_B );
+
+	// Small blocks are never larger than the largest of these structures.
+	siz_t bs_small = bli_max( bli_max( sizeof( cntl_t ), sizeof( packm_params_t ) ),
+	                          bli_max( sizeof( thrcomm_t ), sizeof( thrinfo_t ) ) );
+
+	bs_small += BLIS_WORKSPACE_SMALL_ALIGN_SIZE;
+
+	return 2 * BLIS_WORKSPACE_HEADER_ALIGN_SIZE + sizeof( wshdr_t ) +
+	       num_a * bs_a + num_b * bs_b +
+	       num_t * BLIS_WORKSPACE_SMALL_BLOCKS_PER_THREAD * bs_small;
+}
+
+siz_t bli_workspace_peak
+     (
+       rntm_t* rntm
+     )
+{
+	if ( !bli_rntm_has_workspace( rntm ) ) return 0;
+
+	return bli_workspace_header( bli_rntm_workspace( rntm ) )->peak;
+}
+
+// -----------------------------------------------------------------------------
+
+void* bli_workspace_acquire
+     (
+       siz_t   req_size,
+       siz_t   align_size,
+       siz_t   offset_size,
+       rntm_t* rntm
+     )
+{
+	char*       buf   = bli_rntm_workspace( rntm );
+	const siz_t size  = bli_rntm_workspace_size( rntm );
+	wshdr_t*    hdr   = bli_workspace_header( buf );
+
+	siz_t state, state_new, block, end;
+
+	// Claim the next (suitably aligned) req_size bytes. The loop only
+	// repeats if another thread claimed or released a block in between.
+	do
+	{
+		state = hdr->state;
+
+		const siz_t used = state >> BLIS_WORKSPACE_LIVE_BITS;
+		const siz_t live = state &  BLIS_WORKSPACE_LIVE_MASK;
+
+		// As in bli_pool_alloc_block(), align the address and then apply
+		// the offset.
+		const uintptr_t addr = ( uintptr_t )( buf + used );
+
+		block = ( siz_t )( ( ( addr + align_size - 1 ) / align_size ) * align_size -
+		                   ( uintptr_t )buf ) + offset_size;
+		end   = block + req_size;
+
+		// If the workspace is too small, let the caller fall back to the
+		// pools for this block.
+		if ( size < end || live == BLIS_WORKSPACE_LIVE_MASK )
+			return NULL;
+
+		state_new = ( end << BLIS_WORKSPACE_LIVE_BITS ) | ( live + 1 );
+	}
+	while ( !__sync_bool_compare_and_swap( &(hdr->state), state, state_new ) );
+
+	// Record the high-water mark.
+	siz_t peak;
+
+	while ( ( peak = hdr->peak ) < end &&
+	        !__sync_bool_compare_and_swap( &(hdr->peak), peak, end ) ) ;
+
+	return buf + block;
+}
+
+void bli_workspace_release
+     (
+       rntm_t* rntm
+     )
+{
+	wshdr_t* hdr = bli_workspace_header( bli_rntm_workspace( rntm ) );
+
+	siz_t state, state_new;
+
+	// Once the last block is released, rewind to the start of the
+	// workspace so that the next operation can reuse all of it.
+	do
+	{
+		state = hdr->state;
+
+		const siz_t live = ( state & BLIS_WORKSPACE_LIVE_MASK ) - 1;
+
+		if ( live == 0 ) state_new = hdr->start << BLIS_WORKSPACE_LIVE_BITS;
+		else             state_new = state - 1;
+	}
+	while ( !__sync_bool_compare_and_swap( &(hdr->state), state, state_new ) );
+}
+
+bool bli_workspace_owns
+     (
+       void*   buf,
+       rntm_t* rntm
+     )
+{
+	if ( !bli_rntm_has_workspace( rntm ) ) return FALSE;
+
+	char* ws = bli_rntm_workspace( rntm );
+
+	return ( ws <= ( char* )buf &&
+	         ( char* )buf < ws + bli_rntm_workspace_size( rntm ) );
+}
@@ -0,0 +1,95 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_WORKSPACE_H
+#define BLIS_WORKSPACE_H
+
+// A caller-supplied workspace lets a level-3 operation carve all of its
+// packing blocks and small blocks out of memory provided via the rntm_t,
+// without calling malloc() or taking any locks. Blocks are handed out in
+// order from the start of the workspace, and the whole workspace becomes
+// available again once every block has been released (ie: by the end of
+// each operation). If a workspace runs out, the remaining blocks come from
+// the usual pools instead. A workspace must not be shared by operations that
+// run at the same time.
+
+// The alignment of small blocks carved from a workspace, which matches that
+// of the blocks in the small block allocator's pools.
+#define BLIS_WORKSPACE_SMALL_ALIGN_SIZE 16
+
+// The number of small blocks (control tree nodes, thrinfo_t nodes, and so
+// on) that bli_workspace_size() assumes each thread will need.
+#define BLIS_WORKSPACE_SMALL_BLOCKS_PER_THREAD 32
+
+BLIS_EXPORT_BLIS void  bli_rntm_set_workspace
+     (
+       void*   buf,
+       siz_t   size,
+       rntm_t* rntm
+     );
+
+BLIS_EXPORT_BLIS siz_t bli_workspace_size
+     (
+       opid_t  oper,
+       num_t   dt,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   n_threads
+     );
+
+BLIS_EXPORT_BLIS siz_t bli_workspace_peak
+     (
+       rntm_t* rntm
+     );
+
+void* bli_workspace_acquire
+     (
+       siz_t   req_size,
+       siz_t   align_size,
+       siz_t   offset_size,
+       rntm_t* rntm
+     );
+void  bli_workspace_release
+     (
+       rntm_t* rntm
+     );
+bool  bli_workspace_owns
+     (
+       void*   buf,
+       rntm_t* rntm
+     );
+
+#endif
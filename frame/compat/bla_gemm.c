@@ -179,6 +179,52 @@ void PASTEF77(ch,blasname) \
 	const inc_t cs_b = *ldb; \
 	const inc_t rs_c = 1; \
 	const inc_t cs_c = *ldc; \
+\
+	/* Handle problems that fit within the tiny gemm kernels without
+	   creating any objects. */ \
+	if ( bli_gemm_tiny_is_enabled() ) \
+	{ \
+		err_t r_val = PASTEMAC(ch,gemm_tiny) \
+		( \
+		  blis_transa, \
+		  blis_transb, \
+		  m0, n0, k0, \
+		  (ftype*)alpha, \
+		  (ftype*)a, rs_a, cs_a, \
+		  (ftype*)b, rs_b, cs_b, \
+		  (ftype*)beta, \
+		  (ftype*)c, rs_c, cs_c  \
+		); \
+		if ( r_val == BLIS_SUCCESS ) \
+		{ \
+			/* Finalize BLIS. */ \
+			bli_finalize_auto(); \
+			return; \
+		} \
+	} \
+\
+	/* Hand small problems directly to the sup code, again without creating
+	   any objects. If the sup path declines the problem, fall through to the
+	   object-based API, which will reconsider it in full. */ \
+	{ \
+		err_t r_val = PASTEMAC(ch,gemmsup) \
+		( \
+		  blis_transa, \
+		  blis_transb, \
+		  m0, n0, k0, \
+		  (ftype*)alpha, \
+		  (ftype*)a, rs_a, cs_a, \
+		  (ftype*)b, rs_b, cs_b, \
+		  (ftype*)beta, \
+		  (ftype*)c, rs_c, cs_c  \
+		); \
+		if ( r_val == BLIS_SUCCESS ) \
+		{ \
+			/* Finalize BLIS. */ \
+			bli_finalize_auto(); \
+			return; \
+		} \
+	} \
 \
 	const num_t dt     = PASTEMAC(ch,type); \
 \
@@ -129,6 +129,26 @@
   #define BLIS_RELAX_MCNR_NCMR_CONSTRAINTS
 #endif
 
+// The maximum number of block size classes kept by the packing block
+// allocator for each kind of packed buffer. A request that is too large for
+// every class in use puts a new class into use; only when all classes are in
+// use is an existing class reinitialized (freeing its blocks).
+#ifndef BLIS_POOL_MAX_SIZE_CLASSES
+  #define BLIS_POOL_MAX_SIZE_CLASSES 4
+#endif
+
+// The number of per-thread caches that sit in front of the packing block
+// allocator and the small block allocator, and the number of blocks each
+// cache may hold. Application threads are assigned to caches round-robin;
+// a thread whose cache is momentarily in use by another thread falls back
+// to the locked, shared pools.
+#ifndef BLIS_POOL_CACHE_SLOTS
+  #define BLIS_POOL_CACHE_SLOTS 64
+#endif
+#ifndef BLIS_POOL_CACHE_DEPTH
+  #define BLIS_POOL_CACHE_DEPTH 4
+#endif
+
 // Stay initialized after auto-initialization, unless and until the user
 // explicitly calls bli_finalize().
 #ifdef BLIS_DISABLE_STAY_AUTO_INITIALIZED
@@ -139,6 +159,16 @@
   #define BLIS_ENABLE_STAY_AUTO_INITIALIZED
 #endif
 
+// Handle exact-size tiny gemm problems (see bli_gemm_tiny.h) with kernels
+// that are specialized for their size at compile time?
+#ifdef BLIS_DISABLE_TINY_GEMM
+  #undef BLIS_ENABLE_TINY_GEMM
+#else
+  // Default behavior is enabled.
+  #undef  BLIS_ENABLE_TINY_GEMM // In case user explicitly enabled.
+  #define BLIS_ENABLE_TINY_GEMM
+#endif
+
 
 // -- BLAS COMPATIBILITY LAYER -------------------------------------------------
 
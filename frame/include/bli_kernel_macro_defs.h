@@ -152,6 +152,17 @@
 #define BLIS_PAGE_SIZE                   4096
 #endif
 
+// Size of a huge page. When huge pages are enabled for the packing block
+// allocator, pool blocks are mapped (and sized) in multiples of this value.
+#ifndef BLIS_HUGEPAGE_SIZE
+#define BLIS_HUGEPAGE_SIZE               ( 2 * 1024 * 1024 )
+#endif
+
+// Size of the bookkeeping header that precedes each huge-page mapping.
+#ifndef BLIS_HUGEPAGE_HEADER_SIZE
+#define BLIS_HUGEPAGE_HEADER_SIZE        64
+#endif
+
 // The maximum number of named SIMD vector registers available for use.
 // When configuring with umbrella configuration families, this should be
 // set to the maximum number of registers across all sub-configurations in
@@ -42,10 +42,12 @@
 
 // Info query
 
+// NOTE: This function queries info2.
 BLIS_INLINE num_t bli_obj_dt( obj_t* obj )
 {
 	return ( num_t )
-	       ( obj->info & BLIS_DATATYPE_BITS );
+	       ( ( obj->info  & BLIS_DATATYPE_BITS ) |
+	         ( obj->info2 & BLIS_HALF_FORMAT_BIT ) );
 }
 
 BLIS_INLINE bool bli_obj_is_float( obj_t* obj )
@@ -84,6 +86,12 @@ BLIS_INLINE bool bli_obj_is_const( obj_t* obj )
 	       ( bli_obj_dt( obj ) == BLIS_BITVAL_CONST_TYPE );
 }
 
+BLIS_INLINE bool bli_obj_is_half( obj_t* obj )
+{
+	return ( bool )
+	       ( ( obj->info & BLIS_DATATYPE_BITS ) == BLIS_BITVAL_HALF_TYPE );
+}
+
 BLIS_INLINE dom_t bli_obj_domain( obj_t* obj )
 {
 	return ( dom_t )
@@ -454,17 +462,22 @@ BLIS_INLINE void bli_obj_set_invert_diag( invdiag_t invdiag, obj_t* obj )
 	            ( ( obj->info & ~BLIS_INVERT_DIAG_BIT ) | invdiag );
 }
 
+// NOTE: This function queries and modifies info2.
 BLIS_INLINE void bli_obj_set_dt( num_t dt, obj_t* obj )
 {
-	obj->info = ( objbits_t )
-	            ( ( obj->info & ~BLIS_DATATYPE_BITS ) | dt );
+	obj->info  = ( objbits_t )
+	             ( ( obj->info  & ~BLIS_DATATYPE_BITS ) |
+	               ( dt & BLIS_DATATYPE_BITS ) );
+	obj->info2 = ( objbits_t )
+	             ( ( obj->info2 & ~BLIS_HALF_FORMAT_BIT ) |
+	               ( dt & BLIS_HALF_FORMAT_BIT ) );
 }
 
 BLIS_INLINE void bli_obj_set_target_dt( num_t dt, obj_t* obj )
 {
 	obj->info = ( objbits_t )
 	            ( ( obj->info & ~BLIS_TARGET_DT_BITS ) |
-	              ( dt << BLIS_TARGET_DT_SHIFT ) );
+	              ( ( dt & BLIS_DATATYPE_BITS ) << BLIS_TARGET_DT_SHIFT ) );
 }
 
 BLIS_INLINE void bli_obj_set_target_domain( dom_t dt, obj_t* obj )
@@ -485,7 +498,7 @@ BLIS_INLINE void bli_obj_set_exec_dt( num_t dt, obj_t* obj )
 {
 	obj->info = ( objbits_t )
 	            ( ( obj->info & ~BLIS_EXEC_DT_BITS ) |
-	              ( dt << BLIS_EXEC_DT_SHIFT ) );
+	              ( ( dt & BLIS_DATATYPE_BITS ) << BLIS_EXEC_DT_SHIFT ) );
 }
 
 BLIS_INLINE void bli_obj_set_exec_domain( dom_t dt, obj_t* obj )
@@ -506,7 +519,7 @@ BLIS_INLINE void bli_obj_set_comp_dt( num_t dt, obj_t* obj )
 {
 	obj->info = ( objbits_t )
 	            ( ( obj->info & ~BLIS_COMP_DT_BITS ) |
-	              ( dt << BLIS_COMP_DT_SHIFT ) );
+	              ( ( dt & BLIS_DATATYPE_BITS ) << BLIS_COMP_DT_SHIFT ) );
 }
 
 BLIS_INLINE void bli_obj_set_comp_domain( dom_t dt, obj_t* obj )
@@ -528,7 +541,7 @@ BLIS_INLINE void bli_obj_set_scalar_dt( num_t dt, obj_t* obj )
 {
 	obj->info2 = ( objbits_t )
 	             ( ( obj->info2 & ~BLIS_SCALAR_DT_BITS ) |
-	               ( dt << BLIS_SCALAR_DT_SHIFT ) );
+	               ( ( dt & BLIS_DATATYPE_BITS ) << BLIS_SCALAR_DT_SHIFT ) );
 }
 
 // NOTE: This function queries and modifies info2.
@@ -1149,6 +1162,75 @@ BLIS_INLINE void bli_obj_set_panel_stride( inc_t ps, obj_t* obj )
 	obj->ps = ps;
 }
 
+// Block map query
+
+BLIS_INLINE blkmap_t* bli_obj_blkmap( obj_t* obj )
+{
+	return ( obj->blkmap );
+}
+
+BLIS_INLINE bool bli_obj_is_block_sparse( obj_t* obj )
+{
+	return ( bool )
+	       ( obj->blkmap != NULL );
+}
+
+// Element (i,j) of obj corresponds to element (row_off+i,col_off+j) of the
+// matrix described by the map, or to element (col_off+j,row_off+i) if the
+// map describes the transpose of obj.
+
+BLIS_INLINE dim_t bli_obj_blkmap_row_off( obj_t* obj )
+{
+	return ( obj->blkoff[ BLIS_M ] + obj->off[ BLIS_M ] );
+}
+
+BLIS_INLINE dim_t bli_obj_blkmap_col_off( obj_t* obj )
+{
+	return ( obj->blkoff[ BLIS_N ] + obj->off[ BLIS_N ] );
+}
+
+BLIS_INLINE bool bli_obj_blkmap_is_trans( obj_t* obj )
+{
+	return ( obj->blktrans );
+}
+
+// Block map modification
+
+BLIS_INLINE void bli_obj_set_blkmap( blkmap_t* map, obj_t* obj )
+{
+	obj->blkmap      = map;
+	obj->blkoff[ 0 ] = 0;
+	obj->blkoff[ 1 ] = 0;
+	obj->blktrans    = FALSE;
+}
+
+BLIS_INLINE void bli_obj_set_blkmap_offs( dim_t offm, dim_t offn, bool trans, obj_t* obj )
+{
+	obj->blkoff[ BLIS_M ] = offm - obj->off[ BLIS_M ];
+	obj->blkoff[ BLIS_N ] = offn - obj->off[ BLIS_N ];
+	obj->blktrans         = trans;
+}
+
+// Term list query
+
+BLIS_INLINE sumterms_t* bli_obj_terms( obj_t* obj )
+{
+	return ( obj->terms );
+}
+
+BLIS_INLINE bool bli_obj_has_terms( obj_t* obj )
+{
+	return ( bool )
+	       ( obj->terms != NULL );
+}
+
+// Term list modification
+
+BLIS_INLINE void bli_obj_set_terms( sumterms_t* terms, obj_t* obj )
+{
+	obj->terms = terms;
+}
+
 // stor3_t-related
 
 BLIS_INLINE stor3_t bli_obj_stor3_from_strides( obj_t* c, obj_t* a, obj_t* b )
@@ -1476,6 +1558,13 @@ BLIS_INLINE void bli_obj_induce_trans( obj_t* obj )
 	bli_obj_set_padded_dims( n_padded, m_padded, obj );
 	bli_obj_set_panel_dims( n_panel, m_panel, obj );
 
+	// Induce transposition among block map fields.
+	dim_t  blkoffm  = obj->blkoff[ BLIS_M ];
+
+	obj->blkoff[ BLIS_M ] = obj->blkoff[ BLIS_N ];
+	obj->blkoff[ BLIS_N ] = blkoffm;
+	obj->blktrans         = !obj->blktrans;
+
 	// Note that this macro DOES NOT touch the transposition bit! If
 	// the calling code is using this function to handle an object whose
 	// transposition bit is set prior to computation, that code needs
@@ -1501,6 +1590,13 @@ BLIS_INLINE void bli_obj_induce_fast_trans( obj_t* obj )
 	bli_obj_set_strides( cs, rs, obj );
 	bli_obj_set_offs( offn, offm, obj );
 
+	// Induce transposition among block map fields.
+	dim_t  blkoffm  = obj->blkoff[ BLIS_M ];
+
+	obj->blkoff[ BLIS_M ] = obj->blkoff[ BLIS_N ];
+	obj->blkoff[ BLIS_N ] = blkoffm;
+	obj->blktrans         = !obj->blktrans;
+
 	// Note that this macro DOES NOT touch the transposition bit! If
 	// the calling code is using this function to handle an object whose
 	// transposition bit is set prior to computation, that code needs
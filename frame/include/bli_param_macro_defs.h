@@ -92,6 +92,31 @@ BLIS_INLINE bool bli_is_constant( num_t dt )
 	       ( dt == BLIS_CONSTANT );
 }
 
+BLIS_INLINE bool bli_is_bfloat16( num_t dt )
+{
+	return ( bool )
+	       ( dt == BLIS_BFLOAT16 );
+}
+
+BLIS_INLINE bool bli_is_float16( num_t dt )
+{
+	return ( bool )
+	       ( dt == BLIS_FLOAT16 );
+}
+
+BLIS_INLINE bool bli_is_half( num_t dt )
+{
+	return ( bool )
+	       ( dt == BLIS_BFLOAT16 ||
+	         dt == BLIS_FLOAT16 );
+}
+
+BLIS_INLINE half_t bli_dt_half_type( num_t dt )
+{
+	return ( half_t )
+	       ( ( dt & BLIS_HALF_FORMAT_BIT ) >> BLIS_HALF_FORMAT_SHIFT );
+}
+
 BLIS_INLINE bool bli_is_int( num_t dt )
 {
 	return ( bool )
@@ -199,6 +199,11 @@
 #include "bli_xpbys_mxn.h"
 #include "bli_xpbys_mxn_uplo.h"
 
+// -- Half-precision conversions --
+
+#include "bli_halfs.h"
+
+
 // -- "broadcast B" scalar macros --
 
 #include "bli_bcastbbs_mxn.h"
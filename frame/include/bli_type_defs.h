@@ -170,6 +170,14 @@ typedef uint32_t objbits_t;  // object information bit field
 
 #endif // BLIS_ENABLE_C99_COMPLEX
 
+// -- Half-precision types --
+
+// Half-precision values are only used as storage formats; all arithmetic on
+// them is performed in single precision. Their bit patterns are held in
+// unsigned 16-bit integers.
+typedef uint16_t bfloat16;
+typedef uint16_t float16;
+
 // -- Atom type --
 
 // Note: atom types are used to hold "bufferless" scalar object values. Note
@@ -221,7 +229,7 @@ typedef void* void_fp;
    2 ~ 0   Stored numerical datatype
            - 0: domain    (0 == real, 1 == complex)
            - 1: precision (0 == single, 1 == double)
-           - 2: special   (100 = int; 101 = const)
+           - 2: special   (100 = int; 101 = const; 110 = half)
        3   Transposition required [during pack]?
        4   Conjugation required [during pack]?
    7 ~ 5   Part of matrix stored:
@@ -233,7 +241,7 @@ typedef void* void_fp;
   12 ~ 10  Target numerical datatype
            - 10: domain    (0 == real, 1 == complex)
            - 11: precision (0 == single, 1 == double)
-           - 12: used to encode integer, constant types
+           - 12: used to encode integer, constant, half-precision types
   15 ~ 13  Execution numerical datatype
            - 13: domain    (0 == real, 1 == complex)
            - 14: precision (0 == single, 1 == double)
@@ -292,6 +300,7 @@ typedef void* void_fp;
            -  0: domain    (0 == real, 1 == complex)
            -  1: precision (0 == single, 1 == double)
            -  2: used to encode integer, constant types
+        3  Half-precision storage format (0 == bfloat16, 1 == float16)
 */
 
 // info
@@ -330,6 +339,7 @@ typedef void* void_fp;
 #define BLIS_SCALAR_DT_SHIFT                0
 #define   BLIS_SCALAR_DOMAIN_SHIFT          0
 #define   BLIS_SCALAR_PREC_SHIFT            1
+#define BLIS_HALF_FORMAT_SHIFT              3
 
 //
 // -- BLIS info bit field masks ------------------------------------------------
@@ -371,6 +381,7 @@ typedef void* void_fp;
 #define BLIS_SCALAR_DT_BITS                ( 0x7  << BLIS_SCALAR_DT_SHIFT )
 #define   BLIS_SCALAR_DOMAIN_BIT           ( 0x1  << BLIS_SCALAR_DOMAIN_SHIFT )
 #define   BLIS_SCALAR_PREC_BIT             ( 0x1  << BLIS_SCALAR_PREC_SHIFT )
+#define BLIS_HALF_FORMAT_BIT               ( 0x1  << BLIS_HALF_FORMAT_SHIFT )
 
 
 //
@@ -387,6 +398,9 @@ typedef void* void_fp;
 #define   BLIS_BITVAL_DCOMPLEX_TYPE         ( BLIS_DOMAIN_BIT | BLIS_PRECISION_BIT )
 #define   BLIS_BITVAL_INT_TYPE                0x04
 #define   BLIS_BITVAL_CONST_TYPE              0x05
+#define   BLIS_BITVAL_HALF_TYPE               0x06
+#define   BLIS_BITVAL_BFLOAT16_TYPE           BLIS_BITVAL_HALF_TYPE
+#define   BLIS_BITVAL_FLOAT16_TYPE          ( BLIS_BITVAL_HALF_TYPE | BLIS_HALF_FORMAT_BIT )
 #define BLIS_BITVAL_NO_TRANS                  0x0
 #define BLIS_BITVAL_TRANS                     BLIS_TRANS_BIT
 #define BLIS_BITVAL_NO_CONJ                   0x0
@@ -503,6 +517,11 @@ typedef enum
 
 // -- Data type --
 
+// NOTE: Both half-precision types are stored in the info datatype field as
+// BLIS_BITVAL_HALF_TYPE, which leaves the domain bit clear. The format that
+// distinguishes them lives in the half format bit of info2, and its value
+// is OR'ed into BLIS_FLOAT16 so that bli_obj_dt() can return a distinct
+// num_t for each.
 typedef enum
 {
 	BLIS_FLOAT             = BLIS_BITVAL_FLOAT_TYPE,
@@ -511,6 +530,8 @@ typedef enum
 	BLIS_DCOMPLEX          = BLIS_BITVAL_DCOMPLEX_TYPE,
 	BLIS_INT               = BLIS_BITVAL_INT_TYPE,
 	BLIS_CONSTANT          = BLIS_BITVAL_CONST_TYPE,
+	BLIS_BFLOAT16          = BLIS_BITVAL_BFLOAT16_TYPE,
+	BLIS_FLOAT16           = BLIS_BITVAL_FLOAT16_TYPE,
 	BLIS_DT_LO             = BLIS_FLOAT,
 	BLIS_DT_HI             = BLIS_DCOMPLEX
 } num_t;
@@ -679,6 +700,20 @@ typedef enum
 #define bli_1m   BLIS_1M
 #define bli_nat  BLIS_NAT
 
+// A rule within a per-call induced method policy table. A rule matches a
+// level-3 problem of dimensions m x n x k if each of its bounds is either
+// zero (unbounded) or no smaller than the corresponding dimension.
+typedef struct
+{
+	dim_t m_max;
+	dim_t n_max;
+	dim_t k_max;
+	ind_t method;
+} ind_rule_t;
+
+// The maximum number of rules in each complex datatype's policy table.
+#define BLIS_IND_AUTO_MAX_RULES 16
+
 
 // -- Kernel ID types --
 
@@ -801,6 +836,29 @@ typedef enum
 #define BLIS_NUM_LEVEL3_UKRS 5
 
 
+// Integer gemm micro-kernel types, named for the storage types of A, B
+// and C, respectively.
+typedef enum
+{
+	BLIS_GEMMI_U8S8S32 = 0,
+	BLIS_GEMMI_S16S16S32
+} gemmi_t;
+
+#define BLIS_NUM_GEMMI_TYPES 2
+
+
+// Half-precision storage formats. The value of each is that of the half
+// format bit of the corresponding num_t, so that bli_dt_half_type() can
+// index the kernels that widen them to single precision while packing.
+typedef enum
+{
+	BLIS_HALF_BF16 = 0,
+	BLIS_HALF_FP16
+} half_t;
+
+#define BLIS_NUM_HALF_TYPES 2
+
+
 typedef enum
 {
 	BLIS_REFERENCE_UKERNEL = 0,
@@ -1007,6 +1065,7 @@ typedef enum
 	BLIS_ARCH_CORTEXA15,
 	BLIS_ARCH_CORTEXA9,
 	BLIS_ARCH_A64FX,
+	BLIS_ARCH_ARMSVE,
 
 	// IBM/Power
 	BLIS_ARCH_POWER9,
@@ -1027,7 +1086,7 @@ typedef enum
 
 // NOTE: This value must be updated to reflect the number of enum values
 // listed above for arch_t!
-#define BLIS_NUM_ARCHS 25
+#define BLIS_NUM_ARCHS 26
 
 
 //
@@ -1069,6 +1128,25 @@ typedef struct
 } pool_t;
 
 
+// -- Per-thread block cache type --
+
+typedef struct
+{
+	// Nonzero while a thread is using the cache.
+	volatile int busy;
+
+	dim_t        num_blocks;
+	pblk_t       blocks[ BLIS_POOL_CACHE_DEPTH ];
+	pool_t*      pools[ BLIS_POOL_CACHE_DEPTH ];
+	dim_t        tags[ BLIS_POOL_CACHE_DEPTH ];
+
+	// Keep neighboring caches (and their busy flags) off of each other's
+	// cache lines.
+	char         pad[ 64 ];
+
+} pcache_t;
+
+
 // -- Array type --
 
 typedef struct
@@ -1097,9 +1175,26 @@ typedef struct
 
 typedef struct membrk_s
 {
-	pool_t              pools[3];
+	// Each kind of packed buffer has one pool per block size class.
+	pool_t              pools[3][BLIS_POOL_MAX_SIZE_CLASSES];
 	bli_pthread_mutex_t mutex;
 
+	// The number of size classes in use for each kind of packed buffer,
+	// the number that may be put into use, and the number of times a class
+	// had to be reinitialized to hold larger blocks.
+	dim_t               num_size_classes[3];
+	dim_t               max_size_classes;
+	siz_t               num_reinits[3];
+
+	// Per-thread caches of released blocks, which are consulted before
+	// the (locked) pools.
+	pcache_t            caches[ BLIS_POOL_CACHE_SLOTS ];
+	bool                use_caches;
+
+	// An upper bound, in bytes, on the packing memory that a level-3
+	// operation should require (zero if there is no such bound).
+	siz_t               mem_cap;
+
 	// These fields are used for general-purpose allocation.
 	siz_t               align_size;
 	malloc_ft           malloc_fp;
@@ -1222,6 +1317,44 @@ typedef struct constdata_s
 } constdata_t;
 
 
+// -- Block sparsity map type --
+
+// A block map records which blocks of a matrix, partitioned into blocks of
+// size blk_m x blk_n (the last block row and column may be smaller), may
+// contain nonzero elements. The flags are stored in column-major order, one
+// per block.
+typedef struct blkmap_s
+{
+	dim_t  m;        // length of the matrix described by the map
+	dim_t  n;        // width of the matrix described by the map
+	dim_t  blk_m;    // length of each block
+	dim_t  blk_n;    // width of each block
+	dim_t  m_blk;    // number of block rows
+	dim_t  n_blk;    // number of block columns
+
+	bool*  nz;       // nz[ i + j*m_blk ] is TRUE if block (i,j) is nonzero
+
+} blkmap_t;
+
+
+// -- Linear combination type --
+
+// The maximum number of submatrices in one linear combination.
+#define BLIS_MAX_SUM_TERMS 16
+
+// A term list describes a linear combination of equally-sized submatrices
+// of one matrix. Each submatrix is located at a fixed offset, in elements,
+// from the submatrix that the object refers to, so the list remains valid
+// as the object is partitioned or transposed.
+typedef struct sumterms_s
+{
+	dim_t   n;                           // number of terms
+	inc_t   off[ BLIS_MAX_SUM_TERMS ];   // offset of each submatrix
+	double  coef[ BLIS_MAX_SUM_TERMS ];  // coefficient of each submatrix
+
+} sumterms_t;
+
+
 //
 // -- BLIS object type definitions ---------------------------------------------
 //
@@ -1255,6 +1388,16 @@ typedef struct obj_s
 	                        // usually MR or NR)
 	dim_t         m_panel;  // m dimension of a "full" panel
 	dim_t         n_panel;  // n dimension of a "full" panel
+
+	// Block-sparsity-related fields
+	blkmap_t*     blkmap;   // map of the nonzero blocks (NULL if dense)
+	dim_t         blkoff[2];// map coordinates of the element at offset
+	                        // (0,0), which are swapped if blktrans
+	bool          blktrans; // the map describes the transpose of the object
+
+	// Linear-combination-related fields
+	sumterms_t*   terms;    // submatrices summed by packm and updated by
+	                        // the macro-kernel (NULL if none)
 } obj_t;
 
 // Pre-initializors. Things that must be set afterwards:
@@ -1291,7 +1434,13 @@ typedef struct obj_s
 	.ps        = 0, \
 	.pd        = 0, \
 	.m_panel   = 0, \
-	.n_panel   = 0  \
+	.n_panel   = 0, \
+\
+	.blkmap    = NULL, \
+	.blkoff    = { 0, 0 }, \
+	.blktrans  = FALSE, \
+\
+	.terms     = NULL  \
 }
 
 #define BLIS_OBJECT_INITIALIZER_1X1 \
@@ -1319,7 +1468,13 @@ typedef struct obj_s
 	.ps        = 0, \
 	.pd        = 0, \
 	.m_panel   = 0, \
-	.n_panel   = 0  \
+	.n_panel   = 0, \
+\
+	.blkmap    = NULL, \
+	.blkoff    = { 0, 0 }, \
+	.blktrans  = FALSE, \
+\
+	.terms     = NULL  \
 }
 
 // Define these macros here since they must be updated if contents of
@@ -1353,6 +1508,13 @@ BLIS_INLINE void bli_obj_init_full_shallow_copy_of( obj_t* a, obj_t* b )
 	b->pd        = a->pd;
 	b->m_panel   = a->m_panel;
 	b->n_panel   = a->n_panel;
+
+	b->blkmap    = a->blkmap;
+	b->blkoff[0] = a->blkoff[0];
+	b->blkoff[1] = a->blkoff[1];
+	b->blktrans  = a->blktrans;
+
+	b->terms     = a->terms;
 }
 
 BLIS_INLINE void bli_obj_init_subpart_from( obj_t* a, obj_t* b )
@@ -1386,6 +1548,13 @@ BLIS_INLINE void bli_obj_init_subpart_from( obj_t* a, obj_t* b )
 	b->pd        = a->pd;
 	b->m_panel   = a->m_panel;
 	b->n_panel   = a->n_panel;
+
+	b->blkmap    = a->blkmap;
+	b->blkoff[0] = a->blkoff[0];
+	b->blkoff[1] = a->blkoff[1];
+	b->blktrans  = a->blktrans;
+
+	b->terms     = a->terms;
 }
 
 // Initializors for global scalar constants.
@@ -1439,11 +1608,20 @@ typedef struct cntx_s
 	func_t    l3_sup_kers[ BLIS_NUM_3OP_RC_COMBOS ];
 	mbool_t   l3_sup_kers_prefs[ BLIS_NUM_3OP_RC_COMBOS ];
 
+	void_fp   l3_gemmi_ukrs[ BLIS_NUM_GEMMI_TYPES ];
+	dim_t     l3_gemmi_blkszs[ BLIS_NUM_GEMMI_TYPES ][ BLIS_NUM_BLKSZS ];
+
+	func_t    l3_spmm_ukrs;
+	blksz_t   l3_spmm_nr;
+
+	func_t    l3_gemmsum_ukrs;
+
 	func_t    l1f_kers[ BLIS_NUM_LEVEL1F_KERS ];
 	func_t    l1v_kers[ BLIS_NUM_LEVEL1V_KERS ];
 
 	func_t    packm_kers[ BLIS_NUM_PACKM_KERS ];
 	func_t    unpackm_kers[ BLIS_NUM_UNPACKM_KERS ];
+	void_fp   packm_half_kers[ BLIS_NUM_HALF_TYPES ];
 
 	ind_t     method;
 	pack_t    schema_a_block;
@@ -1468,6 +1646,11 @@ typedef struct rntm_s
 	bool      pack_a; // enable/disable packing of left-hand matrix A.
 	bool      pack_b; // enable/disable packing of right-hand matrix B.
 	bool      l3_sup; // enable/disable small matrix handling in level-3 ops.
+	dim_t     strassen_levels; // levels of Strassen's algorithm for gemm (0 = off).
+	void*     workspace; // caller-supplied memory for packing and small blocks.
+	siz_t     workspace_size;
+	dim_t     spmd_tid;  // caller's id within an SPMD team (see spmd_comm).
+	struct thrcomm_s* spmd_comm; // communicator shared by an SPMD team.
 
 	// "Internal" fields: these should not be exposed to the end-user.
 
@@ -1587,7 +1770,10 @@ typedef enum
 	BLIS_KC_DEF_NONMULTIPLE_OF_KR              = (-164),
 	BLIS_KC_MAX_NONMULTIPLE_OF_KR              = (-165),
 
-	BLIS_ERROR_CODE_MAX                        = (-170)
+	// Tensor-related errors
+	BLIS_INVALID_TENSOR_INDEX                  = (-170),
+
+	BLIS_ERROR_CODE_MAX                        = (-180)
 } err_t;
 
 #endif
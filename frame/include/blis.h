@@ -111,9 +111,12 @@ extern "C" {
 #include "bli_ind.h"
 #include "bli_membrk.h"
 #include "bli_pool.h"
+#include "bli_pcache.h"
 #include "bli_array.h"
+#include "bli_blkmap.h"
 #include "bli_apool.h"
 #include "bli_sba.h"
+#include "bli_workspace.h"
 #include "bli_memsys.h"
 #include "bli_mem.h"
 #include "bli_part.h"
@@ -0,0 +1,118 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_HALFS_H
+#define BLIS_HALFS_H
+
+// Conversions between single precision and the half-precision storage
+// types. Conversions to half precision round to nearest (ties to even);
+// NaNs remain NaNs and values too large for the target become infinite.
+// NOTE: Unions are used to reinterpret bit patterns, which is well-defined
+// in C.
+
+BLIS_INLINE float bli_bf16_to_float( bfloat16 x )
+{
+	union { uint32_t u; float f; } v;
+
+	v.u = ( uint32_t )x << 16;
+
+	return v.f;
+}
+
+BLIS_INLINE bfloat16 bli_float_to_bf16( float x )
+{
+	union { uint32_t u; float f; } v;
+
+	v.f = x;
+
+	// Quiet any NaN rather than letting rounding turn it into infinity.
+	if ( ( v.u & 0x7fffffff ) > 0x7f800000 )
+		return ( bfloat16 )( ( v.u >> 16 ) | 0x0040 );
+
+	v.u += 0x7fff + ( ( v.u >> 16 ) & 1 );
+
+	return ( bfloat16 )( v.u >> 16 );
+}
+
+BLIS_INLINE float bli_fp16_to_float( float16 x )
+{
+	union { uint32_t u; float f; } v;
+
+	// Move the exponent and mantissa into place.
+	v.u = ( uint32_t )( x & 0x7fff ) << 13;
+
+	// Infinities and NaNs only need their exponent widened. Everything else
+	// (including subnormals) is rebiased by scaling by 2^(127-15).
+	if ( ( x & 0x7c00 ) == 0x7c00 ) v.u |= 0x70000000;
+	else                            v.f *= 5.192296858534828e33f; // 2^112
+
+	v.u |= ( uint32_t )( x & 0x8000 ) << 16;
+
+	return v.f;
+}
+
+BLIS_INLINE float16 bli_float_to_fp16( float x )
+{
+	union { uint32_t u; float f; } v;
+
+	v.f = x;
+
+	const uint32_t sign = ( v.u >> 16 ) & 0x8000;
+
+	v.u &= 0x7fffffff;
+
+	// Infinities and NaNs.
+	if ( v.u >= 0x7f800000 )
+		return ( float16 )( sign | 0x7c00 | ( v.u > 0x7f800000 ? 0x0200 : 0 ) );
+
+	// Values that round to a magnitude of at least 2^16.
+	if ( v.u >= 0x477ff000 )
+		return ( float16 )( sign | 0x7c00 );
+
+	// Values that become subnormal (or zero). Adding 0.5 aligns the result
+	// in the low mantissa bits and lets the hardware do the rounding.
+	if ( v.u < 0x38800000 )
+	{
+		v.f += 0.5f;
+
+		return ( float16 )( sign | ( v.u - 0x3f000000 ) );
+	}
+
+	// Normal values: rebias the exponent and round.
+	v.u += 0xc8000fff + ( ( v.u >> 13 ) & 1 );
+
+	return ( float16 )( sign | ( v.u >> 13 ) );
+}
+
+#endif
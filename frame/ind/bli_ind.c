@@ -63,6 +63,16 @@ void bli_ind_init( void )
 
 	if ( c_is_ref ) bli_ind_enable_dt( BLIS_1M, BLIS_SCOMPLEX );
 	if ( z_is_ref ) bli_ind_enable_dt( BLIS_1M, BLIS_DCOMPLEX );
+
+	// If the user named a calibrated induced method policy table via the
+	// environment, load it and enable per-call method selection.
+	const char* path = getenv( "BLIS_IND_TABLE" );
+
+	if ( path != NULL && path[0] != '\0' )
+	{
+		if ( bli_ind_auto_read_table( path ) == BLIS_SUCCESS )
+			bli_l3_ind_auto_set_enable( TRUE );
+	}
 }
 
 void bli_ind_finalize( void )
@@ -218,6 +228,189 @@ char* bli_ind_oper_get_avail_impl_string( opid_t oper, num_t dt )
 
 // -----------------------------------------------------------------------------
 
+void bli_ind_auto_enable( void )
+{
+	bli_init_once();
+
+	bli_l3_ind_auto_set_enable( TRUE );
+}
+
+void bli_ind_auto_disable( void )
+{
+	bli_init_once();
+
+	bli_l3_ind_auto_set_enable( FALSE );
+}
+
+bool bli_ind_auto_is_enabled( void )
+{
+	bli_init_once();
+
+	return bli_l3_ind_auto_get_enable();
+}
+
+void bli_ind_auto_set_allow_3m( bool allow )
+{
+	bli_init_once();
+
+	bli_l3_ind_auto_set_allow_3m( allow );
+}
+
+bool bli_ind_auto_get_allow_3m( void )
+{
+	bli_init_once();
+
+	return bli_l3_ind_auto_get_allow_3m();
+}
+
+err_t bli_ind_auto_set_table( num_t dt, dim_t n_rules, ind_rule_t* rules )
+{
+	bli_init_once();
+
+	return bli_l3_ind_auto_set_table( dt, n_rules, rules );
+}
+
+dim_t bli_ind_auto_get_table( num_t dt, dim_t n_max, ind_rule_t* rules )
+{
+	bli_init_once();
+
+	return bli_l3_ind_auto_get_table( dt, n_max, rules );
+}
+
+ind_t bli_ind_oper_find_auto( opid_t oper, num_t dt, dim_t m, dim_t n, dim_t k )
+{
+	bli_init_once();
+
+	if ( bli_opid_is_level3( oper ) )
+		return bli_l3_ind_oper_find_auto( oper, dt, m, n, k );
+	else
+		return BLIS_NAT;
+}
+
+// -----------------------------------------------------------------------------
+
+//
+// Policy tables are stored as plain text, one rule per line:
+//
+//   <dt> <method> <m_max> <n_max> <k_max>
+//
+// where <dt> is 'c' or 'z', <method> is one of the strings returned by
+// bli_ind_get_impl_string(), and a bound of zero means unbounded. Rules are
+// listed in priority order. Blank lines and lines beginning with '#' are
+// ignored.
+//
+
+static bool bli_ind_map_string_to_method( const char* str, ind_t* method )
+{
+	for ( ind_t im = 0; im < BLIS_NUM_IND_METHODS; ++im )
+	{
+		if ( strcmp( str, bli_ind_impl_str[ im ] ) == 0 )
+		{
+			*method = im;
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+err_t bli_ind_auto_read_table( const char* path )
+{
+	ind_rule_t rules[2][ BLIS_IND_AUTO_MAX_RULES ];
+	dim_t      n_rules[2] = { 0, 0 };
+	char       line[ 256 ];
+	err_t      r_val = BLIS_SUCCESS;
+
+	FILE* file = fopen( path, "r" );
+
+	if ( file == NULL ) return BLIS_FAILURE;
+
+	while ( fgets( line, sizeof( line ), file ) != NULL )
+	{
+		char  dt_ch;
+		char  meth_str[ 16 ];
+		long  m_max, n_max, k_max;
+		ind_t method;
+		int   idt;
+
+		// Skip comments and blank lines.
+		char* p = line;
+		while ( *p == ' ' || *p == '\t' ) ++p;
+		if ( *p == '#' || *p == '\n' || *p == '\0' ) continue;
+
+		if ( sscanf( p, " %c %15s %ld %ld %ld",
+		             &dt_ch, meth_str, &m_max, &n_max, &k_max ) != 5 ||
+		     !bli_ind_map_string_to_method( meth_str, &method ) )
+		{ r_val = BLIS_FAILURE; break; }
+
+		if      ( dt_ch == 'c' ) idt = 0;
+		else if ( dt_ch == 'z' ) idt = 1;
+		else { r_val = BLIS_FAILURE; break; }
+
+		if ( n_rules[ idt ] == BLIS_IND_AUTO_MAX_RULES ||
+		     m_max < 0 || n_max < 0 || k_max < 0 )
+		{ r_val = BLIS_FAILURE; break; }
+
+		ind_rule_t* rule = &rules[ idt ][ n_rules[ idt ] ];
+
+		rule->m_max  = ( dim_t )m_max;
+		rule->n_max  = ( dim_t )n_max;
+		rule->k_max  = ( dim_t )k_max;
+		rule->method = method;
+
+		n_rules[ idt ] += 1;
+	}
+
+	fclose( file );
+
+	// Only install the tables if the entire file was parsed successfully.
+	if ( r_val == BLIS_SUCCESS )
+	{
+		bli_l3_ind_auto_set_table( BLIS_SCOMPLEX, n_rules[0], rules[0] );
+		bli_l3_ind_auto_set_table( BLIS_DCOMPLEX, n_rules[1], rules[1] );
+	}
+
+	return r_val;
+}
+
+err_t bli_ind_auto_write_table( const char* path )
+{
+	ind_rule_t rules[ BLIS_IND_AUTO_MAX_RULES ];
+	num_t      dts[2]   = { BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	char       dt_chs[2] = { 'c', 'z' };
+
+	bli_init_once();
+
+	FILE* file = fopen( path, "w" );
+
+	if ( file == NULL ) return BLIS_FAILURE;
+
+	fprintf( file, "# dt method m_max n_max k_max (0 = unbounded)\n" );
+
+	for ( dim_t i = 0; i < 2; ++i )
+	{
+		dim_t n_rules = bli_l3_ind_auto_get_table( dts[ i ],
+		                                           BLIS_IND_AUTO_MAX_RULES,
+		                                           rules );
+
+		for ( dim_t r = 0; r < n_rules; ++r )
+		{
+			fprintf( file, "%c %s %ld %ld %ld\n",
+			         dt_chs[ i ],
+			         bli_ind_get_impl_string( rules[ r ].method ),
+			         ( long )rules[ r ].m_max,
+			         ( long )rules[ r ].n_max,
+			         ( long )rules[ r ].k_max );
+		}
+	}
+
+	if ( fclose( file ) != 0 ) return BLIS_FAILURE;
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
 char* bli_ind_get_impl_string( ind_t method )
 {
 	return bli_ind_impl_str[ method ];
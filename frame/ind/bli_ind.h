@@ -67,6 +67,18 @@ BLIS_EXPORT_BLIS void_fp bli_ind_oper_get_avail( opid_t oper, num_t dt );
 BLIS_EXPORT_BLIS ind_t   bli_ind_oper_find_avail( opid_t oper, num_t dt );
 BLIS_EXPORT_BLIS char*   bli_ind_oper_get_avail_impl_string( opid_t oper, num_t dt );
 
+// Per-call induced method selection based on problem shape.
+BLIS_EXPORT_BLIS void    bli_ind_auto_enable( void );
+BLIS_EXPORT_BLIS void    bli_ind_auto_disable( void );
+BLIS_EXPORT_BLIS bool    bli_ind_auto_is_enabled( void );
+BLIS_EXPORT_BLIS void    bli_ind_auto_set_allow_3m( bool allow );
+BLIS_EXPORT_BLIS bool    bli_ind_auto_get_allow_3m( void );
+BLIS_EXPORT_BLIS err_t   bli_ind_auto_set_table( num_t dt, dim_t n_rules, ind_rule_t* rules );
+BLIS_EXPORT_BLIS dim_t   bli_ind_auto_get_table( num_t dt, dim_t n_max, ind_rule_t* rules );
+BLIS_EXPORT_BLIS err_t   bli_ind_auto_read_table( const char* path );
+BLIS_EXPORT_BLIS err_t   bli_ind_auto_write_table( const char* path );
+BLIS_EXPORT_BLIS ind_t   bli_ind_oper_find_auto( opid_t oper, num_t dt, dim_t m, dim_t n, dim_t k );
+
 char*  bli_ind_get_impl_string( ind_t method );
 num_t  bli_ind_map_cdt_to_index( num_t dt );
 
@@ -109,6 +109,28 @@ GENFUNC( trmm3, BLIS_TRMM3 )
 GENFUNC( trmm, BLIS_TRMM )
 GENFUNC( trsm, BLIS_TRSM )
 
+
+#undef  GENFUNC
+#define GENFUNC( opname, optype ) \
+\
+void_fp PASTEMAC(opname,ind_get_auto)( num_t dt, dim_t m, dim_t n, dim_t k ) \
+{ \
+	ind_t method = bli_l3_ind_oper_find_auto( optype, dt, m, n, k ); \
+\
+	return bli_l3_ind_oper_get_func( optype, method ); \
+}
+
+GENFUNC( gemm, BLIS_GEMM )
+GENFUNC( hemm, BLIS_HEMM )
+GENFUNC( herk, BLIS_HERK )
+GENFUNC( her2k, BLIS_HER2K )
+GENFUNC( symm, BLIS_SYMM )
+GENFUNC( syrk, BLIS_SYRK )
+GENFUNC( syr2k, BLIS_SYR2K )
+GENFUNC( trmm3, BLIS_TRMM3 )
+GENFUNC( trmm, BLIS_TRMM )
+GENFUNC( trsm, BLIS_TRSM )
+
 // -----------------------------------------------------------------------------
 
 #if 0
@@ -161,6 +183,225 @@ ind_t bli_l3_ind_oper_find_avail( opid_t oper, num_t dt )
 
 // -----------------------------------------------------------------------------
 
+//
+// The per-call induced method policy. When enabled, each complex level-3
+// operation consults the policy table for its datatype and uses the method
+// named by the first rule that matches the problem dimensions, provided
+// that the method is implemented for the operation (and is not a 3m method
+// when those have been excluded). Problems that match no rule fall back to
+// the thread's enabled methods, as usual.
+//
+// Unlike the enablement status above, the policy is shared by all threads.
+//
+
+static ind_rule_t bli_l3_ind_auto_rules[2][BLIS_IND_AUTO_MAX_RULES];
+static dim_t      bli_l3_ind_auto_n_rules[2] = { 0, 0 };
+static bool       bli_l3_ind_auto_enabled    = FALSE;
+static bool       bli_l3_ind_auto_allow_3m   = TRUE;
+
+// A mutex to serialize updates of the policy.
+static bli_pthread_mutex_t auto_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+// A sequence counter that allows the per-call lookup to take a consistent
+// snapshot of the policy without acquiring auto_mutex (in the same way that
+// global_rntm is read in bli_rntm.c). Writers increment it once before and
+// once after modifying the policy, so an odd value means that an update is
+// in progress.
+static volatile gint_t auto_seq = 0;
+
+// Use __sync_* builtins (assumed available) if __atomic_* ones are not present.
+#ifndef __ATOMIC_RELAXED
+
+#define __ATOMIC_RELAXED
+#define __ATOMIC_ACQUIRE
+
+#define __atomic_load_n(ptr, constraint) \
+    __sync_fetch_and_add(ptr, 0)
+#define __atomic_thread_fence(constraint) \
+    __sync_synchronize()
+
+#endif
+
+static void bli_l3_ind_auto_update_begin( void )
+{
+	bli_pthread_mutex_lock( &auto_mutex );
+
+	// Mark the update as in progress. (__sync_add_and_fetch() acts as a full
+	// barrier, so the increment is visible before any change to the policy.)
+	__sync_add_and_fetch( &auto_seq, 1 );
+}
+
+static void bli_l3_ind_auto_update_end( void )
+{
+	// Mark the update as complete, publishing the new policy to subsequent
+	// readers.
+	__sync_add_and_fetch( &auto_seq, 1 );
+
+	bli_pthread_mutex_unlock( &auto_mutex );
+}
+
+BLIS_INLINE bool bli_l3_ind_is_3m( ind_t method )
+{
+	return ( method == BLIS_3MH || method == BLIS_3M1 );
+}
+
+BLIS_INLINE bool bli_l3_ind_rule_matches( ind_rule_t* rule, dim_t m, dim_t n, dim_t k )
+{
+	return ( ( rule->m_max == 0 || m <= rule->m_max ) &&
+	         ( rule->n_max == 0 || n <= rule->n_max ) &&
+	         ( rule->k_max == 0 || k <= rule->k_max ) );
+}
+
+ind_t bli_l3_ind_oper_find_auto( opid_t oper, num_t dt, dim_t m, dim_t n, dim_t k )
+{
+	// If the datatype is real, return native execution.
+	if ( !bli_is_complex( dt ) ) return BLIS_NAT;
+
+	// If the operation is not level-3, return native execution.
+	if ( !bli_opid_is_level3( oper ) ) return BLIS_NAT;
+
+	const num_t idt = bli_ind_map_cdt_to_index( dt );
+
+	ind_rule_t  rules[ BLIS_IND_AUTO_MAX_RULES ];
+	dim_t       n_rules;
+	bool        enabled;
+	bool        allow_3m;
+
+	// Copy the policy for the current datatype without locking. If the
+	// sequence counter is odd, or if it changed while we were copying, a
+	// writer was active and the copy may be torn, so we try again.
+	while ( TRUE )
+	{
+		const gint_t seq0 = __atomic_load_n( &auto_seq, __ATOMIC_ACQUIRE );
+
+		if ( seq0 & 1 ) continue;
+
+		enabled  = bli_l3_ind_auto_enabled;
+		allow_3m = bli_l3_ind_auto_allow_3m;
+		n_rules  = enabled ? bli_l3_ind_auto_n_rules[ idt ] : 0;
+
+		for ( dim_t r = 0; r < n_rules; ++r )
+			rules[ r ] = bli_l3_ind_auto_rules[ idt ][ r ];
+
+		__atomic_thread_fence( __ATOMIC_ACQUIRE );
+
+		const gint_t seq1 = __atomic_load_n( &auto_seq, __ATOMIC_RELAXED );
+
+		if ( seq0 == seq1 ) break;
+	}
+
+	if ( !enabled ) return bli_l3_ind_oper_find_avail( oper, dt );
+
+	// Use the first matching rule whose method may be used for the current
+	// operation.
+	for ( dim_t r = 0; r < n_rules; ++r )
+	{
+		ind_rule_t* rule = &rules[ r ];
+
+		if ( !bli_l3_ind_rule_matches( rule, m, n, k ) ) continue;
+		if ( !allow_3m && bli_l3_ind_is_3m( rule->method ) ) continue;
+		if ( bli_l3_ind_oper_get_func( oper, rule->method ) == NULL ) continue;
+
+		return rule->method;
+	}
+
+	// Otherwise, search the enabled methods as bli_l3_ind_oper_find_avail()
+	// does, except for skipping any excluded 3m methods.
+	for ( ind_t im = 0; im < BLIS_NUM_IND_METHODS; ++im )
+	{
+		void_fp func = bli_l3_ind_oper_get_func( oper, im );
+		bool    stat = bli_l3_ind_oper_get_enable( oper, im, dt );
+
+		if ( !allow_3m && bli_l3_ind_is_3m( im ) ) continue;
+
+		if ( func != NULL &&
+		     stat == TRUE ) return im;
+	}
+
+	return BLIS_NAT;
+}
+
+void bli_l3_ind_auto_set_enable( bool status )
+{
+	bli_l3_ind_auto_update_begin();
+	bli_l3_ind_auto_enabled = status;
+	bli_l3_ind_auto_update_end();
+}
+
+bool bli_l3_ind_auto_get_enable( void )
+{
+	return __atomic_load_n( &bli_l3_ind_auto_enabled, __ATOMIC_RELAXED );
+}
+
+void bli_l3_ind_auto_set_allow_3m( bool allow )
+{
+	bli_l3_ind_auto_update_begin();
+	bli_l3_ind_auto_allow_3m = allow;
+	bli_l3_ind_auto_update_end();
+}
+
+bool bli_l3_ind_auto_get_allow_3m( void )
+{
+	return __atomic_load_n( &bli_l3_ind_auto_allow_3m, __ATOMIC_RELAXED );
+}
+
+err_t bli_l3_ind_auto_set_table( num_t dt, dim_t n_rules, ind_rule_t* rules )
+{
+	if ( !bli_is_complex( dt ) ) return BLIS_FAILURE;
+	if ( n_rules < 0 || BLIS_IND_AUTO_MAX_RULES < n_rules ) return BLIS_FAILURE;
+
+	for ( dim_t r = 0; r < n_rules; ++r )
+	{
+		if ( rules[ r ].method < BLIS_IND_FIRST ||
+		     rules[ r ].method > BLIS_IND_LAST ||
+		     rules[ r ].m_max < 0 ||
+		     rules[ r ].n_max < 0 ||
+		     rules[ r ].k_max < 0 ) return BLIS_FAILURE;
+	}
+
+	const num_t idt = bli_ind_map_cdt_to_index( dt );
+
+	bli_l3_ind_auto_update_begin();
+
+	// BEGIN CRITICAL SECTION
+	{
+		for ( dim_t r = 0; r < n_rules; ++r )
+			bli_l3_ind_auto_rules[ idt ][ r ] = rules[ r ];
+
+		bli_l3_ind_auto_n_rules[ idt ] = n_rules;
+	}
+	// END CRITICAL SECTION
+
+	bli_l3_ind_auto_update_end();
+
+	return BLIS_SUCCESS;
+}
+
+dim_t bli_l3_ind_auto_get_table( num_t dt, dim_t n_max, ind_rule_t* rules )
+{
+	if ( !bli_is_complex( dt ) ) return 0;
+
+	const num_t idt = bli_ind_map_cdt_to_index( dt );
+	dim_t       n_rules;
+
+	bli_pthread_mutex_lock( &auto_mutex );
+
+	// BEGIN CRITICAL SECTION
+	{
+		n_rules = bli_min( n_max, bli_l3_ind_auto_n_rules[ idt ] );
+
+		for ( dim_t r = 0; r < n_rules; ++r )
+			rules[ r ] = bli_l3_ind_auto_rules[ idt ][ r ];
+	}
+	// END CRITICAL SECTION
+
+	bli_pthread_mutex_unlock( &auto_mutex );
+
+	return n_rules;
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_l3_ind_set_enable_dt( ind_t method, num_t dt, bool status )
 {
 	opid_t iop;
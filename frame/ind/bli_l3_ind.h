@@ -54,11 +54,36 @@ GENPROT( trmm3 )
 GENPROT( trmm )
 GENPROT( trsm )
 
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+void_fp PASTEMAC(opname,ind_get_auto)( num_t dt, dim_t m, dim_t n, dim_t k );
+
+GENPROT( gemm )
+GENPROT( hemm )
+GENPROT( herk )
+GENPROT( her2k )
+GENPROT( symm )
+GENPROT( syrk )
+GENPROT( syr2k )
+GENPROT( trmm3 )
+GENPROT( trmm )
+GENPROT( trsm )
+
 // -----------------------------------------------------------------------------
 
 //bool bli_l3_ind_oper_is_avail( opid_t oper, ind_t method, num_t dt );
 
 ind_t   bli_l3_ind_oper_find_avail( opid_t oper, num_t dt );
+ind_t   bli_l3_ind_oper_find_auto( opid_t oper, num_t dt, dim_t m, dim_t n, dim_t k );
+
+void    bli_l3_ind_auto_set_enable( bool status );
+bool    bli_l3_ind_auto_get_enable( void );
+void    bli_l3_ind_auto_set_allow_3m( bool allow );
+bool    bli_l3_ind_auto_get_allow_3m( void );
+err_t   bli_l3_ind_auto_set_table( num_t dt, dim_t n_rules, ind_rule_t* rules );
+dim_t   bli_l3_ind_auto_get_table( num_t dt, dim_t n_max, ind_rule_t* rules );
 
 void    bli_l3_ind_set_enable_dt( ind_t method, num_t dt, bool status );
 
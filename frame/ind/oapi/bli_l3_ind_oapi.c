@@ -54,8 +54,14 @@ void PASTEMAC(opname,imeth) \
 { \
 	bli_init_once(); \
 \
+	/* Select the method (native or induced) according to the problem
+	   dimensions. Unless per-call selection is enabled, this is equivalent
+	   to choosing the first available method. */ \
 	num_t                dt   = bli_obj_dt( c ); \
-	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail)( dt ); \
+	dim_t                m    = bli_obj_length( c ); \
+	dim_t                n    = bli_obj_width( c ); \
+	dim_t                k    = bli_obj_width_after_trans( a ); \
+	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_auto)( dt, m, n, k ); \
 \
 	/* Initialize a local runtime with global settings if necessary. Note
 	   that in the case that a runtime is passed in, we make a local copy. */ \
@@ -91,7 +97,10 @@ void PASTEMAC(opname,imeth) \
 	bli_init_once(); \
 \
 	num_t                dt   = bli_obj_dt( c ); \
-	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail)( dt ); \
+	dim_t                m    = bli_obj_length( c ); \
+	dim_t                n    = bli_obj_width( c ); \
+	dim_t                k    = ( bli_is_left( side ) ? m : n ); \
+	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_auto)( dt, m, n, k ); \
 \
 	/* Initialize a local runtime with global settings if necessary. Note
 	   that in the case that a runtime is passed in, we make a local copy. */ \
@@ -125,7 +134,10 @@ void PASTEMAC(opname,imeth) \
 	bli_init_once(); \
 \
 	num_t                dt   = bli_obj_dt( c ); \
-	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail)( dt ); \
+	dim_t                m    = bli_obj_length( c ); \
+	dim_t                n    = m; \
+	dim_t                k    = bli_obj_width_after_trans( a ); \
+	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_auto)( dt, m, n, k ); \
 \
 	/* Initialize a local runtime with global settings if necessary. Note
 	   that in the case that a runtime is passed in, we make a local copy. */ \
@@ -158,7 +170,10 @@ void PASTEMAC(opname,imeth) \
 	bli_init_once(); \
 \
 	num_t                dt   = bli_obj_dt( b ); \
-	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_avail)( dt ); \
+	dim_t                m    = bli_obj_length( b ); \
+	dim_t                n    = bli_obj_width( b ); \
+	dim_t                k    = ( bli_is_left( side ) ? m : n ); \
+	PASTECH(opname,_oft) func = PASTEMAC(opname,ind_get_auto)( dt, m, n, k ); \
 \
 	/* Initialize a local runtime with global settings if necessary. Note
 	   that in the case that a runtime is passed in, we make a local copy. */ \
@@ -52,6 +52,9 @@ typedef void (*l3int_t)
        thrinfo_t* thread
      );
 
+// Cache of control and thrinfo_t trees for reuse across operations.
+#include "bli_l3_decor_cache.h"
+
 // Level-3 thread decorator prototype.
 void bli_l3_thread_decorator
      (
@@ -67,6 +70,21 @@ void bli_l3_thread_decorator
        cntl_t* cntl
      );
 
+// Level-3 thread decorator for members of an SPMD team.
+void bli_l3_thread_decorator_spmd
+     (
+       l3int_t func,
+       opid_t  family,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl
+     );
+
 // Include definitions specific to the method of multithreading for the
 // conventional code path.
 #include "bli_l3_decor_single.h"
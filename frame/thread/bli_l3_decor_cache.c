@@ -0,0 +1,255 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+static l3tree_t            l3_trees[ BLIS_L3_DECOR_CACHE_SIZE ];
+static bli_pthread_mutex_t l3_trees_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+static uint64_t            l3_trees_clock = 0;
+static bool                l3_trees_enabled = FALSE;
+
+static void bli_l3_decor_cache_free_entry
+     (
+       l3tree_t* tree
+     );
+
+// -----------------------------------------------------------------------------
+
+void bli_l3_decor_cache_init( void )
+{
+	for ( dim_t i = 0; i < BLIS_L3_DECOR_CACHE_SIZE; ++i )
+		memset( &l3_trees[ i ], 0, sizeof( l3tree_t ) );
+
+	// The cache is used unless BLIS_TREE_CACHE is set to 0.
+	l3_trees_enabled = ( bli_env_get_var( "BLIS_TREE_CACHE", -1 ) != 0 );
+}
+
+void bli_l3_decor_cache_finalize( void )
+{
+	for ( dim_t i = 0; i < BLIS_L3_DECOR_CACHE_SIZE; ++i )
+		bli_l3_decor_cache_free_entry( &l3_trees[ i ] );
+
+	l3_trees_enabled = FALSE;
+}
+
+// -----------------------------------------------------------------------------
+
+l3tree_t* bli_l3_decor_cache_checkout
+     (
+       opid_t  family,
+       pack_t  schema_a,
+       pack_t  schema_b,
+       obj_t*  a,
+       rntm_t* rntm,
+       cntl_t* cntl
+     )
+{
+	// User-provided control trees are copied for every operation, and the
+	// nodes of trees built for an operation with a caller-supplied
+	// workspace are carved out of that workspace, so neither is cached.
+	if ( !l3_trees_enabled || cntl != NULL || bli_rntm_has_workspace( rntm ) )
+		return NULL;
+
+	const dim_t  n_threads = bli_rntm_num_threads( rntm );
+	const side_t side      = ( family == BLIS_TRSM && !bli_obj_is_triangular( a )
+	                           ? BLIS_RIGHT : BLIS_LEFT );
+	const dim_t  ways[ 5 ] = { bli_rntm_jc_ways( rntm ),
+	                           bli_rntm_pc_ways( rntm ),
+	                           bli_rntm_ic_ways( rntm ),
+	                           bli_rntm_jr_ways( rntm ),
+	                           bli_rntm_ir_ways( rntm ) };
+
+	l3tree_t* tree     = NULL;
+	l3tree_t* tree_lru = NULL;
+	bool      evict    = FALSE;
+
+	bli_pthread_mutex_lock( &l3_trees_mutex );
+
+	// Look for an idle entry with the same key, and along the way, note the
+	// least recently used idle entry in case there is none.
+	for ( dim_t i = 0; i < BLIS_L3_DECOR_CACHE_SIZE; ++i )
+	{
+		l3tree_t* t = &l3_trees[ i ];
+
+		if ( t->in_use ) continue;
+
+		if ( t->cntls     != NULL     &&
+		     t->family    == family   &&
+		     t->schema_a  == schema_a &&
+		     t->schema_b  == schema_b &&
+		     t->side      == side     &&
+		     t->n_threads == n_threads &&
+		     memcmp( t->ways, ways, sizeof( ways ) ) == 0 )
+		{
+			tree = t;
+			break;
+		}
+
+		if ( tree_lru == NULL || t->last_use < tree_lru->last_use )
+			tree_lru = t;
+	}
+
+	// Otherwise, replace the least recently used idle entry. If every entry
+	// is busy, the caller builds its own trees.
+	if ( tree == NULL )
+	{
+		tree  = tree_lru;
+		evict = TRUE;
+	}
+
+	if ( tree != NULL )
+	{
+		tree->in_use   = TRUE;
+		tree->last_use = ++l3_trees_clock;
+	}
+
+	bli_pthread_mutex_unlock( &l3_trees_mutex );
+
+	// Free the trees of a replaced entry outside of the critical section;
+	// the entry is already marked as in use.
+	if ( tree != NULL && evict ) bli_l3_decor_cache_free_entry( tree );
+
+	// Set up a new (or evicted) entry. Its trees are built later, by each
+	// thread, in bli_l3_decor_cache_get_trees().
+	if ( tree != NULL && tree->cntls == NULL )
+	{
+		tree->family    = family;
+		tree->schema_a  = schema_a;
+		tree->schema_b  = schema_b;
+		tree->side      = side;
+		tree->n_threads = n_threads;
+		memcpy( tree->ways, ways, sizeof( ways ) );
+
+		// Cached trees outlive the operation, and with it the sba array_t,
+		// so their nodes are allocated from the heap (via a NULL rntm_t).
+		tree->gl_comm   = bli_thrcomm_create( NULL, n_threads );
+		tree->cntls     = bli_calloc_intl( n_threads * sizeof( cntl_t* ) );
+		tree->threads   = bli_calloc_intl( n_threads * sizeof( thrinfo_t* ) );
+	}
+
+	return tree;
+}
+
+void bli_l3_decor_cache_checkin
+     (
+       l3tree_t* tree
+     )
+{
+	if ( tree == NULL ) return;
+
+	bli_pthread_mutex_lock( &l3_trees_mutex );
+	tree->in_use = FALSE;
+	bli_pthread_mutex_unlock( &l3_trees_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_l3_decor_cache_get_trees
+     (
+       dim_t       tid,
+       l3tree_t*   tree,
+       obj_t*      a,
+       obj_t*      b,
+       obj_t*      c,
+       rntm_t*     rntm,
+       cntl_t**    cntl_use,
+       thrinfo_t** thread
+     )
+{
+	// The first time a thread uses an entry, it builds its trees just as it
+	// would for a single operation. Thereafter, the trees are reused as-is,
+	// including any thrinfo_t nodes grown by earlier operations.
+	if ( tree->cntls[ tid ] == NULL )
+	{
+		bli_l3_cntl_create_if( tree->family, tree->schema_a, tree->schema_b,
+		                       a, b, c, rntm, NULL, &tree->cntls[ tid ] );
+
+		bli_l3_thrinfo_create_root( tid, tree->gl_comm, rntm,
+		                            tree->cntls[ tid ], &tree->threads[ tid ] );
+	}
+
+	*cntl_use = tree->cntls[ tid ];
+	*thread   = tree->threads[ tid ];
+}
+
+void bli_l3_decor_cache_reset_trees
+     (
+       rntm_t*     rntm,
+       cntl_t*     cntl_use,
+       thrinfo_t*  thread
+     )
+{
+	// Return the pack blocks to the memory broker, as bli_l3_cntl_free()
+	// would, so that cached trees never hold on to packing memory between
+	// operations.
+	bli_cntl_release_mem( rntm, cntl_use, thread );
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_l3_decor_cache_free_entry
+     (
+       l3tree_t* tree
+     )
+{
+	if ( tree->cntls == NULL ) return;
+
+	// Free the trees with a rntm_t that has no sba pool so that the nodes
+	// are returned to the heap from which they came.
+	rntm_t rntm = BLIS_RNTM_INITIALIZER;
+
+	for ( dim_t tid = 0; tid < tree->n_threads; ++tid )
+	{
+		if ( tree->cntls[ tid ] == NULL ) continue;
+
+		bli_l3_cntl_free( &rntm, tree->cntls[ tid ], tree->threads[ tid ] );
+		bli_l3_thrinfo_free( &rntm, tree->threads[ tid ] );
+	}
+
+	// The global communicator is freed along with the root of thread 0's
+	// thrinfo_t tree, if it was ever built.
+	if ( tree->threads[ 0 ] == NULL )
+		bli_thrcomm_free( NULL, tree->gl_comm );
+
+	bli_free_intl( tree->cntls );
+	bli_free_intl( tree->threads );
+
+	// Leave the in_use field alone since the caller may be about to reuse
+	// the entry.
+	tree->gl_comm   = NULL;
+	tree->cntls     = NULL;
+	tree->threads   = NULL;
+	tree->n_threads = 0;
+}
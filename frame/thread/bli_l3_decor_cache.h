@@ -0,0 +1,107 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_L3_DECOR_CACHE_H
+#define BLIS_L3_DECOR_CACHE_H
+
+// The level-3 thread decorators keep the control trees and thrinfo_t trees
+// that they build so that later operations with the same shape of trees
+// can reuse them rather than building them again. An entry is keyed by
+// everything that determines the shape of its trees: the operation family,
+// the pack schemas, the side (for trsm), the number of threads, and the
+// ways of parallelism in each loop. Each thread builds its own trees the
+// first time an entry is used, and the pack mem_t entries cached in the
+// control trees are released at the end of every operation.
+
+// The number of entries in the cache.
+#define BLIS_L3_DECOR_CACHE_SIZE 8
+
+typedef struct l3tree_s
+{
+	opid_t      family;
+	pack_t      schema_a;
+	pack_t      schema_b;
+	side_t      side;
+	dim_t       n_threads;
+	dim_t       ways[ 5 ];
+
+	// The global communicator shared by the roots of the thrinfo_t trees,
+	// and the root of each thread's control tree and thrinfo_t tree.
+	thrcomm_t*  gl_comm;
+	cntl_t**    cntls;
+	thrinfo_t** threads;
+
+	bool        in_use;
+	uint64_t    last_use;
+
+} l3tree_t;
+
+void      bli_l3_decor_cache_init( void );
+void      bli_l3_decor_cache_finalize( void );
+
+l3tree_t* bli_l3_decor_cache_checkout
+     (
+       opid_t  family,
+       pack_t  schema_a,
+       pack_t  schema_b,
+       obj_t*  a,
+       rntm_t* rntm,
+       cntl_t* cntl
+     );
+void      bli_l3_decor_cache_checkin
+     (
+       l3tree_t* tree
+     );
+
+void      bli_l3_decor_cache_get_trees
+     (
+       dim_t       tid,
+       l3tree_t*   tree,
+       obj_t*      a,
+       obj_t*      b,
+       obj_t*      c,
+       rntm_t*     rntm,
+       cntl_t**    cntl_use,
+       thrinfo_t** thread
+     );
+void      bli_l3_decor_cache_reset_trees
+     (
+       rntm_t*     rntm,
+       cntl_t*     cntl_use,
+       thrinfo_t*  thread
+     );
+
+#endif
+
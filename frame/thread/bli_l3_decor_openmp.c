@@ -37,13 +37,144 @@
 
 #ifdef BLIS_ENABLE_OPENMP
 
-// Define a dummy function bli_l3_thread_entry(), which is needed in the
-// pthreads version, so that when building Windows DLLs (with OpenMP enabled
-// or no multithreading) we don't risk having an unresolved symbol.
-void* bli_l3_thread_entry( void* data_void ) { return NULL; }
-
 //#define PRINT_THRINFO
 
+// A data structure to assist in passing operands to each thread.
+typedef struct thread_data
+{
+	l3int_t     func;
+	opid_t      family;
+	pack_t      schema_a;
+	pack_t      schema_b;
+	obj_t*      alpha;
+	obj_t*      a;
+	obj_t*      b;
+	obj_t*      beta;
+	obj_t*      c;
+	cntx_t*     cntx;
+	rntm_t*     rntm;
+	cntl_t*     cntl;
+	dim_t       tid;
+	thrcomm_t*  gl_comm;
+	array_t*    array;
+	l3tree_t*   tree;
+	thrinfo_t** threads;
+} thread_data_t;
+
+// Entry point for each thread, whether it belongs to the OpenMP parallel
+// region opened below or to the team of a thread region. (The function is
+// also needed so that, when building Windows DLLs, we don't risk having an
+// unresolved symbol.)
+void* bli_l3_thread_entry( void* data_void )
+{
+	thread_data_t* data     = data_void;
+
+	l3int_t        func     = data->func;
+	opid_t         family   = data->family;
+	pack_t         schema_a = data->schema_a;
+	pack_t         schema_b = data->schema_b;
+	obj_t*         alpha    = data->alpha;
+	obj_t*         a        = data->a;
+	obj_t*         b        = data->b;
+	obj_t*         beta     = data->beta;
+	obj_t*         c        = data->c;
+	cntx_t*        cntx     = data->cntx;
+	rntm_t*        rntm     = data->rntm;
+	cntl_t*        cntl     = data->cntl;
+	dim_t          tid      = data->tid;
+	array_t*       array    = data->array;
+	thrcomm_t*     gl_comm  = data->gl_comm;
+	l3tree_t*      tree     = data->tree;
+
+	// Create a thread-local copy of the master thread's rntm_t. This is
+	// necessary since we want each thread to be able to track its own
+	// small block pool_t as it executes down the function stack.
+	rntm_t           rntm_l = *rntm;
+	rntm_t* restrict rntm_p = &rntm_l;
+
+	// Use the thread id to access the appropriate pool_t* within the
+	// array_t, and use it to set the sba_pool field within the rntm_t.
+	// If the pool_t* element within the array_t is NULL, it will first
+	// be allocated/initialized.
+	bli_sba_rntm_set_pool( tid, array, rntm_p );
+
+
+	obj_t      a_t, b_t, c_t;
+	cntl_t*    cntl_use;
+	thrinfo_t* thread;
+
+	// Alias thread-local copies of A, B, and C. These will be the objects
+	// we pass down the algorithmic function stack. Making thread-local
+	// aliases is highly recommended in case a thread needs to change any
+	// of the properties of an object without affecting other threads'
+	// objects.
+	bli_obj_alias_to( a, &a_t );
+	bli_obj_alias_to( b, &b_t );
+	bli_obj_alias_to( c, &c_t );
+
+	if ( tree != NULL )
+	{
+		// Use (or, the first time, build) this thread's cached trees.
+		bli_l3_decor_cache_get_trees( tid, tree, &a_t, &b_t, &c_t, rntm_p,
+		                              &cntl_use, &thread );
+	}
+	else
+	{
+		// Create a default control tree for the operation, if needed.
+		bli_l3_cntl_create_if( family, schema_a, schema_b,
+		                       &a_t, &b_t, &c_t, rntm_p, cntl, &cntl_use );
+
+		// Create the root node of the current thread's thrinfo_t structure.
+		bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+	}
+
+#if 1
+	func
+	(
+	  alpha,
+	  &a_t,
+	  &b_t,
+	  beta,
+	  &c_t,
+	  cntx,
+	  rntm_p,
+	  cntl_use,
+	  thread
+	);
+#else
+	bli_thrinfo_grow_tree
+	(
+	  rntm_p,
+	  cntl_use,
+	  thread
+	);
+#endif
+
+	if ( tree != NULL )
+	{
+		// Release the pack blocks held by the cached control tree.
+		bli_l3_decor_cache_reset_trees( rntm_p, cntl_use, thread );
+
+		#ifdef PRINT_THRINFO
+		data->threads[tid] = thread;
+		#endif
+	}
+	else
+	{
+		// Free the thread's local control tree.
+		bli_l3_cntl_free( rntm_p, cntl_use, thread );
+
+		#ifdef PRINT_THRINFO
+		data->threads[tid] = thread;
+		#else
+		// Free the current thread's thrinfo_t structure.
+		bli_l3_thrinfo_free( rntm_p, thread );
+		#endif
+	}
+
+	return NULL;
+}
+
 void bli_l3_thread_decorator
      (
        l3int_t    func,
@@ -58,6 +189,15 @@ void bli_l3_thread_decorator
        cntl_t*    cntl
      )
 {
+	// Members of an SPMD team each execute their own share of the operation
+	// on the team's communicator instead of spawning threads.
+	if ( bli_rntm_is_spmd( rntm ) )
+	{
+		bli_l3_thread_decorator_spmd( func, family, alpha, a, b, beta, c,
+		                              cntx, rntm, cntl );
+		return;
+	}
+
 	// This is part of a hack to support mixed domain in bli_gemm_front().
 	// Sometimes we need to specify a non-standard schema for A and B, and
 	// we decided to transmit them via the schema field in the obj_t's
@@ -69,20 +209,38 @@ void bli_l3_thread_decorator
 	bli_obj_set_pack_schema( BLIS_NOT_PACKED, a );
 	bli_obj_set_pack_schema( BLIS_NOT_PACKED, b );
 
+	// Acquire a core for each thread from the core budget, if it is enabled.
+	// If fewer cores are granted than requested, the ways of parallelism are
+	// refactored for the granted count in rntm_b.
+	rntm_t      rntm_b;
+	const dim_t n_cores = bli_l3_budget_acquire( family, a, c, rntm, &rntm_b );
+
+	if ( n_cores != 0 ) rntm = &rntm_b;
+
 	// Query the total number of threads from the rntm_t object.
 	const dim_t n_threads = bli_rntm_num_threads( rntm );
 
 	#ifdef PRINT_THRINFO
 	thrinfo_t** threads = bli_malloc_intl( n_threads * sizeof( thrinfo_t* ) );
+	#else
+	thrinfo_t** threads = NULL;
 	#endif
 
+	// Check out a set of control and thrinfo_t trees, built by an earlier
+	// operation of the same shape, from the cache. If it returns NULL, the
+	// trees are built (and freed) below, as usual.
+	l3tree_t* restrict tree = bli_l3_decor_cache_checkout( family, schema_a, schema_b,
+	                                                       a, rntm, cntl );
+
 	// NOTE: The sba was initialized in bli_init().
 
 	// Check out an array_t from the small block allocator. This is done
 	// with an internal lock to ensure only one application thread accesses
 	// the sba at a time. bli_sba_checkout_array() will also automatically
-	// resize the array_t, if necessary.
-	array_t* restrict array = bli_sba_checkout_array( n_threads );
+	// resize the array_t, if necessary. The nodes of cached trees come from
+	// the heap instead, so no array_t is needed when they are reused.
+	array_t* restrict array = ( tree == NULL ? bli_sba_checkout_array( n_threads, rntm )
+	                                         : NULL );
 
 	// Access the pool_t* for thread 0 and embed it into the rntm. We do
 	// this up-front only so that we have the rntm_t.sba_pool field
@@ -94,87 +252,90 @@ void bli_l3_thread_decorator
 	// the rntm below.
 	bli_membrk_rntm_set_membrk( rntm );
 
-	// Allocate a global communicator for the root thrinfo_t structures.
-	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
+	// Allocate a global communicator for the root thrinfo_t structures,
+	// unless the cached trees already have one.
+	thrcomm_t* restrict gl_comm = ( tree == NULL ? bli_thrcomm_create( rntm, n_threads )
+	                                             : tree->gl_comm );
+
+	thread_data_t data;
+
+	data.func     = func;
+	data.family   = family;
+	data.schema_a = schema_a;
+	data.schema_b = schema_b;
+	data.alpha    = alpha;
+	data.a        = a;
+	data.b        = b;
+	data.beta     = beta;
+	data.c        = c;
+	data.cntx     = cntx;
+	data.rntm     = rntm;
+	data.cntl     = cntl;
+	data.tid      = 0;
+	data.gl_comm  = gl_comm;
+	data.array    = array;
+	data.tree     = tree;
+	data.threads  = threads;
+
+	// If the calling thread has opened a thread region, the operation is run
+	// by the region's waiting team rather than by a new parallel region.
+	thrteam_t* restrict team = bli_thread_region_team( n_threads );
+
+	if ( team != NULL )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_l3_thread_decorator().omp: " );
+		#endif
+		thread_data_t* datas = bli_malloc_intl( sizeof( thread_data_t ) * n_threads );
 
+		for ( dim_t tid = 0; tid < n_threads; tid++ )
+		{
+			datas[tid]     = data;
+			datas[tid].tid = tid;
+		}
 
-	_Pragma( "omp parallel num_threads(n_threads)" )
+		// Post the operation to the team. Thread 0 (the calling thread)
+		// executes its part and then waits at a barrier for the rest of
+		// the team.
+		bli_thread_team_run( team, n_threads, &bli_l3_thread_entry, datas, sizeof( thread_data_t ) );
+
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_l3_thread_decorator().omp: " );
+		#endif
+		bli_free_intl( datas );
+	}
+	else
 	{
-		// Create a thread-local copy of the master thread's rntm_t. This is
-		// necessary since we want each thread to be able to track its own
-		// small block pool_t as it executes down the function stack.
-		rntm_t           rntm_l = *rntm;
-		rntm_t* restrict rntm_p = &rntm_l;
-
-		// Query the thread's id from OpenMP.
-		const dim_t tid = omp_get_thread_num();
-
-		// Check for a somewhat obscure OpenMP thread-mistmatch issue.
-		bli_l3_thread_decorator_thread_check( n_threads, tid, gl_comm, rntm_p );
-
-		// Use the thread id to access the appropriate pool_t* within the
-		// array_t, and use it to set the sba_pool field within the rntm_t.
-		// If the pool_t* element within the array_t is NULL, it will first
-		// be allocated/initialized.
-		bli_sba_rntm_set_pool( tid, array, rntm_p );
-
-
-		obj_t      a_t, b_t, c_t;
-		cntl_t*    cntl_use;
-		thrinfo_t* thread;
-
-		// Alias thread-local copies of A, B, and C. These will be the objects
-		// we pass down the algorithmic function stack. Making thread-local
-		// aliases is highly recommended in case a thread needs to change any
-		// of the properties of an object without affecting other threads'
-		// objects.
-		bli_obj_alias_to( a, &a_t );
-		bli_obj_alias_to( b, &b_t );
-		bli_obj_alias_to( c, &c_t );
+		_Pragma( "omp parallel num_threads(n_threads)" )
+		{
+			thread_data_t data_l = data;
 
-		// Create a default control tree for the operation, if needed.
-		bli_l3_cntl_create_if( family, schema_a, schema_b,
-		                       &a_t, &b_t, &c_t, rntm_p, cntl, &cntl_use );
+			// Query the thread's id from OpenMP.
+			data_l.tid = omp_get_thread_num();
 
-		// Create the root node of the current thread's thrinfo_t structure.
-		bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+			// If OpenMP created fewer threads than requested (see below), the
+			// cached trees don't fit, so the lone thread builds its own trees,
+			// with its own global communicator, instead.
+			if ( tree != NULL && omp_get_num_threads() != n_threads )
+			{
+				data_l.tree    = NULL;
+				data_l.gl_comm = bli_thrcomm_create( rntm, n_threads );
+			}
 
-#if 1
-		func
-		(
-		  alpha,
-		  &a_t,
-		  &b_t,
-		  beta,
-		  &c_t,
-		  cntx,
-		  rntm_p,
-		  cntl_use,
-		  thread
-		);
-#else
-		bli_thrinfo_grow_tree
-		(
-		  rntm_p,
-		  cntl_use,
-		  thread
-		);
-#endif
+			// Check for a somewhat obscure OpenMP thread-mistmatch issue. If it
+			// triggers, the lone thread's copy of the rntm_t is updated.
+			rntm_t rntm_l = *rntm;
+			data_l.rntm   = &rntm_l;
 
-		// Free the thread's local control tree.
-		bli_l3_cntl_free( rntm_p, cntl_use, thread );
+			bli_l3_thread_decorator_thread_check( n_threads, data_l.tid, data_l.gl_comm, &rntm_l );
 
-		#ifdef PRINT_THRINFO
-		threads[tid] = thread;
-		#else
-		// Free the current thread's thrinfo_t structure.
-		bli_l3_thrinfo_free( rntm_p, thread );
-		#endif
+			bli_l3_thread_entry( &data_l );
+		}
 	}
 
 	// We shouldn't free the global communicator since it was already freed
 	// by the global communicator's chief thread in bli_l3_thrinfo_free()
-	// (called above).
+	// (called from the thread entry function).
 
 	#ifdef PRINT_THRINFO
 	if ( family != BLIS_TRSM ) bli_l3_thrinfo_print_gemm_paths( threads );
@@ -186,6 +347,12 @@ void bli_l3_thread_decorator
 	// check-out, this is done using a lock embedded within the sba to ensure
 	// mutual exclusion.
 	bli_sba_checkin_array( array );
+
+	// Return the cached trees, if any, so that other operations can use them.
+	bli_l3_decor_cache_checkin( tree );
+
+	// Return the cores to the budget.
+	bli_thread_budget_release( n_cores );
 }
 
 // -----------------------------------------------------------------------------
@@ -55,6 +55,7 @@ typedef struct thread_data
 	dim_t      tid;
 	thrcomm_t* gl_comm;
 	array_t*   array;
+	l3tree_t*  tree;
 } thread_data_t;
 
 // Entry point for additional threads
@@ -77,6 +78,7 @@ void* bli_l3_thread_entry( void* data_void )
 	dim_t          tid      = data->tid;
 	array_t*       array    = data->array;
 	thrcomm_t*     gl_comm  = data->gl_comm;
+	l3tree_t*      tree     = data->tree;
 
 	// Create a thread-local copy of the master thread's rntm_t. This is
 	// necessary since we want each thread to be able to track its own
@@ -103,12 +105,21 @@ void* bli_l3_thread_entry( void* data_void )
 	bli_obj_alias_to( b, &b_t );
 	bli_obj_alias_to( c, &c_t );
 
-	// Create a default control tree for the operation, if needed.
-	bli_l3_cntl_create_if( family, schema_a, schema_b,
-	                       &a_t, &b_t, &c_t, rntm_p, cntl, &cntl_use );
+	if ( tree != NULL )
+	{
+		// Use (or, the first time, build) this thread's cached trees.
+		bli_l3_decor_cache_get_trees( tid, tree, &a_t, &b_t, &c_t, rntm_p,
+		                              &cntl_use, &thread );
+	}
+	else
+	{
+		// Create a default control tree for the operation, if needed.
+		bli_l3_cntl_create_if( family, schema_a, schema_b,
+		                       &a_t, &b_t, &c_t, rntm_p, cntl, &cntl_use );
 
-	// Create the root node of the current thread's thrinfo_t structure.
-	bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+		// Create the root node of the current thread's thrinfo_t structure.
+		bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+	}
 
 	func
 	(
@@ -123,11 +134,19 @@ void* bli_l3_thread_entry( void* data_void )
 	  thread
 	);
 
-	// Free the thread's local control tree.
-	bli_l3_cntl_free( rntm_p, cntl_use, thread );
+	if ( tree != NULL )
+	{
+		// Release the pack blocks held by the cached control tree.
+		bli_l3_decor_cache_reset_trees( rntm_p, cntl_use, thread );
+	}
+	else
+	{
+		// Free the thread's local control tree.
+		bli_l3_cntl_free( rntm_p, cntl_use, thread );
 
-	// Free the current thread's thrinfo_t structure.
-	bli_l3_thrinfo_free( rntm_p, thread );
+		// Free the current thread's thrinfo_t structure.
+		bli_l3_thrinfo_free( rntm_p, thread );
+	}
 
 	return NULL;
 }
@@ -146,6 +165,15 @@ void bli_l3_thread_decorator
        cntl_t*    cntl
      )
 {
+	// Members of an SPMD team each execute their own share of the operation
+	// on the team's communicator instead of spawning threads.
+	if ( bli_rntm_is_spmd( rntm ) )
+	{
+		bli_l3_thread_decorator_spmd( func, family, alpha, a, b, beta, c,
+		                              cntx, rntm, cntl );
+		return;
+	}
+
 	// This is part of a hack to support mixed domain in bli_gemm_front().
 	// Sometimes we need to specify a non-standard schema for A and B, and
 	// we decided to transmit them via the schema field in the obj_t's
@@ -157,16 +185,32 @@ void bli_l3_thread_decorator
 	bli_obj_set_pack_schema( BLIS_NOT_PACKED, a );
 	bli_obj_set_pack_schema( BLIS_NOT_PACKED, b );
 
+	// Acquire a core for each thread from the core budget, if it is enabled.
+	// If fewer cores are granted than requested, the ways of parallelism are
+	// refactored for the granted count in rntm_b.
+	rntm_t      rntm_b;
+	const dim_t n_cores = bli_l3_budget_acquire( family, a, c, rntm, &rntm_b );
+
+	if ( n_cores != 0 ) rntm = &rntm_b;
+
 	// Query the total number of threads from the context.
 	const dim_t n_threads = bli_rntm_num_threads( rntm );
 
+	// Check out a set of control and thrinfo_t trees, built by an earlier
+	// operation of the same shape, from the cache. If it returns NULL, the
+	// trees are built (and freed) below, as usual.
+	l3tree_t* restrict tree = bli_l3_decor_cache_checkout( family, schema_a, schema_b,
+	                                                       a, rntm, cntl );
+
 	// NOTE: The sba was initialized in bli_init().
 
 	// Check out an array_t from the small block allocator. This is done
 	// with an internal lock to ensure only one application thread accesses
 	// the sba at a time. bli_sba_checkout_array() will also automatically
-	// resize the array_t, if necessary.
-	array_t* restrict array = bli_sba_checkout_array( n_threads );
+	// resize the array_t, if necessary. The nodes of cached trees come from
+	// the heap instead, so no array_t is needed when they are reused.
+	array_t* restrict array = ( tree == NULL ? bli_sba_checkout_array( n_threads, rntm )
+	                                         : NULL );
 
 	// Access the pool_t* for thread 0 and embed it into the rntm. We do
 	// this up-front only so that we have the rntm_t.sba_pool field
@@ -178,8 +222,14 @@ void bli_l3_thread_decorator
 	// the rntm below.
 	bli_membrk_rntm_set_membrk( rntm );
 
-	// Allocate a global communicator for the root thrinfo_t structures.
-	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
+	// Allocate a global communicator for the root thrinfo_t structures,
+	// unless the cached trees already have one.
+	thrcomm_t* restrict gl_comm = ( tree == NULL ? bli_thrcomm_create( rntm, n_threads )
+	                                             : tree->gl_comm );
+
+	// If the calling thread has opened a thread region, the operation is run
+	// by the region's waiting team rather than by newly spawned threads.
+	thrteam_t* restrict team = bli_thread_region_team( n_threads );
 
 	// Allocate an array of pthread objects and auxiliary data structs to pass
 	// to the thread entry functions.
@@ -214,6 +264,10 @@ void bli_l3_thread_decorator
 		datas[tid].tid      = tid;
 		datas[tid].gl_comm  = gl_comm;
 		datas[tid].array    = array;
+		datas[tid].tree     = tree;
+
+		// Leave the operation to the team, if there is one.
+		if ( team != NULL ) continue;
 
 		// Spawn additional threads for ids greater than 1.
 		if ( tid != 0 )
@@ -222,14 +276,22 @@ void bli_l3_thread_decorator
 			bli_l3_thread_entry( ( void* )(&datas[0]) );
 	}
 
+	// Post the operation to the team. Thread 0 (the calling thread) executes
+	// its part and then waits at a barrier for the rest of the team.
+	if ( team != NULL )
+		bli_thread_team_run( team, n_threads, &bli_l3_thread_entry, datas, sizeof( thread_data_t ) );
+
 	// We shouldn't free the global communicator since it was already freed
 	// by the global communicator's chief thread in bli_l3_thrinfo_free()
 	// (called from the thread entry function).
 
 	// Thread 0 waits for additional threads to finish.
-	for ( dim_t tid = 1; tid < n_threads; tid++ )
+	if ( team == NULL )
 	{
-		bli_pthread_join( pthreads[tid], NULL );
+		for ( dim_t tid = 1; tid < n_threads; tid++ )
+		{
+			bli_pthread_join( pthreads[tid], NULL );
+		}
 	}
 
 	// Check the array_t back into the small block allocator. Similar to the
@@ -237,6 +299,12 @@ void bli_l3_thread_decorator
 	// mutual exclusion.
 	bli_sba_checkin_array( array );
 
+	// Return the cached trees, if any, so that other operations can use them.
+	bli_l3_decor_cache_checkin( tree );
+
+	// Return the cores to the budget.
+	bli_thread_budget_release( n_cores );
+
 	#ifdef BLIS_ENABLE_MEM_TRACING
 	printf( "bli_l3_thread_decorator().pth: " );
 	#endif
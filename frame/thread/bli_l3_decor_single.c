@@ -65,13 +65,21 @@ void bli_l3_thread_decorator
 	// For sequential execution, we use only one thread.
 	const dim_t n_threads = 1;
 
+	// Check out a set of control and thrinfo_t trees, built by an earlier
+	// operation of the same shape, from the cache. If it returns NULL, the
+	// trees are built (and freed) below, as usual.
+	l3tree_t* restrict tree = bli_l3_decor_cache_checkout( family, schema_a, schema_b,
+	                                                       a, rntm, cntl );
+
 	// NOTE: The sba was initialized in bli_init().
 
 	// Check out an array_t from the small block allocator. This is done
 	// with an internal lock to ensure only one application thread accesses
 	// the sba at a time. bli_sba_checkout_array() will also automatically
-	// resize the array_t, if necessary.
-	array_t* restrict array = bli_sba_checkout_array( n_threads );
+	// resize the array_t, if necessary. The nodes of cached trees come from
+	// the heap instead, so no array_t is needed when they are reused.
+	array_t* restrict array = ( tree == NULL ? bli_sba_checkout_array( n_threads, rntm )
+	                                         : NULL );
 
 	// Access the pool_t* for thread 0 and embed it into the rntm. We do
 	// this up-front only so that we can create the global comm below.
@@ -80,8 +88,10 @@ void bli_l3_thread_decorator
 	// Set the packing block allocator field of the rntm.
 	bli_membrk_rntm_set_membrk( rntm );
 
-	// Allcoate a global communicator for the root thrinfo_t structures.
-	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
+	// Allcoate a global communicator for the root thrinfo_t structures,
+	// unless the cached trees already have one.
+	thrcomm_t* restrict gl_comm = ( tree == NULL ? bli_thrcomm_create( rntm, n_threads )
+	                                             : tree->gl_comm );
 
 
 	{
@@ -109,12 +119,21 @@ void bli_l3_thread_decorator
 		// consistently providing local aliases, we can then eliminate aliasing
 		// elsewhere.
 
-		// Create a default control tree for the operation, if needed.
-		bli_l3_cntl_create_if( family, schema_a, schema_b,
-		                       a, b, c, rntm_p, cntl, &cntl_use );
-
-		// Create the root node of the thread's thrinfo_t structure.
-		bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+		if ( tree != NULL )
+		{
+			// Use (or, the first time, build) the cached trees.
+			bli_l3_decor_cache_get_trees( tid, tree, a, b, c, rntm_p,
+			                              &cntl_use, &thread );
+		}
+		else
+		{
+			// Create a default control tree for the operation, if needed.
+			bli_l3_cntl_create_if( family, schema_a, schema_b,
+			                       a, b, c, rntm_p, cntl, &cntl_use );
+
+			// Create the root node of the thread's thrinfo_t structure.
+			bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
+		}
 
 		func
 		(
@@ -129,11 +148,19 @@ void bli_l3_thread_decorator
 		  thread
 		);
 
-		// Free the thread's local control tree.
-		bli_l3_cntl_free( rntm_p, cntl_use, thread );
-
-		// Free the current thread's thrinfo_t structure.
-		bli_l3_thrinfo_free( rntm_p, thread );
+		if ( tree != NULL )
+		{
+			// Release the pack blocks held by the cached control tree.
+			bli_l3_decor_cache_reset_trees( rntm_p, cntl_use, thread );
+		}
+		else
+		{
+			// Free the thread's local control tree.
+			bli_l3_cntl_free( rntm_p, cntl_use, thread );
+
+			// Free the current thread's thrinfo_t structure.
+			bli_l3_thrinfo_free( rntm_p, thread );
+		}
 	}
 
 	// We shouldn't free the global communicator since it was already freed
@@ -144,6 +171,9 @@ void bli_l3_thread_decorator
 	// check-out, this is done using a lock embedded within the sba to ensure
 	// mutual exclusion.
 	bli_sba_checkin_array( array );
+
+	// Return the cached trees, if any, so that other operations can use them.
+	bli_l3_decor_cache_checkin( tree );
 }
 
 #endif
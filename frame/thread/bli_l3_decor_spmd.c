@@ -0,0 +1,172 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// These functions stand in for the level-3 thread decorators when the
+// caller is a member of an SPMD team (see bli_thread_spmd.h). Each member
+// executes only its own share of the operation, as thread spmd_tid of the
+// team's communicator, and no threads are spawned.
+
+void bli_l3_thread_decorator_spmd
+     (
+       l3int_t    func,
+       opid_t     family,
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       cntl_t*    cntl
+     )
+{
+	// This is part of a hack to support mixed domain in bli_gemm_front().
+	// (See the comment in the conventional decorators.)
+	pack_t schema_a = bli_obj_pack_schema( a );
+	pack_t schema_b = bli_obj_pack_schema( b );
+	bli_obj_set_pack_schema( BLIS_NOT_PACKED, a );
+	bli_obj_set_pack_schema( BLIS_NOT_PACKED, b );
+
+	const dim_t      tid     = bli_rntm_spmd_tid( rntm );
+	thrcomm_t* const gl_comm = bli_rntm_spmd_comm( rntm );
+
+	// Each member of the team checks out its own array_t, with a single
+	// pool_t, from the small block allocator.
+	array_t* restrict array = bli_sba_checkout_array( 1, rntm );
+
+	bli_sba_rntm_set_pool( 0, array, rntm );
+	bli_membrk_rntm_set_membrk( rntm );
+
+	obj_t      a_t, b_t, c_t;
+	cntl_t*    cntl_use;
+	thrinfo_t* thread;
+
+	// Alias thread-local copies of A, B, and C.
+	bli_obj_alias_to( a, &a_t );
+	bli_obj_alias_to( b, &b_t );
+	bli_obj_alias_to( c, &c_t );
+
+	// Create a default control tree for the operation, if needed.
+	bli_l3_cntl_create_if( family, schema_a, schema_b,
+	                       &a_t, &b_t, &c_t, rntm, cntl, &cntl_use );
+
+	// Create the root node of the current thread's thrinfo_t structure. The
+	// global communicator belongs to the team, so it must not be freed along
+	// with the thrinfo_t tree.
+	bli_l3_thrinfo_create_root( tid, gl_comm, rntm, cntl_use, &thread );
+	bli_thrinfo_set_free_comm( FALSE, thread );
+
+	func
+	(
+	  alpha,
+	  &a_t,
+	  &b_t,
+	  beta,
+	  &c_t,
+	  cntx,
+	  rntm,
+	  cntl_use,
+	  thread
+	);
+
+	// Free the thread's local control tree and thrinfo_t structure.
+	bli_l3_cntl_free( rntm, cntl_use, thread );
+	bli_l3_thrinfo_free( rntm, thread );
+
+	// Wait for the rest of the team so that the operation is complete when
+	// each member returns.
+	bli_thrcomm_barrier( tid, gl_comm );
+
+	bli_sba_checkin_array( array );
+}
+
+err_t bli_l3_sup_thread_decorator_spmd
+     (
+       l3supint_t func,
+       opid_t     family,
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm
+     )
+{
+	const dim_t      tid     = bli_rntm_spmd_tid( rntm );
+	thrcomm_t* const gl_comm = bli_rntm_spmd_comm( rntm );
+
+	( void )family;
+
+	// Each member of the team checks out its own array_t, with a single
+	// pool_t, from the small block allocator.
+	array_t* restrict array = bli_sba_checkout_array( 1, rntm );
+
+	bli_sba_rntm_set_pool( 0, array, rntm );
+	bli_membrk_rntm_set_membrk( rntm );
+
+	thrinfo_t* thread = NULL;
+
+	// Create the root node of the thread's thrinfo_t structure, which must
+	// not free the team's communicator.
+	bli_l3_sup_thrinfo_create_root( tid, gl_comm, rntm, &thread );
+	bli_thrinfo_set_free_comm( FALSE, thread );
+
+	func
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	// Free the current thread's thrinfo_t structure.
+	bli_l3_sup_thrinfo_free( rntm, thread );
+
+	// Wait for the rest of the team so that the operation is complete when
+	// each member returns.
+	bli_thrcomm_barrier( tid, gl_comm );
+
+	bli_sba_checkin_array( array );
+
+	return BLIS_SUCCESS;
+}
+
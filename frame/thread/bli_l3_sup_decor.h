@@ -65,6 +65,20 @@ err_t bli_l3_sup_thread_decorator
        rntm_t*    rntm
      );
 
+// Level-3 sup thread decorator for members of an SPMD team.
+err_t bli_l3_sup_thread_decorator_spmd
+     (
+       l3supint_t func,
+       opid_t     family,
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm
+     );
+
 // Include definitions specific to the method of multithreading for the
 // sup code path.
 #include "bli_l3_sup_decor_single.h"
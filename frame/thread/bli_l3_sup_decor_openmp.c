@@ -37,13 +37,80 @@
 
 #ifdef BLIS_ENABLE_OPENMP
 
-// Define a dummy function bli_l3_sup_thread_entry(), which is needed in the
-// pthreads version, so that when building Windows DLLs (with OpenMP enabled
-// or no multithreading) we don't risk having an unresolved symbol.
-void* bli_l3_sup_thread_entry( void* data_void ) { return NULL; }
-
 //#define PRINT_THRINFO
 
+// A data structure to assist in passing operands to each thread.
+typedef struct thread_data
+{
+	l3supint_t func;
+	opid_t     family;
+	obj_t*     alpha;
+	obj_t*     a;
+	obj_t*     b;
+	obj_t*     beta;
+	obj_t*     c;
+	cntx_t*    cntx;
+	rntm_t*    rntm;
+	dim_t      tid;
+	thrcomm_t* gl_comm;
+	array_t*   array;
+} thread_data_t;
+
+// Entry point for each thread, whether it belongs to the OpenMP parallel
+// region opened below or to the team of a thread region. (The function is
+// also needed so that, when building Windows DLLs, we don't risk having an
+// unresolved symbol.)
+void* bli_l3_sup_thread_entry( void* data_void )
+{
+	thread_data_t* data     = data_void;
+
+	l3supint_t     func     = data->func;
+	obj_t*         alpha    = data->alpha;
+	obj_t*         a        = data->a;
+	obj_t*         b        = data->b;
+	obj_t*         beta     = data->beta;
+	obj_t*         c        = data->c;
+	cntx_t*        cntx     = data->cntx;
+	rntm_t*        rntm     = data->rntm;
+	dim_t          tid      = data->tid;
+	array_t*       array    = data->array;
+	thrcomm_t*     gl_comm  = data->gl_comm;
+
+	// Create a thread-local copy of the master thread's rntm_t. This is
+	// necessary since we want each thread to be able to track its own
+	// small block pool_t as it executes down the function stack.
+	rntm_t           rntm_l = *rntm;
+	rntm_t* restrict rntm_p = &rntm_l;
+
+	// Use the thread id to access the appropriate pool_t* within the
+	// array_t, and use it to set the sba_pool field within the rntm_t.
+	// If the pool_t* element within the array_t is NULL, it will first
+	// be allocated/initialized.
+	bli_sba_rntm_set_pool( tid, array, rntm_p );
+
+	thrinfo_t* thread = NULL;
+
+	// Create the root node of the thread's thrinfo_t structure.
+	bli_l3_sup_thrinfo_create_root( tid, gl_comm, rntm_p, &thread );
+
+	func
+	(
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm_p,
+	  thread
+	);
+
+	// Free the current thread's thrinfo_t structure.
+	bli_l3_sup_thrinfo_free( rntm_p, thread );
+
+	return NULL;
+}
+
 err_t bli_l3_sup_thread_decorator
      (
        l3supint_t func,
@@ -57,6 +124,20 @@ err_t bli_l3_sup_thread_decorator
        rntm_t*    rntm
      )
 {
+	// Members of an SPMD team each execute their own share of the operation
+	// on the team's communicator instead of spawning threads.
+	if ( bli_rntm_is_spmd( rntm ) )
+		return bli_l3_sup_thread_decorator_spmd( func, family, alpha, a, b, beta, c,
+		                                         cntx, rntm );
+
+	// Acquire a core for each thread from the core budget, if it is enabled.
+	// If fewer cores are granted than requested, the ways of parallelism are
+	// reduced to fit the granted count in rntm_b.
+	rntm_t      rntm_b;
+	const dim_t n_cores = bli_l3_sup_budget_acquire( rntm, &rntm_b );
+
+	if ( n_cores != 0 ) rntm = &rntm_b;
+
 	// Query the total number of threads from the rntm_t object.
 	const dim_t n_threads = bli_rntm_num_threads( rntm );
 
@@ -66,7 +147,7 @@ err_t bli_l3_sup_thread_decorator
 	// with an internal lock to ensure only one application thread accesses
 	// the sba at a time. bli_sba_checkout_array() will also automatically
 	// resize the array_t, if necessary.
-	array_t* restrict array = bli_sba_checkout_array( n_threads );
+	array_t* restrict array = bli_sba_checkout_array( n_threads, rntm );
 
 	// Access the pool_t* for thread 0 and embed it into the rntm. We do
 	// this up-front only so that we have the rntm_t.sba_pool field
@@ -81,48 +162,68 @@ err_t bli_l3_sup_thread_decorator
 	// Allcoate a global communicator for the root thrinfo_t structures.
 	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
 
-
-	_Pragma( "omp parallel num_threads(n_threads)" )
+	thread_data_t data;
+
+	data.func     = func;
+	data.family   = family;
+	data.alpha    = alpha;
+	data.a        = a;
+	data.b        = b;
+	data.beta     = beta;
+	data.c        = c;
+	data.cntx     = cntx;
+	data.rntm     = rntm;
+	data.tid      = 0;
+	data.gl_comm  = gl_comm;
+	data.array    = array;
+
+	// If the calling thread has opened a thread region, the operation is run
+	// by the region's waiting team rather than by a new parallel region.
+	thrteam_t* restrict team = bli_thread_region_team( n_threads );
+
+	if ( team != NULL )
+	{
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_l3_sup_thread_decorator().omp: " );
+		#endif
+		thread_data_t* datas = bli_malloc_intl( sizeof( thread_data_t ) * n_threads );
+
+		for ( dim_t tid = 0; tid < n_threads; tid++ )
+		{
+			datas[tid]     = data;
+			datas[tid].tid = tid;
+		}
+
+		// Post the operation to the team. Thread 0 (the calling thread)
+		// executes its part and then waits at a barrier for the rest of
+		// the team.
+		bli_thread_team_run( team, n_threads, &bli_l3_sup_thread_entry, datas, sizeof( thread_data_t ) );
+
+		#ifdef BLIS_ENABLE_MEM_TRACING
+		printf( "bli_l3_sup_thread_decorator().omp: " );
+		#endif
+		bli_free_intl( datas );
+	}
+	else
 	{
-		// Create a thread-local copy of the master thread's rntm_t. This is
-		// necessary since we want each thread to be able to track its own
-		// small block pool_t as it executes down the function stack.
-		rntm_t           rntm_l = *rntm;
-		rntm_t* restrict rntm_p = &rntm_l;
-
-		// Query the thread's id from OpenMP.
-		const dim_t tid = omp_get_thread_num();
-
-		// Check for a somewhat obscure OpenMP thread-mistmatch issue.
-		// NOTE: This calls the same function used for the conventional/large
-		// code path.
-		bli_l3_thread_decorator_thread_check( n_threads, tid, gl_comm, rntm_p );
-
-		// Use the thread id to access the appropriate pool_t* within the
-		// array_t, and use it to set the sba_pool field within the rntm_t.
-		// If the pool_t* element within the array_t is NULL, it will first
-		// be allocated/initialized.
-		bli_sba_rntm_set_pool( tid, array, rntm_p );
-
-		thrinfo_t* thread = NULL;
-
-		// Create the root node of the thread's thrinfo_t structure.
-		bli_l3_sup_thrinfo_create_root( tid, gl_comm, rntm_p, &thread );
-
-		func
-		(
-		  alpha,
-		  a,
-		  b,
-		  beta,
-		  c,
-		  cntx,
-		  rntm_p,
-		  thread
-		);
-
-		// Free the current thread's thrinfo_t structure.
-		bli_l3_sup_thrinfo_free( rntm_p, thread );
+		_Pragma( "omp parallel num_threads(n_threads)" )
+		{
+			thread_data_t data_l = data;
+
+			// Query the thread's id from OpenMP.
+			data_l.tid = omp_get_thread_num();
+
+			// Check for a somewhat obscure OpenMP thread-mistmatch issue. If it
+			// triggers, the lone thread's copy of the rntm_t is updated.
+			// NOTE: This calls the same function used for the conventional/large
+			// code path.
+			rntm_t rntm_l = *rntm;
+			data_l.rntm   = &rntm_l;
+
+			bli_l3_thread_decorator_thread_check( n_threads, data_l.tid, gl_comm, &rntm_l );
+
+			bli_l3_sup_thread_entry( &data_l );
+		}
 	}
 
 	// We shouldn't free the global communicator since it was already freed
@@ -134,6 +235,9 @@ err_t bli_l3_sup_thread_decorator
 	// mutual exclusion.
 	bli_sba_checkin_array( array );
 
+	// Return the cores to the budget.
+	bli_thread_budget_release( n_cores );
+
 	return BLIS_SUCCESS;
 }
 
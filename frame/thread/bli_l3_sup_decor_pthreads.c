@@ -122,6 +122,20 @@ err_t bli_l3_sup_thread_decorator
        rntm_t*    rntm
      )
 {
+	// Members of an SPMD team each execute their own share of the operation
+	// on the team's communicator instead of spawning threads.
+	if ( bli_rntm_is_spmd( rntm ) )
+		return bli_l3_sup_thread_decorator_spmd( func, family, alpha, a, b, beta, c,
+		                                         cntx, rntm );
+
+	// Acquire a core for each thread from the core budget, if it is enabled.
+	// If fewer cores are granted than requested, the ways of parallelism are
+	// reduced to fit the granted count in rntm_b.
+	rntm_t      rntm_b;
+	const dim_t n_cores = bli_l3_sup_budget_acquire( rntm, &rntm_b );
+
+	if ( n_cores != 0 ) rntm = &rntm_b;
+
 	// Query the total number of threads from the context.
 	const dim_t n_threads = bli_rntm_num_threads( rntm );
 
@@ -131,7 +145,7 @@ err_t bli_l3_sup_thread_decorator
 	// with an internal lock to ensure only one application thread accesses
 	// the sba at a time. bli_sba_checkout_array() will also automatically
 	// resize the array_t, if necessary.
-	array_t* restrict array = bli_sba_checkout_array( n_threads );
+	array_t* restrict array = bli_sba_checkout_array( n_threads, rntm );
 
 	// Access the pool_t* for thread 0 and embed it into the rntm. We do
 	// this up-front only so that we have the rntm_t.sba_pool field
@@ -146,6 +160,10 @@ err_t bli_l3_sup_thread_decorator
 	// Allocate a global communicator for the root thrinfo_t structures.
 	thrcomm_t* restrict gl_comm = bli_thrcomm_create( rntm, n_threads );
 
+	// If the calling thread has opened a thread region, the operation is run
+	// by the region's waiting team rather than by newly spawned threads.
+	thrteam_t* restrict team = bli_thread_region_team( n_threads );
+
 	// Allocate an array of pthread objects and auxiliary data structs to pass
 	// to the thread entry functions.
 
@@ -177,6 +195,9 @@ err_t bli_l3_sup_thread_decorator
 		datas[tid].gl_comm  = gl_comm;
 		datas[tid].array    = array;
 
+		// Leave the operation to the team, if there is one.
+		if ( team != NULL ) continue;
+
 		// Spawn additional threads for ids greater than 1.
 		if ( tid != 0 )
 			bli_pthread_create( &pthreads[tid], NULL, &bli_l3_sup_thread_entry, &datas[tid] );
@@ -184,14 +205,22 @@ err_t bli_l3_sup_thread_decorator
 			bli_l3_sup_thread_entry( ( void* )(&datas[0]) );
 	}
 
+	// Post the operation to the team. Thread 0 (the calling thread) executes
+	// its part and then waits at a barrier for the rest of the team.
+	if ( team != NULL )
+		bli_thread_team_run( team, n_threads, &bli_l3_sup_thread_entry, datas, sizeof( thread_data_t ) );
+
 	// We shouldn't free the global communicator since it was already freed
 	// by the global communicator's chief thread in bli_l3_thrinfo_free()
 	// (called from the thread entry function).
 
 	// Thread 0 waits for additional threads to finish.
-	for ( dim_t tid = 1; tid < n_threads; tid++ )
+	if ( team == NULL )
 	{
-		bli_pthread_join( pthreads[tid], NULL );
+		for ( dim_t tid = 1; tid < n_threads; tid++ )
+		{
+			bli_pthread_join( pthreads[tid], NULL );
+		}
 	}
 
 	// Check the array_t back into the small block allocator. Similar to the
@@ -199,6 +228,9 @@ err_t bli_l3_sup_thread_decorator
 	// mutual exclusion.
 	bli_sba_checkin_array( array );
 
+	// Return the cores to the budget.
+	bli_thread_budget_release( n_cores );
+
 	#ifdef BLIS_ENABLE_MEM_TRACING
 	printf( "bli_l3_thread_decorator().pth: " );
 	#endif
@@ -81,7 +81,12 @@ void bli_thrcomm_cleanup( thrcomm_t* comm )
 
 void bli_thrcomm_barrier( dim_t t_id, thrcomm_t* comm )
 {
-	return;
+	// BLIS itself never spawns threads in this configuration, but the
+	// members of an SPMD team (see bli_thread_spmd.h) still synchronize via
+	// their shared communicator.
+#ifndef BLIS_TREE_BARRIER
+	bli_thrcomm_barrier_atomic( t_id, comm );
+#endif
 }
 
 #endif
@@ -42,10 +42,6 @@ thrcomm_t BLIS_SINGLE_COMM           = {};
 // The global rntm_t structure. (The definition resides in bli_rntm.c.)
 extern rntm_t global_rntm;
 
-// A mutex to allow synchronous access to global_rntm. (The definition
-// resides in bli_rntm.c.)
-extern bli_pthread_mutex_t global_rntm_mutex;
-
 // -----------------------------------------------------------------------------
 
 void bli_thread_init( void )
@@ -57,10 +53,18 @@ void bli_thread_init( void )
 	// Read the environment variables and use them to initialize the
 	// global runtime object.
 	bli_thread_init_rntm_from_env( &global_rntm );
+
+	// Read the core budget, if any, from the environment.
+	bli_thread_budget_init();
+
+	// Initialize the cache of control and thrinfo_t trees.
+	bli_l3_decor_cache_init();
 }
 
 void bli_thread_finalize( void )
 {
+	// Free any control and thrinfo_t trees that are still cached.
+	bli_l3_decor_cache_finalize();
 }
 
 // -----------------------------------------------------------------------------
@@ -209,6 +213,56 @@ void bli_thread_range_sub
 	}
 }
 
+// Find the first row i of a CSR matrix whose starting offset, weighted as
+// described below for bli_thread_range_nnz(), is at least target.
+static dim_t bli_thread_range_nnz_find
+     (
+       dim_t   m,
+       gint_t* row_ptr,
+       guint_t target
+     )
+{
+	dim_t lo = 0;
+	dim_t hi = m;
+
+	while ( lo < hi )
+	{
+		const dim_t   mid = lo + ( hi - lo ) / 2;
+		const guint_t w   = ( guint_t )( row_ptr[ mid ] - row_ptr[ 0 ] ) + mid;
+
+		if ( w < target ) lo = mid + 1;
+		else              hi = mid;
+	}
+
+	return lo;
+}
+
+void bli_thread_range_nnz
+     (
+       thrinfo_t* thread,
+       dim_t      m,
+       gint_t*    row_ptr,
+       dim_t*     start,
+       dim_t*     end
+     )
+{
+	dim_t      n_way      = bli_thread_n_way( thread );
+
+	if ( n_way == 1 ) { *start = 0; *end = m; return; }
+
+	dim_t      work_id    = bli_thread_work_id( thread );
+
+	// Each row is weighted by its number of nonzeros plus one, to account
+	// for the cost of updating the corresponding row of the output even
+	// when the row is empty. Since the weights of rows 0:i-1 sum to
+	// row_ptr[i] - row_ptr[0] + i, the partition boundaries can be found
+	// with a binary search over the row offsets.
+	guint_t    total      = ( guint_t )( row_ptr[ m ] - row_ptr[ 0 ] ) + m;
+
+	*start = bli_thread_range_nnz_find( m, row_ptr, ( total * ( work_id     ) ) / n_way );
+	*end   = bli_thread_range_nnz_find( m, row_ptr, ( total * ( work_id + 1 ) ) / n_way );
+}
+
 siz_t bli_thread_range_l2r
      (
        thrinfo_t* thr,
@@ -1262,13 +1316,13 @@ void bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir )
 	// We must ensure that global_rntm has been initialized.
 	bli_init_once();
 
-	// Acquire the mutex protecting global_rntm.
-	bli_pthread_mutex_lock( &global_rntm_mutex );
+	// Begin an update of global_rntm.
+	bli_rntm_global_update_begin();
 
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, &global_rntm );
 
-	// Release the mutex protecting global_rntm.
-	bli_pthread_mutex_unlock( &global_rntm_mutex );
+	// Publish the update to global_rntm.
+	bli_rntm_global_update_end();
 }
 
 void bli_thread_set_num_threads( dim_t n_threads )
@@ -1276,13 +1330,13 @@ void bli_thread_set_num_threads( dim_t n_threads )
 	// We must ensure that global_rntm has been initialized.
 	bli_init_once();
 
-	// Acquire the mutex protecting global_rntm.
-	bli_pthread_mutex_lock( &global_rntm_mutex );
+	// Begin an update of global_rntm.
+	bli_rntm_global_update_begin();
 
 	bli_rntm_set_num_threads_only( n_threads, &global_rntm );
 
-	// Release the mutex protecting global_rntm.
-	bli_pthread_mutex_unlock( &global_rntm_mutex );
+	// Publish the update to global_rntm.
+	bli_rntm_global_update_end();
 }
 
 // ----------------------------------------------------------------------------
@@ -1292,7 +1346,7 @@ void bli_thread_init_rntm_from_env
        rntm_t* rntm
      )
 {
-	// NOTE: We don't need to acquire the global_rntm_mutex here because this
+	// NOTE: We don't need to guard the update of global_rntm here because this
 	// function is only called from bli_thread_init(), which is only called
 	// by bli_init_once().
 
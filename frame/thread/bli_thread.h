@@ -40,6 +40,15 @@
 // Include thread communicator (thrcomm_t) object definitions and prototypes.
 #include "bli_thrcomm.h"
 
+// Include thread region (thrteam_t) object definitions and prototypes.
+#include "bli_thread_region.h"
+
+// Include prototypes for calling BLIS from within an existing thread team.
+#include "bli_thread_spmd.h"
+
+// Include prototypes for the process-wide core budget.
+#include "bli_thread_budget.h"
+
 // Include thread info (thrinfo_t) object definitions and prototypes.
 #include "bli_thrinfo.h"
 #include "bli_thrinfo_sup.h"
@@ -78,6 +87,16 @@ void bli_thread_range_sub
        dim_t*     end
      );
 
+BLIS_EXPORT_BLIS
+void bli_thread_range_nnz
+     (
+       thrinfo_t* thread,
+       dim_t      m,
+       gint_t*    row_ptr,
+       dim_t*     start,
+       dim_t*     end
+     );
+
 #undef  GENPROT
 #define GENPROT( opname ) \
 \
@@ -0,0 +1,243 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The total number of cores in the budget (zero if the budget is disabled)
+// and the number of cores currently granted to operations. Both are only
+// modified while holding budget_mutex, on whose condition variable requests
+// wait for a core to be returned.
+static volatile dim_t      budget_total  = 0;
+static dim_t               budget_in_use = 0;
+
+static bli_pthread_mutex_t budget_mutex  = BLIS_PTHREAD_MUTEX_INITIALIZER;
+static bli_pthread_cond_t  budget_cond   = BLIS_PTHREAD_COND_INITIALIZER;
+
+// -----------------------------------------------------------------------------
+
+void bli_thread_budget_init( void )
+{
+	// NOTE: This function is only called from bli_thread_init(), so no
+	// other thread can be using the budget yet.
+	dim_t n_cores = bli_env_get_var( "BLIS_CORE_BUDGET", 0 );
+
+	budget_total = bli_max( n_cores, 0 );
+}
+
+void bli_thread_set_core_budget( dim_t n_cores )
+{
+	// We must ensure that the budget has been read from the environment so
+	// that it does not later overwrite the value set here.
+	bli_init_once();
+
+	bli_pthread_mutex_lock( &budget_mutex );
+
+	// Cores that are already granted remain in use until they are returned,
+	// even if the new budget is smaller. Queued requests re-examine the
+	// budget, since it may have grown (or been disabled).
+	budget_total = bli_max( n_cores, 0 );
+
+	bli_pthread_cond_broadcast( &budget_cond );
+
+	bli_pthread_mutex_unlock( &budget_mutex );
+}
+
+dim_t bli_thread_get_core_budget( void )
+{
+	bli_init_once();
+
+	return budget_total;
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_thread_budget_acquire( dim_t n_threads )
+{
+	// Requests for a single thread, and all requests when the budget is
+	// disabled, are granted without being metered. The return value of zero
+	// indicates that no cores are held.
+	if ( n_threads < 2 || budget_total == 0 ) return 0;
+
+	dim_t n_cores = 0;
+
+	bli_pthread_mutex_lock( &budget_mutex );
+
+	// Queue the request while every core in the budget is in use.
+	while ( 0 < budget_total && budget_total <= budget_in_use )
+		bli_pthread_cond_wait( &budget_cond, &budget_mutex );
+
+	// Grant as many of the requested cores as are free.
+	if ( 0 < budget_total )
+	{
+		n_cores = bli_min( n_threads, budget_total - budget_in_use );
+
+		budget_in_use += n_cores;
+	}
+
+	bli_pthread_mutex_unlock( &budget_mutex );
+
+	return n_cores;
+}
+
+void bli_thread_budget_release( dim_t n_cores )
+{
+	if ( n_cores == 0 ) return;
+
+	bli_pthread_mutex_lock( &budget_mutex );
+
+	budget_in_use -= n_cores;
+
+	// Wake the queued requests so that they can claim the returned cores.
+	bli_pthread_cond_broadcast( &budget_cond );
+
+	bli_pthread_mutex_unlock( &budget_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+static dim_t bli_l3_budget_trim
+     (
+       dim_t   n_cores,
+       rntm_t* rntm
+     )
+{
+	// If the ways of parallelism use fewer threads than the cores granted,
+	// return the surplus cores right away.
+	const dim_t n_threads = bli_rntm_num_threads( rntm );
+
+	if ( n_threads < n_cores )
+	{
+		bli_thread_budget_release( n_cores - n_threads );
+		n_cores = n_threads;
+	}
+
+	return n_cores;
+}
+
+dim_t bli_l3_budget_acquire
+     (
+       opid_t  family,
+       obj_t*  a,
+       obj_t*  c,
+       rntm_t* rntm,
+       rntm_t* rntm_b
+     )
+{
+	const dim_t n_threads = bli_rntm_num_threads( rntm );
+
+	// A thread region's team already occupies its cores.
+	if ( bli_thread_region_team( n_threads ) != NULL ) return 0;
+
+	dim_t n_cores = bli_thread_budget_acquire( n_threads );
+
+	if ( n_cores == 0 ) return 0;
+
+	*rntm_b = *rntm;
+
+	if ( n_cores < n_threads )
+	{
+		// The front-ends of the triangular operations present the triangular
+		// matrix as A when it is on the left.
+		const side_t side = ( bli_obj_is_triangular( a ) ? BLIS_LEFT : BLIS_RIGHT );
+
+		// Factor the granted number of threads into ways of parallelism,
+		// just as the operation's front-end did for the requested number.
+		bli_rntm_set_num_threads( n_cores, rntm_b );
+		bli_rntm_set_ways_for_op
+		(
+		  family,
+		  side,
+		  bli_obj_length( c ),
+		  bli_obj_width( c ),
+		  bli_obj_width( a ),
+		  rntm_b
+		);
+
+		n_cores = bli_l3_budget_trim( n_cores, rntm_b );
+	}
+
+	return n_cores;
+}
+
+dim_t bli_l3_sup_budget_acquire
+     (
+       rntm_t* rntm,
+       rntm_t* rntm_b
+     )
+{
+	const dim_t n_threads = bli_rntm_num_threads( rntm );
+
+	// A thread region's team already occupies its cores.
+	if ( bli_thread_region_team( n_threads ) != NULL ) return 0;
+
+	dim_t n_cores = bli_thread_budget_acquire( n_threads );
+
+	if ( n_cores == 0 ) return 0;
+
+	*rntm_b = *rntm;
+
+	if ( n_cores < n_threads )
+	{
+		// The callers of the sup decorator choose their ways of parallelism
+		// in different ways (e.g. spmm assigns all of them to the jc loop), so
+		// rather than refactoring, we keep the same loops parallelized and
+		// shrink the largest number of ways until the threads fit within the
+		// granted cores. (The sup variants refactor automatically factored
+		// ways again for the shape of the problem.)
+		dim_t ways[ 5 ] = { bli_rntm_jc_ways( rntm_b ), bli_rntm_pc_ways( rntm_b ),
+		                    bli_rntm_ic_ways( rntm_b ), bli_rntm_jr_ways( rntm_b ),
+		                    bli_rntm_ir_ways( rntm_b ) };
+		dim_t n_ways   = ways[0] * ways[1] * ways[2] * ways[3] * ways[4];
+
+		while ( n_cores < n_ways )
+		{
+			dim_t i_max = 0;
+
+			for ( dim_t i = 1; i < 5; ++i )
+				if ( ways[ i_max ] < ways[ i ] ) i_max = i;
+
+			n_ways = ( n_ways / ways[ i_max ] ) * ( ways[ i_max ] - 1 );
+			ways[ i_max ] -= 1;
+		}
+
+		bli_rntm_set_num_threads_only( n_ways, rntm_b );
+		bli_rntm_set_ways_only( ways[0], ways[1], ways[2], ways[3], ways[4], rntm_b );
+
+		n_cores = bli_l3_budget_trim( n_cores, rntm_b );
+	}
+
+	return n_cores;
+}
+
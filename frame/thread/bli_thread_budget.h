@@ -0,0 +1,73 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_THREAD_BUDGET_H
+#define BLIS_THREAD_BUDGET_H
+
+// The core budget limits the number of cores that the level-3 operations of
+// all application threads occupy at once. When it is enabled (via the
+// BLIS_CORE_BUDGET environment variable or bli_thread_set_core_budget()),
+// each multithreaded operation asks the budget for one core per thread on
+// entry to its thread decorator and returns them on exit. A request is
+// granted in full if enough cores are free, shrunk to the free cores if
+// some are, and queued until a core is returned if none are. The ways of
+// parallelism of a shrunken request are refactored for the granted count.
+// Single-threaded operations, operations run by a thread region's team, and
+// members of an SPMD team are not metered.
+
+BLIS_EXPORT_BLIS void  bli_thread_set_core_budget( dim_t n_cores );
+BLIS_EXPORT_BLIS dim_t bli_thread_get_core_budget( void );
+
+void  bli_thread_budget_init( void );
+
+dim_t bli_thread_budget_acquire( dim_t n_threads );
+void  bli_thread_budget_release( dim_t n_cores );
+
+dim_t bli_l3_budget_acquire
+     (
+       opid_t  family,
+       obj_t*  a,
+       obj_t*  c,
+       rntm_t* rntm,
+       rntm_t* rntm_b
+     );
+dim_t bli_l3_sup_budget_acquire
+     (
+       rntm_t* rntm,
+       rntm_t* rntm_b
+     );
+
+#endif
+
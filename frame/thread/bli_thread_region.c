@@ -0,0 +1,310 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "blis.h"
+
+// The number of times an idle worker polls for the next operation before it
+// goes to sleep on the team's condition variable.
+#define BLIS_THREAD_TEAM_SPIN_ITERS 100000
+
+// The team owned by the calling thread, if it has opened a region, and the
+// nesting depth of its bli_thread_region_begin() calls.
+static BLIS_THREAD_LOCAL thrteam_t* region_team  = NULL;
+static BLIS_THREAD_LOCAL dim_t      region_depth = 0;
+
+// -----------------------------------------------------------------------------
+
+static void bli_thread_team_post( thrteam_t* team )
+{
+	// Increment the generation under the mutex so that a worker that is
+	// about to sleep cannot miss the wakeup.
+	bli_pthread_mutex_lock( &team->mutex );
+
+	__sync_add_and_fetch( &team->gen, 1 );
+
+	bli_pthread_cond_broadcast( &team->cond );
+
+	bli_pthread_mutex_unlock( &team->mutex );
+}
+
+static void bli_thread_team_worker( thrteam_t* team, dim_t tid )
+{
+	gint_t gen = 0;
+
+	while ( TRUE )
+	{
+		// Wait for the master to post the next operation, first by polling
+		// and then, if the master is busy elsewhere, by sleeping.
+		for ( dim_t i = 0; team->gen == gen && i < BLIS_THREAD_TEAM_SPIN_ITERS; ++i ) ;
+
+		if ( team->gen == gen )
+		{
+			bli_pthread_mutex_lock( &team->mutex );
+
+			while ( team->gen == gen )
+				bli_pthread_cond_wait( &team->cond, &team->mutex );
+
+			bli_pthread_mutex_unlock( &team->mutex );
+		}
+
+		// Make sure we see the fields that were set before the generation
+		// was incremented.
+		__sync_synchronize();
+
+		gen = team->gen;
+
+		if ( team->stop ) break;
+
+		// Only the first n_active threads take part in the operation; the
+		// others go straight to the barrier.
+		if ( tid < team->n_active )
+			team->entry( ( char* )team->datas + tid * team->data_size );
+
+		bli_thrcomm_barrier( tid, &team->comm );
+	}
+}
+
+#ifdef BLIS_ENABLE_PTHREADS
+
+static void* bli_thread_team_entry( void* team_void )
+{
+	thrteam_t* team = team_void;
+
+	// Claim a thread id. The master is always thread 0.
+	const dim_t tid = __sync_add_and_fetch( &team->n_started, 1 );
+
+	bli_thread_team_worker( team, tid );
+
+	return NULL;
+}
+
+#endif
+
+#ifdef BLIS_ENABLE_OPENMP
+
+static void* bli_thread_team_entry( void* team_void )
+{
+	thrteam_t*  team      = team_void;
+	const dim_t n_workers = team->n_threads - 1;
+
+	// The workers are the threads of an OpenMP parallel region opened by
+	// this helper thread, so that they are subject to the usual OpenMP
+	// settings (e.g. OMP_PROC_BIND and OMP_PLACES).
+	_Pragma( "omp parallel num_threads(n_workers)" )
+	{
+		const dim_t tid = omp_get_thread_num() + 1;
+
+		// OpenMP may give us fewer threads than we asked for, so the size of
+		// the team is only known once we are inside the parallel region.
+		if ( tid == 1 )
+		{
+			team->n_threads = omp_get_num_threads() + 1;
+			bli_thrcomm_init( team->n_threads, &team->comm );
+
+			__sync_synchronize();
+			team->ready = TRUE;
+		}
+
+		_Pragma( "omp barrier" )
+
+		bli_thread_team_worker( team, tid );
+	}
+
+	return NULL;
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+void bli_thread_region_begin( dim_t n_threads )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// Nested regions share the team of the outermost one.
+	if ( region_depth++ > 0 ) return;
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+
+	// A non-positive thread count means "use the global setting".
+	if ( n_threads < 1 ) n_threads = bli_thread_get_num_threads();
+
+	// A team of one would have nothing to do.
+	if ( n_threads < 2 ) return;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_region_begin(): " );
+	#endif
+	thrteam_t* team = bli_malloc_intl( sizeof( thrteam_t ) );
+
+	team->n_threads = n_threads;
+	team->entry     = NULL;
+	team->datas     = NULL;
+	team->data_size = 0;
+	team->n_active  = 0;
+	team->n_started = 0;
+	team->gen       = 0;
+	team->stop      = FALSE;
+	team->ready     = FALSE;
+	team->busy      = FALSE;
+
+	bli_pthread_mutex_init( &team->mutex, NULL );
+	bli_pthread_cond_init( &team->cond, NULL );
+
+	#ifdef BLIS_ENABLE_PTHREADS
+
+	bli_thrcomm_init( n_threads, &team->comm );
+	team->ready = TRUE;
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_region_begin().pth: " );
+	#endif
+	team->pthreads = bli_malloc_intl( sizeof( bli_pthread_t ) * ( n_threads - 1 ) );
+
+	for ( dim_t i = 0; i < n_threads - 1; ++i )
+		bli_pthread_create( &team->pthreads[i], NULL, &bli_thread_team_entry, team );
+
+	#else
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_region_begin().pth: " );
+	#endif
+	team->pthreads = bli_malloc_intl( sizeof( bli_pthread_t ) );
+
+	bli_pthread_create( &team->pthreads[0], NULL, &bli_thread_team_entry, team );
+
+	// Wait for the helper thread to report the actual size of the team.
+	while ( !team->ready ) ;
+	__sync_synchronize();
+
+	#endif
+
+	region_team = team;
+
+#else
+	( void )n_threads;
+#endif
+}
+
+void bli_thread_region_end( void )
+{
+	// Ignore unbalanced calls, and let the outermost region end the team.
+	if ( region_depth == 0 ) return;
+	if ( --region_depth > 0 ) return;
+
+	thrteam_t* team = region_team;
+
+	if ( team == NULL ) return;
+
+	region_team = NULL;
+
+	// Tell the workers to exit and wait for them.
+	team->stop = TRUE;
+	bli_thread_team_post( team );
+
+	#ifdef BLIS_ENABLE_PTHREADS
+	const dim_t n_pthreads = team->n_threads - 1;
+	#else
+	const dim_t n_pthreads = 1;
+	#endif
+
+	for ( dim_t i = 0; i < n_pthreads; ++i )
+		bli_pthread_join( team->pthreads[i], NULL );
+
+	bli_thrcomm_cleanup( &team->comm );
+	bli_pthread_cond_destroy( &team->cond );
+	bli_pthread_mutex_destroy( &team->mutex );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_region_end().pth: " );
+	#endif
+	bli_free_intl( team->pthreads );
+
+	#ifdef BLIS_ENABLE_MEM_TRACING
+	printf( "bli_thread_region_end(): " );
+	#endif
+	bli_free_intl( team );
+}
+
+// -----------------------------------------------------------------------------
+
+thrteam_t* bli_thread_region_team( dim_t n_threads )
+{
+	thrteam_t* team = region_team;
+
+	// The team can run an operation only if the calling thread owns one that
+	// is idle (i.e., this is not a call made from within a running
+	// operation) and that is large enough.
+	if ( team == NULL || team->busy ) return NULL;
+	if ( n_threads < 2 || team->n_threads < n_threads ) return NULL;
+
+	return team;
+}
+
+void bli_thread_region_update_rntm( rntm_t* rntm )
+{
+	thrteam_t* team = region_team;
+
+	// Within a region, operations that are not given a rntm_t use the whole
+	// team rather than the global thread settings.
+	if ( team != NULL )
+		bli_rntm_set_num_threads( team->n_threads, rntm );
+}
+
+void bli_thread_team_run
+     (
+       thrteam_t* team,
+       dim_t      n_threads,
+       void*   (* entry )( void* ),
+       void*      datas,
+       siz_t      data_size
+     )
+{
+	team->entry     = entry;
+	team->datas     = datas;
+	team->data_size = data_size;
+	team->n_active  = n_threads;
+	team->busy      = TRUE;
+
+	bli_thread_team_post( team );
+
+	// The master is thread 0.
+	entry( datas );
+
+	bli_thrcomm_barrier( 0, &team->comm );
+
+	team->busy = FALSE;
+}
+
@@ -0,0 +1,96 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#ifndef BLIS_THREAD_REGION_H
+#define BLIS_THREAD_REGION_H
+
+// A thread region lets an application thread (the master) keep a team of
+// BLIS threads alive across consecutive operations. Between
+// bli_thread_region_begin() and bli_thread_region_end(), the level-3 thread
+// decorators hand each operation issued by the master to the waiting team
+// instead of forking and joining a new set of threads. Workers spin briefly
+// for the next operation and then sleep on a condition variable, so a
+// master that spends a long time outside of BLIS does not burn the team's
+// cores.
+
+typedef struct thrteam_s
+{
+	// The number of threads in the team, including the master.
+	dim_t               n_threads;
+
+	// The operation most recently posted by the master: the entry function,
+	// an array of per-thread arguments (one of data_size bytes for each
+	// participating thread), and the number of participating threads.
+	void*            (* entry )( void* );
+	void*               datas;
+	siz_t               data_size;
+	dim_t               n_active;
+
+	// The generation counter, which the master increments to post an
+	// operation (or to tell the workers to exit, if stop is set), and the
+	// number of workers that have claimed a thread id.
+	volatile gint_t     gen;
+	volatile gint_t     n_started;
+	volatile bool       stop;
+	volatile bool       ready;
+	bool                busy;
+
+	// A barrier across the whole team that ends each operation, and the
+	// mutex and condition variable on which idle workers sleep.
+	thrcomm_t           comm;
+	bli_pthread_mutex_t mutex;
+	bli_pthread_cond_t  cond;
+
+	// The worker threads (pthreads), or the single helper thread whose
+	// OpenMP parallel region supplies the workers (OpenMP).
+	bli_pthread_t*      pthreads;
+
+} thrteam_t;
+
+BLIS_EXPORT_BLIS void bli_thread_region_begin( dim_t n_threads );
+BLIS_EXPORT_BLIS void bli_thread_region_end( void );
+
+thrteam_t* bli_thread_region_team( dim_t n_threads );
+void       bli_thread_region_update_rntm( rntm_t* rntm );
+
+void       bli_thread_team_run
+     (
+       thrteam_t* team,
+       dim_t      n_threads,
+       void*   (* entry )( void* ),
+       void*      datas,
+       siz_t      data_size
+     );
+
+#endif
@@ -0,0 +1,90 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+thrcomm_t* bli_spmd_comm_create( dim_t n_threads )
+{
+	bli_init_once();
+
+	// The communicator outlives any one operation, so it comes from the
+	// heap rather than from the small block allocator.
+	return bli_thrcomm_create( NULL, n_threads );
+}
+
+void bli_spmd_comm_free( thrcomm_t* comm )
+{
+	bli_thrcomm_free( NULL, comm );
+}
+
+void bli_rntm_set_spmd( dim_t tid, thrcomm_t* comm, rntm_t* rntm )
+{
+	// Record the caller's place in the team.
+	bli_rntm_set_spmd_only( tid, comm, rntm );
+
+	// The team's threads are the only threads that take part, so the ways
+	// of parallelism are factored from the size of the team.
+	bli_rntm_set_num_threads( bli_thrcomm_num_threads( comm ), rntm );
+}
+
+// -----------------------------------------------------------------------------
+
+bool bli_rntm_spmd_solo
+     (
+       rntm_t* rntm,
+       rntm_t* rntm_solo
+     )
+{
+	// Some cases (e.g. those that modify an operand before the level-3
+	// algorithm starts) can't be divided among the members of a team. Those
+	// are executed by thread 0 alone, using a copy of the rntm_t with the
+	// SPMD fields cleared. This function returns TRUE for thread 0, which
+	// should execute the operation with rntm_solo, and all members of the
+	// team should then call bli_rntm_spmd_barrier().
+	*rntm_solo = *rntm;
+
+	bli_rntm_clear_spmd( rntm_solo );
+	bli_rntm_set_num_threads( 1, rntm_solo );
+
+	return bli_rntm_spmd_am_chief( rntm );
+}
+
+void bli_rntm_spmd_barrier( rntm_t* rntm )
+{
+	if ( !bli_rntm_is_spmd( rntm ) ) return;
+
+	bli_thrcomm_barrier( bli_rntm_spmd_tid( rntm ), bli_rntm_spmd_comm( rntm ) );
+}
+
@@ -0,0 +1,67 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_THREAD_SPMD_H
+#define BLIS_THREAD_SPMD_H
+
+// SPMD execution lets a team of application threads that already exist
+// (e.g. the threads of an OpenMP parallel region or of a thread pool) call
+// a level-3 operation together. Each thread passes the same operands along
+// with a rntm_t that records its id within the team and a communicator
+// shared by the team (see bli_rntm_set_spmd()). The level-3 thread
+// decorators then run each caller as one of the threads of the usual
+// thrinfo_t-driven algorithm instead of spawning threads, and every caller
+// returns once the whole operation is complete.
+
+BLIS_EXPORT_BLIS thrcomm_t* bli_spmd_comm_create( dim_t n_threads );
+BLIS_EXPORT_BLIS void       bli_spmd_comm_free( thrcomm_t* comm );
+
+BLIS_EXPORT_BLIS void       bli_rntm_set_spmd( dim_t tid, thrcomm_t* comm, rntm_t* rntm );
+
+bool bli_rntm_spmd_solo( rntm_t* rntm, rntm_t* rntm_solo );
+void bli_rntm_spmd_barrier( rntm_t* rntm );
+
+// Without multithreading support, the level-3 algorithms can't be divided
+// among the members of a team, so thread 0 executes each operation alone.
+BLIS_INLINE bool bli_spmd_shares_work( void )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+	return TRUE;
+#else
+	return FALSE;
+#endif
+}
+
+#endif
@@ -0,0 +1,271 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+/*
+   o Vector-length agnostic packm kernels for the (2*VL)x8 (real) and
+     (VL)x8 (complex) gemm micro-kernels in bli_gemm_armsve_int_2vx8.c.
+     Each kernel intrinsically packs micropanels of MR = 2*svcnt[wd]()
+     (real) or svcnt[wd]() (complex) rows, and so must only be registered
+     in the context under a packm kernel id equal to that MR.
+   o Edge cases (cdim < MR) are handled with predicated (zeroing) loads,
+     which also take care of zero-filling the remainder of each column of
+     the micropanel. Columns n through n_max-1 are zero-filled explicitly.
+   o Strided (inca != 1) micropanels are read with gather loads. 32-bit
+     gathers are used for single-precision data, so very large values of
+     inca fall back to scalar code.
+*/
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, svtype, svitype, vsuf, bsuf, isuf, cntv, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t           conja, \
+       pack_t           schema, \
+       dim_t            cdim, \
+       dim_t            n, \
+       dim_t            n_max, \
+       void*   restrict kappa_, \
+       void*   restrict a_, inc_t inca, inc_t lda, \
+       void*   restrict p_,             inc_t ldp, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	ctype* restrict kappa = kappa_; \
+	ctype* restrict a     = a_; \
+	ctype* restrict p     = p_; \
+\
+	const dim_t    vl   = cntv(); \
+	const dim_t    mr   = 2 * vl; \
+	const svbool_t pg   = PASTECH(svptrue_,bsuf)(); \
+	const svbool_t pg0  = PASTECH(svwhilelt_,bsuf)( ( int64_t )0,  ( int64_t )cdim ); \
+	const svbool_t pg1  = PASTECH(svwhilelt_,bsuf)( ( int64_t )vl, ( int64_t )cdim ); \
+	const svtype   zero = PASTECH(svdup_,vsuf)( 0 ); \
+\
+	const bool     kappa_is_one = PASTEMAC(ch,eq1)( *kappa ); \
+\
+	if ( inca == 1 ) \
+	{ \
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			svtype v0 = svld1( pg0, a + k*lda ); \
+			svtype v1 = svld1( pg1, a + k*lda + vl ); \
+\
+			if ( !kappa_is_one ) \
+			{ \
+				v0 = svmul_x( pg, v0, *kappa ); \
+				v1 = svmul_x( pg, v1, *kappa ); \
+			} \
+\
+			svst1( pg, p + k*ldp, v0 ); \
+			svst1_vnum( pg, p + k*ldp, 1, v1 ); \
+		} \
+	} \
+	else if ( inca <= INT32_MAX / mr ) \
+	{ \
+		const svitype idx0 = PASTECH(svindex_,isuf)( 0,       inca ); \
+		const svitype idx1 = PASTECH(svindex_,isuf)( vl*inca, inca ); \
+\
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			svtype v0 = svld1_gather_index( pg0, a + k*lda, idx0 ); \
+			svtype v1 = svld1_gather_index( pg1, a + k*lda, idx1 ); \
+\
+			if ( !kappa_is_one ) \
+			{ \
+				v0 = svmul_x( pg, v0, *kappa ); \
+				v1 = svmul_x( pg, v1, *kappa ); \
+			} \
+\
+			svst1( pg, p + k*ldp, v0 ); \
+			svst1_vnum( pg, p + k*ldp, 1, v1 ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+				PASTEMAC(ch,scal2s)( *kappa, *(a + i*inca + k*lda), \
+				                             *(p + i      + k*ldp) ); \
+			for ( dim_t i = cdim; i < mr; ++i ) \
+				PASTEMAC(ch,set0s)( *(p + i + k*ldp) ); \
+		} \
+	} \
+\
+	for ( dim_t k = n; k < n_max; ++k ) \
+	{ \
+		svst1( pg, p + k*ldp, zero ); \
+		svst1_vnum( pg, p + k*ldp, 1, zero ); \
+	} \
+}
+
+GENTFUNC( float,  s, svfloat32_t, svint32_t, f32, b32, s32, svcntw, packm_armsve_int_2vxk )
+GENTFUNC( double, d, svfloat64_t, svint64_t, f64, b64, s64, svcntd, packm_armsve_int_2vxk )
+
+
+// -----------------------------------------------------------------------------
+
+// Replicate a complex scalar across every (real,imaginary) pair of an SVE
+// register.
+#define bli_cdupq_armsve( x ) \
+	svdupq_n_f32( bli_creal( x ), bli_cimag( x ), bli_creal( x ), bli_cimag( x ) )
+#define bli_zdupq_armsve( x ) \
+	svdupq_n_f64( bli_zreal( x ), bli_zimag( x ) )
+
+// Complex multiplication x*s of interleaved vectors via a pair of fcmla
+// instructions (rotations 0 and 90).
+#define SVE_CMUL( x, s ) \
+	svcmla_x( pg, svcmla_x( pg, zero, x, s, 0 ), x, s, 90 )
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, svtype, svitype, vsuf, bsuf, isuf, cntv, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t           conja, \
+       pack_t           schema, \
+       dim_t            cdim, \
+       dim_t            n, \
+       dim_t            n_max, \
+       void*   restrict kappa_, \
+       void*   restrict a_, inc_t inca, inc_t lda, \
+       void*   restrict p_,             inc_t ldp, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	ctype*   restrict kappa = kappa_; \
+	ctype*   restrict a     = a_; \
+	ctype*   restrict p     = p_; \
+	ctype_r* restrict a_r   = a_; \
+	ctype_r* restrict p_r   = p_; \
+\
+	/* Each vector holds vl real elements, or vl/2 complex elements. The
+	   predicates below are therefore expressed in units of real elements. */ \
+	const dim_t    vl   = cntv(); \
+	const dim_t    mr   = vl; \
+	const svbool_t pg   = PASTECH(svptrue_,bsuf)(); \
+	const svbool_t pg0  = PASTECH(svwhilelt_,bsuf)( ( int64_t )0,  ( int64_t )( 2*cdim ) ); \
+	const svbool_t pg1  = PASTECH(svwhilelt_,bsuf)( ( int64_t )vl, ( int64_t )( 2*cdim ) ); \
+	const svtype   zero = PASTECH(svdup_,vsuf)( 0 ); \
+\
+	/* Active only on the odd (imaginary) lanes. */ \
+	const svbool_t pg_im = PASTECH(svtrn2_,bsuf)( svpfalse(), pg ); \
+\
+	const bool     kappa_is_one = PASTEMAC(ch,eq1)( *kappa ); \
+	const bool     conj_a       = bli_is_conj( conja ); \
+	const svtype   kappav       = PASTEMAC(ch,dupq_armsve)( *kappa ); \
+\
+	if ( inca == 1 || inca <= INT32_MAX / ( 2*mr ) ) \
+	{ \
+		/* Offsets (in real elements) of the real and imaginary parts of
+		   each complex element within a column of A:
+		     2*inca*(e/2) + (e%2)
+		   which reduces to a contiguous load when inca == 1. */ \
+		const svitype iota = PASTECH(svindex_,isuf)( 0, 1 ); \
+		const svitype idx0 = svadd_x( pg, svmul_x( pg, svasr_x( pg, iota, 1 ), 2*inca ), \
+		                                  svand_x( pg, iota, 1 ) ); \
+		const svitype idx1 = svadd_x( pg, idx0, vl*inca ); \
+\
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			ctype_r* restrict ak = a_r + 2*k*lda; \
+			svtype   v0, v1; \
+\
+			if ( inca == 1 ) \
+			{ \
+				v0 = svld1( pg0, ak ); \
+				v1 = svld1_vnum( pg1, ak, 1 ); \
+			} \
+			else \
+			{ \
+				v0 = svld1_gather_index( pg0, ak, idx0 ); \
+				v1 = svld1_gather_index( pg1, ak, idx1 ); \
+			} \
+\
+			if ( conj_a ) \
+			{ \
+				v0 = svneg_m( v0, pg_im, v0 ); \
+				v1 = svneg_m( v1, pg_im, v1 ); \
+			} \
+\
+			if ( !kappa_is_one ) \
+			{ \
+				v0 = SVE_CMUL( v0, kappav ); \
+				v1 = SVE_CMUL( v1, kappav ); \
+			} \
+\
+			svst1( pg, p_r + 2*k*ldp, v0 ); \
+			svst1_vnum( pg, p_r + 2*k*ldp, 1, v1 ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t k = 0; k < n; ++k ) \
+		{ \
+			if ( conj_a ) \
+			{ \
+				for ( dim_t i = 0; i < cdim; ++i ) \
+					PASTEMAC(ch,scal2js)( *kappa, *(a + i*inca + k*lda), \
+					                              *(p + i      + k*ldp) ); \
+			} \
+			else \
+			{ \
+				for ( dim_t i = 0; i < cdim; ++i ) \
+					PASTEMAC(ch,scal2s)( *kappa, *(a + i*inca + k*lda), \
+					                             *(p + i      + k*ldp) ); \
+			} \
+			for ( dim_t i = cdim; i < mr; ++i ) \
+				PASTEMAC(ch,set0s)( *(p + i + k*ldp) ); \
+		} \
+	} \
+\
+	for ( dim_t k = n; k < n_max; ++k ) \
+	{ \
+		svst1( pg, p_r + 2*k*ldp, zero ); \
+		svst1_vnum( pg, p_r + 2*k*ldp, 1, zero ); \
+	} \
+}
+
+GENTFUNCCO( scomplex, float,  c, s, svfloat32_t, svint32_t, f32, b32, s32, svcntw, packm_armsve_int_2vxk )
+GENTFUNCCO( dcomplex, double, z, d, svfloat64_t, svint64_t, f64, b64, s64, svcntd, packm_armsve_int_2vxk )
+
@@ -0,0 +1,295 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#else
+#error "No Arm SVE intrinsics support in compiler"
+#endif // __ARM_FEATURE_SVE
+
+/*
+   o Vector-length agnostic (2*VL)x8 micro-kernels, where VL is the number
+     of elements of the kernel's datatype that fit in one SVE register.
+     The real kernels therefore compute MR = 2*VL rows of C while the
+     complex kernels (which hold VL/2 interleaved complex elements per
+     register) compute MR = VL rows of C.
+   o The register blocksize MR is not known until runtime, so the context
+     initialization function for the armsve configuration queries the
+     vector length (via svcnt[wd]()) and registers MR accordingly. The
+     micro-kernels and the bli_cntx_init_armsve() function must agree on
+     the value of MR.
+   o The accumulators occupy 16 vector registers; the A columns occupy two
+     more and the broadcast elements of B occupy at most eight others.
+   o General stride and row-stored C are handled by writing alpha*A*B to a
+     temporary column-stored microtile and updating C via xpbys_mxn.
+*/
+
+// Accumulate the rank-1 update a(:,0:1) * b(j) into column j of the
+// accumulator microtile.
+#define SVE_RANK1_COL_R( j ) \
+	ab0##j = svmla_x( pg, ab0##j, a0, b[ j ] ); \
+	ab1##j = svmla_x( pg, ab1##j, a1, b[ j ] );
+
+// Update column j of a column-stored C with alpha*ab(:,j) + beta*c(:,j).
+#define SVE_UPDATE_COL_R( j ) \
+{ \
+	ab0##j = svmul_x( pg, ab0##j, *alpha ); \
+	ab1##j = svmul_x( pg, ab1##j, *alpha ); \
+\
+	if ( !beta_is_zero ) \
+	{ \
+		ab0##j = svmla_x( pg, ab0##j, svld1( pg, c + j*cs_c ),         *beta ); \
+		ab1##j = svmla_x( pg, ab1##j, svld1_vnum( pg, c + j*cs_c, 1 ), *beta ); \
+	} \
+\
+	svst1( pg, c + j*cs_c, ab0##j ); \
+	svst1_vnum( pg, c + j*cs_c, 1, ab1##j ); \
+}
+
+// Store alpha*ab(:,j) to column j of the temporary microtile ct.
+#define SVE_STORE_COL_R( j ) \
+	svst1( pg, ct + j*mr, svmul_x( pg, ab0##j, *alpha ) ); \
+	svst1_vnum( pg, ct + j*mr, 1, svmul_x( pg, ab1##j, *alpha ) );
+
+#define SVE_FOR_EACH_COL( op ) \
+	op( 0 ) op( 1 ) op( 2 ) op( 3 ) op( 4 ) op( 5 ) op( 6 ) op( 7 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, svtype, vsuf, bsuf, cntv, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t               k0, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t rs_c0, inc_t cs_c0, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	const dim_t    mr   = 2 * cntv(); \
+	const dim_t    nr   = 8; \
+	const inc_t    rs_c = rs_c0; \
+	const inc_t    cs_c = cs_c0; \
+	const svbool_t pg   = PASTECH(svptrue_,bsuf)(); \
+\
+	svtype ab00 = PASTECH(svdup_,vsuf)( 0 ), ab10 = ab00; \
+	svtype ab01 = ab00, ab11 = ab00; \
+	svtype ab02 = ab00, ab12 = ab00; \
+	svtype ab03 = ab00, ab13 = ab00; \
+	svtype ab04 = ab00, ab14 = ab00; \
+	svtype ab05 = ab00, ab15 = ab00; \
+	svtype ab06 = ab00, ab16 = ab00; \
+	svtype ab07 = ab00, ab17 = ab00; \
+\
+	for ( dim_t l = 0; l < k0; ++l ) \
+	{ \
+		const svtype a0 = svld1( pg, a ); \
+		const svtype a1 = svld1_vnum( pg, a, 1 ); \
+\
+		SVE_FOR_EACH_COL( SVE_RANK1_COL_R ) \
+\
+		a += mr; \
+		b += nr; \
+	} \
+\
+	if ( rs_c == 1 ) \
+	{ \
+		const bool beta_is_zero = PASTEMAC(ch,eq0)( *beta ); \
+\
+		SVE_FOR_EACH_COL( SVE_UPDATE_COL_R ) \
+	} \
+	else \
+	{ \
+		ctype ct[ BLIS_STACK_BUF_MAX_SIZE / sizeof( ctype ) ] \
+		         __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+		SVE_FOR_EACH_COL( SVE_STORE_COL_R ) \
+\
+		PASTEMAC3(ch,ch,ch,xpbys_mxn) \
+		( \
+		  mr, nr, \
+		  ct, 1, mr, \
+		  beta, \
+		  c, rs_c, cs_c \
+		); \
+	} \
+}
+
+GENTFUNC( float,  s, svfloat32_t, f32, b32, svcntw, gemm_armsve_int_2vx8 )
+GENTFUNC( double, d, svfloat64_t, f64, b64, svcntd, gemm_armsve_int_2vx8 )
+
+
+// -----------------------------------------------------------------------------
+
+// Broadcast a single complex element to every (real,imaginary) pair of an
+// SVE register.
+BLIS_INLINE svfloat32_t bli_cbcast_armsve( scomplex* restrict x )
+{
+	uint64_t u;
+
+	memcpy( &u, x, sizeof( uint64_t ) );
+
+	return svreinterpret_f32_u64( svdup_n_u64( u ) );
+}
+
+BLIS_INLINE svfloat64_t bli_zbcast_armsve( dcomplex* restrict x )
+{
+	// A dcomplex occupies exactly one 128-bit quadword.
+	return svld1rq_f64( svptrue_b64(), ( double* )x );
+}
+
+// Complex multiplication x*s of interleaved vectors via a pair of fcmla
+// instructions (rotations 0 and 90).
+#define SVE_CMUL( x, s ) \
+	svcmla_x( pg, svcmla_x( pg, zero, x, s, 0 ), x, s, 90 )
+
+// Complex multiply-accumulate acc += x*s.
+#define SVE_CMLA( acc, x, s ) \
+	acc = svcmla_x( pg, acc, x, s, 0 ); \
+	acc = svcmla_x( pg, acc, x, s, 90 );
+
+#define SVE_RANK1_COL_C( j ) \
+	SVE_CMLA( ab0##j, a0, b##j ) \
+	SVE_CMLA( ab1##j, a1, b##j )
+
+#define SVE_UPDATE_COL_C( j ) \
+{ \
+	ab0##j = SVE_CMUL( ab0##j, alphav ); \
+	ab1##j = SVE_CMUL( ab1##j, alphav ); \
+\
+	if ( !beta_is_zero ) \
+	{ \
+		SVE_CMLA( ab0##j, svld1( pg, c_r + 2*j*cs_c ),         betav ) \
+		SVE_CMLA( ab1##j, svld1_vnum( pg, c_r + 2*j*cs_c, 1 ), betav ) \
+	} \
+\
+	svst1( pg, c_r + 2*j*cs_c, ab0##j ); \
+	svst1_vnum( pg, c_r + 2*j*cs_c, 1, ab1##j ); \
+}
+
+#define SVE_STORE_COL_C( j ) \
+	svst1( pg, ct_r + 2*j*mr, SVE_CMUL( ab0##j, alphav ) ); \
+	svst1_vnum( pg, ct_r + 2*j*mr, 1, SVE_CMUL( ab1##j, alphav ) );
+
+
+#undef  GENTFUNCCO
+#define GENTFUNCCO( ctype, ctype_r, ch, chr, svtype, vsuf, bsuf, cntv, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t               k0, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t rs_c0, inc_t cs_c0, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	const dim_t    mr   = cntv(); \
+	const dim_t    nr   = 8; \
+	const inc_t    rs_c = rs_c0; \
+	const inc_t    cs_c = cs_c0; \
+	const svbool_t pg   = PASTECH(svptrue_,bsuf)(); \
+	const svtype   zero = PASTECH(svdup_,vsuf)( 0 ); \
+\
+	ctype_r* restrict a_r = ( ctype_r* )a; \
+	ctype_r* restrict c_r = ( ctype_r* )c; \
+\
+	svtype ab00 = zero, ab10 = zero; \
+	svtype ab01 = zero, ab11 = zero; \
+	svtype ab02 = zero, ab12 = zero; \
+	svtype ab03 = zero, ab13 = zero; \
+	svtype ab04 = zero, ab14 = zero; \
+	svtype ab05 = zero, ab15 = zero; \
+	svtype ab06 = zero, ab16 = zero; \
+	svtype ab07 = zero, ab17 = zero; \
+\
+	for ( dim_t l = 0; l < k0; ++l ) \
+	{ \
+		const svtype a0 = svld1( pg, a_r ); \
+		const svtype a1 = svld1_vnum( pg, a_r, 1 ); \
+\
+		const svtype b0 = PASTEMAC(ch,bcast_armsve)( b + 0 ); \
+		const svtype b1 = PASTEMAC(ch,bcast_armsve)( b + 1 ); \
+		const svtype b2 = PASTEMAC(ch,bcast_armsve)( b + 2 ); \
+		const svtype b3 = PASTEMAC(ch,bcast_armsve)( b + 3 ); \
+		const svtype b4 = PASTEMAC(ch,bcast_armsve)( b + 4 ); \
+		const svtype b5 = PASTEMAC(ch,bcast_armsve)( b + 5 ); \
+		const svtype b6 = PASTEMAC(ch,bcast_armsve)( b + 6 ); \
+		const svtype b7 = PASTEMAC(ch,bcast_armsve)( b + 7 ); \
+\
+		SVE_FOR_EACH_COL( SVE_RANK1_COL_C ) \
+\
+		a_r += 2*mr; \
+		b   += nr; \
+	} \
+\
+	const svtype alphav = PASTEMAC(ch,bcast_armsve)( alpha ); \
+	const svtype betav  = PASTEMAC(ch,bcast_armsve)( beta ); \
+\
+	if ( rs_c == 1 ) \
+	{ \
+		const bool beta_is_zero = PASTEMAC(ch,eq0)( *beta ); \
+\
+		SVE_FOR_EACH_COL( SVE_UPDATE_COL_C ) \
+	} \
+	else \
+	{ \
+		ctype ct[ BLIS_STACK_BUF_MAX_SIZE / sizeof( ctype ) ] \
+		         __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+		ctype_r* restrict ct_r = ( ctype_r* )ct; \
+\
+		SVE_FOR_EACH_COL( SVE_STORE_COL_C ) \
+\
+		PASTEMAC3(ch,ch,ch,xpbys_mxn) \
+		( \
+		  mr, nr, \
+		  ct, 1, mr, \
+		  beta, \
+		  c, rs_c, cs_c \
+		); \
+	} \
+}
+
+GENTFUNCCO( scomplex, float,  c, s, svfloat32_t, f32, b32, svcntw, gemm_armsve_int_2vx8 )
+GENTFUNCCO( dcomplex, double, z, d, svfloat64_t, f64, b64, svcntd, gemm_armsve_int_2vx8 )
+
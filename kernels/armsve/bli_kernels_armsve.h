@@ -34,4 +34,14 @@
 
 GEMM_UKR_PROT( double,   d, gemm_armsve256_asm_8x8 )
 
+GEMM_UKR_PROT( float,    s, gemm_armsve_int_2vx8 )
+GEMM_UKR_PROT( double,   d, gemm_armsve_int_2vx8 )
+GEMM_UKR_PROT( scomplex, c, gemm_armsve_int_2vx8 )
+GEMM_UKR_PROT( dcomplex, z, gemm_armsve_int_2vx8 )
+
 PACKM_KER_PROT( double,   d, packm_armsve256_asm_8xk )
+
+PACKM_KER_PROT( float,    s, packm_armsve_int_2vxk )
+PACKM_KER_PROT( double,   d, packm_armsve_int_2vxk )
+PACKM_KER_PROT( scomplex, c, packm_armsve_int_2vxk )
+PACKM_KER_PROT( dcomplex, z, packm_armsve_int_2vxk )
@@ -0,0 +1,186 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Half-precision packm kernels for AVX2. bfloat16 values are widened by
+// zero-extending each 16-bit pattern and shifting it into the upper half of
+// a 32-bit lane; float16 values are widened with the F16C vcvtph2ps
+// instruction. See ref_kernels/1m/bli_packm_half_ref.c for the semantics.
+//
+// Column-stored micro-panels (inca == 1) are converted eight rows at a
+// time. Row-stored micro-panels (lda == 1), which arise when packing B from
+// a column-stored matrix, are converted eight columns at a time for eight
+// rows and then transposed in registers, so that both the loads and the
+// stores are contiguous.
+//
+
+BLIS_INLINE __m256 bli_bf16_to_float_8( __m128i h )
+{
+	return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( h ), 16 ) );
+}
+
+BLIS_INLINE __m256 bli_fp16_to_float_8( __m128i h )
+{
+	return _mm256_cvtph_ps( h );
+}
+
+// Transpose the 8x8 single-precision block held in r[0..7].
+BLIS_INLINE void bli_transpose_8x8_ps( __m256 r[ 8 ] )
+{
+	__m256 t0 = _mm256_unpacklo_ps( r[ 0 ], r[ 1 ] );
+	__m256 t1 = _mm256_unpackhi_ps( r[ 0 ], r[ 1 ] );
+	__m256 t2 = _mm256_unpacklo_ps( r[ 2 ], r[ 3 ] );
+	__m256 t3 = _mm256_unpackhi_ps( r[ 2 ], r[ 3 ] );
+	__m256 t4 = _mm256_unpacklo_ps( r[ 4 ], r[ 5 ] );
+	__m256 t5 = _mm256_unpackhi_ps( r[ 4 ], r[ 5 ] );
+	__m256 t6 = _mm256_unpacklo_ps( r[ 6 ], r[ 7 ] );
+	__m256 t7 = _mm256_unpackhi_ps( r[ 6 ], r[ 7 ] );
+
+	__m256 s0 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+	__m256 s1 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+	__m256 s2 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+	__m256 s3 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+	__m256 s4 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+	__m256 s5 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+	__m256 s6 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+	__m256 s7 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+	r[ 0 ] = _mm256_permute2f128_ps( s0, s4, 0x20 );
+	r[ 1 ] = _mm256_permute2f128_ps( s1, s5, 0x20 );
+	r[ 2 ] = _mm256_permute2f128_ps( s2, s6, 0x20 );
+	r[ 3 ] = _mm256_permute2f128_ps( s3, s7, 0x20 );
+	r[ 4 ] = _mm256_permute2f128_ps( s0, s4, 0x31 );
+	r[ 5 ] = _mm256_permute2f128_ps( s1, s5, 0x31 );
+	r[ 6 ] = _mm256_permute2f128_ps( s2, s6, 0x31 );
+	r[ 7 ] = _mm256_permute2f128_ps( s3, s7, 0x31 );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, opname, vcvt, cvt ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       dim_t            cdim, \
+       dim_t            n, \
+       void*   restrict a, inc_t inca, inc_t lda, \
+       float*  restrict p,             inc_t ldp, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	ctype* restrict a_cast = a; \
+\
+	if ( inca == 1 ) \
+	{ \
+		const __m256i lanes = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ); \
+\
+		for ( dim_t l = 0; l < n; ++l ) \
+		{ \
+			ctype* restrict al = a_cast + l*lda; \
+			float* restrict pl = p      + l*ldp; \
+			dim_t           i  = 0; \
+\
+			for ( ; i + 8 <= cdim; i += 8 ) \
+				_mm256_storeu_ps( pl + i, vcvt( _mm_loadu_si128( ( __m128i* )( al + i ) ) ) ); \
+\
+			/* Convert the last rows through a zero-filled buffer, which
+			   also produces the zeros that pad the micro-panel to ldp. */ \
+			for ( ; i < ldp; i += 8 ) \
+			{ \
+				const dim_t n_load  = bli_max( 0, bli_min( 8, cdim - i ) ); \
+				const dim_t n_store = bli_min( 8, ldp - i ); \
+				ctype       ah[ 8 ] = { 0 }; \
+\
+				for ( dim_t q = 0; q < n_load; ++q ) ah[ q ] = al[ i + q ]; \
+\
+				__m256 v = vcvt( _mm_loadu_si128( ( __m128i* )ah ) ); \
+\
+				if ( n_store == 8 ) _mm256_storeu_ps( pl + i, v ); \
+				else _mm256_maskstore_ps( pl + i, \
+				       _mm256_cmpgt_epi32( _mm256_set1_epi32( n_store ), lanes ), v ); \
+			} \
+		} \
+	} \
+	else if ( lda == 1 ) \
+	{ \
+		dim_t i = 0; \
+\
+		for ( ; i + 8 <= cdim; i += 8 ) \
+		{ \
+			ctype* restrict ai = a_cast + i*inca; \
+			dim_t           l  = 0; \
+\
+			for ( ; l + 8 <= n; l += 8 ) \
+			{ \
+				__m256 r[ 8 ]; \
+\
+				for ( dim_t q = 0; q < 8; ++q ) \
+					r[ q ] = vcvt( _mm_loadu_si128( ( __m128i* )( ai + q*inca + l ) ) ); \
+\
+				bli_transpose_8x8_ps( r ); \
+\
+				for ( dim_t q = 0; q < 8; ++q ) \
+					_mm256_storeu_ps( p + i + ( l + q )*ldp, r[ q ] ); \
+			} \
+\
+			for ( ; l < n; ++l ) \
+				for ( dim_t q = 0; q < 8; ++q ) \
+					p[ i + q + l*ldp ] = cvt( ai[ q*inca + l ] ); \
+		} \
+\
+		for ( ; i < cdim; ++i ) \
+			for ( dim_t l = 0; l < n; ++l ) \
+				p[ i + l*ldp ] = cvt( a_cast[ i*inca + l ] ); \
+\
+		if ( cdim < ldp ) \
+			for ( dim_t l = 0; l < n; ++l ) \
+				for ( dim_t i = cdim; i < ldp; ++i ) \
+					p[ i + l*ldp ] = 0.0f; \
+	} \
+	else \
+	{ \
+		for ( dim_t l = 0; l < n; ++l ) \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+				p[ i + l*ldp ] = cvt( a_cast[ i*inca + l*lda ] ); \
+			for ( dim_t i = cdim; i < ldp; ++i ) \
+				p[ i + l*ldp ] = 0.0f; \
+		} \
+	} \
+}
+
+GENTFUNC( bfloat16, packm_bf16_haswell_int, bli_bf16_to_float_8, bli_bf16_to_float )
+GENTFUNC( float16,  packm_fp16_haswell_int, bli_fp16_to_float_8, bli_fp16_to_float )
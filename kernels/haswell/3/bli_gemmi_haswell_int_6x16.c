@@ -0,0 +1,233 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Integer gemm micro-kernels for AVX2. Both kernels compute a 6x16 int32
+// micro-tile, with each row of the micro-tile held in two ymm registers.
+// The micro-panels are packed so that each row of A (column of B) stores
+// one 32-bit group of consecutive k elements (four u8/s8 values or two s16
+// values); see ref_kernels/3/bli_gemmi_ref.c for the exact layout and
+// semantics.
+//
+// For u8s8s32, vpmaddubsw multiplies the unsigned bytes of A by the signed
+// bytes of B and sums adjacent pairs of products into int16 (with
+// saturation), after which vpmaddwd against a vector of ones sums adjacent
+// int16 pairs into int32. For s16s16s32, vpmaddwd is used directly.
+//
+
+#define MR 6
+#define NR 16
+
+BLIS_INLINE __m256i bli_gemmi_haswell_bcast( const void* p )
+{
+	int32_t x;
+
+	memcpy( &x, p, sizeof( int32_t ) );
+
+	return _mm256_set1_epi32( x );
+}
+
+__attribute__((always_inline))
+static inline void bli_gemmi_haswell_int_6x16
+     (
+       const bool           is_u8s8,
+       dim_t                k_iter,
+       int32_t*    restrict alpha,
+       const char* restrict a,
+       const char* restrict b,
+       int32_t*    restrict beta,
+       int32_t*    restrict c, inc_t rs_c, inc_t cs_c,
+       int32_t*    restrict ra,
+       int32_t*    restrict cb
+     )
+{
+	const __m256i ones = _mm256_set1_epi16( 1 );
+	__m256i       ab[ MR ][ 2 ];
+
+	for ( dim_t i = 0; i < MR; ++i )
+	{
+		ab[ i ][ 0 ] = _mm256_setzero_si256();
+		ab[ i ][ 1 ] = _mm256_setzero_si256();
+	}
+
+	for ( dim_t l = 0; l < k_iter; ++l )
+	{
+		const __m256i b0 = _mm256_loadu_si256( ( const __m256i* )( b +  0 ) );
+		const __m256i b1 = _mm256_loadu_si256( ( const __m256i* )( b + 32 ) );
+
+		for ( dim_t i = 0; i < MR; ++i )
+		{
+			const __m256i a0 = bli_gemmi_haswell_bcast( a + i*4 );
+			__m256i       t0, t1;
+
+			if ( is_u8s8 )
+			{
+				t0 = _mm256_madd_epi16( _mm256_maddubs_epi16( a0, b0 ), ones );
+				t1 = _mm256_madd_epi16( _mm256_maddubs_epi16( a0, b1 ), ones );
+			}
+			else
+			{
+				t0 = _mm256_madd_epi16( a0, b0 );
+				t1 = _mm256_madd_epi16( a0, b1 );
+			}
+
+			ab[ i ][ 0 ] = _mm256_add_epi32( ab[ i ][ 0 ], t0 );
+			ab[ i ][ 1 ] = _mm256_add_epi32( ab[ i ][ 1 ], t1 );
+		}
+
+		a += MR * 4;
+		b += NR * 4;
+	}
+
+	// Apply the row and column offsets and scale by alpha.
+	const __m256i cb0 = _mm256_loadu_si256( ( const __m256i* )( cb + 0 ) );
+	const __m256i cb1 = _mm256_loadu_si256( ( const __m256i* )( cb + 8 ) );
+	const __m256i alphav = _mm256_set1_epi32( *alpha );
+	const __m256i betav  = _mm256_set1_epi32( *beta );
+
+	for ( dim_t i = 0; i < MR; ++i )
+	{
+		const __m256i rai = _mm256_set1_epi32( ra[ i ] );
+
+		ab[ i ][ 0 ] = _mm256_add_epi32( ab[ i ][ 0 ], _mm256_add_epi32( rai, cb0 ) );
+		ab[ i ][ 1 ] = _mm256_add_epi32( ab[ i ][ 1 ], _mm256_add_epi32( rai, cb1 ) );
+
+		if ( *alpha != 1 )
+		{
+			ab[ i ][ 0 ] = _mm256_mullo_epi32( ab[ i ][ 0 ], alphav );
+			ab[ i ][ 1 ] = _mm256_mullo_epi32( ab[ i ][ 1 ], alphav );
+		}
+	}
+
+	if ( cs_c == 1 )
+	{
+		// C is row-stored.
+
+		for ( dim_t i = 0; i < MR; ++i )
+		{
+			__m256i* restrict c0 = ( __m256i* )( c + i*rs_c + 0 );
+			__m256i* restrict c1 = ( __m256i* )( c + i*rs_c + 8 );
+
+			if ( *beta != 0 )
+			{
+				__m256i y0 = _mm256_loadu_si256( c0 );
+				__m256i y1 = _mm256_loadu_si256( c1 );
+
+				if ( *beta != 1 )
+				{
+					y0 = _mm256_mullo_epi32( y0, betav );
+					y1 = _mm256_mullo_epi32( y1, betav );
+				}
+
+				ab[ i ][ 0 ] = _mm256_add_epi32( ab[ i ][ 0 ], y0 );
+				ab[ i ][ 1 ] = _mm256_add_epi32( ab[ i ][ 1 ], y1 );
+			}
+
+			_mm256_storeu_si256( c0, ab[ i ][ 0 ] );
+			_mm256_storeu_si256( c1, ab[ i ][ 1 ] );
+		}
+	}
+	else
+	{
+		// C is column-stored or general-stored.
+
+		int32_t ct[ MR * NR ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+		for ( dim_t i = 0; i < MR; ++i )
+		{
+			_mm256_store_si256( ( __m256i* )( ct + i*NR + 0 ), ab[ i ][ 0 ] );
+			_mm256_store_si256( ( __m256i* )( ct + i*NR + 8 ), ab[ i ][ 1 ] );
+		}
+
+		const uint32_t beta_u = ( uint32_t )*beta;
+
+		for ( dim_t j = 0; j < NR; ++j )
+		for ( dim_t i = 0; i < MR; ++i )
+		{
+			int32_t* restrict cij = c + i*rs_c + j*cs_c;
+
+			if ( beta_u == 0 ) *cij = ct[ i*NR + j ];
+			else               *cij = ( int32_t )( beta_u * ( uint32_t )*cij
+			                                       + ( uint32_t )ct[ i*NR + j ] );
+		}
+	}
+}
+
+void bli_gemmi_u8s8s32_haswell_int_6x16
+     (
+       dim_t               k,
+       int32_t*   restrict alpha,
+       uint8_t*   restrict a,
+       int8_t*    restrict b,
+       int32_t*   restrict beta,
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c,
+       int32_t*   restrict ra,
+       int32_t*   restrict cb,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_gemmi_haswell_int_6x16
+	(
+	  TRUE, k / 4,
+	  alpha, ( const char* )a, ( const char* )b, beta,
+	  c, rs_c, cs_c, ra, cb
+	);
+}
+
+void bli_gemmi_s16s16s32_haswell_int_6x16
+     (
+       dim_t               k,
+       int32_t*   restrict alpha,
+       int16_t*   restrict a,
+       int16_t*   restrict b,
+       int32_t*   restrict beta,
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c,
+       int32_t*   restrict ra,
+       int32_t*   restrict cb,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_gemmi_haswell_int_6x16
+	(
+	  FALSE, k / 2,
+	  alpha, ( const char* )a, ( const char* )b, beta,
+	  c, rs_c, cs_c, ra, cb
+	);
+}
+
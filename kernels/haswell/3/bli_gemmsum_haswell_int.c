@@ -0,0 +1,161 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Multi-target gemm micro-kernels for AVX2 that pair with the native
+// haswell gemm micro-kernels (6x16 for float, 6x8 for double). Each row
+// of the MR x NR product A * B is held in two ymm registers and, once the
+// k loop is done, is added to the corresponding row of each of the nterm
+// micro-tiles of C with its own alpha (see ref_kernels/3/bli_gemmsum_ref.c
+// for the exact semantics). Edge cases along n use masked loads and
+// stores; general-stride C is updated from a temporary copy of the
+// product.
+//
+
+BLIS_INLINE __m256i bli_gemmsum_haswell_smask( dim_t n )
+{
+	return _mm256_cmpgt_epi32( _mm256_set1_epi32( n ),
+	                           _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) );
+}
+
+BLIS_INLINE __m256i bli_gemmsum_haswell_dmask( dim_t n )
+{
+	return _mm256_cmpgt_epi64( _mm256_set1_epi64x( n ),
+	                           _mm256_setr_epi64x( 0, 1, 2, 3 ) );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, vec_t, VL, MR, NR, mask, \
+                  setzero, set1, loadu, storeu, mloadu, mstoreu, fmadd ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       dim_t               nterm, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype**    restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	vec_t ab[ MR ][ 2 ]; \
+\
+	for ( dim_t i = 0; i < MR; ++i ) \
+	{ \
+		ab[ i ][ 0 ] = setzero(); \
+		ab[ i ][ 1 ] = setzero(); \
+	} \
+\
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		const vec_t b0 = loadu( b +  0 ); \
+		const vec_t b1 = loadu( b + VL ); \
+\
+		for ( dim_t i = 0; i < MR; ++i ) \
+		{ \
+			const vec_t ai = set1( a[ i ] ); \
+\
+			ab[ i ][ 0 ] = fmadd( ai, b0, ab[ i ][ 0 ] ); \
+			ab[ i ][ 1 ] = fmadd( ai, b1, ab[ i ][ 1 ] ); \
+		} \
+\
+		a += MR; \
+		b += NR; \
+	} \
+\
+	if ( cs_c == 1 ) \
+	{ \
+		/* C is row-stored. */ \
+		const __m256i mask0 = mask( n ); \
+		const __m256i mask1 = mask( n - VL ); \
+\
+		for ( dim_t t = 0; t < nterm; ++t ) \
+		{ \
+			const vec_t alphav = set1( alpha[ t ] ); \
+\
+			for ( dim_t i = 0; i < m; ++i ) \
+			{ \
+				ctype* restrict ci = c[ t ] + i*rs_c; \
+\
+				if ( n == NR ) \
+				{ \
+					storeu( ci +  0, fmadd( alphav, ab[ i ][ 0 ], loadu( ci +  0 ) ) ); \
+					storeu( ci + VL, fmadd( alphav, ab[ i ][ 1 ], loadu( ci + VL ) ) ); \
+				} \
+				else \
+				{ \
+					const vec_t c0 = mloadu( ci +  0, mask0 ); \
+					const vec_t c1 = mloadu( ci + VL, mask1 ); \
+\
+					mstoreu( ci +  0, mask0, fmadd( alphav, ab[ i ][ 0 ], c0 ) ); \
+					mstoreu( ci + VL, mask1, fmadd( alphav, ab[ i ][ 1 ], c1 ) ); \
+				} \
+			} \
+		} \
+	} \
+	else \
+	{ \
+		/* C is column-stored or general-stored. */ \
+		ctype ct[ MR * NR ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+		for ( dim_t i = 0; i < MR; ++i ) \
+		{ \
+			storeu( ct + i*NR +  0, ab[ i ][ 0 ] ); \
+			storeu( ct + i*NR + VL, ab[ i ][ 1 ] ); \
+		} \
+\
+		for ( dim_t t = 0; t < nterm; ++t ) \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,axpys)( alpha[ t ], ct[ i*NR + j ], \
+			                    c[ t ][ i*rs_c + j*cs_c ] ); \
+	} \
+}
+
+GENTFUNC( float,  s, gemmsum_haswell_int_6x16, __m256,  8, 6, 16,
+          bli_gemmsum_haswell_smask,
+          _mm256_setzero_ps, _mm256_set1_ps, _mm256_loadu_ps, _mm256_storeu_ps,
+          _mm256_maskload_ps, _mm256_maskstore_ps, _mm256_fmadd_ps )
+
+GENTFUNC( double, d, gemmsum_haswell_int_6x8,  __m256d, 4, 6,  8,
+          bli_gemmsum_haswell_dmask,
+          _mm256_setzero_pd, _mm256_set1_pd, _mm256_loadu_pd, _mm256_storeu_pd,
+          _mm256_maskload_pd, _mm256_maskstore_pd, _mm256_fmadd_pd )
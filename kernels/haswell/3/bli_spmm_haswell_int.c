@@ -0,0 +1,149 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// spmm micro-kernels for AVX2. Each kernel updates one row of C with the
+// product of one row of a sparse (CSR) matrix A and a micro-panel of B that
+// is two ymm registers (nr = 16 for float, 8 for double) wide; see
+// ref_kernels/3/bli_spmm_ref.c for the exact semantics. Four nonzeros are
+// processed per iteration, each into its own pair of accumulators, so that
+// consecutive fused multiply-adds are independent.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, nr, vtype, vw, vzero, vbcast, vload, vfma, vadd, vmul, vstore ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t               n, \
+       dim_t               nnz, \
+       ctype*     restrict alpha, \
+       gint_t*    restrict col_ind, \
+       ctype*     restrict val, \
+       ctype*     restrict b, inc_t rs_b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	vtype ab00 = vzero(), ab01 = vzero(); \
+	vtype ab10 = vzero(), ab11 = vzero(); \
+	vtype ab20 = vzero(), ab21 = vzero(); \
+	vtype ab30 = vzero(), ab31 = vzero(); \
+\
+	dim_t p = 0; \
+\
+	for ( ; p + 3 < nnz; p += 4 ) \
+	{ \
+		const ctype* restrict b0 = b + col_ind[ p + 0 ] * rs_b; \
+		const ctype* restrict b1 = b + col_ind[ p + 1 ] * rs_b; \
+		const ctype* restrict b2 = b + col_ind[ p + 2 ] * rs_b; \
+		const ctype* restrict b3 = b + col_ind[ p + 3 ] * rs_b; \
+\
+		const vtype v0 = vbcast( val + p + 0 ); \
+		const vtype v1 = vbcast( val + p + 1 ); \
+		const vtype v2 = vbcast( val + p + 2 ); \
+		const vtype v3 = vbcast( val + p + 3 ); \
+\
+		ab00 = vfma( v0, vload( b0      ), ab00 ); \
+		ab01 = vfma( v0, vload( b0 + vw ), ab01 ); \
+		ab10 = vfma( v1, vload( b1      ), ab10 ); \
+		ab11 = vfma( v1, vload( b1 + vw ), ab11 ); \
+		ab20 = vfma( v2, vload( b2      ), ab20 ); \
+		ab21 = vfma( v2, vload( b2 + vw ), ab21 ); \
+		ab30 = vfma( v3, vload( b3      ), ab30 ); \
+		ab31 = vfma( v3, vload( b3 + vw ), ab31 ); \
+	} \
+\
+	for ( ; p < nnz; ++p ) \
+	{ \
+		const ctype* restrict b0 = b + col_ind[ p ] * rs_b; \
+\
+		const vtype v0 = vbcast( val + p ); \
+\
+		ab00 = vfma( v0, vload( b0      ), ab00 ); \
+		ab01 = vfma( v0, vload( b0 + vw ), ab01 ); \
+	} \
+\
+	/* Combine the accumulators and scale the result by alpha. */ \
+	const vtype alphav = vbcast( alpha ); \
+\
+	ab00 = vmul( alphav, vadd( vadd( ab00, ab10 ), vadd( ab20, ab30 ) ) ); \
+	ab01 = vmul( alphav, vadd( vadd( ab01, ab11 ), vadd( ab21, ab31 ) ) ); \
+\
+	/* Output/accumulate the result based on the value of beta. */ \
+	if ( n == nr && cs_c == 1 ) \
+	{ \
+		if ( *beta == 0 ) \
+		{ \
+			vstore( c,      ab00 ); \
+			vstore( c + vw, ab01 ); \
+		} \
+		else \
+		{ \
+			const vtype betav = vbcast( beta ); \
+\
+			vstore( c,      vfma( betav, vload( c      ), ab00 ) ); \
+			vstore( c + vw, vfma( betav, vload( c + vw ), ab01 ) ); \
+		} \
+	} \
+	else \
+	{ \
+		ctype ab[ nr ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+		vstore( ab,      ab00 ); \
+		vstore( ab + vw, ab01 ); \
+\
+		if ( *beta == 0 ) \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+				c[ j*cs_c ] = ab[ j ]; \
+		} \
+		else \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+				c[ j*cs_c ] = *beta * c[ j*cs_c ] + ab[ j ]; \
+		} \
+	} \
+}
+
+GENTFUNC( float,  s, spmm_haswell_int_16, 16, __m256,  8, _mm256_setzero_ps, _mm256_broadcast_ss,
+          _mm256_loadu_ps, _mm256_fmadd_ps, _mm256_add_ps, _mm256_mul_ps, _mm256_storeu_ps )
+GENTFUNC( double, d, spmm_haswell_int_8,   8, __m256d, 4, _mm256_setzero_pd, _mm256_broadcast_sd,
+          _mm256_loadu_pd, _mm256_fmadd_pd, _mm256_add_pd, _mm256_mul_pd, _mm256_storeu_pd )
+
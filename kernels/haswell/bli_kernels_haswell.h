@@ -47,6 +47,18 @@ GEMM_UKR_PROT( double,   d, gemm_haswell_asm_8x6 )
 GEMM_UKR_PROT( scomplex, c, gemm_haswell_asm_8x3 )
 GEMM_UKR_PROT( dcomplex, z, gemm_haswell_asm_4x3 )
 
+// gemmi (intrinsics 6x16)
+GEMMI_UKR_PROT( uint8_t, int8_t,  gemmi_u8s8s32_haswell_int_6x16 )
+GEMMI_UKR_PROT( int16_t, int16_t, gemmi_s16s16s32_haswell_int_6x16 )
+
+// spmm (intrinsics)
+SPMM_UKR_PROT( float,    s, spmm_haswell_int_16 )
+SPMM_UKR_PROT( double,   d, spmm_haswell_int_8 )
+
+// gemmsum (intrinsics)
+GEMMSUM_UKR_PROT( float,    s, gemmsum_haswell_int_6x16 )
+GEMMSUM_UKR_PROT( double,   d, gemmsum_haswell_int_6x8 )
+
 // gemmtrsm_l (asm d6x8)
 GEMMTRSM_UKR_PROT( float,    s, gemmtrsm_l_haswell_asm_6x16 )
 GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_l_haswell_asm_6x8 )
@@ -63,6 +75,13 @@ GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_u_haswell_asm_6x8 )
 //GEMM_UKR_PROT( dcomplex, z, gemm_haswell_asm_4x3 )
 
 
+// -- level-1m -----------------------------------------------------------------
+
+// packm (half-precision, intrinsics)
+PACKM_HALF_KER_PROT( packm_bf16_haswell_int )
+PACKM_HALF_KER_PROT( packm_fp16_haswell_int )
+
+
 // -- level-3 sup --------------------------------------------------------------
 
 // -- double real --
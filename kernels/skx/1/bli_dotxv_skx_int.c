@@ -0,0 +1,308 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_sdotxv_skx_int
+     (
+       conj_t           conjx,
+       conj_t           conjy,
+       dim_t            n,
+       float*  restrict alpha,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       float*  restrict beta,
+       float*  restrict rho,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 16;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float*  restrict y0;
+	float            rho0;
+
+	__m512           rho0v, rho1v, rho2v, rho3v;
+	__m512           x0v, x1v, x2v, x3v;
+	__m512           y0v, y1v, y2v, y3v;
+
+	// If beta is zero, initialize rho to zero instead of scaling
+	// rho by beta (in case rho contains NaN or Inf).
+	if ( PASTEMAC(s,eq0)( *beta ) )
+	{
+		PASTEMAC(s,set0s)( *rho );
+	}
+	else
+	{
+		PASTEMAC(s,scals)( *beta, *rho );
+	}
+
+	// If the vector dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(s,eq0)( *alpha ) ) return;
+
+	// Initialize the local scalar rho0 to zero.
+	PASTEMAC(s,set0s)( rho0 );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads, compute the dot product with scalar code.
+	if ( incx != 1 || incy != 1 )
+	{
+		for ( i = 0; i < n; ++i )
+		{
+			rho0 += (*x) * (*y);
+
+			x += incx;
+			y += incy;
+		}
+
+		// Accumulate the final result into the output variable.
+		PASTEMAC(s,axpys)( *alpha, rho0, *rho );
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Initialize the unrolled iterations' rho vectors to zero.
+	rho0v = _mm512_setzero_ps();
+	rho1v = _mm512_setzero_ps();
+	rho2v = _mm512_setzero_ps();
+	rho3v = _mm512_setzero_ps();
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the x and y input vector elements.
+		x0v = _mm512_loadu_ps( x0 + 0*n_elem_per_reg );
+		y0v = _mm512_loadu_ps( y0 + 0*n_elem_per_reg );
+
+		x1v = _mm512_loadu_ps( x0 + 1*n_elem_per_reg );
+		y1v = _mm512_loadu_ps( y0 + 1*n_elem_per_reg );
+
+		x2v = _mm512_loadu_ps( x0 + 2*n_elem_per_reg );
+		y2v = _mm512_loadu_ps( y0 + 2*n_elem_per_reg );
+
+		x3v = _mm512_loadu_ps( x0 + 3*n_elem_per_reg );
+		y3v = _mm512_loadu_ps( y0 + 3*n_elem_per_reg );
+
+		// Compute the element-wise product of the x and y vectors,
+		// storing in the corresponding rho vectors.
+		rho0v = _mm512_fmadd_ps( x0v, y0v, rho0v );
+		rho1v = _mm512_fmadd_ps( x1v, y1v, rho1v );
+		rho2v = _mm512_fmadd_ps( x2v, y2v, rho2v );
+		rho3v = _mm512_fmadd_ps( x3v, y3v, rho3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Handle the leftover elements one vector at a time, using masked
+	// loads for the final partial vector. Masked-off lanes are loaded as
+	// zero and thus do not contribute to rho.
+	while ( 0 < n_left )
+	{
+		const dim_t n_cur = bli_min( n_left, n_elem_per_reg );
+		const __mmask16 mask = ( __mmask16 )( ( 1ULL << n_cur ) - 1 );
+
+		x0v = _mm512_maskz_loadu_ps( mask, x0 );
+		y0v = _mm512_maskz_loadu_ps( mask, y0 );
+
+		rho0v = _mm512_fmadd_ps( x0v, y0v, rho0v );
+
+		x0 += n_cur;
+		y0 += n_cur;
+
+		n_left -= n_cur;
+	}
+
+	// Accumulate the unrolled rho vectors into a single vector and then
+	// reduce it to a scalar.
+	rho0v = _mm512_add_ps( rho0v, rho1v );
+	rho2v = _mm512_add_ps( rho2v, rho3v );
+	rho0v = _mm512_add_ps( rho0v, rho2v );
+
+	rho0 += _mm512_reduce_add_ps( rho0v );
+
+	// Accumulate the final result into the output variable.
+	PASTEMAC(s,axpys)( *alpha, rho0, *rho );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ddotxv_skx_int
+     (
+       conj_t           conjx,
+       conj_t           conjy,
+       dim_t            n,
+       double* restrict alpha,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       double* restrict beta,
+       double* restrict rho,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double* restrict y0;
+	double           rho0;
+
+	__m512d          rho0v, rho1v, rho2v, rho3v;
+	__m512d          x0v, x1v, x2v, x3v;
+	__m512d          y0v, y1v, y2v, y3v;
+
+	// If beta is zero, initialize rho to zero instead of scaling
+	// rho by beta (in case rho contains NaN or Inf).
+	if ( PASTEMAC(d,eq0)( *beta ) )
+	{
+		PASTEMAC(d,set0s)( *rho );
+	}
+	else
+	{
+		PASTEMAC(d,scals)( *beta, *rho );
+	}
+
+	// If the vector dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(d,eq0)( *alpha ) ) return;
+
+	// Initialize the local scalar rho0 to zero.
+	PASTEMAC(d,set0s)( rho0 );
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads, compute the dot product with scalar code.
+	if ( incx != 1 || incy != 1 )
+	{
+		for ( i = 0; i < n; ++i )
+		{
+			rho0 += (*x) * (*y);
+
+			x += incx;
+			y += incy;
+		}
+
+		// Accumulate the final result into the output variable.
+		PASTEMAC(d,axpys)( *alpha, rho0, *rho );
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+
+	// Initialize the unrolled iterations' rho vectors to zero.
+	rho0v = _mm512_setzero_pd();
+	rho1v = _mm512_setzero_pd();
+	rho2v = _mm512_setzero_pd();
+	rho3v = _mm512_setzero_pd();
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the x and y input vector elements.
+		x0v = _mm512_loadu_pd( x0 + 0*n_elem_per_reg );
+		y0v = _mm512_loadu_pd( y0 + 0*n_elem_per_reg );
+
+		x1v = _mm512_loadu_pd( x0 + 1*n_elem_per_reg );
+		y1v = _mm512_loadu_pd( y0 + 1*n_elem_per_reg );
+
+		x2v = _mm512_loadu_pd( x0 + 2*n_elem_per_reg );
+		y2v = _mm512_loadu_pd( y0 + 2*n_elem_per_reg );
+
+		x3v = _mm512_loadu_pd( x0 + 3*n_elem_per_reg );
+		y3v = _mm512_loadu_pd( y0 + 3*n_elem_per_reg );
+
+		// Compute the element-wise product of the x and y vectors,
+		// storing in the corresponding rho vectors.
+		rho0v = _mm512_fmadd_pd( x0v, y0v, rho0v );
+		rho1v = _mm512_fmadd_pd( x1v, y1v, rho1v );
+		rho2v = _mm512_fmadd_pd( x2v, y2v, rho2v );
+		rho3v = _mm512_fmadd_pd( x3v, y3v, rho3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Handle the leftover elements one vector at a time, using masked
+	// loads for the final partial vector. Masked-off lanes are loaded as
+	// zero and thus do not contribute to rho.
+	while ( 0 < n_left )
+	{
+		const dim_t n_cur = bli_min( n_left, n_elem_per_reg );
+		const __mmask8 mask = ( __mmask8 )( ( 1ULL << n_cur ) - 1 );
+
+		x0v = _mm512_maskz_loadu_pd( mask, x0 );
+		y0v = _mm512_maskz_loadu_pd( mask, y0 );
+
+		rho0v = _mm512_fmadd_pd( x0v, y0v, rho0v );
+
+		x0 += n_cur;
+		y0 += n_cur;
+
+		n_left -= n_cur;
+	}
+
+	// Accumulate the unrolled rho vectors into a single vector and then
+	// reduce it to a scalar.
+	rho0v = _mm512_add_pd( rho0v, rho1v );
+	rho2v = _mm512_add_pd( rho2v, rho3v );
+	rho0v = _mm512_add_pd( rho0v, rho2v );
+
+	rho0 += _mm512_reduce_add_pd( rho0v );
+
+	// Accumulate the final result into the output variable.
+	PASTEMAC(d,axpys)( *alpha, rho0, *rho );
+}
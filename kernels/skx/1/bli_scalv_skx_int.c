@@ -0,0 +1,254 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_sscalv_skx_int
+     (
+       conj_t           conjalpha,
+       dim_t            n,
+       float*  restrict alpha,
+       float*  restrict x, inc_t incx,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 16;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	float*  restrict x0;
+
+	__m512           alphav;
+	__m512           x0v, x1v, x2v, x3v;
+
+	// If the vector dimension is zero, or if alpha is unit, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(s,eq1)( *alpha ) ) return;
+
+	// If alpha is zero, use setv.
+	if ( PASTEMAC(s,eq0)( *alpha ) )
+	{
+		float*       zero = bli_s0;
+		ssetv_ker_ft f    = bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_SETV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  n,
+		  zero,
+		  x, incx,
+		  cntx
+		);
+		return;
+	}
+
+	// If x is not unit-stride, perform the entire operation with scalar
+	// code.
+	if ( incx != 1 )
+	{
+		const float  alpha_c = *alpha;
+
+		for ( i = 0; i < n; ++i )
+		{
+			*x *= alpha_c;
+
+			x += incx;
+		}
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// Initialize local pointers.
+	x0 = x;
+
+	// Broadcast the alpha scalar to all elements of a vector register.
+	alphav = _mm512_set1_ps( *alpha );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm512_loadu_ps( x0 + 0*n_elem_per_reg );
+		x1v = _mm512_loadu_ps( x0 + 1*n_elem_per_reg );
+		x2v = _mm512_loadu_ps( x0 + 2*n_elem_per_reg );
+		x3v = _mm512_loadu_ps( x0 + 3*n_elem_per_reg );
+
+		// perform : x := alpha * x;
+		x0v = _mm512_mul_ps( alphav, x0v );
+		x1v = _mm512_mul_ps( alphav, x1v );
+		x2v = _mm512_mul_ps( alphav, x2v );
+		x3v = _mm512_mul_ps( alphav, x3v );
+
+		// Store the output.
+		_mm512_storeu_ps( x0 + 0*n_elem_per_reg, x0v );
+		_mm512_storeu_ps( x0 + 1*n_elem_per_reg, x1v );
+		_mm512_storeu_ps( x0 + 2*n_elem_per_reg, x2v );
+		_mm512_storeu_ps( x0 + 3*n_elem_per_reg, x3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Handle the leftover elements one vector at a time, using a write
+	// mask for the final partial vector instead of a scalar loop.
+	while ( 0 < n_left )
+	{
+		const dim_t n_cur = bli_min( n_left, n_elem_per_reg );
+		const __mmask16 mask = ( __mmask16 )( ( 1ULL << n_cur ) - 1 );
+
+		x0v = _mm512_maskz_loadu_ps( mask, x0 );
+		x0v = _mm512_mul_ps( alphav, x0v );
+		_mm512_mask_storeu_ps( x0, mask, x0v );
+
+		x0 += n_cur;
+
+		n_left -= n_cur;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_dscalv_skx_int
+     (
+       conj_t           conjalpha,
+       dim_t            n,
+       double* restrict alpha,
+       double* restrict x, inc_t incx,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	double* restrict x0;
+
+	__m512d          alphav;
+	__m512d          x0v, x1v, x2v, x3v;
+
+	// If the vector dimension is zero, or if alpha is unit, return early.
+	if ( bli_zero_dim1( n ) || PASTEMAC(d,eq1)( *alpha ) ) return;
+
+	// If alpha is zero, use setv.
+	if ( PASTEMAC(d,eq0)( *alpha ) )
+	{
+		double*       zero = bli_d0;
+		dsetv_ker_ft f    = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_SETV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  n,
+		  zero,
+		  x, incx,
+		  cntx
+		);
+		return;
+	}
+
+	// If x is not unit-stride, perform the entire operation with scalar
+	// code.
+	if ( incx != 1 )
+	{
+		const double alpha_c = *alpha;
+
+		for ( i = 0; i < n; ++i )
+		{
+			*x *= alpha_c;
+
+			x += incx;
+		}
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// Initialize local pointers.
+	x0 = x;
+
+	// Broadcast the alpha scalar to all elements of a vector register.
+	alphav = _mm512_set1_pd( *alpha );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm512_loadu_pd( x0 + 0*n_elem_per_reg );
+		x1v = _mm512_loadu_pd( x0 + 1*n_elem_per_reg );
+		x2v = _mm512_loadu_pd( x0 + 2*n_elem_per_reg );
+		x3v = _mm512_loadu_pd( x0 + 3*n_elem_per_reg );
+
+		// perform : x := alpha * x;
+		x0v = _mm512_mul_pd( alphav, x0v );
+		x1v = _mm512_mul_pd( alphav, x1v );
+		x2v = _mm512_mul_pd( alphav, x2v );
+		x3v = _mm512_mul_pd( alphav, x3v );
+
+		// Store the output.
+		_mm512_storeu_pd( x0 + 0*n_elem_per_reg, x0v );
+		_mm512_storeu_pd( x0 + 1*n_elem_per_reg, x1v );
+		_mm512_storeu_pd( x0 + 2*n_elem_per_reg, x2v );
+		_mm512_storeu_pd( x0 + 3*n_elem_per_reg, x3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Handle the leftover elements one vector at a time, using a write
+	// mask for the final partial vector instead of a scalar loop.
+	while ( 0 < n_left )
+	{
+		const dim_t n_cur = bli_min( n_left, n_elem_per_reg );
+		const __mmask8 mask = ( __mmask8 )( ( 1ULL << n_cur ) - 1 );
+
+		x0v = _mm512_maskz_loadu_pd( mask, x0 );
+		x0v = _mm512_mul_pd( alphav, x0v );
+		_mm512_mask_storeu_pd( x0, mask, x0v );
+
+		x0 += n_cur;
+
+		n_left -= n_cur;
+	}
+}
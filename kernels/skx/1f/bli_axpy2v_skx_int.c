@@ -0,0 +1,296 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_saxpy2v_skx_int
+     (
+       conj_t           conjx,
+       conj_t           conjy,
+       dim_t            n,
+       float*  restrict alphax,
+       float*  restrict alphay,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       float*  restrict z, inc_t incz,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 16;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	float*  restrict x0;
+	float*  restrict y0;
+	float*  restrict z0;
+
+	__m512           alphaxv, alphayv;
+	__m512           x0v, x1v, x2v, x3v;
+	__m512           y0v, y1v, y2v, y3v;
+	__m512           z0v, z1v, z2v, z3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, perform the entire operation with scalar code.
+	if ( incx != 1 || incy != 1 || incz != 1 )
+	{
+		const float  alphax_c = *alphax;
+		const float  alphay_c = *alphay;
+
+		for ( i = 0; i < n; ++i )
+		{
+			*z += alphax_c * (*x) + alphay_c * (*y);
+
+			x += incx;
+			y += incy;
+			z += incz;
+		}
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+	z0 = z;
+
+	// Broadcast the alpha scalars to all elements of vector registers.
+	alphaxv = _mm512_set1_ps( *alphax );
+	alphayv = _mm512_set1_ps( *alphay );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm512_loadu_ps( x0 + 0*n_elem_per_reg );
+		x1v = _mm512_loadu_ps( x0 + 1*n_elem_per_reg );
+		x2v = _mm512_loadu_ps( x0 + 2*n_elem_per_reg );
+		x3v = _mm512_loadu_ps( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm512_loadu_ps( y0 + 0*n_elem_per_reg );
+		y1v = _mm512_loadu_ps( y0 + 1*n_elem_per_reg );
+		y2v = _mm512_loadu_ps( y0 + 2*n_elem_per_reg );
+		y3v = _mm512_loadu_ps( y0 + 3*n_elem_per_reg );
+
+		z0v = _mm512_loadu_ps( z0 + 0*n_elem_per_reg );
+		z1v = _mm512_loadu_ps( z0 + 1*n_elem_per_reg );
+		z2v = _mm512_loadu_ps( z0 + 2*n_elem_per_reg );
+		z3v = _mm512_loadu_ps( z0 + 3*n_elem_per_reg );
+
+		// perform : z += alphax * x + alphay * y;
+		z0v = _mm512_fmadd_ps( x0v, alphaxv, z0v );
+		z1v = _mm512_fmadd_ps( x1v, alphaxv, z1v );
+		z2v = _mm512_fmadd_ps( x2v, alphaxv, z2v );
+		z3v = _mm512_fmadd_ps( x3v, alphaxv, z3v );
+
+		z0v = _mm512_fmadd_ps( y0v, alphayv, z0v );
+		z1v = _mm512_fmadd_ps( y1v, alphayv, z1v );
+		z2v = _mm512_fmadd_ps( y2v, alphayv, z2v );
+		z3v = _mm512_fmadd_ps( y3v, alphayv, z3v );
+
+		// Store the output.
+		_mm512_storeu_ps( z0 + 0*n_elem_per_reg, z0v );
+		_mm512_storeu_ps( z0 + 1*n_elem_per_reg, z1v );
+		_mm512_storeu_ps( z0 + 2*n_elem_per_reg, z2v );
+		_mm512_storeu_ps( z0 + 3*n_elem_per_reg, z3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+		z0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Handle the leftover elements one vector at a time, using a write
+	// mask for the final partial vector instead of a scalar loop.
+	while ( 0 < n_left )
+	{
+		const dim_t n_cur = bli_min( n_left, n_elem_per_reg );
+		const __mmask16 mask = ( __mmask16 )( ( 1ULL << n_cur ) - 1 );
+
+		x0v = _mm512_maskz_loadu_ps( mask, x0 );
+		y0v = _mm512_maskz_loadu_ps( mask, y0 );
+		z0v = _mm512_maskz_loadu_ps( mask, z0 );
+
+		z0v = _mm512_fmadd_ps( x0v, alphaxv, z0v );
+		z0v = _mm512_fmadd_ps( y0v, alphayv, z0v );
+
+		_mm512_mask_storeu_ps( z0, mask, z0v );
+
+		x0 += n_cur;
+		y0 += n_cur;
+		z0 += n_cur;
+
+		n_left -= n_cur;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_daxpy2v_skx_int
+     (
+       conj_t           conjx,
+       conj_t           conjy,
+       dim_t            n,
+       double* restrict alphax,
+       double* restrict alphay,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       double* restrict z, inc_t incz,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 4;
+
+	dim_t            i;
+	dim_t            n_viter;
+	dim_t            n_left;
+
+	double* restrict x0;
+	double* restrict y0;
+	double* restrict z0;
+
+	__m512d          alphaxv, alphayv;
+	__m512d          x0v, x1v, x2v, x3v;
+	__m512d          y0v, y1v, y2v, y3v;
+	__m512d          z0v, z1v, z2v, z3v;
+
+	// If the vector dimension is zero, return early.
+	if ( bli_zero_dim1( n ) ) return;
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, perform the entire operation with scalar code.
+	if ( incx != 1 || incy != 1 || incz != 1 )
+	{
+		const double alphax_c = *alphax;
+		const double alphay_c = *alphay;
+
+		for ( i = 0; i < n; ++i )
+		{
+			*z += alphax_c * (*x) + alphay_c * (*y);
+
+			x += incx;
+			y += incy;
+			z += incz;
+		}
+		return;
+	}
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	n_viter = ( n ) / ( n_elem_per_reg * n_iter_unroll );
+	n_left  = ( n ) % ( n_elem_per_reg * n_iter_unroll );
+
+	// Initialize local pointers.
+	x0 = x;
+	y0 = y;
+	z0 = z;
+
+	// Broadcast the alpha scalars to all elements of vector registers.
+	alphaxv = _mm512_set1_pd( *alphax );
+	alphayv = _mm512_set1_pd( *alphay );
+
+	for ( i = 0; i < n_viter; ++i )
+	{
+		// Load the input values.
+		x0v = _mm512_loadu_pd( x0 + 0*n_elem_per_reg );
+		x1v = _mm512_loadu_pd( x0 + 1*n_elem_per_reg );
+		x2v = _mm512_loadu_pd( x0 + 2*n_elem_per_reg );
+		x3v = _mm512_loadu_pd( x0 + 3*n_elem_per_reg );
+
+		y0v = _mm512_loadu_pd( y0 + 0*n_elem_per_reg );
+		y1v = _mm512_loadu_pd( y0 + 1*n_elem_per_reg );
+		y2v = _mm512_loadu_pd( y0 + 2*n_elem_per_reg );
+		y3v = _mm512_loadu_pd( y0 + 3*n_elem_per_reg );
+
+		z0v = _mm512_loadu_pd( z0 + 0*n_elem_per_reg );
+		z1v = _mm512_loadu_pd( z0 + 1*n_elem_per_reg );
+		z2v = _mm512_loadu_pd( z0 + 2*n_elem_per_reg );
+		z3v = _mm512_loadu_pd( z0 + 3*n_elem_per_reg );
+
+		// perform : z += alphax * x + alphay * y;
+		z0v = _mm512_fmadd_pd( x0v, alphaxv, z0v );
+		z1v = _mm512_fmadd_pd( x1v, alphaxv, z1v );
+		z2v = _mm512_fmadd_pd( x2v, alphaxv, z2v );
+		z3v = _mm512_fmadd_pd( x3v, alphaxv, z3v );
+
+		z0v = _mm512_fmadd_pd( y0v, alphayv, z0v );
+		z1v = _mm512_fmadd_pd( y1v, alphayv, z1v );
+		z2v = _mm512_fmadd_pd( y2v, alphayv, z2v );
+		z3v = _mm512_fmadd_pd( y3v, alphayv, z3v );
+
+		// Store the output.
+		_mm512_storeu_pd( z0 + 0*n_elem_per_reg, z0v );
+		_mm512_storeu_pd( z0 + 1*n_elem_per_reg, z1v );
+		_mm512_storeu_pd( z0 + 2*n_elem_per_reg, z2v );
+		_mm512_storeu_pd( z0 + 3*n_elem_per_reg, z3v );
+
+		x0 += n_elem_per_reg * n_iter_unroll;
+		y0 += n_elem_per_reg * n_iter_unroll;
+		z0 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	// Handle the leftover elements one vector at a time, using a write
+	// mask for the final partial vector instead of a scalar loop.
+	while ( 0 < n_left )
+	{
+		const dim_t n_cur = bli_min( n_left, n_elem_per_reg );
+		const __mmask8 mask = ( __mmask8 )( ( 1ULL << n_cur ) - 1 );
+
+		x0v = _mm512_maskz_loadu_pd( mask, x0 );
+		y0v = _mm512_maskz_loadu_pd( mask, y0 );
+		z0v = _mm512_maskz_loadu_pd( mask, z0 );
+
+		z0v = _mm512_fmadd_pd( x0v, alphaxv, z0v );
+		z0v = _mm512_fmadd_pd( y0v, alphayv, z0v );
+
+		_mm512_mask_storeu_pd( z0, mask, z0v );
+
+		x0 += n_cur;
+		y0 += n_cur;
+		z0 += n_cur;
+
+		n_left -= n_cur;
+	}
+}
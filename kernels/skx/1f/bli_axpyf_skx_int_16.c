@@ -0,0 +1,290 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_saxpyf_skx_int_16
+     (
+       conj_t           conja,
+       conj_t           conjx,
+       dim_t            m,
+       dim_t            b_n,
+       float*  restrict alpha,
+       float*  restrict a, inc_t inca, inc_t lda,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      fuse_fac       = 16;
+
+	const dim_t      n_elem_per_reg = 16;
+
+	dim_t            i;
+	dim_t            m_viter;
+	dim_t            m_left;
+
+	float            chi[ 16 ];
+
+	__m512           chiv[ 16 ];
+	__m512           y0v;
+
+	// If either dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim2( m, b_n ) || PASTEMAC(s,eq0)( *alpha ) ) return;
+
+	// If b_n is not equal to the fusing factor, then perform the entire
+	// operation as a loop over axpyv.
+	if ( b_n != fuse_fac )
+	{
+		saxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_AXPYV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			float*  a1   = a + (0  )*inca + (i  )*lda;
+			float*  chi1 = x + (i  )*incx;
+			float*  y1   = y + (0  )*incy;
+			float   alpha_chi1;
+
+			PASTEMAC(s,copycjs)( conjx, *chi1, alpha_chi1 );
+			PASTEMAC(s,scals)( *alpha, alpha_chi1 );
+
+			f
+			(
+			  conja,
+			  m,
+			  &alpha_chi1,
+			  a1, inca,
+			  y1, incy,
+			  cntx
+			);
+		}
+
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor.
+
+	// Scale each chi scalar by alpha.
+	for ( dim_t j = 0; j < 16; ++j )
+	{
+		chi[ j ] = *( x + j*incx );
+		PASTEMAC(s,scals)( *alpha, chi[ j ] );
+	}
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, perform the entire operation with scalar code.
+	if ( inca != 1 || incy != 1 )
+	{
+		for ( i = 0; i < m; ++i )
+		{
+			float  y0c = *y;
+
+			for ( dim_t j = 0; j < 16; ++j )
+				y0c += chi[ j ] * *( a + j*lda );
+
+			*y = y0c;
+
+			a += inca;
+			y += incy;
+		}
+		return;
+	}
+
+	m_viter = ( m ) / ( n_elem_per_reg );
+	m_left  = ( m ) % ( n_elem_per_reg );
+
+	// Broadcast the (alpha*chi?) scalars to all elements of vector registers.
+	// Together with y and one column of A, these occupy 18 of the 32 zmm
+	// registers.
+	for ( dim_t j = 0; j < 16; ++j )
+		chiv[ j ] = _mm512_set1_ps( chi[ j ] );
+
+	for ( i = 0; i < m_viter; ++i )
+	{
+		y0v = _mm512_loadu_ps( y );
+
+		// perform : y += alpha * A * x;
+		for ( dim_t j = 0; j < 16; ++j )
+			y0v = _mm512_fmadd_ps( _mm512_loadu_ps( a + j*lda ), chiv[ j ], y0v );
+
+		_mm512_storeu_ps( y, y0v );
+
+		a += n_elem_per_reg;
+		y += n_elem_per_reg;
+	}
+
+	// Handle the leftover rows with a single masked iteration instead of
+	// scalar code.
+	if ( 0 < m_left )
+	{
+		const __mmask16 mask = ( __mmask16 )( ( 1ULL << m_left ) - 1 );
+
+		y0v = _mm512_maskz_loadu_ps( mask, y );
+
+		for ( dim_t j = 0; j < 16; ++j )
+			y0v = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( mask, a + j*lda ), chiv[ j ], y0v );
+
+		_mm512_mask_storeu_ps( y, mask, y0v );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_daxpyf_skx_int_16
+     (
+       conj_t           conja,
+       conj_t           conjx,
+       dim_t            m,
+       dim_t            b_n,
+       double* restrict alpha,
+       double* restrict a, inc_t inca, inc_t lda,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      fuse_fac       = 16;
+
+	const dim_t      n_elem_per_reg = 8;
+
+	dim_t            i;
+	dim_t            m_viter;
+	dim_t            m_left;
+
+	double           chi[ 16 ];
+
+	__m512d          chiv[ 16 ];
+	__m512d          y0v;
+
+	// If either dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim2( m, b_n ) || PASTEMAC(d,eq0)( *alpha ) ) return;
+
+	// If b_n is not equal to the fusing factor, then perform the entire
+	// operation as a loop over axpyv.
+	if ( b_n != fuse_fac )
+	{
+		daxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_AXPYV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			double* a1   = a + (0  )*inca + (i  )*lda;
+			double* chi1 = x + (i  )*incx;
+			double* y1   = y + (0  )*incy;
+			double  alpha_chi1;
+
+			PASTEMAC(d,copycjs)( conjx, *chi1, alpha_chi1 );
+			PASTEMAC(d,scals)( *alpha, alpha_chi1 );
+
+			f
+			(
+			  conja,
+			  m,
+			  &alpha_chi1,
+			  a1, inca,
+			  y1, incy,
+			  cntx
+			);
+		}
+
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor.
+
+	// Scale each chi scalar by alpha.
+	for ( dim_t j = 0; j < 16; ++j )
+	{
+		chi[ j ] = *( x + j*incx );
+		PASTEMAC(d,scals)( *alpha, chi[ j ] );
+	}
+
+	// If there is anything that would interfere with our use of contiguous
+	// vector loads/stores, perform the entire operation with scalar code.
+	if ( inca != 1 || incy != 1 )
+	{
+		for ( i = 0; i < m; ++i )
+		{
+			double y0c = *y;
+
+			for ( dim_t j = 0; j < 16; ++j )
+				y0c += chi[ j ] * *( a + j*lda );
+
+			*y = y0c;
+
+			a += inca;
+			y += incy;
+		}
+		return;
+	}
+
+	m_viter = ( m ) / ( n_elem_per_reg );
+	m_left  = ( m ) % ( n_elem_per_reg );
+
+	// Broadcast the (alpha*chi?) scalars to all elements of vector registers.
+	// Together with y and one column of A, these occupy 18 of the 32 zmm
+	// registers.
+	for ( dim_t j = 0; j < 16; ++j )
+		chiv[ j ] = _mm512_set1_pd( chi[ j ] );
+
+	for ( i = 0; i < m_viter; ++i )
+	{
+		y0v = _mm512_loadu_pd( y );
+
+		// perform : y += alpha * A * x;
+		for ( dim_t j = 0; j < 16; ++j )
+			y0v = _mm512_fmadd_pd( _mm512_loadu_pd( a + j*lda ), chiv[ j ], y0v );
+
+		_mm512_storeu_pd( y, y0v );
+
+		a += n_elem_per_reg;
+		y += n_elem_per_reg;
+	}
+
+	// Handle the leftover rows with a single masked iteration instead of
+	// scalar code.
+	if ( 0 < m_left )
+	{
+		const __mmask8 mask = ( __mmask8 )( ( 1ULL << m_left ) - 1 );
+
+		y0v = _mm512_maskz_loadu_pd( mask, y );
+
+		for ( dim_t j = 0; j < 16; ++j )
+			y0v = _mm512_fmadd_pd( _mm512_maskz_loadu_pd( mask, a + j*lda ), chiv[ j ], y0v );
+
+		_mm512_mask_storeu_pd( y, mask, y0v );
+	}
+}
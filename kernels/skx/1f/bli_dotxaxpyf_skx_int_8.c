@@ -0,0 +1,414 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_sdotxaxpyf_skx_int_8
+     (
+       conj_t           conjat,
+       conj_t           conja,
+       conj_t           conjw,
+       conj_t           conjx,
+       dim_t            m,
+       dim_t            b_n,
+       float*  restrict alpha,
+       float*  restrict a, inc_t inca, inc_t lda,
+       float*  restrict w, inc_t incw,
+       float*  restrict x, inc_t incx,
+       float*  restrict beta,
+       float*  restrict y, inc_t incy,
+       float*  restrict z, inc_t incz,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      fuse_fac       = 8;
+
+	const dim_t      n_elem_per_reg = 16;
+
+	dim_t            i;
+	dim_t            m_viter;
+	dim_t            m_left;
+
+	float            rho[ 8 ];
+
+	__m512           chiv[ 8 ];
+	__m512           rhov[ 8 ];
+	__m512           av[ 8 ];
+	__m512           w0v, z0v;
+
+	// If the b_n dimension is zero, y is empty and there is no computation.
+	if ( bli_zero_dim1( b_n ) ) return;
+
+	// If b_n is not equal to the fusing factor, or if there is anything
+	// that would interfere with our use of contiguous vector loads/stores,
+	// then perform the operation as a dotxf followed by an axpyf. Those
+	// kernels handle the remaining cases, albeit with two passes over A.
+	if ( b_n != fuse_fac || inca != 1 || incw != 1 || incz != 1 )
+	{
+		PASTECH(s,dotxf_ker_ft) kfp_df
+		=
+		bli_cntx_get_l1f_ker_dt( BLIS_FLOAT, BLIS_DOTXF_KER, cntx );
+		PASTECH(s,axpyf_ker_ft) kfp_af
+		=
+		bli_cntx_get_l1f_ker_dt( BLIS_FLOAT, BLIS_AXPYF_KER, cntx );
+
+		kfp_df
+		(
+		  conjat,
+		  conjw,
+		  m,
+		  b_n,
+		  alpha,
+		  a, inca, lda,
+		  w, incw,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+
+		kfp_af
+		(
+		  conja,
+		  conjx,
+		  m,
+		  b_n,
+		  alpha,
+		  a, inca, lda,
+		  x, incx,
+		  z, incz,
+		  cntx
+		);
+
+		return;
+	}
+
+	// If the m dimension is zero, or if alpha is zero, the computation
+	// simplifies to updating y.
+	if ( bli_zero_dim1( m ) || PASTEMAC(s,eq0)( *alpha ) )
+	{
+		PASTECH(s,scalv_ker_ft) f
+		=
+		bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  b_n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor
+	// and that A, w, and z are unit-stride. Each column of A is loaded only
+	// once and used for both the dotxf (y) and axpyf (z) updates. With 32
+	// zmm registers, the eight accumulators, eight broadcast (alpha*chi)
+	// values, and eight columns of A all stay resident.
+
+	m_viter = ( m ) / ( n_elem_per_reg );
+	m_left  = ( m ) % ( n_elem_per_reg );
+
+	// Broadcast the (alpha*chi?) scalars to all elements of vector registers
+	// and initialize the rho vector accumulators to zero.
+	for ( dim_t j = 0; j < 8; ++j )
+	{
+		float  alpha_chi = *( x + j*incx );
+
+		PASTEMAC(s,scals)( *alpha, alpha_chi );
+
+		chiv[ j ] = _mm512_set1_ps( alpha_chi );
+		rhov[ j ] = _mm512_setzero_ps();
+	}
+
+	for ( i = 0; i < m_viter; ++i )
+	{
+		// Load the input values.
+		w0v = _mm512_loadu_ps( w );
+		z0v = _mm512_loadu_ps( z );
+
+		for ( dim_t j = 0; j < 8; ++j )
+			av[ j ] = _mm512_loadu_ps( a + j*lda );
+
+		// perform : rho?v += a?v * w0v;
+		//           z0v   += a?v * chi?v;
+		for ( dim_t j = 0; j < 8; ++j )
+		{
+			rhov[ j ] = _mm512_fmadd_ps( av[ j ], w0v, rhov[ j ] );
+			z0v       = _mm512_fmadd_ps( av[ j ], chiv[ j ], z0v );
+		}
+
+		// Store the output.
+		_mm512_storeu_ps( z, z0v );
+
+		a += n_elem_per_reg;
+		w += n_elem_per_reg;
+		z += n_elem_per_reg;
+	}
+
+	// Handle the leftover rows with a single masked iteration instead of
+	// scalar code. Masked-off lanes are loaded as zero and thus do not
+	// contribute to the rho accumulators.
+	if ( 0 < m_left )
+	{
+		const __mmask16 mask = ( __mmask16 )( ( 1ULL << m_left ) - 1 );
+
+		w0v = _mm512_maskz_loadu_ps( mask, w );
+		z0v = _mm512_maskz_loadu_ps( mask, z );
+
+		for ( dim_t j = 0; j < 8; ++j )
+			av[ j ] = _mm512_maskz_loadu_ps( mask, a + j*lda );
+
+		for ( dim_t j = 0; j < 8; ++j )
+		{
+			rhov[ j ] = _mm512_fmadd_ps( av[ j ], w0v, rhov[ j ] );
+			z0v       = _mm512_fmadd_ps( av[ j ], chiv[ j ], z0v );
+		}
+
+		_mm512_mask_storeu_ps( z, mask, z0v );
+	}
+
+	// Sum the elements within each rho vector.
+	for ( dim_t j = 0; j < 8; ++j )
+		rho[ j ] = _mm512_reduce_add_ps( rhov[ j ] );
+
+	// Now scale y by beta (or overwrite it if beta is zero) and add in the
+	// alpha-scaled dot products.
+	if ( PASTEMAC(s,eq0)( *beta ) )
+	{
+		for ( dim_t j = 0; j < 8; ++j )
+			PASTEMAC(s,scal2s)( *alpha, rho[ j ], *( y + j*incy ) );
+	}
+	else
+	{
+		for ( dim_t j = 0; j < 8; ++j )
+		{
+			PASTEMAC(s,scals)( *beta, *( y + j*incy ) );
+			PASTEMAC(s,axpys)( *alpha, rho[ j ], *( y + j*incy ) );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ddotxaxpyf_skx_int_8
+     (
+       conj_t           conjat,
+       conj_t           conja,
+       conj_t           conjw,
+       conj_t           conjx,
+       dim_t            m,
+       dim_t            b_n,
+       double* restrict alpha,
+       double* restrict a, inc_t inca, inc_t lda,
+       double* restrict w, inc_t incw,
+       double* restrict x, inc_t incx,
+       double* restrict beta,
+       double* restrict y, inc_t incy,
+       double* restrict z, inc_t incz,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      fuse_fac       = 8;
+
+	const dim_t      n_elem_per_reg = 8;
+
+	dim_t            i;
+	dim_t            m_viter;
+	dim_t            m_left;
+
+	double           rho[ 8 ];
+
+	__m512d          chiv[ 8 ];
+	__m512d          rhov[ 8 ];
+	__m512d          av[ 8 ];
+	__m512d          w0v, z0v;
+
+	// If the b_n dimension is zero, y is empty and there is no computation.
+	if ( bli_zero_dim1( b_n ) ) return;
+
+	// If b_n is not equal to the fusing factor, or if there is anything
+	// that would interfere with our use of contiguous vector loads/stores,
+	// then perform the operation as a dotxf followed by an axpyf. Those
+	// kernels handle the remaining cases, albeit with two passes over A.
+	if ( b_n != fuse_fac || inca != 1 || incw != 1 || incz != 1 )
+	{
+		PASTECH(d,dotxf_ker_ft) kfp_df
+		=
+		bli_cntx_get_l1f_ker_dt( BLIS_DOUBLE, BLIS_DOTXF_KER, cntx );
+		PASTECH(d,axpyf_ker_ft) kfp_af
+		=
+		bli_cntx_get_l1f_ker_dt( BLIS_DOUBLE, BLIS_AXPYF_KER, cntx );
+
+		kfp_df
+		(
+		  conjat,
+		  conjw,
+		  m,
+		  b_n,
+		  alpha,
+		  a, inca, lda,
+		  w, incw,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+
+		kfp_af
+		(
+		  conja,
+		  conjx,
+		  m,
+		  b_n,
+		  alpha,
+		  a, inca, lda,
+		  x, incx,
+		  z, incz,
+		  cntx
+		);
+
+		return;
+	}
+
+	// If the m dimension is zero, or if alpha is zero, the computation
+	// simplifies to updating y.
+	if ( bli_zero_dim1( m ) || PASTEMAC(d,eq0)( *alpha ) )
+	{
+		PASTECH(d,scalv_ker_ft) f
+		=
+		bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  b_n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor
+	// and that A, w, and z are unit-stride. Each column of A is loaded only
+	// once and used for both the dotxf (y) and axpyf (z) updates. With 32
+	// zmm registers, the eight accumulators, eight broadcast (alpha*chi)
+	// values, and eight columns of A all stay resident.
+
+	m_viter = ( m ) / ( n_elem_per_reg );
+	m_left  = ( m ) % ( n_elem_per_reg );
+
+	// Broadcast the (alpha*chi?) scalars to all elements of vector registers
+	// and initialize the rho vector accumulators to zero.
+	for ( dim_t j = 0; j < 8; ++j )
+	{
+		double alpha_chi = *( x + j*incx );
+
+		PASTEMAC(d,scals)( *alpha, alpha_chi );
+
+		chiv[ j ] = _mm512_set1_pd( alpha_chi );
+		rhov[ j ] = _mm512_setzero_pd();
+	}
+
+	for ( i = 0; i < m_viter; ++i )
+	{
+		// Load the input values.
+		w0v = _mm512_loadu_pd( w );
+		z0v = _mm512_loadu_pd( z );
+
+		for ( dim_t j = 0; j < 8; ++j )
+			av[ j ] = _mm512_loadu_pd( a + j*lda );
+
+		// perform : rho?v += a?v * w0v;
+		//           z0v   += a?v * chi?v;
+		for ( dim_t j = 0; j < 8; ++j )
+		{
+			rhov[ j ] = _mm512_fmadd_pd( av[ j ], w0v, rhov[ j ] );
+			z0v       = _mm512_fmadd_pd( av[ j ], chiv[ j ], z0v );
+		}
+
+		// Store the output.
+		_mm512_storeu_pd( z, z0v );
+
+		a += n_elem_per_reg;
+		w += n_elem_per_reg;
+		z += n_elem_per_reg;
+	}
+
+	// Handle the leftover rows with a single masked iteration instead of
+	// scalar code. Masked-off lanes are loaded as zero and thus do not
+	// contribute to the rho accumulators.
+	if ( 0 < m_left )
+	{
+		const __mmask8 mask = ( __mmask8 )( ( 1ULL << m_left ) - 1 );
+
+		w0v = _mm512_maskz_loadu_pd( mask, w );
+		z0v = _mm512_maskz_loadu_pd( mask, z );
+
+		for ( dim_t j = 0; j < 8; ++j )
+			av[ j ] = _mm512_maskz_loadu_pd( mask, a + j*lda );
+
+		for ( dim_t j = 0; j < 8; ++j )
+		{
+			rhov[ j ] = _mm512_fmadd_pd( av[ j ], w0v, rhov[ j ] );
+			z0v       = _mm512_fmadd_pd( av[ j ], chiv[ j ], z0v );
+		}
+
+		_mm512_mask_storeu_pd( z, mask, z0v );
+	}
+
+	// Sum the elements within each rho vector.
+	for ( dim_t j = 0; j < 8; ++j )
+		rho[ j ] = _mm512_reduce_add_pd( rhov[ j ] );
+
+	// Now scale y by beta (or overwrite it if beta is zero) and add in the
+	// alpha-scaled dot products.
+	if ( PASTEMAC(d,eq0)( *beta ) )
+	{
+		for ( dim_t j = 0; j < 8; ++j )
+			PASTEMAC(d,scal2s)( *alpha, rho[ j ], *( y + j*incy ) );
+	}
+	else
+	{
+		for ( dim_t j = 0; j < 8; ++j )
+		{
+			PASTEMAC(d,scals)( *beta, *( y + j*incy ) );
+			PASTEMAC(d,axpys)( *alpha, rho[ j ], *( y + j*incy ) );
+		}
+	}
+}
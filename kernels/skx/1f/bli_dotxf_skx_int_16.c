@@ -0,0 +1,450 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// -----------------------------------------------------------------------------
+
+void bli_sdotxf_skx_int_16
+     (
+       conj_t           conjat,
+       conj_t           conjx,
+       dim_t            m,
+       dim_t            b_n,
+       float*  restrict alpha,
+       float*  restrict a, inc_t inca, inc_t lda,
+       float*  restrict x, inc_t incx,
+       float*  restrict beta,
+       float*  restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      fuse_fac       = 16;
+
+	const dim_t      n_elem_per_reg = 16;
+
+	dim_t            i;
+
+	// Intermediate variables to hold the completed dot products.
+	float            rho[ 16 ] = { 0 };
+
+	// If the b_n dimension is zero, y is empty and there is no computation.
+	if ( bli_zero_dim1( b_n ) ) return;
+
+	// If the m dimension is zero, or if alpha is zero, the computation
+	// simplifies to updating y.
+	if ( bli_zero_dim1( m ) || PASTEMAC(s,eq0)( *alpha ) )
+	{
+		sscalv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  b_n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// If b_n is not equal to the fusing factor, then perform the entire
+	// operation as a loop over dotxv.
+	if ( b_n != fuse_fac )
+	{
+		sdotxv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_DOTXV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			float*  a1   = a + (0  )*inca + (i  )*lda;
+			float*  x1   = x + (0  )*incx;
+			float*  psi1 = y + (i  )*incy;
+
+			f
+			(
+			  conjat,
+			  conjx,
+			  m,
+			  alpha,
+			  a1, inca,
+			  x1, incx,
+			  beta,
+			  psi1,
+			  cntx
+			);
+		}
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor.
+	// As with the AVX2 kernels, we handle two storage formats explicitly:
+	// (1) A is stored by columns, in which case each of the 16 dot products
+	// gets its own vector accumulator, or (2) A is stored by rows, in which
+	// case each row of A is loaded whole and scaled by a broadcast element
+	// of x. Anything else is computed with scalar code.
+
+	if ( inca == 1 && incx == 1 )
+	{
+		const dim_t m_viter = ( m ) / ( n_elem_per_reg );
+		const dim_t m_left  = ( m ) % ( n_elem_per_reg );
+
+		__m512  rhov[ 16 ];
+		__m512  x0v;
+
+		for ( dim_t j = 0; j < 16; ++j )
+			rhov[ j ] = _mm512_setzero_ps();
+
+		for ( i = 0; i < m_viter; ++i )
+		{
+			x0v = _mm512_loadu_ps( x );
+
+			// perform: rho?v += a?v * x0v;
+			for ( dim_t j = 0; j < 16; ++j )
+				rhov[ j ] = _mm512_fmadd_ps( _mm512_loadu_ps( a + j*lda ), x0v, rhov[ j ] );
+
+			a += n_elem_per_reg;
+			x += n_elem_per_reg;
+		}
+
+		// Handle the leftover rows with a single masked iteration. Masked-off
+		// lanes are loaded as zero and thus do not contribute to rho.
+		if ( 0 < m_left )
+		{
+			const __mmask16 mask = ( __mmask16 )( ( 1ULL << m_left ) - 1 );
+
+			x0v = _mm512_maskz_loadu_ps( mask, x );
+
+			for ( dim_t j = 0; j < 16; ++j )
+				rhov[ j ] = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( mask, a + j*lda ), x0v, rhov[ j ] );
+		}
+
+		// Sum the elements within each rho vector.
+		for ( dim_t j = 0; j < 16; ++j )
+			rho[ j ] = _mm512_reduce_add_ps( rhov[ j ] );
+	}
+	else if ( lda == 1 )
+	{
+		// Each row of A (i.e., 16 consecutive elements) spans this many
+		// vector registers.
+		const dim_t n_reg         = 16 / n_elem_per_reg;
+		const dim_t n_iter_unroll = 4;
+
+		const dim_t m_viter = ( m ) / ( n_iter_unroll );
+		const dim_t m_left  = ( m ) % ( n_iter_unroll );
+
+		// Use a separate set of accumulators for each unrolled iteration
+		// to break the dependency chain on the fmadd results.
+		__m512  rhov[ 4 ][ 2 ];
+
+		for ( dim_t u = 0; u < 4; ++u )
+		for ( dim_t r = 0; r < n_reg; ++r )
+			rhov[ u ][ r ] = _mm512_setzero_ps();
+
+		for ( i = 0; i < m_viter; ++i )
+		{
+			for ( dim_t u = 0; u < 4; ++u )
+			{
+				const __m512  xv = _mm512_set1_ps( *( x + u*incx ) );
+
+				for ( dim_t r = 0; r < n_reg; ++r )
+					rhov[ u ][ r ] = _mm512_fmadd_ps( _mm512_loadu_ps( a + u*inca + r*n_elem_per_reg ), xv, rhov[ u ][ r ] );
+			}
+
+			a += n_iter_unroll * inca;
+			x += n_iter_unroll * incx;
+		}
+
+		for ( i = 0; i < m_left; ++i )
+		{
+			const __m512  xv = _mm512_set1_ps( *x );
+
+			for ( dim_t r = 0; r < n_reg; ++r )
+				rhov[ 0 ][ r ] = _mm512_fmadd_ps( _mm512_loadu_ps( a + r*n_elem_per_reg ), xv, rhov[ 0 ][ r ] );
+
+			a += inca;
+			x += incx;
+		}
+
+		// Combine the unrolled accumulators and write the vector components
+		// to the scalar rho values.
+		for ( dim_t r = 0; r < n_reg; ++r )
+		{
+			rhov[ 0 ][ r ] = _mm512_add_ps( rhov[ 0 ][ r ], rhov[ 1 ][ r ] );
+			rhov[ 2 ][ r ] = _mm512_add_ps( rhov[ 2 ][ r ], rhov[ 3 ][ r ] );
+			rhov[ 0 ][ r ] = _mm512_add_ps( rhov[ 0 ][ r ], rhov[ 2 ][ r ] );
+
+			_mm512_storeu_ps( rho + r*n_elem_per_reg, rhov[ 0 ][ r ] );
+		}
+	}
+	else
+	{
+		// No vectorization possible; use scalar iterations for the entire
+		// problem.
+		for ( i = 0; i < m; ++i )
+		{
+			const float  x0c = *x;
+
+			for ( dim_t j = 0; j < 16; ++j )
+				rho[ j ] += *( a + j*lda ) * x0c;
+
+			a += inca;
+			x += incx;
+		}
+	}
+
+	// We know at this point that alpha is nonzero; however, beta may still
+	// be zero. If beta is indeed zero, we must overwrite y rather than scale
+	// by beta (in case y contains NaN or Inf).
+	if ( PASTEMAC(s,eq0)( *beta ) )
+	{
+		for ( dim_t j = 0; j < 16; ++j )
+			PASTEMAC(s,scal2s)( *alpha, rho[ j ], *( y + j*incy ) );
+	}
+	else
+	{
+		for ( dim_t j = 0; j < 16; ++j )
+		{
+			PASTEMAC(s,scals)( *beta, *( y + j*incy ) );
+			PASTEMAC(s,axpys)( *alpha, rho[ j ], *( y + j*incy ) );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ddotxf_skx_int_16
+     (
+       conj_t           conjat,
+       conj_t           conjx,
+       dim_t            m,
+       dim_t            b_n,
+       double* restrict alpha,
+       double* restrict a, inc_t inca, inc_t lda,
+       double* restrict x, inc_t incx,
+       double* restrict beta,
+       double* restrict y, inc_t incy,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      fuse_fac       = 16;
+
+	const dim_t      n_elem_per_reg = 8;
+
+	dim_t            i;
+
+	// Intermediate variables to hold the completed dot products.
+	double           rho[ 16 ] = { 0 };
+
+	// If the b_n dimension is zero, y is empty and there is no computation.
+	if ( bli_zero_dim1( b_n ) ) return;
+
+	// If the m dimension is zero, or if alpha is zero, the computation
+	// simplifies to updating y.
+	if ( bli_zero_dim1( m ) || PASTEMAC(d,eq0)( *alpha ) )
+	{
+		dscalv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  b_n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// If b_n is not equal to the fusing factor, then perform the entire
+	// operation as a loop over dotxv.
+	if ( b_n != fuse_fac )
+	{
+		ddotxv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_DOTXV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			double* a1   = a + (0  )*inca + (i  )*lda;
+			double* x1   = x + (0  )*incx;
+			double* psi1 = y + (i  )*incy;
+
+			f
+			(
+			  conjat,
+			  conjx,
+			  m,
+			  alpha,
+			  a1, inca,
+			  x1, incx,
+			  beta,
+			  psi1,
+			  cntx
+			);
+		}
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor.
+	// As with the AVX2 kernels, we handle two storage formats explicitly:
+	// (1) A is stored by columns, in which case each of the 16 dot products
+	// gets its own vector accumulator, or (2) A is stored by rows, in which
+	// case each row of A is loaded whole and scaled by a broadcast element
+	// of x. Anything else is computed with scalar code.
+
+	if ( inca == 1 && incx == 1 )
+	{
+		const dim_t m_viter = ( m ) / ( n_elem_per_reg );
+		const dim_t m_left  = ( m ) % ( n_elem_per_reg );
+
+		__m512d rhov[ 16 ];
+		__m512d x0v;
+
+		for ( dim_t j = 0; j < 16; ++j )
+			rhov[ j ] = _mm512_setzero_pd();
+
+		for ( i = 0; i < m_viter; ++i )
+		{
+			x0v = _mm512_loadu_pd( x );
+
+			// perform: rho?v += a?v * x0v;
+			for ( dim_t j = 0; j < 16; ++j )
+				rhov[ j ] = _mm512_fmadd_pd( _mm512_loadu_pd( a + j*lda ), x0v, rhov[ j ] );
+
+			a += n_elem_per_reg;
+			x += n_elem_per_reg;
+		}
+
+		// Handle the leftover rows with a single masked iteration. Masked-off
+		// lanes are loaded as zero and thus do not contribute to rho.
+		if ( 0 < m_left )
+		{
+			const __mmask8 mask = ( __mmask8 )( ( 1ULL << m_left ) - 1 );
+
+			x0v = _mm512_maskz_loadu_pd( mask, x );
+
+			for ( dim_t j = 0; j < 16; ++j )
+				rhov[ j ] = _mm512_fmadd_pd( _mm512_maskz_loadu_pd( mask, a + j*lda ), x0v, rhov[ j ] );
+		}
+
+		// Sum the elements within each rho vector.
+		for ( dim_t j = 0; j < 16; ++j )
+			rho[ j ] = _mm512_reduce_add_pd( rhov[ j ] );
+	}
+	else if ( lda == 1 )
+	{
+		// Each row of A (i.e., 16 consecutive elements) spans this many
+		// vector registers.
+		const dim_t n_reg         = 16 / n_elem_per_reg;
+		const dim_t n_iter_unroll = 4;
+
+		const dim_t m_viter = ( m ) / ( n_iter_unroll );
+		const dim_t m_left  = ( m ) % ( n_iter_unroll );
+
+		// Use a separate set of accumulators for each unrolled iteration
+		// to break the dependency chain on the fmadd results.
+		__m512d rhov[ 4 ][ 2 ];
+
+		for ( dim_t u = 0; u < 4; ++u )
+		for ( dim_t r = 0; r < n_reg; ++r )
+			rhov[ u ][ r ] = _mm512_setzero_pd();
+
+		for ( i = 0; i < m_viter; ++i )
+		{
+			for ( dim_t u = 0; u < 4; ++u )
+			{
+				const __m512d xv = _mm512_set1_pd( *( x + u*incx ) );
+
+				for ( dim_t r = 0; r < n_reg; ++r )
+					rhov[ u ][ r ] = _mm512_fmadd_pd( _mm512_loadu_pd( a + u*inca + r*n_elem_per_reg ), xv, rhov[ u ][ r ] );
+			}
+
+			a += n_iter_unroll * inca;
+			x += n_iter_unroll * incx;
+		}
+
+		for ( i = 0; i < m_left; ++i )
+		{
+			const __m512d xv = _mm512_set1_pd( *x );
+
+			for ( dim_t r = 0; r < n_reg; ++r )
+				rhov[ 0 ][ r ] = _mm512_fmadd_pd( _mm512_loadu_pd( a + r*n_elem_per_reg ), xv, rhov[ 0 ][ r ] );
+
+			a += inca;
+			x += incx;
+		}
+
+		// Combine the unrolled accumulators and write the vector components
+		// to the scalar rho values.
+		for ( dim_t r = 0; r < n_reg; ++r )
+		{
+			rhov[ 0 ][ r ] = _mm512_add_pd( rhov[ 0 ][ r ], rhov[ 1 ][ r ] );
+			rhov[ 2 ][ r ] = _mm512_add_pd( rhov[ 2 ][ r ], rhov[ 3 ][ r ] );
+			rhov[ 0 ][ r ] = _mm512_add_pd( rhov[ 0 ][ r ], rhov[ 2 ][ r ] );
+
+			_mm512_storeu_pd( rho + r*n_elem_per_reg, rhov[ 0 ][ r ] );
+		}
+	}
+	else
+	{
+		// No vectorization possible; use scalar iterations for the entire
+		// problem.
+		for ( i = 0; i < m; ++i )
+		{
+			const double x0c = *x;
+
+			for ( dim_t j = 0; j < 16; ++j )
+				rho[ j ] += *( a + j*lda ) * x0c;
+
+			a += inca;
+			x += incx;
+		}
+	}
+
+	// We know at this point that alpha is nonzero; however, beta may still
+	// be zero. If beta is indeed zero, we must overwrite y rather than scale
+	// by beta (in case y contains NaN or Inf).
+	if ( PASTEMAC(d,eq0)( *beta ) )
+	{
+		for ( dim_t j = 0; j < 16; ++j )
+			PASTEMAC(d,scal2s)( *alpha, rho[ j ], *( y + j*incy ) );
+	}
+	else
+	{
+		for ( dim_t j = 0; j < 16; ++j )
+		{
+			PASTEMAC(d,scals)( *beta, *( y + j*incy ) );
+			PASTEMAC(d,axpys)( *alpha, rho[ j ], *( y + j*incy ) );
+		}
+	}
+}
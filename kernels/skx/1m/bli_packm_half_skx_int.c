@@ -0,0 +1,155 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Half-precision packm kernels for AVX-512. bfloat16 values are widened by
+// zero-extending each 16-bit pattern and shifting it into the upper half of
+// a 32-bit lane; float16 values are widened with vcvtph2ps. (The AVX512_BF16
+// extension only adds instructions for narrowing to bfloat16 and for
+// bfloat16 dot products, so there is no faster way to widen.) See
+// ref_kernels/1m/bli_packm_half_ref.c for the semantics.
+//
+// Column-stored micro-panels (inca == 1) are converted sixteen rows at a
+// time, with masked loads and stores for the last rows and for the zeros
+// that pad the micro-panel to ldp. Row-stored micro-panels (lda == 1),
+// which arise when packing B from a column-stored matrix, are loaded
+// sixteen columns at a time and scattered into the micro-panel.
+//
+
+BLIS_INLINE __m512 bli_bf16_to_float_16( __m256i h )
+{
+	return _mm512_castsi512_ps( _mm512_slli_epi32( _mm512_cvtepu16_epi32( h ), 16 ) );
+}
+
+BLIS_INLINE __m512 bli_fp16_to_float_16( __m256i h )
+{
+	return _mm512_cvtph_ps( h );
+}
+
+BLIS_INLINE __mmask16 bli_mask_16( dim_t n )
+{
+	return ( __mmask16 )( n >= 16 ? 0xFFFF : ( n <= 0 ? 0 : ( 1u << n ) - 1 ) );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, opname, vcvt, cvt ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       dim_t            cdim, \
+       dim_t            n, \
+       void*   restrict a, inc_t inca, inc_t lda, \
+       float*  restrict p,             inc_t ldp, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	ctype* restrict a_cast = a; \
+\
+	if ( inca == 1 ) \
+	{ \
+		for ( dim_t l = 0; l < n; ++l ) \
+		{ \
+			ctype* restrict al = a_cast + l*lda; \
+			float* restrict pl = p      + l*ldp; \
+			dim_t           i  = 0; \
+\
+			for ( ; i + 16 <= cdim; i += 16 ) \
+				_mm512_storeu_ps( pl + i, vcvt( _mm256_loadu_si256( ( __m256i* )( al + i ) ) ) ); \
+\
+			/* Masked-off lanes of the load are zeroed, which produces the
+			   zeros that pad the micro-panel to ldp. */ \
+			for ( ; i < ldp; i += 16 ) \
+			{ \
+				const __mmask16 m_load  = bli_mask_16( cdim - i ); \
+				const __mmask16 m_store = bli_mask_16( ldp  - i ); \
+\
+				__m512 v = vcvt( _mm256_maskz_loadu_epi16( m_load, al + i ) ); \
+\
+				_mm512_mask_storeu_ps( pl + i, m_store, v ); \
+			} \
+		} \
+	} \
+	else if ( lda == 1 ) \
+	{ \
+		/* The offsets of sixteen consecutive columns of the micro-panel. */ \
+		const __m512i offs = _mm512_mullo_epi32 \
+		( \
+		  _mm512_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ), \
+		  _mm512_set1_epi32( ( int )ldp ) \
+		); \
+\
+		for ( dim_t i = 0; i < cdim; ++i ) \
+		{ \
+			ctype* restrict ai = a_cast + i*inca; \
+			dim_t           l  = 0; \
+\
+			for ( ; l + 16 <= n; l += 16 ) \
+			{ \
+				__m512 v = vcvt( _mm256_loadu_si256( ( __m256i* )( ai + l ) ) ); \
+\
+				_mm512_i32scatter_ps( p + i + l*ldp, offs, v, 4 ); \
+			} \
+\
+			if ( l < n ) \
+			{ \
+				const __mmask16 m = bli_mask_16( n - l ); \
+\
+				__m512 v = vcvt( _mm256_maskz_loadu_epi16( m, ai + l ) ); \
+\
+				_mm512_mask_i32scatter_ps( p + i + l*ldp, m, offs, v, 4 ); \
+			} \
+		} \
+\
+		for ( dim_t l = 0; l < n; ++l ) \
+			for ( dim_t i = cdim; i < ldp; i += 16 ) \
+				_mm512_mask_storeu_ps( p + i + l*ldp, bli_mask_16( ldp - i ), \
+				                       _mm512_setzero_ps() ); \
+	} \
+	else \
+	{ \
+		for ( dim_t l = 0; l < n; ++l ) \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+				p[ i + l*ldp ] = cvt( a_cast[ i*inca + l*lda ] ); \
+			for ( dim_t i = cdim; i < ldp; ++i ) \
+				p[ i + l*ldp ] = 0.0f; \
+		} \
+	} \
+}
+
+GENTFUNC( bfloat16, packm_bf16_skx_int, bli_bf16_to_float_16, bli_bf16_to_float )
+GENTFUNC( float16,  packm_fp16_skx_int, bli_fp16_to_float_16, bli_fp16_to_float )
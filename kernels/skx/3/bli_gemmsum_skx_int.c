@@ -0,0 +1,147 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+//
+// Multi-target gemm micro-kernels for AVX-512 that pair with the native
+// skx gemm micro-kernels (32x12 for float, 16x14 for double). Each column
+// of the MR x NR product A * B is held in two zmm registers and, once the
+// k loop is done, is added to the corresponding column of each of the
+// nterm micro-tiles of C with its own alpha (see
+// ref_kernels/3/bli_gemmsum_ref.c for the exact semantics). Edge cases
+// along m use masked loads and stores; general-stride C is updated from a
+// temporary copy of the product.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, vec_t, mask_t, VL, MR, NR, \
+                  setzero, set1, loadu, storeu, mloadu, mstoreu, fmadd ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       dim_t               nterm, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype**    restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	vec_t ab[ NR ][ 2 ]; \
+\
+	for ( dim_t j = 0; j < NR; ++j ) \
+	{ \
+		ab[ j ][ 0 ] = setzero(); \
+		ab[ j ][ 1 ] = setzero(); \
+	} \
+\
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		const vec_t a0 = loadu( a +  0 ); \
+		const vec_t a1 = loadu( a + VL ); \
+\
+		for ( dim_t j = 0; j < NR; ++j ) \
+		{ \
+			const vec_t bj = set1( b[ j ] ); \
+\
+			ab[ j ][ 0 ] = fmadd( a0, bj, ab[ j ][ 0 ] ); \
+			ab[ j ][ 1 ] = fmadd( a1, bj, ab[ j ][ 1 ] ); \
+		} \
+\
+		a += MR; \
+		b += NR; \
+	} \
+\
+	if ( rs_c == 1 ) \
+	{ \
+		/* C is column-stored. */ \
+		const mask_t mask0 = ( mask_t )( ( 1ULL << bli_min( m, VL ) ) - 1 ); \
+		const mask_t mask1 = ( mask_t )( ( 1ULL << bli_max( m - VL, 0 ) ) - 1 ); \
+\
+		for ( dim_t t = 0; t < nterm; ++t ) \
+		{ \
+			const vec_t alphav = set1( alpha[ t ] ); \
+\
+			for ( dim_t j = 0; j < n; ++j ) \
+			{ \
+				ctype* restrict cj = c[ t ] + j*cs_c; \
+\
+				if ( m == MR ) \
+				{ \
+					storeu( cj +  0, fmadd( alphav, ab[ j ][ 0 ], loadu( cj +  0 ) ) ); \
+					storeu( cj + VL, fmadd( alphav, ab[ j ][ 1 ], loadu( cj + VL ) ) ); \
+				} \
+				else \
+				{ \
+					const vec_t c0 = mloadu( setzero(), mask0, cj +  0 ); \
+					const vec_t c1 = mloadu( setzero(), mask1, cj + VL ); \
+\
+					mstoreu( cj +  0, mask0, fmadd( alphav, ab[ j ][ 0 ], c0 ) ); \
+					mstoreu( cj + VL, mask1, fmadd( alphav, ab[ j ][ 1 ], c1 ) ); \
+				} \
+			} \
+		} \
+	} \
+	else \
+	{ \
+		/* C is row-stored or general-stored. */ \
+		ctype ct[ MR * NR ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+		for ( dim_t j = 0; j < NR; ++j ) \
+		{ \
+			storeu( ct + j*MR +  0, ab[ j ][ 0 ] ); \
+			storeu( ct + j*MR + VL, ab[ j ][ 1 ] ); \
+		} \
+\
+		for ( dim_t t = 0; t < nterm; ++t ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+		for ( dim_t j = 0; j < n; ++j ) \
+			PASTEMAC(ch,axpys)( alpha[ t ], ct[ i + j*MR ], \
+			                    c[ t ][ i*rs_c + j*cs_c ] ); \
+	} \
+}
+
+GENTFUNC( float,  s, gemmsum_skx_int_32x12, __m512,  __mmask16, 16, 32, 12,
+          _mm512_setzero_ps, _mm512_set1_ps, _mm512_loadu_ps, _mm512_storeu_ps,
+          _mm512_mask_loadu_ps, _mm512_mask_storeu_ps, _mm512_fmadd_ps )
+
+GENTFUNC( double, d, gemmsum_skx_int_16x14, __m512d, __mmask8,   8, 16, 14,
+          _mm512_setzero_pd, _mm512_set1_pd, _mm512_loadu_pd, _mm512_storeu_pd,
+          _mm512_mask_loadu_pd, _mm512_mask_storeu_pd, _mm512_fmadd_pd )
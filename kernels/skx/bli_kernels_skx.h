@@ -38,4 +38,53 @@ GEMM_UKR_PROT( float ,   s, gemm_skx_asm_12x32_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x12_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x14 )
 
+// gemmsum (intrinsics)
+GEMMSUM_UKR_PROT( float ,   s, gemmsum_skx_int_32x12 )
+GEMMSUM_UKR_PROT( double,   d, gemmsum_skx_int_16x14 )
+
+// -- level-1v --
+
+// axpyv (intrinsics)
+AXPYV_KER_PROT( float,    s, axpyv_skx_int )
+AXPYV_KER_PROT( double,   d, axpyv_skx_int )
+
+// dotv (intrinsics)
+DOTV_KER_PROT( float,    s, dotv_skx_int )
+DOTV_KER_PROT( double,   d, dotv_skx_int )
+
+// dotxv (intrinsics)
+DOTXV_KER_PROT( float,    s, dotxv_skx_int )
+DOTXV_KER_PROT( double,   d, dotxv_skx_int )
+
+// scalv (intrinsics)
+SCALV_KER_PROT( float,    s, scalv_skx_int )
+SCALV_KER_PROT( double,   d, scalv_skx_int )
+
+// -- level-1f --
+
+// axpyf (intrinsics)
+AXPYF_KER_PROT( float,    s, axpyf_skx_int_16 )
+AXPYF_KER_PROT( double,   d, axpyf_skx_int_16 )
+
+// dotxf (intrinsics)
+DOTXF_KER_PROT( float,    s, dotxf_skx_int_16 )
+DOTXF_KER_PROT( double,   d, dotxf_skx_int_16 )
+
+// axpy2v (intrinsics)
+AXPY2V_KER_PROT( float,    s, axpy2v_skx_int )
+AXPY2V_KER_PROT( double,   d, axpy2v_skx_int )
+
+// dotaxpyv (intrinsics)
+DOTAXPYV_KER_PROT( float,    s, dotaxpyv_skx_int )
+DOTAXPYV_KER_PROT( double,   d, dotaxpyv_skx_int )
+
+// dotxaxpyf (intrinsics)
+DOTXAXPYF_KER_PROT( float,    s, dotxaxpyf_skx_int_8 )
+DOTXAXPYF_KER_PROT( double,   d, dotxaxpyf_skx_int_8 )
+
+// -- level-1m --
+
+// packm (half-precision, intrinsics)
+PACKM_HALF_KER_PROT( packm_bf16_skx_int )
+PACKM_HALF_KER_PROT( packm_fp16_skx_int )
 
@@ -0,0 +1,562 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+/* Union data structure to access AVX registers
+   One 256-bit AVX register holds 8 SP elements. */
+typedef union
+{
+	__m256  v;
+	float   f[8] __attribute__((aligned(64)));
+} v8sf_t;
+
+/* Union data structure to access AVX registers
+*  One 256-bit AVX register holds 4 DP elements. */
+typedef union
+{
+	__m256d v;
+	double  d[4] __attribute__((aligned(64)));
+} v4df_t;
+
+// -----------------------------------------------------------------------------
+
+void bli_sdotxaxpyf_zen_int_4
+     (
+       conj_t           conjat,
+       conj_t           conja,
+       conj_t           conjw,
+       conj_t           conjx,
+       dim_t            m,
+       dim_t            b_n,
+       float*  restrict alpha,
+       float*  restrict a, inc_t inca, inc_t lda,
+       float*  restrict w, inc_t incw,
+       float*  restrict x, inc_t incx,
+       float*  restrict beta,
+       float*  restrict y, inc_t incy,
+       float*  restrict z, inc_t incz,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      fuse_fac       = 4;
+
+	const dim_t      n_elem_per_reg = 8;
+	const dim_t      n_iter_unroll  = 1;
+
+	dim_t            i;
+	dim_t            m_viter;
+	dim_t            m_left;
+
+	float*  restrict a0;
+	float*  restrict a1;
+	float*  restrict a2;
+	float*  restrict a3;
+
+	float*  restrict w0;
+	float*  restrict z0;
+
+	v8sf_t           chi0v, chi1v, chi2v, chi3v;
+	v8sf_t           rho0v, rho1v, rho2v, rho3v;
+
+	v8sf_t           a0v, a1v, a2v, a3v;
+	v8sf_t           w0v, z0v;
+
+	float            chi0, chi1, chi2, chi3;
+	float            rho0, rho1, rho2, rho3;
+
+	// If the b_n dimension is zero, y is empty and there is no computation.
+	if ( bli_zero_dim1( b_n ) ) return;
+
+	// If b_n is not equal to the fusing factor, or if there is anything
+	// that would interfere with our use of contiguous vector loads/stores,
+	// then perform the operation as a dotxf followed by an axpyf. Those
+	// kernels handle the remaining cases, albeit with two passes over A.
+	if ( b_n != fuse_fac || inca != 1 || incw != 1 || incz != 1 )
+	{
+		PASTECH(s,dotxf_ker_ft) kfp_df
+		=
+		bli_cntx_get_l1f_ker_dt( BLIS_FLOAT, BLIS_DOTXF_KER, cntx );
+		PASTECH(s,axpyf_ker_ft) kfp_af
+		=
+		bli_cntx_get_l1f_ker_dt( BLIS_FLOAT, BLIS_AXPYF_KER, cntx );
+
+		kfp_df
+		(
+		  conjat,
+		  conjw,
+		  m,
+		  b_n,
+		  alpha,
+		  a, inca, lda,
+		  w, incw,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+
+		kfp_af
+		(
+		  conja,
+		  conjx,
+		  m,
+		  b_n,
+		  alpha,
+		  a, inca, lda,
+		  x, incx,
+		  z, incz,
+		  cntx
+		);
+
+		return;
+	}
+
+	// If the m dimension is zero, or if alpha is zero, the computation
+	// simplifies to updating y.
+	if ( bli_zero_dim1( m ) || PASTEMAC(s,eq0)( *alpha ) )
+	{
+		PASTECH(s,scalv_ker_ft) f
+		=
+		bli_cntx_get_l1v_ker_dt( BLIS_FLOAT, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  b_n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor
+	// and that A, w, and z are unit-stride. Each column of A is loaded only
+	// once and used for both the dotxf (y) and axpyf (z) updates.
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	m_viter = ( m ) / ( n_elem_per_reg * n_iter_unroll );
+	m_left  = ( m ) % ( n_elem_per_reg * n_iter_unroll );
+
+	a0   = a + 0*lda;
+	a1   = a + 1*lda;
+	a2   = a + 2*lda;
+	a3   = a + 3*lda;
+	w0   = w;
+	z0   = z;
+
+	chi0 = *( x + 0*incx );
+	chi1 = *( x + 1*incx );
+	chi2 = *( x + 2*incx );
+	chi3 = *( x + 3*incx );
+
+	// Scale each chi scalar by alpha.
+	PASTEMAC(s,scals)( *alpha, chi0 );
+	PASTEMAC(s,scals)( *alpha, chi1 );
+	PASTEMAC(s,scals)( *alpha, chi2 );
+	PASTEMAC(s,scals)( *alpha, chi3 );
+
+	// Broadcast the (alpha*chi?) scalars to all elements of vector registers.
+	chi0v.v = _mm256_broadcast_ss( &chi0 );
+	chi1v.v = _mm256_broadcast_ss( &chi1 );
+	chi2v.v = _mm256_broadcast_ss( &chi2 );
+	chi3v.v = _mm256_broadcast_ss( &chi3 );
+
+	// Initialize b_n rho vector accumulators to zero.
+	rho0v.v = _mm256_setzero_ps();
+	rho1v.v = _mm256_setzero_ps();
+	rho2v.v = _mm256_setzero_ps();
+	rho3v.v = _mm256_setzero_ps();
+
+	// If there are vectorized iterations, perform them with vector
+	// instructions.
+	for ( i = 0; i < m_viter; ++i )
+	{
+		// Load the input values.
+		w0v.v = _mm256_loadu_ps( w0 + 0*n_elem_per_reg );
+		z0v.v = _mm256_loadu_ps( z0 + 0*n_elem_per_reg );
+
+		a0v.v = _mm256_loadu_ps( a0 + 0*n_elem_per_reg );
+		a1v.v = _mm256_loadu_ps( a1 + 0*n_elem_per_reg );
+		a2v.v = _mm256_loadu_ps( a2 + 0*n_elem_per_reg );
+		a3v.v = _mm256_loadu_ps( a3 + 0*n_elem_per_reg );
+
+		// perform : rho?v += a?v * w0v;
+		rho0v.v = _mm256_fmadd_ps( a0v.v, w0v.v, rho0v.v );
+		rho1v.v = _mm256_fmadd_ps( a1v.v, w0v.v, rho1v.v );
+		rho2v.v = _mm256_fmadd_ps( a2v.v, w0v.v, rho2v.v );
+		rho3v.v = _mm256_fmadd_ps( a3v.v, w0v.v, rho3v.v );
+
+		// perform : z0v += a?v * chi?v;
+		z0v.v = _mm256_fmadd_ps( a0v.v, chi0v.v, z0v.v );
+		z0v.v = _mm256_fmadd_ps( a1v.v, chi1v.v, z0v.v );
+		z0v.v = _mm256_fmadd_ps( a2v.v, chi2v.v, z0v.v );
+		z0v.v = _mm256_fmadd_ps( a3v.v, chi3v.v, z0v.v );
+
+		// Store the output.
+		_mm256_storeu_ps( ( z0 + 0*n_elem_per_reg ), z0v.v );
+
+		w0 += n_elem_per_reg;
+		z0 += n_elem_per_reg;
+		a0 += n_elem_per_reg;
+		a1 += n_elem_per_reg;
+		a2 += n_elem_per_reg;
+		a3 += n_elem_per_reg;
+	}
+
+	// Sum the elements within each rho vector.
+	rho0 = rho0v.f[0] + rho0v.f[1] + rho0v.f[2] + rho0v.f[3] +
+	       rho0v.f[4] + rho0v.f[5] + rho0v.f[6] + rho0v.f[7];
+	rho1 = rho1v.f[0] + rho1v.f[1] + rho1v.f[2] + rho1v.f[3] +
+	       rho1v.f[4] + rho1v.f[5] + rho1v.f[6] + rho1v.f[7];
+	rho2 = rho2v.f[0] + rho2v.f[1] + rho2v.f[2] + rho2v.f[3] +
+	       rho2v.f[4] + rho2v.f[5] + rho2v.f[6] + rho2v.f[7];
+	rho3 = rho3v.f[0] + rho3v.f[1] + rho3v.f[2] + rho3v.f[3] +
+	       rho3v.f[4] + rho3v.f[5] + rho3v.f[6] + rho3v.f[7];
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// as soon as the m_left cleanup loop below if BLIS is compiled with
+	// -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < m_left ; ++i )
+	{
+		const float  w0c = *w0;
+		float        z0c = *z0;
+
+		const float  a0c = *a0;
+		const float  a1c = *a1;
+		const float  a2c = *a2;
+		const float  a3c = *a3;
+
+		rho0 += a0c * w0c;
+		rho1 += a1c * w0c;
+		rho2 += a2c * w0c;
+		rho3 += a3c * w0c;
+
+		z0c += chi0 * a0c;
+		z0c += chi1 * a1c;
+		z0c += chi2 * a2c;
+		z0c += chi3 * a3c;
+
+		*z0 = z0c;
+
+		w0 += 1;
+		z0 += 1;
+		a0 += 1;
+		a1 += 1;
+		a2 += 1;
+		a3 += 1;
+	}
+
+	// Now scale y by beta (or overwrite it if beta is zero) and add in the
+	// alpha-scaled dot products.
+	if ( PASTEMAC(s,eq0)( *beta ) )
+	{
+		PASTEMAC(s,scal2s)( *alpha, rho0, *( y + 0*incy ) );
+		PASTEMAC(s,scal2s)( *alpha, rho1, *( y + 1*incy ) );
+		PASTEMAC(s,scal2s)( *alpha, rho2, *( y + 2*incy ) );
+		PASTEMAC(s,scal2s)( *alpha, rho3, *( y + 3*incy ) );
+	}
+	else
+	{
+		PASTEMAC(s,scals)( *beta, *( y + 0*incy ) );
+		PASTEMAC(s,scals)( *beta, *( y + 1*incy ) );
+		PASTEMAC(s,scals)( *beta, *( y + 2*incy ) );
+		PASTEMAC(s,scals)( *beta, *( y + 3*incy ) );
+
+		PASTEMAC(s,axpys)( *alpha, rho0, *( y + 0*incy ) );
+		PASTEMAC(s,axpys)( *alpha, rho1, *( y + 1*incy ) );
+		PASTEMAC(s,axpys)( *alpha, rho2, *( y + 2*incy ) );
+		PASTEMAC(s,axpys)( *alpha, rho3, *( y + 3*incy ) );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_ddotxaxpyf_zen_int_4
+     (
+       conj_t           conjat,
+       conj_t           conja,
+       conj_t           conjw,
+       conj_t           conjx,
+       dim_t            m,
+       dim_t            b_n,
+       double* restrict alpha,
+       double* restrict a, inc_t inca, inc_t lda,
+       double* restrict w, inc_t incw,
+       double* restrict x, inc_t incx,
+       double* restrict beta,
+       double* restrict y, inc_t incy,
+       double* restrict z, inc_t incz,
+       cntx_t* restrict cntx
+     )
+{
+	const dim_t      fuse_fac       = 4;
+
+	const dim_t      n_elem_per_reg = 4;
+	const dim_t      n_iter_unroll  = 1;
+
+	dim_t            i;
+	dim_t            m_viter;
+	dim_t            m_left;
+
+	double* restrict a0;
+	double* restrict a1;
+	double* restrict a2;
+	double* restrict a3;
+
+	double* restrict w0;
+	double* restrict z0;
+
+	v4df_t           chi0v, chi1v, chi2v, chi3v;
+	v4df_t           rho0v, rho1v, rho2v, rho3v;
+
+	v4df_t           a0v, a1v, a2v, a3v;
+	v4df_t           w0v, z0v;
+
+	double           chi0, chi1, chi2, chi3;
+	double           rho0, rho1, rho2, rho3;
+
+	// If the b_n dimension is zero, y is empty and there is no computation.
+	if ( bli_zero_dim1( b_n ) ) return;
+
+	// If b_n is not equal to the fusing factor, or if there is anything
+	// that would interfere with our use of contiguous vector loads/stores,
+	// then perform the operation as a dotxf followed by an axpyf. Those
+	// kernels handle the remaining cases, albeit with two passes over A.
+	if ( b_n != fuse_fac || inca != 1 || incw != 1 || incz != 1 )
+	{
+		PASTECH(d,dotxf_ker_ft) kfp_df
+		=
+		bli_cntx_get_l1f_ker_dt( BLIS_DOUBLE, BLIS_DOTXF_KER, cntx );
+		PASTECH(d,axpyf_ker_ft) kfp_af
+		=
+		bli_cntx_get_l1f_ker_dt( BLIS_DOUBLE, BLIS_AXPYF_KER, cntx );
+
+		kfp_df
+		(
+		  conjat,
+		  conjw,
+		  m,
+		  b_n,
+		  alpha,
+		  a, inca, lda,
+		  w, incw,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+
+		kfp_af
+		(
+		  conja,
+		  conjx,
+		  m,
+		  b_n,
+		  alpha,
+		  a, inca, lda,
+		  x, incx,
+		  z, incz,
+		  cntx
+		);
+
+		return;
+	}
+
+	// If the m dimension is zero, or if alpha is zero, the computation
+	// simplifies to updating y.
+	if ( bli_zero_dim1( m ) || PASTEMAC(d,eq0)( *alpha ) )
+	{
+		PASTECH(d,scalv_ker_ft) f
+		=
+		bli_cntx_get_l1v_ker_dt( BLIS_DOUBLE, BLIS_SCALV_KER, cntx );
+
+		f
+		(
+		  BLIS_NO_CONJUGATE,
+		  b_n,
+		  beta,
+		  y, incy,
+		  cntx
+		);
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor
+	// and that A, w, and z are unit-stride. Each column of A is loaded only
+	// once and used for both the dotxf (y) and axpyf (z) updates.
+
+	// Use the unrolling factor and the number of elements per register
+	// to compute the number of vectorized and leftover iterations.
+	m_viter = ( m ) / ( n_elem_per_reg * n_iter_unroll );
+	m_left  = ( m ) % ( n_elem_per_reg * n_iter_unroll );
+
+	a0   = a + 0*lda;
+	a1   = a + 1*lda;
+	a2   = a + 2*lda;
+	a3   = a + 3*lda;
+	w0   = w;
+	z0   = z;
+
+	chi0 = *( x + 0*incx );
+	chi1 = *( x + 1*incx );
+	chi2 = *( x + 2*incx );
+	chi3 = *( x + 3*incx );
+
+	// Scale each chi scalar by alpha.
+	PASTEMAC(d,scals)( *alpha, chi0 );
+	PASTEMAC(d,scals)( *alpha, chi1 );
+	PASTEMAC(d,scals)( *alpha, chi2 );
+	PASTEMAC(d,scals)( *alpha, chi3 );
+
+	// Broadcast the (alpha*chi?) scalars to all elements of vector registers.
+	chi0v.v = _mm256_broadcast_sd( &chi0 );
+	chi1v.v = _mm256_broadcast_sd( &chi1 );
+	chi2v.v = _mm256_broadcast_sd( &chi2 );
+	chi3v.v = _mm256_broadcast_sd( &chi3 );
+
+	// Initialize b_n rho vector accumulators to zero.
+	rho0v.v = _mm256_setzero_pd();
+	rho1v.v = _mm256_setzero_pd();
+	rho2v.v = _mm256_setzero_pd();
+	rho3v.v = _mm256_setzero_pd();
+
+	// If there are vectorized iterations, perform them with vector
+	// instructions.
+	for ( i = 0; i < m_viter; ++i )
+	{
+		// Load the input values.
+		w0v.v = _mm256_loadu_pd( w0 + 0*n_elem_per_reg );
+		z0v.v = _mm256_loadu_pd( z0 + 0*n_elem_per_reg );
+
+		a0v.v = _mm256_loadu_pd( a0 + 0*n_elem_per_reg );
+		a1v.v = _mm256_loadu_pd( a1 + 0*n_elem_per_reg );
+		a2v.v = _mm256_loadu_pd( a2 + 0*n_elem_per_reg );
+		a3v.v = _mm256_loadu_pd( a3 + 0*n_elem_per_reg );
+
+		// perform : rho?v += a?v * w0v;
+		rho0v.v = _mm256_fmadd_pd( a0v.v, w0v.v, rho0v.v );
+		rho1v.v = _mm256_fmadd_pd( a1v.v, w0v.v, rho1v.v );
+		rho2v.v = _mm256_fmadd_pd( a2v.v, w0v.v, rho2v.v );
+		rho3v.v = _mm256_fmadd_pd( a3v.v, w0v.v, rho3v.v );
+
+		// perform : z0v += a?v * chi?v;
+		z0v.v = _mm256_fmadd_pd( a0v.v, chi0v.v, z0v.v );
+		z0v.v = _mm256_fmadd_pd( a1v.v, chi1v.v, z0v.v );
+		z0v.v = _mm256_fmadd_pd( a2v.v, chi2v.v, z0v.v );
+		z0v.v = _mm256_fmadd_pd( a3v.v, chi3v.v, z0v.v );
+
+		// Store the output.
+		_mm256_storeu_pd( ( z0 + 0*n_elem_per_reg ), z0v.v );
+
+		w0 += n_elem_per_reg;
+		z0 += n_elem_per_reg;
+		a0 += n_elem_per_reg;
+		a1 += n_elem_per_reg;
+		a2 += n_elem_per_reg;
+		a3 += n_elem_per_reg;
+	}
+
+	// Sum the elements within each rho vector.
+	rho0 = rho0v.d[0] + rho0v.d[1] + rho0v.d[2] + rho0v.d[3];
+	rho1 = rho1v.d[0] + rho1v.d[1] + rho1v.d[2] + rho1v.d[3];
+	rho2 = rho2v.d[0] + rho2v.d[1] + rho2v.d[2] + rho2v.d[3];
+	rho3 = rho3v.d[0] + rho3v.d[1] + rho3v.d[2] + rho3v.d[3];
+
+	// Issue vzeroupper instruction to clear upper lanes of ymm registers.
+	// This avoids a performance penalty caused by false dependencies when
+	// transitioning from from AVX to SSE instructions (which may occur
+	// as soon as the m_left cleanup loop below if BLIS is compiled with
+	// -mfpmath=sse).
+	_mm256_zeroupper();
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( i = 0; i < m_left ; ++i )
+	{
+		const double w0c = *w0;
+		double       z0c = *z0;
+
+		const double a0c = *a0;
+		const double a1c = *a1;
+		const double a2c = *a2;
+		const double a3c = *a3;
+
+		rho0 += a0c * w0c;
+		rho1 += a1c * w0c;
+		rho2 += a2c * w0c;
+		rho3 += a3c * w0c;
+
+		z0c += chi0 * a0c;
+		z0c += chi1 * a1c;
+		z0c += chi2 * a2c;
+		z0c += chi3 * a3c;
+
+		*z0 = z0c;
+
+		w0 += 1;
+		z0 += 1;
+		a0 += 1;
+		a1 += 1;
+		a2 += 1;
+		a3 += 1;
+	}
+
+	// Now scale y by beta (or overwrite it if beta is zero) and add in the
+	// alpha-scaled dot products.
+	if ( PASTEMAC(d,eq0)( *beta ) )
+	{
+		PASTEMAC(d,scal2s)( *alpha, rho0, *( y + 0*incy ) );
+		PASTEMAC(d,scal2s)( *alpha, rho1, *( y + 1*incy ) );
+		PASTEMAC(d,scal2s)( *alpha, rho2, *( y + 2*incy ) );
+		PASTEMAC(d,scal2s)( *alpha, rho3, *( y + 3*incy ) );
+	}
+	else
+	{
+		PASTEMAC(d,scals)( *beta, *( y + 0*incy ) );
+		PASTEMAC(d,scals)( *beta, *( y + 1*incy ) );
+		PASTEMAC(d,scals)( *beta, *( y + 2*incy ) );
+		PASTEMAC(d,scals)( *beta, *( y + 3*incy ) );
+
+		PASTEMAC(d,axpys)( *alpha, rho0, *( y + 0*incy ) );
+		PASTEMAC(d,axpys)( *alpha, rho1, *( y + 1*incy ) );
+		PASTEMAC(d,axpys)( *alpha, rho2, *( y + 2*incy ) );
+		PASTEMAC(d,axpys)( *alpha, rho3, *( y + 3*incy ) );
+	}
+}
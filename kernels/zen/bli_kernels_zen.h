@@ -68,6 +68,14 @@ SCALV_KER_PROT( double,   d, scalv_zen_int )
 
 // -- level-1f --
 
+// axpy2v (intrinsics)
+AXPY2V_KER_PROT( float,    s, axpy2v_zen_int )
+AXPY2V_KER_PROT( double,   d, axpy2v_zen_int )
+
+// dotaxpyv (intrinsics)
+DOTAXPYV_KER_PROT( float,    s, dotaxpyv_zen_int )
+DOTAXPYV_KER_PROT( double,   d, dotaxpyv_zen_int )
+
 // axpyf (intrinsics)
 AXPYF_KER_PROT( float,    s, axpyf_zen_int_8 )
 AXPYF_KER_PROT( double,   d, axpyf_zen_int_8 )
@@ -76,3 +84,7 @@ AXPYF_KER_PROT( double,   d, axpyf_zen_int_8 )
 DOTXF_KER_PROT( float,    s, dotxf_zen_int_8 )
 DOTXF_KER_PROT( double,   d, dotxf_zen_int_8 )
 
+// dotxaxpyf (intrinsics)
+DOTXAXPYF_KER_PROT( float,    s, dotxaxpyf_zen_int_4 )
+DOTXAXPYF_KER_PROT( double,   d, dotxaxpyf_zen_int_4 )
+
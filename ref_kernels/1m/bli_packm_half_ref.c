@@ -0,0 +1,82 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Reference half-precision packm kernels. Each packs a cdim x n micro-panel
+// of A, stored in bfloat16 or float16, into a micro-panel of single-precision
+// values with leading dimension ldp, widening each element as it is copied.
+// Rows cdim through ldp - 1 of the micro-panel are set to zero.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, opname, cvt, arch, suf ) \
+\
+void PASTEMAC2(opname,arch,suf) \
+     ( \
+       dim_t            cdim, \
+       dim_t            n, \
+       void*   restrict a, inc_t inca, inc_t lda, \
+       float*  restrict p,             inc_t ldp, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	ctype* restrict a_cast = a; \
+\
+	if ( inca == 1 ) \
+	{ \
+		for ( dim_t l = 0; l < n; ++l ) \
+		{ \
+			for ( dim_t i = 0; i < cdim; ++i ) \
+				p[ i + l*ldp ] = cvt( a_cast[ i + l*lda ] ); \
+			for ( dim_t i = cdim; i < ldp; ++i ) \
+				p[ i + l*ldp ] = 0.0f; \
+		} \
+	} \
+	else \
+	{ \
+		/* Walk along n in the inner loop so that row-stored micro-panels
+		   are read contiguously. */ \
+		for ( dim_t i = 0; i < cdim; ++i ) \
+			for ( dim_t l = 0; l < n; ++l ) \
+				p[ i + l*ldp ] = cvt( a_cast[ i*inca + l*lda ] ); \
+		for ( dim_t l = 0; l < n; ++l ) \
+			for ( dim_t i = cdim; i < ldp; ++i ) \
+				p[ i + l*ldp ] = 0.0f; \
+	} \
+}
+
+GENTFUNC( bfloat16, packm_bf16, bli_bf16_to_float, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+GENTFUNC( float16,  packm_fp16, bli_fp16_to_float, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
@@ -0,0 +1,149 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Reference integer gemm micro-kernels. The micro-panels of A and B are
+// packed with kr consecutive elements along k stored together for each row
+// of A (or column of B), so that one group of kr products contributes to
+// each element of the micro-tile at a time:
+//
+//   a[ g*mr*kr + i*kr + q ] = A( i, g*kr + q )
+//   b[ g*nr*kr + j*kr + q ] = B( g*kr + q, j )
+//
+// The micro-kernels compute
+//
+//   C := beta * C + alpha * ( A * B + ra * 1^T + 1 * cb^T )
+//
+// where ra and cb are vectors of length mr and nr, respectively. All int32
+// arithmetic wraps modulo 2^32. The way each group of products is summed
+// mirrors the x86 vpmaddubsw/vpmaddwd instructions so that the optimized
+// kernels produce identical results: for u8s8s32, adjacent pairs of
+// products are summed with saturation to int16 before being widened.
+//
+
+BLIS_INLINE uint32_t bli_gemmi_u8s8s32_dotgrp
+     (
+       const uint8_t* restrict a,
+       const int8_t*  restrict b
+     )
+{
+	int32_t t0 = ( int32_t )a[0] * b[0] + ( int32_t )a[1] * b[1];
+	int32_t t1 = ( int32_t )a[2] * b[2] + ( int32_t )a[3] * b[3];
+
+	t0 = bli_min( bli_max( t0, INT16_MIN ), INT16_MAX );
+	t1 = bli_min( bli_max( t1, INT16_MIN ), INT16_MAX );
+
+	return ( uint32_t )( t0 + t1 );
+}
+
+BLIS_INLINE uint32_t bli_gemmi_s16s16s32_dotgrp
+     (
+       const int16_t* restrict a,
+       const int16_t* restrict b
+     )
+{
+	return ( uint32_t )( ( int32_t )a[0] * b[0] ) +
+	       ( uint32_t )( ( int32_t )a[1] * b[1] );
+}
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype_a, ctype_b, opname, arch, suf, mr, nr, kr ) \
+\
+void PASTEMAC2(opname,arch,suf) \
+     ( \
+       dim_t               k, \
+       int32_t*   restrict alpha, \
+       ctype_a*   restrict a, \
+       ctype_b*   restrict b, \
+       int32_t*   restrict beta, \
+       int32_t*   restrict c, inc_t rs_c, inc_t cs_c, \
+       int32_t*   restrict ra, \
+       int32_t*   restrict cb, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	uint32_t        ab[ mr * nr ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const uint32_t  alpha_u = ( uint32_t )*alpha; \
+	const uint32_t  beta_u  = ( uint32_t )*beta; \
+\
+	/* Initialize the accumulator elements in ab to zero. */ \
+	PRAGMA_SIMD \
+	for ( dim_t i = 0; i < mr * nr; ++i ) ab[ i ] = 0; \
+\
+	/* Accumulate one group of kr products into each element at a time. */ \
+	for ( dim_t g = 0; g < k / kr; ++g ) \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		{ \
+			PRAGMA_SIMD \
+			for ( dim_t j = 0; j < nr; ++j ) \
+				ab[ i*nr + j ] += PASTEMAC(opname,_dotgrp)( a + i*kr, b + j*kr ); \
+		} \
+\
+		a += mr * kr; \
+		b += nr * kr; \
+	} \
+\
+	/* Apply the row and column offsets and scale by alpha. */ \
+	for ( dim_t i = 0; i < mr; ++i ) \
+	{ \
+		PRAGMA_SIMD \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			ab[ i*nr + j ] = alpha_u * ( ab[ i*nr + j ] + ( uint32_t )ra[ i ] \
+			                                            + ( uint32_t )cb[ j ] ); \
+	} \
+\
+	/* Output/accumulate the result in ab based on the value of beta. */ \
+	if ( beta_u == 0 ) \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			c[ i*rs_c + j*cs_c ] = ( int32_t )ab[ i*nr + j ]; \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < mr; ++i ) \
+		for ( dim_t j = 0; j < nr; ++j ) \
+			c[ i*rs_c + j*cs_c ] = ( int32_t )( beta_u * ( uint32_t )c[ i*rs_c + j*cs_c ] \
+			                                    + ab[ i*nr + j ] ); \
+	} \
+}
+
+GENTFUNC( uint8_t, int8_t,  gemmi_u8s8s32,   BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, 4, 16, 4 )
+GENTFUNC( int16_t, int16_t, gemmi_s16s16s32, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, 4, 16, 2 )
+
@@ -0,0 +1,138 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// Reference multi-target gemm micro-kernels. Each call computes the product
+// of an MR x k micro-panel of A and a k x NR micro-panel of B, both packed
+// as for the native gemm micro-kernel, and adds it to each of nterm
+// micro-tiles of C with its own scalar:
+//
+//   C_t := C_t + alpha[ t ] * A * B,  t = 0:nterm-1,
+//
+// where C_t is the m x n micro-tile at c[ t ] with strides rs_c and cs_c,
+// and m <= MR, n <= NR. Since the register blocksizes differ from one
+// configuration to another, they are queried from the context so that the
+// same reference kernel pairs with any native gemm micro-kernel.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       dim_t               nterm, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype**    restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	const num_t     dt     = PASTEMAC(ch,type); \
+\
+	const inc_t     packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const inc_t     packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+\
+	ctype           ab[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t     rs_ab  = n; \
+	const inc_t     cs_ab  = 1; \
+\
+	/* Initialize the accumulator elements in ab to zero. */ \
+	for ( dim_t i = 0; i < m * n; ++i ) \
+	{ \
+		PASTEMAC(ch,set0s)( ab[ i ] ); \
+	} \
+\
+	/* Perform a series of k rank-1 updates into ab. */ \
+	for ( dim_t l = 0; l < k; ++l ) \
+	{ \
+		for ( dim_t i = 0; i < m; ++i ) \
+		{ \
+			PRAGMA_SIMD \
+			for ( dim_t j = 0; j < n; ++j ) \
+			{ \
+				PASTEMAC(ch,dots) \
+				( \
+				  a[ i ], \
+				  b[ j ], \
+				  ab[ i*rs_ab + j*cs_ab ]  \
+				); \
+			} \
+		} \
+\
+		a += packmr; \
+		b += packnr; \
+	} \
+\
+	/* Accumulate the scaled result into each micro-tile of C. */ \
+	for ( dim_t t = 0; t < nterm; ++t ) \
+	{ \
+		ctype* restrict ct = c[ t ]; \
+\
+		if ( cs_c == 1 ) \
+		{ \
+			for ( dim_t i = 0; i < m; ++i ) \
+			for ( dim_t j = 0; j < n; ++j ) \
+			PASTEMAC(ch,axpys) \
+			( \
+			  alpha[ t ], \
+			  ab[ i*rs_ab + j*cs_ab ], \
+			  ct[ i*rs_c  + j*1     ]  \
+			); \
+		} \
+		else \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+			PASTEMAC(ch,axpys) \
+			( \
+			  alpha[ t ], \
+			  ab[ i*rs_ab + j*cs_ab ], \
+			  ct[ i*rs_c  + j*cs_c  ]  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC2( gemmsum, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,136 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// Reference spmm micro-kernels. Each call updates nr columns of one row of
+// C with the product of one row of a sparse (CSR) matrix A and a micro-panel
+// of B packed as nr-wide rows:
+//
+//   c[ j ] := beta * c[ j ] + alpha * sum_p val[ p ] * b[ col_ind[ p ]*rs_b + j ]
+//
+// for p = 0:nnz-1 and j = 0:n-1, where n <= nr. The packed micro-panel is
+// padded with zeros to nr columns, so all nr columns are computed and only
+// the first n are stored. Two sets of accumulators are used for alternating
+// nonzeros so that consecutive updates do not depend on one another.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf, nr ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t               n, \
+       dim_t               nnz, \
+       ctype*     restrict alpha, \
+       gint_t*    restrict col_ind, \
+       ctype*     restrict val, \
+       ctype*     restrict b, inc_t rs_b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	ctype           ab0[ nr ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	ctype           ab1[ nr ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+	/* Initialize the accumulator elements to zero. */ \
+	PRAGMA_SIMD \
+	for ( dim_t j = 0; j < nr; ++j ) \
+	{ \
+		PASTEMAC(ch,set0s)( ab0[ j ] ); \
+		PASTEMAC(ch,set0s)( ab1[ j ] ); \
+	} \
+\
+	/* Accumulate the rows of b selected by the column indices, two at
+	   a time. */ \
+	dim_t p = 0; \
+\
+	for ( ; p + 1 < nnz; p += 2 ) \
+	{ \
+		const ctype* restrict b0 = b + col_ind[ p + 0 ] * rs_b; \
+		const ctype* restrict b1 = b + col_ind[ p + 1 ] * rs_b; \
+		const ctype           v0 = val[ p + 0 ]; \
+		const ctype           v1 = val[ p + 1 ]; \
+\
+		PRAGMA_SIMD \
+		for ( dim_t j = 0; j < nr; ++j ) \
+		{ \
+			PASTEMAC(ch,dots)( v0, b0[ j ], ab0[ j ] ); \
+			PASTEMAC(ch,dots)( v1, b1[ j ], ab1[ j ] ); \
+		} \
+	} \
+\
+	if ( p < nnz ) \
+	{ \
+		const ctype* restrict b0 = b + col_ind[ p ] * rs_b; \
+		const ctype           v0 = val[ p ]; \
+\
+		PRAGMA_SIMD \
+		for ( dim_t j = 0; j < nr; ++j ) \
+		{ \
+			PASTEMAC(ch,dots)( v0, b0[ j ], ab0[ j ] ); \
+		} \
+	} \
+\
+	/* Combine the accumulators and scale the result by alpha. */ \
+	PRAGMA_SIMD \
+	for ( dim_t j = 0; j < nr; ++j ) \
+	{ \
+		PASTEMAC(ch,adds)( ab1[ j ], ab0[ j ] ); \
+		PASTEMAC(ch,scals)( *alpha, ab0[ j ] ); \
+	} \
+\
+	/* Output/accumulate the result based on the value of beta. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		PASTEMAC(ch,copys)( ab0[ j ], c[ j*cs_c ] ); \
+	} \
+	else \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		PASTEMAC(ch,xpbys)( ab0[ j ], *beta, c[ j*cs_c ] ); \
+	} \
+}
+
+GENTFUNC( float,    s, spmm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, 16 )
+GENTFUNC( double,   d, spmm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, 8 )
+GENTFUNC( scomplex, c, spmm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, 8 )
+GENTFUNC( dcomplex, z, spmm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, 4 )
+
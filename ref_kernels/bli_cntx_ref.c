@@ -144,6 +144,31 @@
 // Include the small/unpacked kernel API template.
 #include "bli_l3_sup_ker.h"
 
+// -- Level-3 integer micro-kernel prototype definitions -----------------------
+
+GEMMI_UKR_PROT( uint8_t, int8_t,  GENARNAME(gemmi_u8s8s32) )
+GEMMI_UKR_PROT( int16_t, int16_t, GENARNAME(gemmi_s16s16s32) )
+
+// -- Level-3 spmm micro-kernel prototype definitions --------------------------
+
+#undef  spmm_ukr_name
+#define spmm_ukr_name       GENARNAME(spmm)
+
+#undef  GENTPROT
+#define GENTPROT SPMM_UKR_PROT
+
+INSERT_GENTPROT_BASIC0( spmm_ukr_name )
+
+// -- Level-3 multi-target gemm micro-kernel prototype definitions -------------
+
+#undef  gemmsum_ukr_name
+#define gemmsum_ukr_name    GENARNAME(gemmsum)
+
+#undef  GENTPROT
+#define GENTPROT GEMMSUM_UKR_PROT
+
+INSERT_GENTPROT_BASIC0( gemmsum_ukr_name )
+
 // -- Level-1m (packm/unpackm) kernel prototype redefinitions ------------------
 
 #undef  packm_2xk_ker_name
@@ -167,6 +192,9 @@
 #undef  packm_24xk_ker_name
 #define packm_24xk_ker_name GENARNAME(packm_24xk)
 
+PACKM_HALF_KER_PROT( GENARNAME(packm_bf16) )
+PACKM_HALF_KER_PROT( GENARNAME(packm_fp16) )
+
 #undef  unpackm_2xk_ker_name
 #define unpackm_2xk_ker_name  GENARNAME(unpackm_2xk)
 #undef  unpackm_4xk_ker_name
@@ -465,6 +493,14 @@ void GENBARNAME(cntx_init)
 	// Set the gemm slot to the default gemm sup handler.
 	vfuncs[ BLIS_GEMM ] = bli_gemmsup_ref;
 
+	// Set the herk and syrk slots to the default sup handler for operations
+	// that update one triangle of C.
+	vfuncs[ BLIS_HERK ] = bli_gemmtsup_ref;
+	vfuncs[ BLIS_SYRK ] = bli_gemmtsup_ref;
+
+	// Set the trsm slot to the default trsm sup handler.
+	vfuncs[ BLIS_TRSM ] = bli_trsmsup_ref;
+
 
 	// -- Set level-3 small/unpacked micro-kernels and preferences -------------
 
@@ -515,6 +551,39 @@ void GENBARNAME(cntx_init)
 	bli_mbool_init( &mbools[ BLIS_XXX ],  TRUE,  TRUE,  TRUE,  TRUE );
 
 
+	// -- Set level-3 integer micro-kernels and blocksizes ---------------------
+
+	// The reference kernels are instantiated with mr = 4 and nr = 16.
+	bli_cntx_set_l3_gemmi_ukr
+	(
+	  BLIS_GEMMI_U8S8S32,   GENBARNAME(gemmi_u8s8s32),   4, 16, 256, 512, 4096,
+	  cntx
+	);
+	bli_cntx_set_l3_gemmi_ukr
+	(
+	  BLIS_GEMMI_S16S16S32, GENBARNAME(gemmi_s16s16s32), 4, 16, 128, 256, 4096,
+	  cntx
+	);
+
+
+	// -- Set level-3 spmm micro-kernels ---------------------------------------
+
+	// The reference kernels are instantiated with nr = 16, 8, 8, and 4.
+	bli_cntx_set_l3_spmm_ukr( BLIS_FLOAT,    GENBARNAME(sspmm), 16, cntx );
+	bli_cntx_set_l3_spmm_ukr( BLIS_DOUBLE,   GENBARNAME(dspmm),  8, cntx );
+	bli_cntx_set_l3_spmm_ukr( BLIS_SCOMPLEX, GENBARNAME(cspmm),  8, cntx );
+	bli_cntx_set_l3_spmm_ukr( BLIS_DCOMPLEX, GENBARNAME(zspmm),  4, cntx );
+
+
+	// -- Set level-3 multi-target gemm micro-kernels --------------------------
+
+	// The reference kernels query the register blocksizes from the context.
+	bli_cntx_set_l3_gemmsum_ukr( BLIS_FLOAT,    GENBARNAME(sgemmsum), cntx );
+	bli_cntx_set_l3_gemmsum_ukr( BLIS_DOUBLE,   GENBARNAME(dgemmsum), cntx );
+	bli_cntx_set_l3_gemmsum_ukr( BLIS_SCOMPLEX, GENBARNAME(cgemmsum), cntx );
+	bli_cntx_set_l3_gemmsum_ukr( BLIS_DCOMPLEX, GENBARNAME(zgemmsum), cntx );
+
+
 	// -- Set level-1f kernels -------------------------------------------------
 
 	funcs = bli_cntx_l1f_kers_buf( cntx );
@@ -584,6 +653,11 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_UNPACKM_14XK_KER ], unpackm_14xk_ker_name );
 	gen_func_init( &funcs[ BLIS_UNPACKM_16XK_KER ], unpackm_16xk_ker_name );
 
+	// The half-precision packm kernels are instantiated with a scalar loop
+	// that handles any micro-panel dimension.
+	bli_cntx_set_packm_half_ker( BLIS_HALF_BF16, GENBARNAME(packm_bf16), cntx );
+	bli_cntx_set_packm_half_ker( BLIS_HALF_FP16, GENBARNAME(packm_fp16), cntx );
+
 
 	// -- Set miscellaneous fields ---------------------------------------------
 
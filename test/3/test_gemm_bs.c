@@ -0,0 +1,226 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+//
+// A performance study of block-sparse gemm. For each problem size, A is
+// filled with random values and then a random subset of its BS x BS blocks
+// (a fraction 1 - DENSITY of them) is set to zero. Conventional (dense)
+// gemm is timed along with gemm after a block map that identifies the
+// nonzero blocks of A is attached. The reported gflops are "effective"
+// rates (based on 2mnk flops in both cases) and are followed by the
+// largest difference between the two results, relative to the largest
+// element of the dense result.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+#define BS      64
+#define DENSITY 0.3
+
+int main( int argc, char** argv )
+{
+	obj_t    a, b, c;
+	obj_t    c_save, c_ref;
+	obj_t    alpha, beta;
+	obj_t    norm;
+	obj_t    a_blk;
+	blkmap_t map;
+	dim_t    m, n, k;
+	dim_t    p;
+	dim_t    p_begin, p_max, p_inc;
+	int      m_input, n_input, k_input;
+	num_t    dt, dt_r;
+	char     dt_ch;
+	int      r, n_repeats;
+	rntm_t   rntm;
+
+	double   dtime;
+	double   dtime_save;
+	double   gflops[ 2 ];
+	double   diff;
+	double   norm_ref, norm_i;
+
+	n_repeats = 3;
+
+	dt      = DT;
+	dt_r    = bli_dt_proj_to_real( dt );
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	m_input = -1;
+	n_input = -1;
+	k_input = -1;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	srand( 1 );
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cgemm_bs", THR_STR, dt_ch );
+	printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %5.2f %7.2f %7.2f %8.1e ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		if ( m_input < 0 ) m = p / ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+		if ( n_input < 0 ) n = p / ( dim_t )abs(n_input);
+		else               n =     ( dim_t )    n_input;
+		if ( k_input < 0 ) k = p / ( dim_t )abs(k_input);
+		else               k =     ( dim_t )    k_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt_r, 1, 1, 0, 0, &norm );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+	#else
+		bli_obj_create( dt, m, k, k, 1, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c );
+		bli_obj_create( dt, m, n, n, 1, &c_save );
+		bli_obj_create( dt, m, n, n, 1, &c_ref );
+	#endif
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		// Zero out a random subset of the blocks of A.
+		for ( dim_t j = 0; j < k; j += BS )
+		for ( dim_t i = 0; i < m; i += BS )
+		{
+			if ( rand() < DENSITY * RAND_MAX ) continue;
+
+			bli_acquire_mpart( i, j, bli_min( BS, m - i ), bli_min( BS, k - j ),
+			                   &a, &a_blk );
+			bli_setm( &BLIS_ZERO, &a_blk );
+		}
+
+		bli_setsc(  (2.0/1.0), 0.0, &alpha );
+		bli_setsc(  (1.0/1.0), 0.0, &beta );
+
+		bli_copym( &c, &c_save );
+
+		// Use the threading parameters given by the environment, if any.
+		bli_rntm_init_from_global( &rntm );
+
+		for ( int sparse = 0; sparse < 2; ++sparse )
+		{
+			// For the second pass, attach a map of the nonzero blocks of A.
+			if ( sparse )
+			{
+				bli_blkmap_create_from_obj( BS, BS, &a, &map );
+				bli_obj_set_blkmap( &map, &a );
+			}
+
+			dtime_save = DBL_MAX;
+
+			for ( r = 0; r < n_repeats; ++r )
+			{
+				bli_copym( &c_save, &c );
+
+				dtime = bli_clock();
+
+				bli_gemm_ex( &alpha,
+				             &a,
+				             &b,
+				             &beta,
+				             &c,
+				             NULL,
+				             &rntm );
+
+				dtime_save = bli_clock_min_diff( dtime_save, dtime );
+			}
+
+			gflops[ sparse ] = ( 2.0 * m * k * n ) / ( dtime_save * 1.0e9 );
+		}
+
+		// Measure the difference of the block-sparse result from the dense
+		// result.
+		bli_obj_set_blkmap( NULL, &a );
+		bli_copym( &c_save, &c_ref );
+		bli_gemm_ex( &alpha, &a, &b, &beta, &c_ref, NULL, &rntm );
+		bli_normim( &c_ref, &norm );
+		bli_getsc( &norm, &norm_ref, &norm_i );
+		bli_subm( &c_ref, &c );
+		bli_normim( &c, &norm );
+		bli_getsc( &norm, &diff, &norm_i );
+		diff /= norm_ref;
+
+		printf( "data_%s_%cgemm_bs", THR_STR, dt_ch );
+		printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %5.2f %7.2f %7.2f %8.1e ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        ( double )bli_blkmap_nnz_blks( &map ) /
+		        ( double )( bli_blkmap_num_blk_rows( &map ) *
+		                    bli_blkmap_num_blk_cols( &map ) ),
+		        gflops[ 0 ], gflops[ 1 ], diff );
+
+		bli_blkmap_free( &map );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &norm );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_ref );
+	}
+
+	return 0;
+}
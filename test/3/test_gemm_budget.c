@@ -0,0 +1,230 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include <unistd.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "blis.h"
+
+//
+// A study of the core budget. NUM_APP_THREADS application threads each
+// repeatedly call multithreaded gemm (with BLIS_NUM_THREADS threads) on
+// their own copy of C, all at the same time, first with the core budget
+// disabled and then with a budget equal to the number of online cores. The
+// reported gflops are the aggregate rates over all application threads for
+// each, followed by the largest difference between any thread's result and
+// that of a single ordinary call, which should be zero.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+#define NUM_APP_THREADS 4
+
+typedef struct
+{
+	obj_t* alpha;
+	obj_t* a;
+	obj_t* b;
+	obj_t* beta;
+	obj_t* c;
+	int    n_repeats;
+} budget_args_t;
+
+static void* budget_thread( void* args_p )
+{
+	budget_args_t* args = args_p;
+
+	for ( int r = 0; r < args->n_repeats; ++r )
+		bli_gemm( args->alpha, args->a, args->b, args->beta, args->c );
+
+	return NULL;
+}
+
+static double run_callers( budget_args_t* args )
+{
+	pthread_t threads[ NUM_APP_THREADS ];
+	double    dtime = bli_clock();
+
+	for ( int t = 0; t < NUM_APP_THREADS; ++t )
+		pthread_create( &threads[ t ], NULL, budget_thread, &args[ t ] );
+
+	for ( int t = 0; t < NUM_APP_THREADS; ++t )
+		pthread_join( threads[ t ], NULL );
+
+	return bli_clock() - dtime;
+}
+
+int main( int argc, char** argv )
+{
+	obj_t         a, b, c[ NUM_APP_THREADS ], c_ref;
+	obj_t         alpha, beta, diff;
+	budget_args_t args[ NUM_APP_THREADS ];
+	dim_t         m, n, k;
+	dim_t         p;
+	dim_t         p_begin, p_max, p_inc;
+	int           m_input, n_input, k_input;
+	num_t         dt;
+	char          dt_ch;
+	int           n_repeats;
+	dim_t         n_cores;
+
+	double        dtime_free;
+	double        dtime_budget;
+	double        gflops_free;
+	double        gflops_budget;
+	double        resid, resid_i, resid_max;
+
+	n_repeats = 4;
+
+	dt      = DT;
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	m_input = -1;
+	n_input = -1;
+	k_input = -1;
+
+	n_cores = ( dim_t )sysconf( _SC_NPROCESSORS_ONLN );
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cgemm_budget", THR_STR, dt_ch );
+	printf( "( %2lu, 1:6 ) = [ %4lu %4lu %4lu %7.2f %7.2f %8.2e ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		if ( m_input < 0 ) m = p / ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+		if ( n_input < 0 ) n = p / ( dim_t )abs(n_input);
+		else               n =     ( dim_t )    n_input;
+		if ( k_input < 0 ) k = p / ( dim_t )abs(k_input);
+		else               k =     ( dim_t )    k_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt, 1, 1, 0, 0, &diff );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+	#else
+		bli_obj_create( dt, m, k, k, 1, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c_ref );
+	#endif
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c_ref );
+
+		// Use a beta of zero so that every call computes the same result.
+		bli_setsc(  (1.0/1.0), 0.0, &alpha );
+		bli_setsc(  (0.0/1.0), 0.0, &beta );
+
+		for ( int t = 0; t < NUM_APP_THREADS; ++t )
+		{
+			bli_obj_create_conf_to( &c_ref, &c[ t ] );
+			bli_copym( &c_ref, &c[ t ] );
+
+			args[ t ].alpha     = &alpha;
+			args[ t ].a         = &a;
+			args[ t ].b         = &b;
+			args[ t ].beta      = &beta;
+			args[ t ].c         = &c[ t ];
+			args[ t ].n_repeats = n_repeats;
+		}
+
+		bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+
+		// Time the callers with the core budget disabled, and then with a
+		// budget of one core per online core.
+		bli_thread_set_core_budget( 0 );
+		dtime_free = run_callers( args );
+
+		bli_thread_set_core_budget( n_cores );
+		dtime_budget = run_callers( args );
+
+		bli_thread_set_core_budget( 0 );
+
+		gflops_free   = ( 2.0 * m * k * n * NUM_APP_THREADS * n_repeats ) /
+		                ( dtime_free * 1.0e9 );
+		gflops_budget = ( 2.0 * m * k * n * NUM_APP_THREADS * n_repeats ) /
+		                ( dtime_budget * 1.0e9 );
+
+		// Compare the result of each caller against the reference.
+		resid_max = 0.0;
+
+		for ( int t = 0; t < NUM_APP_THREADS; ++t )
+		{
+			bli_subm( &c_ref, &c[ t ] );
+			bli_normfm( &c[ t ], &diff );
+			bli_getsc( &diff, &resid, &resid_i );
+
+			resid_max = bli_max( resid_max, resid );
+
+			bli_obj_free( &c[ t ] );
+		}
+
+		printf( "data_%s_%cgemm_budget", THR_STR, dt_ch );
+		printf( "( %2lu, 1:6 ) = [ %4lu %4lu %4lu %7.2f %7.2f %8.2e ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        gflops_free, gflops_budget, resid_max );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &diff );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c_ref );
+	}
+
+	return 0;
+}
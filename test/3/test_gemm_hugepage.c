@@ -0,0 +1,248 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// syscall() is a GNU extension.
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#include "blis.h"
+
+//
+// A study of the effect of backing the packing block pools with huge pages.
+// The pools are configured once, when BLIS is initialized, so the driver
+// measures whichever mode is in effect; run it once with BLIS_HUGEPAGES=0
+// and once with BLIS_HUGEPAGES=1 and compare. For each problem size, the
+// gflops of the fastest repetition is reported along with the smallest
+// number of dTLB load misses (per million flops) seen in any repetition. On
+// systems where hardware counters are unavailable (non-Linux, or when
+// perf_event_paranoid forbids access), the miss column reads -1.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+#ifdef __linux__
+static int dtlb_open( void )
+{
+	struct perf_event_attr attr;
+
+	memset( &attr, 0, sizeof( attr ) );
+
+	attr.type           = PERF_TYPE_HW_CACHE;
+	attr.size           = sizeof( attr );
+	attr.config         = PERF_COUNT_HW_CACHE_DTLB |
+	                      ( PERF_COUNT_HW_CACHE_OP_READ     <<  8 ) |
+	                      ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+	attr.disabled       = 1;
+	attr.inherit        = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv     = 1;
+
+	return ( int )syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+}
+
+static void dtlb_start( int fd )
+{
+	if ( fd < 0 ) return;
+	ioctl( fd, PERF_EVENT_IOC_RESET, 0 );
+	ioctl( fd, PERF_EVENT_IOC_ENABLE, 0 );
+}
+
+static double dtlb_stop( int fd )
+{
+	long long count;
+
+	if ( fd < 0 ) return -1.0;
+	ioctl( fd, PERF_EVENT_IOC_DISABLE, 0 );
+	if ( read( fd, &count, sizeof( count ) ) != sizeof( count ) ) return -1.0;
+
+	return ( double )count;
+}
+#else
+static int    dtlb_open( void )     { return -1; }
+static void   dtlb_start( int fd )  { ( void )fd; }
+static double dtlb_stop( int fd )   { ( void )fd; return -1.0; }
+#endif
+
+int main( int argc, char** argv )
+{
+	obj_t    a, b, c;
+	obj_t    c_save;
+	obj_t    alpha, beta;
+	dim_t    m, n, k;
+	dim_t    p;
+	dim_t    p_begin, p_max, p_inc;
+	int      m_input, n_input, k_input;
+	num_t    dt;
+	char     dt_ch;
+	int      r, n_repeats;
+	int      fd;
+
+	double   dtime;
+	double   dtime_save;
+	double   misses;
+	double   misses_save;
+	double   gflops;
+	double   mpmf;
+
+	n_repeats = 3;
+
+	dt      = DT;
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	m_input = -1;
+	n_input = -1;
+	k_input = -1;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	// Initialize BLIS so that the pool mode can be queried up-front.
+	bli_init();
+
+	fd = dtlb_open();
+
+	printf( "%% huge pages for packing blocks: %d\n",
+	        ( int )bli_membrk_hugepages_enabled() );
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cgemm_hugepage_%d", THR_STR, dt_ch,
+	        ( int )bli_membrk_hugepages_enabled() );
+	printf( "( %2lu, 1:5 ) = [ %4lu %4lu %4lu %7.2f %9.2f ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		if ( m_input < 0 ) m = p / ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+		if ( n_input < 0 ) n = p / ( dim_t )abs(n_input);
+		else               n =     ( dim_t )    n_input;
+		if ( k_input < 0 ) k = p / ( dim_t )abs(k_input);
+		else               k =     ( dim_t )    k_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+	#else
+		bli_obj_create( dt, m, k, k, 1, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c );
+		bli_obj_create( dt, m, n, n, 1, &c_save );
+	#endif
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		bli_setsc(  (2.0/1.0), 0.0, &alpha );
+		bli_setsc(  (1.0/1.0), 0.0, &beta );
+
+		bli_copym( &c, &c_save );
+
+		dtime_save  = DBL_MAX;
+		misses_save = -1.0;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c_save, &c );
+
+			dtlb_start( fd );
+
+			dtime = bli_clock();
+
+			bli_gemm( &alpha,
+			          &a,
+			          &b,
+			          &beta,
+			          &c );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+
+			misses = dtlb_stop( fd );
+
+			// Like the time, keep the smallest miss count observed.
+			if ( misses_save < 0.0 || misses < misses_save )
+				misses_save = misses;
+		}
+
+		gflops = ( 2.0 * m * k * n ) / ( dtime_save * 1.0e9 );
+
+		if ( misses_save < 0.0 ) mpmf = -1.0;
+		else                     mpmf = misses_save /
+		                                ( 2.0 * m * k * n / 1.0e6 );
+
+		printf( "data_%s_%cgemm_hugepage_%d", THR_STR, dt_ch,
+		        ( int )bli_membrk_hugepages_enabled() );
+		printf( "( %2lu, 1:5 ) = [ %4lu %4lu %4lu %7.2f %9.2f ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        gflops, mpmf );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+	}
+
+	if ( fd >= 0 ) close( fd );
+
+	return 0;
+}
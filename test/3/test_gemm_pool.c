@@ -0,0 +1,198 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+//
+// A study of the packing block allocator's size classes. Each iteration
+// alternates between gemm using the default context and gemm using a copy
+// of it whose cache blocksizes MC and KC have been quadrupled, so the two
+// shapes require packed blocks of different sizes. (The pools are sized up
+// front for the largest datatype, so a smaller factor may not be enough to
+// exceed that size.) The reported gflops is
+// the average rate over all iterations of both shapes, followed by the
+// number of times the pools for A and B had to be reinitialized (freeing
+// and reallocating their blocks) and the number of size classes in use for
+// A. Run with BLIS_POOL_SIZE_CLASSES=1 to reproduce a single block size per
+// pool, where the first request for larger blocks reinitializes the pool,
+// discarding the blocks already allocated, and where the smaller shape then
+// packs into the larger blocks.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+int main( int argc, char** argv )
+{
+	obj_t    a, b, c;
+	obj_t    alpha, beta;
+	dim_t    m, n, k;
+	dim_t    p;
+	dim_t    p_begin, p_max, p_inc;
+	int      m_input, n_input, k_input;
+	num_t    dt;
+	char     dt_ch;
+	int      r, n_repeats;
+	cntx_t   cntx_big;
+	cntx_t*  cntx_def;
+
+	double   dtime;
+	double   dtime_sum;
+	double   gflops;
+	siz_t    reinits_a, reinits_b;
+
+	n_repeats = 10;
+
+	dt      = DT;
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	m_input = -1;
+	n_input = -1;
+	k_input = -1;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	// Make a copy of the default context with larger cache blocksizes.
+	cntx_def = bli_gks_query_cntx();
+	cntx_big = *cntx_def;
+
+	{
+		const bszid_t bszids[ 2 ] = { BLIS_MC, BLIS_KC };
+
+		for ( dim_t i = 0; i < 2; ++i )
+		{
+			blksz_t* bs = bli_cntx_get_blksz( bszids[ i ], &cntx_big );
+
+			bli_blksz_set_def( 4 * bli_blksz_get_def( dt, bs ), dt, bs );
+			bli_blksz_set_max( 4 * bli_blksz_get_max( dt, bs ), dt, bs );
+		}
+	}
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cgemm_pool", THR_STR, dt_ch );
+	printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %7.2f %5lu %5lu %2lu ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		if ( m_input < 0 ) m = p / ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+		if ( n_input < 0 ) n = p / ( dim_t )abs(n_input);
+		else               n =     ( dim_t )    n_input;
+		if ( k_input < 0 ) k = p / ( dim_t )abs(k_input);
+		else               k =     ( dim_t )    k_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+	#else
+		bli_obj_create( dt, m, k, k, 1, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c );
+	#endif
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		bli_setsc(  (1.0/1.0), 0.0, &alpha );
+		bli_setsc(  (0.0/1.0), 0.0, &beta );
+
+		reinits_a = bli_membrk_num_reinits( BLIS_BUFFER_FOR_A_BLOCK );
+		reinits_b = bli_membrk_num_reinits( BLIS_BUFFER_FOR_B_PANEL );
+
+		dtime_sum = 0.0;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			cntx_t* cntx = ( r % 2 == 0 ? cntx_def : &cntx_big );
+
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha,
+			             &a,
+			             &b,
+			             &beta,
+			             &c,
+			             cntx,
+			             NULL );
+
+			dtime_sum += bli_clock() - dtime;
+		}
+
+		reinits_a = bli_membrk_num_reinits( BLIS_BUFFER_FOR_A_BLOCK ) - reinits_a;
+		reinits_b = bli_membrk_num_reinits( BLIS_BUFFER_FOR_B_PANEL ) - reinits_b;
+
+		gflops = ( 2.0 * m * k * n * n_repeats ) / ( dtime_sum * 1.0e9 );
+
+		printf( "data_%s_%cgemm_pool", THR_STR, dt_ch );
+		printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %7.2f %5lu %5lu %2lu ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        gflops,
+		        ( unsigned long )reinits_a,
+		        ( unsigned long )reinits_b,
+		        ( unsigned long )bli_membrk_num_size_classes( BLIS_BUFFER_FOR_A_BLOCK ) );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+	}
+
+	return 0;
+}
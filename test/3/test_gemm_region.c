@@ -0,0 +1,221 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include <unistd.h>
+#include "blis.h"
+
+//
+// A study of thread regions. For each problem size, a short solver-like
+// sequence (trsm, gemm, herk, gemm) is run many times, first with every
+// operation forking and joining its own threads and then inside a thread
+// region, where one team of BLIS_NUM_THREADS threads executes all of them.
+// The average time per sequence (in microseconds) is reported for each, along
+// with the largest difference between the two results, which should be zero.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+static void run_seq( obj_t* alpha, obj_t* beta, obj_t* l, obj_t* a,
+                     obj_t* b, obj_t* c, obj_t* h )
+{
+	bli_trsm( BLIS_LEFT, alpha, l, b );
+	bli_gemm( alpha, a, b, beta, c );
+	bli_herk( alpha, a, beta, h );
+	bli_gemm( alpha, h, c, beta, b );
+}
+
+int main( int argc, char** argv )
+{
+	obj_t    a, l, b, c, h;
+	obj_t    b0, c0, h0;
+	obj_t    b1, c1, h1;
+	obj_t    alpha, beta, diff, scale;
+	dim_t    m;
+	dim_t    p;
+	dim_t    p_begin, p_max, p_inc;
+	int      m_input;
+	num_t    dt;
+	char     dt_ch;
+	int      r, n_repeats;
+
+	double   dtime;
+	double   dtime_fork;
+	double   dtime_region;
+	double   resid, resid_i;
+
+	n_repeats = 20;
+
+	dt      = DT;
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	m_input = -1;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cgemm_region", THR_STR, dt_ch );
+	printf( "( %2lu, 1:4 ) = [ %4lu %9.2f %9.2f %8.2e ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0, 0.0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		if ( m_input < 0 ) m = p / ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt, 1, 1, 0, 0, &diff );
+		bli_obj_create( dt, 1, 1, 0, 0, &scale );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, m, m, 0, 0, &a );
+		bli_obj_create( dt, m, m, 0, 0, &l );
+		bli_obj_create( dt, m, m, 0, 0, &b );
+		bli_obj_create( dt, m, m, 0, 0, &c );
+		bli_obj_create( dt, m, m, 0, 0, &h );
+	#else
+		bli_obj_create( dt, m, m, m, 1, &a );
+		bli_obj_create( dt, m, m, m, 1, &l );
+		bli_obj_create( dt, m, m, m, 1, &b );
+		bli_obj_create( dt, m, m, m, 1, &c );
+		bli_obj_create( dt, m, m, m, 1, &h );
+	#endif
+
+		bli_obj_create_conf_to( &b, &b0 );
+		bli_obj_create_conf_to( &c, &c0 );
+		bli_obj_create_conf_to( &h, &h0 );
+		bli_obj_create_conf_to( &b, &b1 );
+		bli_obj_create_conf_to( &c, &c1 );
+		bli_obj_create_conf_to( &h, &h1 );
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &l );
+		bli_obj_set_uplo( BLIS_LOWER, &l );
+		bli_obj_set_struc( BLIS_HERMITIAN, &h );
+		bli_obj_set_uplo( BLIS_LOWER, &h );
+		bli_obj_set_struc( BLIS_HERMITIAN, &h0 );
+		bli_obj_set_uplo( BLIS_LOWER, &h0 );
+		bli_obj_set_struc( BLIS_HERMITIAN, &h1 );
+		bli_obj_set_uplo( BLIS_LOWER, &h1 );
+
+		// Keep the values small so that repeating the sequence does not
+		// overflow, and make L diagonally dominant so that trsm is stable.
+		bli_randm( &a );
+		bli_randm( &l );
+		bli_randm( &b0 );
+		bli_randm( &c0 );
+		bli_randm( &h0 );
+		bli_mktrim( &l );
+		bli_setsc( ( double )m, 0.0, &scale );
+		bli_shiftd( &scale, &l );
+		bli_setsc( 1.0/( double )m, 0.0, &scale );
+		bli_scalm( &scale, &a );
+
+		bli_setsc(  (1.0/2.0), 0.0, &alpha );
+		bli_setsc(  (1.0/4.0), 0.0, &beta );
+
+		// Run the sequence without a thread region. The first run is only
+		// to warm up.
+		bli_copym( &b0, &b ); bli_copym( &c0, &c ); bli_copym( &h0, &h );
+		run_seq( &alpha, &beta, &l, &a, &b, &c, &h );
+
+		bli_copym( &b0, &b ); bli_copym( &c0, &c ); bli_copym( &h0, &h );
+
+		dtime = bli_clock();
+
+		for ( r = 0; r < n_repeats; ++r )
+			run_seq( &alpha, &beta, &l, &a, &b, &c, &h );
+
+		dtime_fork = ( bli_clock() - dtime ) / n_repeats;
+
+		bli_copym( &b, &b1 ); bli_copym( &c, &c1 ); bli_copym( &h, &h1 );
+
+		// Run the same sequence inside a thread region.
+		bli_thread_region_begin( 0 );
+
+		bli_copym( &b0, &b ); bli_copym( &c0, &c ); bli_copym( &h0, &h );
+		run_seq( &alpha, &beta, &l, &a, &b, &c, &h );
+
+		bli_copym( &b0, &b ); bli_copym( &c0, &c ); bli_copym( &h0, &h );
+
+		dtime = bli_clock();
+
+		for ( r = 0; r < n_repeats; ++r )
+			run_seq( &alpha, &beta, &l, &a, &b, &c, &h );
+
+		dtime_region = ( bli_clock() - dtime ) / n_repeats;
+
+		bli_thread_region_end();
+
+		// Compare the results of the two runs.
+		bli_subm( &b, &b1 );
+		bli_normfm( &b1, &diff );
+		bli_getsc( &diff, &resid, &resid_i );
+
+		printf( "data_%s_%cgemm_region", THR_STR, dt_ch );
+		printf( "( %2lu, 1:4 ) = [ %4lu %9.2f %9.2f %8.2e ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        dtime_fork * 1.0e6,
+		        dtime_region * 1.0e6,
+		        resid );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &diff );
+		bli_obj_free( &scale );
+
+		bli_obj_free( &a );
+		bli_obj_free( &l );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &h );
+		bli_obj_free( &b0 );
+		bli_obj_free( &c0 );
+		bli_obj_free( &h0 );
+		bli_obj_free( &b1 );
+		bli_obj_free( &c1 );
+		bli_obj_free( &h1 );
+	}
+
+	return 0;
+}
@@ -0,0 +1,195 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include <unistd.h>
+#include "blis.h"
+
+//
+// A study of reserving packing memory ahead of time. For each problem size,
+// the packing block pools are first trimmed to nothing and the first gemm
+// is timed, which includes allocating and faulting in the packing blocks.
+// Then the pools are trimmed again, bli_membrk_reserve() is called for the
+// problem, and the first gemm is timed again. The reported times (in
+// milliseconds) are followed by the gflops of subsequent calls and the
+// total size (in MB) of the pools afterwards. Run with BLIS_POOL_MEM_CAP
+// set (in bytes) to see how capping the packing memory reduces the pools
+// at the expense of smaller blocking.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+int main( int argc, char** argv )
+{
+	obj_t    a, b, c;
+	obj_t    alpha, beta;
+	dim_t    m, n, k;
+	dim_t    p;
+	dim_t    p_begin, p_max, p_inc;
+	int      m_input, n_input, k_input;
+	num_t    dt;
+	char     dt_ch;
+	int      r, n_repeats;
+	dim_t    nt;
+
+	double   dtime;
+	double   dtime_save;
+	double   dtime_cold;
+	double   dtime_rsvd;
+	double   gflops;
+
+	n_repeats = 3;
+
+	dt      = DT;
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	m_input = -1;
+	n_input = -1;
+	k_input = -1;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	// Reserve for as many threads as gemm will use.
+	nt = bli_thread_get_num_threads();
+	if ( nt < 1 ) nt = 1;
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cgemm_reserve", THR_STR, dt_ch );
+	printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %8.3f %8.3f %7.2f %7.2f ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		if ( m_input < 0 ) m = p / ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+		if ( n_input < 0 ) n = p / ( dim_t )abs(n_input);
+		else               n =     ( dim_t )    n_input;
+		if ( k_input < 0 ) k = p / ( dim_t )abs(k_input);
+		else               k =     ( dim_t )    k_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+	#else
+		bli_obj_create( dt, m, k, k, 1, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c );
+	#endif
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		bli_setsc(  (1.0/1.0), 0.0, &alpha );
+		bli_setsc(  (0.0/1.0), 0.0, &beta );
+
+		// Time the first call with empty pools.
+		bli_membrk_trim( 0 );
+
+		dtime = bli_clock();
+
+		bli_gemm( &alpha,
+		          &a,
+		          &b,
+		          &beta,
+		          &c );
+
+		dtime_cold = bli_clock() - dtime;
+
+		// Time the first call after reserving packing memory for it.
+		bli_membrk_trim( 0 );
+		bli_membrk_reserve( dt, m, n, k, nt );
+
+		dtime = bli_clock();
+
+		bli_gemm( &alpha,
+		          &a,
+		          &b,
+		          &beta,
+		          &c );
+
+		dtime_rsvd = bli_clock() - dtime;
+
+		dtime_save = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+
+			bli_gemm( &alpha,
+			          &a,
+			          &b,
+			          &beta,
+			          &c );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+		}
+
+		gflops = ( 2.0 * m * k * n ) / ( dtime_save * 1.0e9 );
+
+		printf( "data_%s_%cgemm_reserve", THR_STR, dt_ch );
+		printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %8.3f %8.3f %7.2f %7.2f ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        dtime_cold * 1.0e3,
+		        dtime_rsvd * 1.0e3,
+		        gflops,
+		        bli_membrk_total_size() / ( 1024.0 * 1024.0 ) );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+	}
+
+	return 0;
+}
@@ -0,0 +1,250 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include <unistd.h>
+#include "blis.h"
+
+//
+// A study of SPMD execution. For each problem size, a team of application
+// threads (BLIS_NUM_THREADS of them, or four if unset) calls gemm together,
+// each passing a rntm_t that records its place in the team. The average time
+// per call (in microseconds) is reported alongside that of an ordinary call
+// from one thread, along with the largest difference between the two results,
+// which should be zero.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+typedef struct
+{
+	obj_t*     alpha;
+	obj_t*     a;
+	obj_t*     b;
+	obj_t*     beta;
+	obj_t*     c;
+	thrcomm_t* comm;
+	dim_t      tid;
+	int        n_repeats;
+} team_args_t;
+
+static void* team_member( void* data_void )
+{
+	team_args_t* args = data_void;
+	rntm_t       rntm = BLIS_RNTM_INITIALIZER;
+	int          r;
+
+	bli_rntm_set_spmd( args->tid, args->comm, &rntm );
+
+	for ( r = 0; r < args->n_repeats; ++r )
+		bli_gemm_ex( args->alpha, args->a, args->b, args->beta, args->c,
+		             NULL, &rntm );
+
+	return NULL;
+}
+
+static void run_team( dim_t n_team, team_args_t* args, bli_pthread_t* ids )
+{
+	dim_t t;
+
+	// The calling thread takes part as thread 0.
+	for ( t = 1; t < n_team; ++t )
+		bli_pthread_create( &ids[t], NULL, team_member, &args[t] );
+
+	team_member( &args[0] );
+
+	for ( t = 1; t < n_team; ++t )
+		bli_pthread_join( ids[t], NULL );
+}
+
+int main( int argc, char** argv )
+{
+	obj_t          a, b, c;
+	obj_t          c0, c1;
+	obj_t          alpha, beta, diff;
+	dim_t          m, n, k;
+	dim_t          p;
+	dim_t          p_begin, p_max, p_inc;
+	int            m_input, n_input, k_input;
+	num_t          dt;
+	char           dt_ch;
+	int            r, n_repeats;
+	dim_t          n_team, t;
+
+	team_args_t*   args;
+	bli_pthread_t* ids;
+	thrcomm_t*     comm;
+
+	double         dtime;
+	double         dtime_one;
+	double         dtime_spmd;
+	double         resid, resid_i;
+
+	n_repeats = 10;
+
+	dt      = DT;
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	m_input = -1;
+	n_input = -1;
+	k_input = -1;
+
+	n_team = bli_thread_get_num_threads();
+	if ( n_team < 1 ) n_team = 4;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	args = malloc( n_team * sizeof( team_args_t ) );
+	ids  = malloc( n_team * sizeof( bli_pthread_t ) );
+	comm = bli_spmd_comm_create( n_team );
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cgemm_spmd", THR_STR, dt_ch );
+	printf( "( %2lu, 1:6 ) = [ %4lu %4lu %4lu %9.2f %9.2f %8.2e ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		if ( m_input < 0 ) m = p / ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+		if ( n_input < 0 ) n = p / ( dim_t )abs(n_input);
+		else               n =     ( dim_t )    n_input;
+		if ( k_input < 0 ) k = p / ( dim_t )abs(k_input);
+		else               k =     ( dim_t )    k_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt, 1, 1, 0, 0, &diff );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+	#else
+		bli_obj_create( dt, m, k, k, 1, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c );
+	#endif
+		bli_obj_create_conf_to( &c, &c0 );
+		bli_obj_create_conf_to( &c, &c1 );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c0 );
+
+		// Use a beta of zero so that every call computes the same result.
+		bli_setsc(  (1.0/1.0), 0.0, &alpha );
+		bli_setsc(  (0.0/1.0), 0.0, &beta );
+
+		// Time ordinary calls from one thread. The first call is only to
+		// warm up.
+		bli_copym( &c0, &c );
+		bli_gemm( &alpha, &a, &b, &beta, &c );
+
+		dtime = bli_clock();
+
+		for ( r = 0; r < n_repeats; ++r )
+			bli_gemm( &alpha, &a, &b, &beta, &c );
+
+		dtime_one = ( bli_clock() - dtime ) / n_repeats;
+
+		bli_copym( &c, &c1 );
+
+		// Time the same calls made together by the team.
+		for ( t = 0; t < n_team; ++t )
+		{
+			args[t].alpha     = &alpha;
+			args[t].a         = &a;
+			args[t].b         = &b;
+			args[t].beta      = &beta;
+			args[t].c         = &c;
+			args[t].comm      = comm;
+			args[t].tid       = t;
+			args[t].n_repeats = 1;
+		}
+
+		bli_copym( &c0, &c );
+		run_team( n_team, args, ids );
+
+		for ( t = 0; t < n_team; ++t )
+			args[t].n_repeats = n_repeats;
+
+		dtime = bli_clock();
+
+		run_team( n_team, args, ids );
+
+		dtime_spmd = ( bli_clock() - dtime ) / n_repeats;
+
+		// Compare the results of the two runs.
+		bli_subm( &c, &c1 );
+		bli_normfm( &c1, &diff );
+		bli_getsc( &diff, &resid, &resid_i );
+
+		printf( "data_%s_%cgemm_spmd", THR_STR, dt_ch );
+		printf( "( %2lu, 1:6 ) = [ %4lu %4lu %4lu %9.2f %9.2f %8.2e ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        dtime_one * 1.0e6,
+		        dtime_spmd * 1.0e6,
+		        resid );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &diff );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c0 );
+		bli_obj_free( &c1 );
+	}
+
+	bli_spmd_comm_free( comm );
+	free( args );
+	free( ids );
+
+	return 0;
+}
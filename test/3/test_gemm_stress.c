@@ -0,0 +1,196 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include <unistd.h>
+#include <pthread.h>
+#include "blis.h"
+
+//
+// A stress test of the memory allocators in a request-per-thread setting.
+// NUM_APP_THREADS application threads each repeatedly call single-threaded
+// gemm on their own small matrices, all at the same time. Every such call
+// checks out packing blocks from the packing block allocator and an array
+// from the small block allocator, so this exercises the locks that guard
+// them. The reported gflops is the aggregate rate over all application
+// threads, followed by the number of gemm calls completed per second. Run
+// each binary with and without BLIS_POOL_CACHE=0 to compare the per-thread
+// block caches against always going to the shared (locked) pools.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+#define NUM_APP_THREADS 16
+
+// Small problems are where the allocators' overhead is most visible.
+#define S_BEGIN 16
+#define S_MAX   128
+#define S_INC   16
+
+typedef struct
+{
+	num_t  dt;
+	dim_t  m, n, k;
+	int    n_repeats;
+} stress_args_t;
+
+static void* stress_thread( void* args_p )
+{
+	stress_args_t* args = args_p;
+
+	obj_t    a, b, c;
+	obj_t    alpha, beta;
+	rntm_t   rntm;
+
+	const num_t dt = args->dt;
+	const dim_t m  = args->m;
+	const dim_t n  = args->n;
+	const dim_t k  = args->k;
+
+	// Each application thread runs BLIS single-threaded.
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( 1, &rntm );
+
+	bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+	bli_obj_create( dt, 1, 1, 0, 0, &beta );
+
+#ifdef COL_STORAGE
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+#else
+	bli_obj_create( dt, m, k, k, 1, &a );
+	bli_obj_create( dt, k, n, n, 1, &b );
+	bli_obj_create( dt, m, n, n, 1, &c );
+#endif
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	bli_setsc(  (1.0/1.0), 0.0, &alpha );
+	bli_setsc(  (1.0/1.0), 0.0, &beta );
+
+	for ( int r = 0; r < args->n_repeats; ++r )
+	{
+		bli_gemm_ex( &alpha,
+		             &a,
+		             &b,
+		             &beta,
+		             &c,
+		             NULL,
+		             &rntm );
+	}
+
+	bli_obj_free( &alpha );
+	bli_obj_free( &beta );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return NULL;
+}
+
+int main( int argc, char** argv )
+{
+	pthread_t     threads[ NUM_APP_THREADS ];
+	stress_args_t args;
+	dim_t         p;
+	num_t         dt;
+	char          dt_ch;
+	int           n_calls;
+
+	double   dtime;
+	double   gflops;
+	double   calls_per_s;
+
+	dt      = DT;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	// Initialize BLIS up front so that its one-time setup is not counted.
+	bli_init();
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = S_BEGIN; p + S_INC <= S_MAX; p += S_INC ) ;
+
+	printf( "data_%s_%cgemm_stress", THR_STR, dt_ch );
+	printf( "( %2lu, 1:5 ) = [ %4lu %4lu %4lu %7.2f %9.0f ];\n",
+	        ( unsigned long )(p - S_BEGIN)/S_INC + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0 );
+
+	for ( p = S_MAX; S_BEGIN <= p; p -= S_INC )
+	{
+		args.dt = dt;
+		args.m  = p;
+		args.n  = p;
+		args.k  = p;
+
+		// Keep the amount of work per size roughly constant.
+		args.n_repeats = bli_max( 1, ( int )( ( 256.0 * 256.0 * 256.0 ) /
+		                                      ( ( double )p * p * p ) ) );
+
+		n_calls = NUM_APP_THREADS * args.n_repeats;
+
+		dtime = bli_clock();
+
+		for ( int t = 0; t < NUM_APP_THREADS; ++t )
+			pthread_create( &threads[ t ], NULL, stress_thread, &args );
+
+		for ( int t = 0; t < NUM_APP_THREADS; ++t )
+			pthread_join( threads[ t ], NULL );
+
+		dtime = bli_clock() - dtime;
+
+		gflops      = ( 2.0 * p * p * p * n_calls ) / ( dtime * 1.0e9 );
+		calls_per_s = n_calls / dtime;
+
+		printf( "data_%s_%cgemm_stress", THR_STR, dt_ch );
+		printf( "( %2lu, 1:5 ) = [ %4lu %4lu %4lu %7.2f %9.0f ];\n",
+		        ( unsigned long )(p - S_BEGIN)/S_INC + 1,
+		        ( unsigned long )p,
+		        ( unsigned long )p,
+		        ( unsigned long )p,
+		        gflops, calls_per_s );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
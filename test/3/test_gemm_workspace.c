@@ -0,0 +1,213 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include <unistd.h>
+#include "blis.h"
+
+//
+// A study of running gemm out of a caller-supplied workspace. For each
+// problem size, bli_workspace_size() is queried, a buffer of that size is
+// attached to a rntm_t, and gemm is run with that rntm_t so that all of its
+// packing and small-block allocations are carved out of the buffer. The
+// result is compared against a gemm run without a workspace. The reported
+// values are the gflops with the workspace, the size estimated by
+// bli_workspace_size() and the peak usage of the workspace (both in KB),
+// and the norm of the difference between the two results (which should be
+// zero).
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+int main( int argc, char** argv )
+{
+	obj_t    a, b, c, c_ref;
+	obj_t    alpha, beta;
+	obj_t    norm;
+	dim_t    m, n, k;
+	dim_t    p;
+	dim_t    p_begin, p_max, p_inc;
+	int      m_input, n_input, k_input;
+	num_t    dt;
+	char     dt_ch;
+	int      r, n_repeats;
+	dim_t    nt;
+
+	rntm_t   rntm;
+	void*    ws;
+	siz_t    ws_size;
+
+	double   dtime;
+	double   dtime_save;
+	double   gflops;
+	double   resid, resid_i;
+
+	n_repeats = 3;
+
+	dt      = DT;
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	m_input = -1;
+	n_input = -1;
+	k_input = -1;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	// Size the workspace for as many threads as gemm will use.
+	nt = bli_thread_get_num_threads();
+	if ( nt < 1 ) nt = 1;
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cgemm_workspace", THR_STR, dt_ch );
+	printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %7.2f %9.1f %9.1f %8.2e ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		if ( m_input < 0 ) m = p / ( dim_t )abs(m_input);
+		else               m =     ( dim_t )    m_input;
+		if ( n_input < 0 ) n = p / ( dim_t )abs(n_input);
+		else               n =     ( dim_t )    n_input;
+		if ( k_input < 0 ) k = p / ( dim_t )abs(k_input);
+		else               k =     ( dim_t )    k_input;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_scalar_init_detached( bli_dt_proj_to_real( dt ), &norm );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+	#else
+		bli_obj_create( dt, m, k, k, 1, &a );
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c );
+		bli_obj_create( dt, m, n, n, 1, &c_ref );
+	#endif
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+		bli_copym( &c, &c_ref );
+
+		bli_setsc(  (1.0/1.0), 0.0, &alpha );
+		bli_setsc(  (1.0/1.0), 0.0, &beta );
+
+		// Query the workspace that gemm needs for this problem and attach
+		// a buffer of that size to the rntm_t.
+		ws_size = bli_workspace_size( BLIS_GEMM, dt, m, n, k, nt );
+		ws      = malloc( ws_size );
+
+		bli_rntm_set_workspace( ws, ws_size, &rntm );
+
+		// Compute the reference result without the workspace.
+		bli_gemm( &alpha,
+		          &a,
+		          &b,
+		          &beta,
+		          &c_ref );
+
+		bli_gemm_ex( &alpha,
+		             &a,
+		             &b,
+		             &beta,
+		             &c,
+		             NULL,
+		             &rntm );
+
+		bli_subm( &c_ref, &c );
+		bli_normfm( &c, &norm );
+		bli_getsc( &norm, &resid, &resid_i );
+
+		bli_setsc(  (0.0/1.0), 0.0, &beta );
+
+		dtime_save = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha,
+			             &a,
+			             &b,
+			             &beta,
+			             &c,
+			             NULL,
+			             &rntm );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+		}
+
+		gflops = ( 2.0 * m * k * n ) / ( dtime_save * 1.0e9 );
+
+		printf( "data_%s_%cgemm_workspace", THR_STR, dt_ch );
+		printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %7.2f %9.1f %9.1f %8.2e ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        gflops,
+		        ws_size / 1024.0,
+		        bli_workspace_peak( &rntm ) / 1024.0,
+		        resid );
+
+		bli_rntm_set_workspace( NULL, 0, &rntm );
+		free( ws );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_ref );
+	}
+
+	return 0;
+}
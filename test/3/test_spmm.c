@@ -0,0 +1,277 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+//
+// A performance study of sparse-times-dense matrix multiplication. For each
+// problem size, a random m x k sparse matrix A with a fraction DENSITY of
+// nonzeros is generated in CSR format and multiplied by a dense k x n
+// matrix B, where n is fixed. The time taken by a straightforward loop over
+// the nonzeros of A is compared with that of bli_?spmm(). The reported
+// gflops are based on 2*nnz*n flops in both cases and are followed by the
+// largest difference between the two results, relative to the largest
+// element of the loop-based result.
+//
+
+#define COL_STORAGE
+//#define ROW_STORAGE
+
+#define N_FIXED 64
+#define DENSITY 0.05
+
+// The straightforward loop: C := beta * C + alpha * A * B, computing one
+// element of C at a time.
+#define GENLOOP( ctype, ch ) \
+\
+static void spmm_loop_ ## ch \
+     ( \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       gint_t* row_ptr, \
+       gint_t* col_ind, \
+       ctype*  val, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	for ( dim_t i = 0; i < m; ++i ) \
+	for ( dim_t j = 0; j < n; ++j ) \
+	{ \
+		ctype cij = 0; \
+\
+		for ( gint_t q = row_ptr[ i ]; q < row_ptr[ i + 1 ]; ++q ) \
+			cij += val[ q ] * b[ col_ind[ q ]*rs_b + j*cs_b ]; \
+\
+		c[ i*rs_c + j*cs_c ] = *beta * c[ i*rs_c + j*cs_c ] + *alpha * cij; \
+	} \
+}
+
+GENLOOP( float,  s )
+GENLOOP( double, d )
+
+int main( int argc, char** argv )
+{
+	obj_t    b, c;
+	obj_t    c_save, c_ref;
+	obj_t    alpha, beta;
+	obj_t    norm;
+	dim_t    m, n, k;
+	dim_t    p;
+	dim_t    p_begin, p_max, p_inc;
+	num_t    dt, dt_r;
+	char     dt_ch;
+	int      r, n_repeats;
+	rntm_t   rntm;
+
+	double   dtime;
+	double   dtime_save;
+	double   gflops[ 2 ];
+	double   diff;
+	double   norm_ref, norm_i;
+
+	n_repeats = 3;
+
+	dt      = DT;
+	dt_r    = bli_dt_proj_to_real( dt );
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	srand( 1 );
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%cspmm", THR_STR, dt_ch );
+	printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %5.3f %7.2f %7.2f %8.1e ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		m = p;
+		k = p;
+		n = N_FIXED;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt_r, 1, 1, 0, 0, &norm );
+
+	#ifdef COL_STORAGE
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+		bli_obj_create( dt, m, n, 0, 0, &c_ref );
+	#else
+		bli_obj_create( dt, k, n, n, 1, &b );
+		bli_obj_create( dt, m, n, n, 1, &c );
+		bli_obj_create( dt, m, n, n, 1, &c_save );
+		bli_obj_create( dt, m, n, n, 1, &c_ref );
+	#endif
+
+		bli_randm( &b );
+		bli_randm( &c );
+
+		bli_setsc(  (2.0/1.0), 0.0, &alpha );
+		bli_setsc(  (1.0/1.0), 0.0, &beta );
+
+		bli_copym( &c, &c_save );
+
+		// Generate A in CSR format, with values in [-1,1].
+		dim_t   nnz_max = ( dim_t )( 1.5 * DENSITY * m * k ) + m + 1;
+		gint_t* row_ptr = malloc( sizeof( gint_t ) * ( m + 1 ) );
+		gint_t* col_ind = malloc( sizeof( gint_t ) * nnz_max );
+		double* val     = malloc( sizeof( double ) * nnz_max );
+		dim_t   nnz     = 0;
+
+		row_ptr[ 0 ] = 0;
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			for ( dim_t l = 0; l < k && nnz < nnz_max; ++l )
+			{
+				if ( rand() >= DENSITY * RAND_MAX ) continue;
+
+				col_ind[ nnz ] = l;
+				val[ nnz ]     = 2.0 * rand() / RAND_MAX - 1.0;
+				++nnz;
+			}
+			row_ptr[ i + 1 ] = nnz;
+		}
+
+		float*  val_s   = malloc( sizeof( float ) * nnz_max );
+		for ( dim_t q = 0; q < nnz; ++q ) val_s[ q ] = val[ q ];
+
+		void*   val_use = ( bli_is_float( dt ) ? ( void* )val_s : ( void* )val );
+
+		// Use the threading parameters given by the environment, if any.
+		bli_rntm_init_from_global( &rntm );
+
+		void*   buf_a   = bli_obj_buffer( &alpha );
+		void*   buf_b   = bli_obj_buffer( &beta );
+		void*   buf_bm  = bli_obj_buffer( &b );
+		void*   buf_c   = bli_obj_buffer( &c );
+		inc_t   rs_b    = bli_obj_row_stride( &b );
+		inc_t   cs_b    = bli_obj_col_stride( &b );
+		inc_t   rs_c    = bli_obj_row_stride( &c );
+		inc_t   cs_c    = bli_obj_col_stride( &c );
+
+		for ( int spmm = 0; spmm < 2; ++spmm )
+		{
+			dtime_save = DBL_MAX;
+
+			for ( r = 0; r < n_repeats; ++r )
+			{
+				bli_copym( &c_save, &c );
+
+				dtime = bli_clock();
+
+				if ( spmm == 0 )
+				{
+					if ( bli_is_float( dt ) )
+						spmm_loop_s( m, n, buf_a, row_ptr, col_ind, val_use,
+						             buf_bm, rs_b, cs_b, buf_b, buf_c, rs_c, cs_c );
+					else
+						spmm_loop_d( m, n, buf_a, row_ptr, col_ind, val_use,
+						             buf_bm, rs_b, cs_b, buf_b, buf_c, rs_c, cs_c );
+				}
+				else if ( bli_is_float( dt ) )
+				{
+					bli_sspmm_ex( m, n, k, buf_a, row_ptr, col_ind, val_use,
+					              buf_bm, rs_b, cs_b, buf_b, buf_c, rs_c, cs_c,
+					              NULL, &rntm );
+				}
+				else
+				{
+					bli_dspmm_ex( m, n, k, buf_a, row_ptr, col_ind, val_use,
+					              buf_bm, rs_b, cs_b, buf_b, buf_c, rs_c, cs_c,
+					              NULL, &rntm );
+				}
+
+				dtime_save = bli_clock_min_diff( dtime_save, dtime );
+			}
+
+			gflops[ spmm ] = ( 2.0 * nnz * n ) / ( dtime_save * 1.0e9 );
+
+			// Save the result of the loop for comparison.
+			if ( spmm == 0 ) bli_copym( &c, &c_ref );
+		}
+
+		// Measure the difference of the spmm result from the loop-based
+		// result.
+		bli_normim( &c_ref, &norm );
+		bli_getsc( &norm, &norm_ref, &norm_i );
+		bli_subm( &c_ref, &c );
+		bli_normim( &c, &norm );
+		bli_getsc( &norm, &diff, &norm_i );
+		diff /= norm_ref;
+
+		printf( "data_%s_%cspmm", THR_STR, dt_ch );
+		printf( "( %2lu, 1:7 ) = [ %4lu %4lu %4lu %5.3f %7.2f %7.2f %8.1e ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        ( double )nnz / ( ( double )m * k ),
+		        gflops[ 0 ], gflops[ 1 ], diff );
+
+		free( row_ptr );
+		free( col_ind );
+		free( val );
+		free( val_s );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &norm );
+
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_ref );
+	}
+
+	return 0;
+}
+
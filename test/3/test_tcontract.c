@@ -0,0 +1,287 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+//
+// A performance study of tensor contraction. For each problem size p, the
+// contraction
+//
+//   C[a,d,b,c] := beta * C[a,d,b,c] + alpha * A[a,e,b,f] * B[f,d,e,c]
+//
+// is computed, where indices a, d, and e have length L_FIXED and b, c, and
+// f have length p/L_FIXED, so that the contraction is equivalent to a
+// p x p x p gemm. Each tensor is stored with its first index varying
+// fastest. The time taken to permute the tensors into matrices, call
+// bli_?gemm(), and permute the result back into C is compared with that of
+// bli_?tcontract(). The reported gflops are based on 2*p^3 flops in both
+// cases and are followed by the largest difference between the two
+// results, relative to the largest element of the gemm-based result.
+//
+
+#define L_FIXED 10
+
+// Copy between a 4-dimensional tensor and a column-stored matrix whose row
+// index combines tensor dimensions r0 (varying fastest) and r1, and whose
+// column index combines dimensions c0 (varying fastest) and c1.
+#define GENPERM( ctype, ch ) \
+\
+static void perm_ ## ch \
+     ( \
+       bool   to_mat, \
+       dim_t* len, \
+       inc_t* st, \
+       int    r0, int r1, \
+       int    c0, int c1, \
+       ctype* t, \
+       ctype* mat  \
+     ) \
+{ \
+	const dim_t m = len[ r0 ] * len[ r1 ]; \
+\
+	for ( dim_t j1 = 0; j1 < len[ c1 ]; ++j1 ) \
+	for ( dim_t j0 = 0; j0 < len[ c0 ]; ++j0 ) \
+	for ( dim_t i1 = 0; i1 < len[ r1 ]; ++i1 ) \
+	for ( dim_t i0 = 0; i0 < len[ r0 ]; ++i0 ) \
+	{ \
+		ctype* tp = t   + i0*st[ r0 ] + i1*st[ r1 ] + j0*st[ c0 ] + j1*st[ c1 ]; \
+		ctype* mp = mat + ( i0 + i1*len[ r0 ] ) + ( j0 + j1*len[ c0 ] )*m; \
+\
+		if ( to_mat ) *mp = *tp; \
+		else          *tp = *mp; \
+	} \
+}
+
+GENPERM( float,  s )
+GENPERM( double, d )
+
+int main( int argc, char** argv )
+{
+	obj_t    a, b, c;
+	obj_t    am, bm, cm;
+	obj_t    c_save, c_ref;
+	obj_t    alpha, beta;
+	obj_t    norm;
+	dim_t    m, n, k;
+	dim_t    p;
+	dim_t    p_begin, p_max, p_inc;
+	num_t    dt, dt_r;
+	char     dt_ch;
+	int      r, n_repeats;
+	rntm_t   rntm;
+
+	double   dtime;
+	double   dtime_save;
+	double   gflops[ 2 ];
+	double   diff;
+	double   norm_ref, norm_i;
+
+	n_repeats = 3;
+
+	dt      = DT;
+	dt_r    = bli_dt_proj_to_real( dt );
+
+	p_begin = P_BEGIN;
+	p_max   = P_MAX;
+	p_inc   = P_INC;
+
+	// Choose the char corresponding to the requested datatype.
+	if ( bli_is_float( dt ) ) dt_ch = 's';
+	else                      dt_ch = 'd';
+
+	// Begin with initializing the last entry to zero so that
+	// matlab allocates space for the entire array once up-front.
+	for ( p = p_begin; p + p_inc <= p_max; p += p_inc ) ;
+
+	printf( "data_%s_%ctcontract", THR_STR, dt_ch );
+	printf( "( %2lu, 1:6 ) = [ %4lu %4lu %4lu %7.2f %7.2f %8.1e ];\n",
+	        ( unsigned long )(p - p_begin)/p_inc + 1,
+	        ( unsigned long )0,
+	        ( unsigned long )0,
+	        ( unsigned long )0, 0.0, 0.0, 0.0 );
+
+	for ( p = p_max; p_begin <= p; p -= p_inc )
+	{
+		const dim_t L = L_FIXED;
+		const dim_t P = p / L_FIXED;
+
+		m = L * P;
+		n = L * P;
+		k = L * P;
+
+		// The dimensions of each tensor, in storage order.
+		dim_t len_a[ 4 ] = { L, L, P, P }; char idx_a[ 4 ] = { 'a', 'e', 'b', 'f' };
+		dim_t len_b[ 4 ] = { P, L, L, P }; char idx_b[ 4 ] = { 'f', 'd', 'e', 'c' };
+		dim_t len_c[ 4 ] = { L, L, P, P }; char idx_c[ 4 ] = { 'a', 'd', 'b', 'c' };
+
+		inc_t st_a[ 4 ], st_b[ 4 ], st_c[ 4 ];
+
+		st_a[ 0 ] = 1; st_b[ 0 ] = 1; st_c[ 0 ] = 1;
+		for ( int i = 1; i < 4; ++i )
+		{
+			st_a[ i ] = st_a[ i - 1 ] * len_a[ i - 1 ];
+			st_b[ i ] = st_b[ i - 1 ] * len_b[ i - 1 ];
+			st_c[ i ] = st_c[ i - 1 ] * len_c[ i - 1 ];
+		}
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt_r, 1, 1, 0, 0, &norm );
+
+		// The tensors are stored as vectors.
+		bli_obj_create( dt, m * k, 1, 0, 0, &a );
+		bli_obj_create( dt, k * n, 1, 0, 0, &b );
+		bli_obj_create( dt, m * n, 1, 0, 0, &c );
+		bli_obj_create( dt, m * n, 1, 0, 0, &c_save );
+		bli_obj_create( dt, m * n, 1, 0, 0, &c_ref );
+
+		bli_obj_create( dt, m, k, 0, 0, &am );
+		bli_obj_create( dt, k, n, 0, 0, &bm );
+		bli_obj_create( dt, m, n, 0, 0, &cm );
+
+		bli_randv( &a );
+		bli_randv( &b );
+		bli_randv( &c );
+
+		bli_setsc(  (2.0/1.0), 0.0, &alpha );
+		bli_setsc(  (1.0/1.0), 0.0, &beta );
+
+		bli_copyv( &c, &c_save );
+
+		// Use the threading parameters given by the environment, if any.
+		bli_rntm_init_from_global( &rntm );
+
+		void*   buf_al  = bli_obj_buffer( &alpha );
+		void*   buf_be  = bli_obj_buffer( &beta );
+		void*   buf_a   = bli_obj_buffer( &a );
+		void*   buf_b   = bli_obj_buffer( &b );
+		void*   buf_c   = bli_obj_buffer( &c );
+		void*   buf_am  = bli_obj_buffer( &am );
+		void*   buf_bm  = bli_obj_buffer( &bm );
+		void*   buf_cm  = bli_obj_buffer( &cm );
+
+		for ( int tc = 0; tc < 2; ++tc )
+		{
+			dtime_save = DBL_MAX;
+
+			for ( r = 0; r < n_repeats; ++r )
+			{
+				bli_copyv( &c_save, &c );
+
+				dtime = bli_clock();
+
+				if ( tc == 0 && bli_is_float( dt ) )
+				{
+					// m = (a,b), n = (c,d), k = (e,f).
+					perm_s( TRUE,  len_a, st_a, 0, 2, 1, 3, buf_a, buf_am );
+					perm_s( TRUE,  len_b, st_b, 2, 0, 3, 1, buf_b, buf_bm );
+					perm_s( TRUE,  len_c, st_c, 0, 2, 3, 1, buf_c, buf_cm );
+
+					bli_gemm_ex( &alpha, &am, &bm, &beta, &cm, NULL, &rntm );
+
+					perm_s( FALSE, len_c, st_c, 0, 2, 3, 1, buf_c, buf_cm );
+				}
+				else if ( tc == 0 )
+				{
+					perm_d( TRUE,  len_a, st_a, 0, 2, 1, 3, buf_a, buf_am );
+					perm_d( TRUE,  len_b, st_b, 2, 0, 3, 1, buf_b, buf_bm );
+					perm_d( TRUE,  len_c, st_c, 0, 2, 3, 1, buf_c, buf_cm );
+
+					bli_gemm_ex( &alpha, &am, &bm, &beta, &cm, NULL, &rntm );
+
+					perm_d( FALSE, len_c, st_c, 0, 2, 3, 1, buf_c, buf_cm );
+				}
+				else if ( bli_is_float( dt ) )
+				{
+					bli_stcontract_ex( buf_al,
+					                   4, len_a, buf_a, st_a, idx_a,
+					                   4, len_b, buf_b, st_b, idx_b,
+					                   buf_be,
+					                   4, len_c, buf_c, st_c, idx_c,
+					                   NULL, &rntm );
+				}
+				else
+				{
+					bli_dtcontract_ex( buf_al,
+					                   4, len_a, buf_a, st_a, idx_a,
+					                   4, len_b, buf_b, st_b, idx_b,
+					                   buf_be,
+					                   4, len_c, buf_c, st_c, idx_c,
+					                   NULL, &rntm );
+				}
+
+				dtime_save = bli_clock_min_diff( dtime_save, dtime );
+			}
+
+			gflops[ tc ] = ( 2.0 * m * n * k ) / ( dtime_save * 1.0e9 );
+
+			// Save the result of gemm for comparison.
+			if ( tc == 0 ) bli_copyv( &c, &c_ref );
+		}
+
+		// Measure the difference of the tcontract result from the gemm-based
+		// result.
+		bli_normiv( &c_ref, &norm );
+		bli_getsc( &norm, &norm_ref, &norm_i );
+		bli_subv( &c_ref, &c );
+		bli_normiv( &c, &norm );
+		bli_getsc( &norm, &diff, &norm_i );
+		diff /= norm_ref;
+
+		printf( "data_%s_%ctcontract", THR_STR, dt_ch );
+		printf( "( %2lu, 1:6 ) = [ %4lu %4lu %4lu %7.2f %7.2f %8.1e ];\n",
+		        ( unsigned long )(p - p_begin)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )n,
+		        ( unsigned long )k,
+		        gflops[ 0 ], gflops[ 1 ], diff );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &norm );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_ref );
+
+		bli_obj_free( &am );
+		bli_obj_free( &bm );
+		bli_obj_free( &cm );
+	}
+
+	return 0;
+}
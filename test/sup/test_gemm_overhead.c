@@ -0,0 +1,158 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include <math.h>
+#include "blis.h"
+
+// Microbenchmark for the per-call overhead of small gemm problems that are
+// handled by the sup code. For each problem size, we time N_CALLS
+// back-to-back calls through
+//  - the BLAS API, which hands the problem to the sup code directly via the
+//    object-free bli_?gemmsup() entry point, and
+//  - the object API, which reaches the same sup kernels and block loops via
+//    bli_gemmsup() and the sup thread decorator,
+// and report the best-of-N_REPEATS time per call in nanoseconds along with
+// the maximum absolute difference between the two results. The smallest
+// size exceeds BLIS_GEMM_TINY_MAX so that the tiny gemm path never applies.
+
+#ifndef N_CALLS
+#define N_CALLS   20000
+#endif
+
+#ifndef N_REPEATS
+#define N_REPEATS 3
+#endif
+
+#ifndef P_BEGIN
+#define P_BEGIN   20
+#endif
+
+#ifndef P_MAX
+#define P_MAX     100
+#endif
+
+#ifndef P_INC
+#define P_INC     5
+#endif
+
+int main( int argc, char** argv )
+{
+	const num_t dt   = BLIS_DOUBLE;
+
+	double      beta = 1.0;
+
+	bli_init();
+
+	printf( "%% ns per call (best of %d, %d calls each)\n", N_REPEATS, N_CALLS );
+	printf( "%%   n     blas     oapi   max|diff|\n" );
+
+	for ( dim_t n = P_BEGIN; n <= P_MAX; n += P_INC )
+	{
+		const f77_int n_f = n;
+
+		// Scale the product so that repeated accumulation into C neither
+		// overflows nor is optimized away.
+		double alpha = 1.0 / ( double )N_CALLS;
+
+		obj_t a, b, c, c2, alphao, betao;
+
+		bli_obj_create( dt, n, n, 0, 0, &a );
+		bli_obj_create( dt, n, n, 0, 0, &b );
+		bli_obj_create( dt, n, n, 0, 0, &c );
+		bli_obj_create( dt, n, n, 0, 0, &c2 );
+
+		bli_obj_create_1x1_with_attached_buffer( dt, &alpha, &alphao );
+		bli_obj_create_1x1_with_attached_buffer( dt, &beta,  &betao );
+
+		bli_randm( &a );
+		bli_randm( &b );
+
+		double* ap = bli_obj_buffer( &a );
+		double* bp = bli_obj_buffer( &b );
+		double* cp = bli_obj_buffer( &c );
+
+		// The objects' column strides may have been padded for alignment.
+		const f77_int ld_a = bli_obj_col_stride( &a );
+		const f77_int ld_b = bli_obj_col_stride( &b );
+		const f77_int ld_c = bli_obj_col_stride( &c );
+
+		double dtime_blas = DBL_MAX;
+		double dtime_oapi = DBL_MAX;
+
+		for ( dim_t r = 0; r < N_REPEATS; ++r )
+		{
+			bli_setm( &BLIS_ZERO, &c );
+
+			double dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_CALLS; ++i )
+				dgemm_( "N", "N", &n_f, &n_f, &n_f,
+				        &alpha, ap, &ld_a, bp, &ld_b, &beta, cp, &ld_c );
+
+			dtime_blas = bli_clock_min_diff( dtime_blas, dtime );
+
+			bli_setm( &BLIS_ZERO, &c2 );
+
+			dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_CALLS; ++i )
+				bli_gemm( &alphao, &a, &b, &betao, &c2 );
+
+			dtime_oapi = bli_clock_min_diff( dtime_oapi, dtime );
+		}
+
+		double diff = 0.0;
+		double* c2p = bli_obj_buffer( &c2 );
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < n; ++i )
+			diff = bli_fmax( diff, fabs( cp[ i + j*ld_c ] - c2p[ i + j*ld_c ] ) );
+
+		printf( "%5lu %8.1f %8.1f   %8.2e\n",
+		        ( unsigned long )n,
+		        dtime_blas / N_CALLS * 1.0e9,
+		        dtime_oapi / N_CALLS * 1.0e9,
+		        diff );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c2 );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
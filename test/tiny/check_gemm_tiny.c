@@ -0,0 +1,210 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include <math.h>
+#include "blis.h"
+
+// Correctness check for the tiny gemm path. For every datatype, every
+// combination of m, n, and k from 0 to BLIS_GEMM_TINY_MAX + 1, every
+// trans/conj combination, and a few (alpha, beta) pairs, we compute
+// C := beta * C + alpha * op(A) * op(B) through
+//  - the typed API (which takes the tiny gemm path when the problem fits),
+//  - the expert typed API with an explicit rntm_t (which bypasses the tiny
+//    gemm path and uses sup or the conventional implementation),
+// and compare the results. When alpha is zero, A and B are filled with NaN
+// so that any read of A or B shows up as a NaN in C. The driver prints one
+// line per datatype and exits with a nonzero status if any case fails.
+
+#define DIM_MAX ( BLIS_GEMM_TINY_MAX + 1 )
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+static dim_t PASTEMAC(ch,opname)( rntm_t* rntm ) \
+{ \
+	const num_t   dt      = PASTEMAC(ch,type); \
+	const dim_t   n_trans = bli_is_complex( dt ) ? 3 : 2; \
+	const trans_t trans[ 3 ] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE, \
+	                             BLIS_CONJ_NO_TRANSPOSE }; \
+\
+	const ctype_r eps     = bli_is_single_prec( dt ) ? FLT_EPSILON \
+	                                                 : DBL_EPSILON; \
+	const ctype_r thresh  = 100.0 * eps; \
+	const ctype_r nan     = NAN; \
+\
+	/* The (alpha, beta) pairs to test. */ \
+	ctype  alphas[ 5 ]; \
+	ctype  betas[ 5 ]; \
+\
+	PASTEMAC(ch,sets)(  1.0,  0.0, alphas[ 0 ] ); PASTEMAC(ch,sets)(  1.0,  0.0, betas[ 0 ] ); \
+	PASTEMAC(ch,sets)( -0.5,  0.7, alphas[ 1 ] ); PASTEMAC(ch,sets)(  1.5, -0.3, betas[ 1 ] ); \
+	PASTEMAC(ch,sets)( -0.5,  0.7, alphas[ 2 ] ); PASTEMAC(ch,sets)(  0.0,  0.0, betas[ 2 ] ); \
+	PASTEMAC(ch,sets)(  0.0,  0.0, alphas[ 3 ] ); PASTEMAC(ch,sets)(  1.5, -0.3, betas[ 3 ] ); \
+	PASTEMAC(ch,sets)(  0.0,  0.0, alphas[ 4 ] ); PASTEMAC(ch,sets)(  0.0,  0.0, betas[ 4 ] ); \
+\
+	ctype* a  = bli_malloc_user( DIM_MAX * DIM_MAX * sizeof( ctype ) ); \
+	ctype* b  = bli_malloc_user( DIM_MAX * DIM_MAX * sizeof( ctype ) ); \
+	ctype* c0 = bli_malloc_user( DIM_MAX * DIM_MAX * sizeof( ctype ) ); \
+	ctype* c1 = bli_malloc_user( DIM_MAX * DIM_MAX * sizeof( ctype ) ); \
+	ctype* c2 = bli_malloc_user( DIM_MAX * DIM_MAX * sizeof( ctype ) ); \
+\
+	PASTEMAC(ch,randm)( 0, BLIS_DENSE, DIM_MAX, DIM_MAX, c0, 1, DIM_MAX ); \
+\
+	dim_t n_fail = 0; \
+\
+	for ( dim_t m  = 0; m  <= DIM_MAX; ++m  ) \
+	for ( dim_t n  = 0; n  <= DIM_MAX; ++n  ) \
+	for ( dim_t k  = 0; k  <= DIM_MAX; ++k  ) \
+	for ( dim_t ta = 0; ta < n_trans;  ++ta ) \
+	for ( dim_t tb = 0; tb < n_trans;  ++tb ) \
+	for ( dim_t ab = 0; ab < 5;        ++ab ) \
+	{ \
+		ctype*  alpha = &alphas[ ab ]; \
+		ctype*  beta  = &betas[ ab ]; \
+\
+		/* Store op(A) and op(B) column-major with a leading dimension of
+		   DIM_MAX, whether or not they are transposed. */ \
+		const inc_t lda = DIM_MAX; \
+		const inc_t ldb = DIM_MAX; \
+		const inc_t ldc = DIM_MAX; \
+\
+		if ( PASTEMAC(ch,eq0)( *alpha ) ) \
+		{ \
+			ctype nanv; \
+			PASTEMAC(ch,sets)( nan, nan, nanv ); \
+			PASTEMAC(ch,setm)( BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, \
+			                   BLIS_DENSE, DIM_MAX, DIM_MAX, &nanv, \
+			                   a, 1, lda ); \
+			PASTEMAC(ch,setm)( BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, \
+			                   BLIS_DENSE, DIM_MAX, DIM_MAX, &nanv, \
+			                   b, 1, ldb ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,randm)( 0, BLIS_DENSE, DIM_MAX, DIM_MAX, a, 1, lda ); \
+			PASTEMAC(ch,randm)( 0, BLIS_DENSE, DIM_MAX, DIM_MAX, b, 1, ldb ); \
+		} \
+\
+		PASTEMAC(ch,copym)( 0, BLIS_NONUNIT_DIAG, BLIS_DENSE, \
+		                    BLIS_NO_TRANSPOSE, DIM_MAX, DIM_MAX, \
+		                    c0, 1, ldc, c1, 1, ldc ); \
+		PASTEMAC(ch,copym)( 0, BLIS_NONUNIT_DIAG, BLIS_DENSE, \
+		                    BLIS_NO_TRANSPOSE, DIM_MAX, DIM_MAX, \
+		                    c0, 1, ldc, c2, 1, ldc ); \
+\
+		PASTEMAC(ch,gemm) \
+		( \
+		  trans[ ta ], trans[ tb ], m, n, k, \
+		  alpha, a, 1, lda, b, 1, ldb, beta, c1, 1, ldc \
+		); \
+\
+		PASTEMAC(ch,gemm_ex) \
+		( \
+		  trans[ ta ], trans[ tb ], m, n, k, \
+		  alpha, a, 1, lda, b, 1, ldb, beta, c2, 1, ldc, \
+		  NULL, rntm \
+		); \
+\
+		/* Compare the results relative to the magnitude of the reference,
+		   including the elements of C outside of the m x n block, which
+		   must not have been touched. */ \
+		ctype_r diff = 0.0; \
+		ctype_r norm = 1.0; \
+\
+		for ( dim_t j = 0; j < DIM_MAX; ++j ) \
+		for ( dim_t i = 0; i < DIM_MAX; ++i ) \
+		{ \
+			ctype   d; \
+			ctype_r d_abs; \
+			ctype_r c_abs; \
+\
+			PASTEMAC(ch,copys)( c1[ i + j*ldc ], d ); \
+			PASTEMAC(ch,subs)( c2[ i + j*ldc ], d ); \
+			PASTEMAC2(ch,chr,abval2s)( d, d_abs ); \
+			PASTEMAC2(ch,chr,abval2s)( c2[ i + j*ldc ], c_abs ); \
+\
+			if ( isnan( d_abs ) ) d_abs = nan; \
+			diff = bli_fmax( diff, d_abs ); \
+			norm = bli_fmax( norm, c_abs ); \
+		} \
+\
+		if ( !( diff <= thresh * ( k + 1 ) * norm ) ) \
+		{ \
+			if ( n_fail < 10 ) \
+				printf( "%% %s FAIL m=%2lu n=%2lu k=%2lu ta=%lu tb=%lu " \
+				        "ab=%lu diff=%8.2e\n", #ch, \
+				        ( unsigned long )m, ( unsigned long )n, \
+				        ( unsigned long )k, ( unsigned long )ta, \
+				        ( unsigned long )tb, ( unsigned long )ab, \
+				        ( double )diff ); \
+			++n_fail; \
+		} \
+	} \
+\
+	bli_free_user( a ); \
+	bli_free_user( b ); \
+	bli_free_user( c0 ); \
+	bli_free_user( c1 ); \
+	bli_free_user( c2 ); \
+\
+	return n_fail; \
+}
+
+INSERT_GENTFUNCR_BASIC0( check_tiny )
+
+int main( int argc, char** argv )
+{
+	rntm_t rntm;
+	dim_t  n_fail = 0;
+	dim_t  n;
+
+	bli_init();
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( 1, &rntm );
+
+	n = bli_scheck_tiny( &rntm ); n_fail += n;
+	printf( "%% s: %s\n", n == 0 ? "PASS" : "FAIL" );
+	n = bli_dcheck_tiny( &rntm ); n_fail += n;
+	printf( "%% d: %s\n", n == 0 ? "PASS" : "FAIL" );
+	n = bli_ccheck_tiny( &rntm ); n_fail += n;
+	printf( "%% c: %s\n", n == 0 ? "PASS" : "FAIL" );
+	n = bli_zcheck_tiny( &rntm ); n_fail += n;
+	printf( "%% z: %s\n", n == 0 ? "PASS" : "FAIL" );
+
+	bli_finalize();
+
+	return n_fail == 0 ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include <math.h>
+#include "blis.h"
+
+// Microbenchmark for the tiny gemm path. For each square size handled by
+// the tiny gemm kernels, we time N_CALLS back-to-back calls through
+//  - the typed API (which takes the tiny gemm path),
+//  - the BLAS API (which also takes the tiny gemm path), and
+//  - the expert typed API with an explicit rntm_t (which bypasses the tiny
+//    gemm path and uses sup or the conventional implementation),
+// and report the best-of-N_REPEATS time per call in nanoseconds along with
+// the maximum absolute difference between the tiny and full results.
+
+#ifndef N_CALLS
+#define N_CALLS   100000
+#endif
+
+#ifndef N_REPEATS
+#define N_REPEATS 3
+#endif
+
+int main( int argc, char** argv )
+{
+	const trans_t transa = BLIS_NO_TRANSPOSE;
+	const trans_t transb = BLIS_NO_TRANSPOSE;
+
+	double  alpha = 1.0;
+	double  beta  = 1.0;
+
+	rntm_t  rntm;
+
+	bli_init();
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( 1, &rntm );
+
+	printf( "%% ns per call (best of %d, %d calls each)\n", N_REPEATS, N_CALLS );
+	printf( "%%  n     tapi     blas     full   max|diff|\n" );
+
+	for ( dim_t n = BLIS_GEMM_TINY_MIN; n <= BLIS_GEMM_TINY_MAX; ++n )
+	{
+		const f77_int n_f = n;
+		const f77_int ld  = n;
+
+		double* a  = bli_malloc_user( n * n * sizeof( double ) );
+		double* b  = bli_malloc_user( n * n * sizeof( double ) );
+		double* c  = bli_malloc_user( n * n * sizeof( double ) );
+		double* c2 = bli_malloc_user( n * n * sizeof( double ) );
+
+		bli_drandm( 0, BLIS_DENSE, n, n, a, 1, n );
+		bli_drandm( 0, BLIS_DENSE, n, n, b, 1, n );
+
+		// Scale the product so that repeated accumulation into C neither
+		// overflows nor is optimized away.
+		alpha = 1.0 / ( double )N_CALLS;
+
+		double dtime_tapi = DBL_MAX;
+		double dtime_blas = DBL_MAX;
+		double dtime_full = DBL_MAX;
+
+		for ( dim_t r = 0; r < N_REPEATS; ++r )
+		{
+			bli_dsetm( BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, BLIS_DENSE,
+			           n, n, bli_d0, c, 1, n );
+
+			double dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_CALLS; ++i )
+				bli_dgemm( transa, transb, n, n, n,
+				           &alpha, a, 1, n, b, 1, n, &beta, c, 1, n );
+
+			dtime_tapi = bli_clock_min_diff( dtime_tapi, dtime );
+
+			bli_dsetm( BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, BLIS_DENSE,
+			           n, n, bli_d0, c, 1, n );
+
+			dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_CALLS; ++i )
+				dgemm_( "N", "N", &n_f, &n_f, &n_f,
+				        &alpha, a, &ld, b, &ld, &beta, c, &ld );
+
+			dtime_blas = bli_clock_min_diff( dtime_blas, dtime );
+
+			bli_dsetm( BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, BLIS_DENSE,
+			           n, n, bli_d0, c2, 1, n );
+
+			dtime = bli_clock();
+
+			for ( dim_t i = 0; i < N_CALLS; ++i )
+				bli_dgemm_ex( transa, transb, n, n, n,
+				              &alpha, a, 1, n, b, 1, n, &beta, c2, 1, n,
+				              NULL, &rntm );
+
+			dtime_full = bli_clock_min_diff( dtime_full, dtime );
+		}
+
+		double diff = 0.0;
+
+		for ( dim_t i = 0; i < n * n; ++i )
+			diff = bli_fmax( diff, fabs( c[ i ] - c2[ i ] ) );
+
+		printf( "%4lu %8.1f %8.1f %8.1f   %8.2e\n",
+		        ( unsigned long )n,
+		        dtime_tapi / N_CALLS * 1.0e9,
+		        dtime_blas / N_CALLS * 1.0e9,
+		        dtime_full / N_CALLS * 1.0e9,
+		        diff );
+
+		bli_free_user( a );
+		bli_free_user( b );
+		bli_free_user( c );
+		bli_free_user( c2 );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
+
@@ -114,6 +114,79 @@ void libblis_test_gemm_md_check
        double*        resid
      );
 
+void libblis_test_gemm_half_check
+     (
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     );
+
+void libblis_test_gemm_half_round
+     (
+       obj_t*         x,
+       num_t          dt_h,
+       obj_t*         x_h,
+       obj_t*         x_u
+     );
+
+void libblis_test_gemm_int_check
+     (
+       trans_t        transa,
+       trans_t        transb,
+       dim_t          m,
+       dim_t          n,
+       dim_t          k,
+       bool           rows,
+       double*        resid
+     );
+
+void libblis_test_gemm_strassen_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     );
+
+void libblis_test_gemm_bs_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     );
+
+void libblis_test_gemm_spmm_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     );
+
+void libblis_test_gemm_tcontract_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     );
+
 double libblis_test_gemm_flops
      (
        obj_t* a,
@@ -287,6 +360,44 @@ void libblis_test_gemm_experiment
 	// Perform checks.
 	libblis_test_gemm_check( params, &alpha, &a, &b, &beta, &c, &c_save, resid );
 
+	// For single precision, also check the half-precision and integer
+	// implementations.
+	if ( bli_is_float( datatype ) )
+	{
+		double resid_half;
+		double resid_int;
+
+		libblis_test_gemm_half_check( &alpha, &a, &b, &beta, &c_save, &resid_half );
+		libblis_test_gemm_int_check( transa, transb, m, n, k,
+		                             bli_obj_is_row_stored( &c ), &resid_int );
+
+		*resid = bli_fmaxabs( *resid, resid_half );
+		*resid = bli_fmaxabs( *resid, resid_int );
+	}
+
+	// Also check the implementations that compute the same product by other
+	// means: Strassen's algorithm (real domain only), block-sparse gemm,
+	// sparse-times-dense multiplication, and tensor contraction.
+	if ( m > 0 && n > 0 && k > 0 )
+	{
+		double resid_x;
+
+		if ( bli_obj_is_real( &c ) )
+		{
+			libblis_test_gemm_strassen_check( params, &alpha, &a, &b, &beta, &c_save, &resid_x );
+			*resid = bli_fmaxabs( *resid, resid_x );
+		}
+
+		libblis_test_gemm_bs_check( params, &alpha, &a, &b, &beta, &c_save, &resid_x );
+		*resid = bli_fmaxabs( *resid, resid_x );
+
+		libblis_test_gemm_spmm_check( params, &alpha, &a, &b, &beta, &c_save, &resid_x );
+		*resid = bli_fmaxabs( *resid, resid_x );
+
+		libblis_test_gemm_tcontract_check( params, &alpha, &a, &b, &beta, &c_save, &resid_x );
+		*resid = bli_fmaxabs( *resid, resid_x );
+	}
+
 	// Zero out performance and residual if output matrix is empty.
 	libblis_test_check_empty_problem( &c, perf, resid );
 
@@ -652,6 +763,590 @@ void libblis_test_gemm_check
 	bli_obj_free( &z );
 }
 
+void libblis_test_gemm_half_check
+     (
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     )
+{
+	// The storage datatypes of A, B, and C for each half-precision case.
+	const num_t dts[ 4 ][ 3 ] =
+	{
+	  { BLIS_BFLOAT16, BLIS_BFLOAT16, BLIS_FLOAT    },
+	  { BLIS_FLOAT16,  BLIS_FLOAT16,  BLIS_FLOAT    },
+	  { BLIS_BFLOAT16, BLIS_FLOAT,    BLIS_FLOAT    },
+	  { BLIS_BFLOAT16, BLIS_BFLOAT16, BLIS_BFLOAT16 }
+	};
+
+	dim_t  m = bli_obj_length( c_orig );
+	dim_t  n = bli_obj_width( c_orig );
+	dim_t  k = bli_obj_width_after_trans( a );
+
+	obj_t  a_h, a_u, b_h, b_u, c_h, c_u;
+
+	*resid = 0.0;
+
+	//
+	// Pre-conditions:
+	// - a, b, and c_orig are randomized single-precision matrices.
+	//
+	// For each case, A, B, and C_orig are rounded to the half-precision
+	// storage datatypes and then widened back to single precision as A_u,
+	// B_u, and C_u, which hold exactly the values that the half-precision
+	// operands represent. We then compute
+	//
+	//   C_h := beta * C_h + alpha * transa(A_h) * transb(B_h)
+	//
+	// with the half-precision implementation and
+	//
+	//   C_u := beta * C_u + alpha * transa(A_u) * transb(B_u)
+	//
+	// with sgemm. Since both accumulate in single precision, the results
+	// should differ only by rounding, except that when C_h is stored as
+	// bfloat16, each of its elements may also differ from the corresponding
+	// element of C_u by one bfloat16 ulp. The residual is the norm of any
+	// difference beyond that, relative to the norm of C_u.
+	//
+
+	for ( dim_t q = 0; q < 4; ++q )
+	{
+		libblis_test_gemm_half_round( a,      dts[ q ][ 0 ], &a_h, &a_u );
+		libblis_test_gemm_half_round( b,      dts[ q ][ 1 ], &b_h, &b_u );
+		libblis_test_gemm_half_round( c_orig, dts[ q ][ 2 ], &c_h, &c_u );
+
+		bli_gemm( alpha, &a_h, &b_h, beta, &c_h );
+		bli_gemm( alpha, &a_u, &b_u, beta, &c_u );
+
+		void*  buf_h = bli_obj_buffer_at_off( &c_h );
+		float* buf_u = bli_obj_buffer_at_off( &c_u );
+		inc_t  rs_c  = bli_obj_row_stride( &c_u );
+		inc_t  cs_c  = bli_obj_col_stride( &c_u );
+		bool   c_bf  = bli_is_bfloat16( dts[ q ][ 2 ] );
+
+		float  c_max = 0.0f;
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+			c_max = bli_fmax( c_max, fabsf( buf_u[ i*rs_c + j*cs_c ] ) );
+
+		// Allow for the rounding errors of single-precision accumulation,
+		// which may cross a bfloat16 rounding boundary.
+		const double slack = ( k + 1 ) * FLT_EPSILON * c_max;
+
+		double norm_e = 0.0;
+		double norm_u = 0.0;
+
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			double u  = buf_u[ i*rs_c + j*cs_c ];
+			double h;
+			double tol = 0.0;
+
+			if ( c_bf )
+			{
+				int e;
+
+				h   = bli_bf16_to_float( ( ( bfloat16* )buf_h )[ i*rs_c + j*cs_c ] );
+				frexp( u, &e );
+				tol = ldexp( 1.0, e - 8 ) + slack;
+			}
+			else
+			{
+				h   = ( ( float* )buf_h )[ i*rs_c + j*cs_c ];
+			}
+
+			double e_ij = bli_fmax( 0.0, fabs( h - u ) - tol );
+
+			norm_e += e_ij * e_ij;
+			norm_u += u * u;
+		}
+
+		double resid_q = ( norm_u > 0.0 ? sqrt( norm_e / norm_u ) : sqrt( norm_e ) );
+
+		*resid = bli_fmaxabs( *resid, resid_q );
+
+		bli_obj_free( &a_h );
+		bli_obj_free( &a_u );
+		bli_obj_free( &b_h );
+		bli_obj_free( &b_u );
+		bli_obj_free( &c_h );
+		bli_obj_free( &c_u );
+	}
+}
+
+void libblis_test_gemm_half_round
+     (
+       obj_t*         x,
+       num_t          dt_h,
+       obj_t*         x_h,
+       obj_t*         x_u
+     )
+{
+	dim_t  m    = bli_obj_length( x );
+	dim_t  n    = bli_obj_width( x );
+	float* buf  = bli_obj_buffer_at_off( x );
+	inc_t  rs   = bli_obj_row_stride( x );
+	inc_t  cs   = bli_obj_col_stride( x );
+
+	// Store x_h and x_u by rows if x is stored by rows, and by columns
+	// otherwise, so that the half-precision implementation sees the same
+	// storage combinations as sgemm.
+	bool   rows = bli_obj_is_row_stored( x );
+
+	bli_obj_create( dt_h,       m, n, rows ? n : 1, rows ? 1 : m, x_h );
+	bli_obj_create( BLIS_FLOAT, m, n, rows ? n : 1, rows ? 1 : m, x_u );
+
+	void*  buf_h = bli_obj_buffer( x_h );
+	float* buf_u = bli_obj_buffer( x_u );
+	inc_t  rs_h  = bli_obj_row_stride( x_h );
+	inc_t  cs_h  = bli_obj_col_stride( x_h );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		float xij = buf[ i*rs + j*cs ];
+		inc_t ij  = i*rs_h + j*cs_h;
+
+		if      ( bli_is_bfloat16( dt_h ) )
+		{
+			bfloat16 h = bli_float_to_bf16( xij );
+			( ( bfloat16* )buf_h )[ ij ] = h;
+			buf_u[ ij ] = bli_bf16_to_float( h );
+		}
+		else if ( bli_is_float16( dt_h ) )
+		{
+			float16 h = bli_float_to_fp16( xij );
+			( ( float16* )buf_h )[ ij ] = h;
+			buf_u[ ij ] = bli_fp16_to_float( h );
+		}
+		else
+		{
+			( ( float* )buf_h )[ ij ] = xij;
+			buf_u[ ij ] = xij;
+		}
+	}
+
+	bli_obj_set_conjtrans( bli_obj_conjtrans_status( x ), x_h );
+	bli_obj_set_conjtrans( bli_obj_conjtrans_status( x ), x_u );
+}
+
+void libblis_test_gemm_int_check
+     (
+       trans_t        transa,
+       trans_t        transb,
+       dim_t          m,
+       dim_t          n,
+       dim_t          k,
+       bool           rows,
+       double*        resid
+     )
+{
+	const int32_t a_zp  = 3;
+	const int32_t b_zp  = -2;
+	int32_t       alpha = 2;
+	int32_t       beta  = -3;
+
+	*resid = 0.0;
+
+	//
+	// The integer implementations are checked against a straightforward
+	// triple loop on randomized integer operands with the dimensions and
+	// transpositions of the current problem. The elements of A are limited
+	// to 7 bits so that the u8s8s32 results are exact (see bli_gemm_i.h),
+	// so the residual is zero unless some element of C is wrong.
+	//
+
+	transa = ( bli_does_trans( transa ) ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE );
+	transb = ( bli_does_trans( transb ) ? BLIS_TRANSPOSE : BLIS_NO_TRANSPOSE );
+
+	// Store A and B by columns. If A (B) is transposed, it is stored as
+	// k x m (n x k), so the strides of transa(A) (transb(B)) are swapped.
+	const inc_t ld_a = ( bli_does_trans( transa ) ? k : m );
+	const inc_t ld_b = ( bli_does_trans( transb ) ? n : k );
+	const inc_t rs_a = ( bli_does_trans( transa ) ? ld_a : 1 );
+	const inc_t cs_a = ( bli_does_trans( transa ) ? 1 : ld_a );
+	const inc_t rs_b = ( bli_does_trans( transb ) ? ld_b : 1 );
+	const inc_t cs_b = ( bli_does_trans( transb ) ? 1 : ld_b );
+	const inc_t rs_c = ( rows ? n : 1 );
+	const inc_t cs_c = ( rows ? 1 : m );
+
+	const siz_t mk = bli_max( m * k, 1 );
+	const siz_t kn = bli_max( k * n, 1 );
+	const siz_t mn = bli_max( m * n, 1 );
+
+	uint8_t* a_u8  = malloc( mk * sizeof( uint8_t ) );
+	int8_t*  b_s8  = malloc( kn * sizeof( int8_t ) );
+	int16_t* a_s16 = malloc( mk * sizeof( int16_t ) );
+	int16_t* b_s16 = malloc( kn * sizeof( int16_t ) );
+	int32_t* c     = malloc( mn * sizeof( int32_t ) );
+	int32_t* c_u8  = malloc( mn * sizeof( int32_t ) );
+	int32_t* c_s16 = malloc( mn * sizeof( int32_t ) );
+
+	for ( siz_t i = 0; i < mk; ++i )
+	{
+		a_u8[ i ]  = ( uint8_t )( rand() % 128 );
+		a_s16[ i ] = ( int16_t )( rand() % 601 - 300 );
+	}
+	for ( siz_t i = 0; i < kn; ++i )
+	{
+		b_s8[ i ]  = ( int8_t )( rand() % 256 - 128 );
+		b_s16[ i ] = ( int16_t )( rand() % 601 - 300 );
+	}
+	for ( siz_t i = 0; i < mn; ++i )
+	{
+		c[ i ] = c_u8[ i ] = c_s16[ i ] = rand() % 2001 - 1000;
+	}
+
+	bli_gemm_u8s8s32( transa, transb, m, n, k, &alpha,
+	                  a_u8, 1, ld_a, a_zp, b_s8, 1, ld_b, b_zp,
+	                  &beta, c_u8, rs_c, cs_c );
+	bli_gemm_s16s16s32( transa, transb, m, n, k, &alpha,
+	                    a_s16, 1, ld_a, a_zp, b_s16, 1, ld_b, b_zp,
+	                    &beta, c_s16, rs_c, cs_c );
+
+	dim_t n_wrong = 0;
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		int64_t ab_u8  = 0;
+		int64_t ab_s16 = 0;
+
+		for ( dim_t l = 0; l < k; ++l )
+		{
+			ab_u8  += ( int64_t )( a_u8[ i*rs_a + l*cs_a ] - a_zp ) *
+			                     ( b_s8[ l*rs_b + j*cs_b ] - b_zp );
+			ab_s16 += ( int64_t )( a_s16[ i*rs_a + l*cs_a ] - a_zp ) *
+			                     ( b_s16[ l*rs_b + j*cs_b ] - b_zp );
+		}
+
+		const int64_t cij = c[ i*rs_c + j*cs_c ];
+
+		// All int32 arithmetic wraps modulo 2^32.
+		const int32_t r_u8  = ( int32_t )( uint32_t )( beta*cij + alpha*ab_u8 );
+		const int32_t r_s16 = ( int32_t )( uint32_t )( beta*cij + alpha*ab_s16 );
+
+		if ( c_u8[ i*rs_c + j*cs_c ]  != r_u8 )  ++n_wrong;
+		if ( c_s16[ i*rs_c + j*cs_c ] != r_s16 ) ++n_wrong;
+	}
+
+	*resid = ( double )n_wrong;
+
+	free( a_u8 );
+	free( b_s8 );
+	free( a_s16 );
+	free( b_s16 );
+	free( c );
+	free( c_u8 );
+	free( c_s16 );
+}
+
+void libblis_test_gemm_strassen_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     )
+{
+	obj_t  z;
+	rntm_t rntm;
+
+	*resid = 0.0;
+
+	// Compute the product with one and two levels of Strassen's algorithm
+	// and check each result in the same way as conventional gemm.
+	for ( dim_t levels = 1; levels <= 2; ++levels )
+	{
+		double resid_l;
+
+		bli_obj_create( bli_obj_dt( c_orig ), bli_obj_length( c_orig ),
+		                bli_obj_width( c_orig ), bli_obj_row_stride( c_orig ),
+		                bli_obj_col_stride( c_orig ), &z );
+		bli_copym( c_orig, &z );
+
+		bli_rntm_init( &rntm );
+		bli_rntm_set_strassen_levels( levels, &rntm );
+
+		bli_gemm_ex( alpha, a, b, beta, &z, NULL, &rntm );
+
+		libblis_test_gemm_check( params, alpha, a, b, beta, &z, c_orig, &resid_l );
+
+		*resid = bli_fmaxabs( *resid, resid_l );
+
+		bli_obj_free( &z );
+	}
+}
+
+void libblis_test_gemm_bs_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     )
+{
+	num_t    dt = bli_obj_dt( c_orig );
+	dim_t    m  = bli_obj_length( c_orig );
+	dim_t    k  = bli_obj_width_after_trans( a );
+
+	obj_t    a_bs, a_z, z, a_blk;
+	blkmap_t map;
+
+	//
+	// A block map that marks roughly one block in three as zero is attached
+	// to a copy of transa(A), A_bs, without zeroing those blocks, and
+	//
+	//   Z := beta * C_orig + alpha * A_bs * transb(B)
+	//
+	// is checked as if A_bs were A_z, a copy of A_bs in which the zero
+	// blocks have actually been zeroed.
+	//
+
+	bli_obj_create( dt, m, k, 0, 0, &a_bs );
+	bli_obj_create( dt, m, k, 0, 0, &a_z );
+	bli_obj_create( dt, m, bli_obj_width( c_orig ), bli_obj_row_stride( c_orig ),
+	                bli_obj_col_stride( c_orig ), &z );
+
+	bli_copym( a, &a_bs );
+	bli_copym( a, &a_z );
+	bli_copym( c_orig, &z );
+
+	// The blocksizes of the map are not multiples of any register blocksize
+	// so that the micro-panels of A straddle the boundaries of the blocks.
+	bli_blkmap_create( m, k, 40, 24, &map );
+
+	for ( dim_t j = 0; j < bli_blkmap_num_blk_cols( &map ); ++j )
+	for ( dim_t i = 0; i < bli_blkmap_num_blk_rows( &map ); ++i )
+	{
+		bool nz = ( ( i + 2*j ) % 3 != 0 );
+
+		bli_blkmap_set_nonzero( i, j, nz, &map );
+
+		if ( !nz )
+		{
+			dim_t i0 = i * 40;
+			dim_t j0 = j * 24;
+
+			bli_acquire_mpart( i0, j0, bli_min( 40, m - i0 ),
+			                   bli_min( 24, k - j0 ), &a_z, &a_blk );
+			bli_setm( &BLIS_ZERO, &a_blk );
+		}
+	}
+
+	bli_obj_set_blkmap( &map, &a_bs );
+
+	bli_gemm( alpha, &a_bs, b, beta, &z );
+
+	libblis_test_gemm_check( params, alpha, &a_z, b, beta, &z, c_orig, resid );
+
+	bli_blkmap_free( &map );
+
+	bli_obj_free( &a_bs );
+	bli_obj_free( &a_z );
+	bli_obj_free( &z );
+}
+
+void libblis_test_gemm_spmm_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     )
+{
+	num_t    dt    = bli_obj_dt( c_orig );
+	dim_t    m     = bli_obj_length( c_orig );
+	dim_t    n     = bli_obj_width( c_orig );
+	dim_t    k     = bli_obj_width_after_trans( a );
+	siz_t    es    = bli_obj_elem_size( c_orig );
+
+	obj_t    a_d, b_r, z;
+
+	//
+	// A copy of transa(A), A_d, has about two in five of its elements set
+	// to zero, and the remaining elements are stored in CSR format. Then
+	//
+	//   Z := beta * C_orig + alpha * A_d * transb(B)
+	//
+	// is computed with spmm, with transb(B) stored by rows, and checked in
+	// the same way as gemm.
+	//
+
+	bli_obj_create( dt, m, k, 0, 0, &a_d );
+	bli_obj_create( dt, k, n, n, 1, &b_r );
+	bli_obj_create( dt, m, n, bli_obj_row_stride( c_orig ),
+	                bli_obj_col_stride( c_orig ), &z );
+
+	bli_copym( a, &a_d );
+	bli_copym( b, &b_r );
+	bli_copym( c_orig, &z );
+
+	char*    buf_a   = bli_obj_buffer( &a_d );
+	inc_t    cs_a    = bli_obj_col_stride( &a_d );
+
+	gint_t*  row_ptr = malloc( ( m + 1 ) * sizeof( gint_t ) );
+	gint_t*  col_ind = malloc( bli_max( m * k, 1 ) * sizeof( gint_t ) );
+	char*    val     = malloc( bli_max( m * k, 1 ) * es );
+	gint_t   nnz     = 0;
+
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		row_ptr[ i ] = nnz;
+
+		for ( dim_t j = 0; j < k; ++j )
+		{
+			char* aij = buf_a + ( i + j*cs_a ) * es;
+
+			if ( ( i*7 + j*13 ) % 5 < 2 )
+			{
+				memset( aij, 0, es );
+			}
+			else
+			{
+				col_ind[ nnz ] = j;
+				memcpy( val + nnz*es, aij, es );
+				++nnz;
+			}
+		}
+	}
+	row_ptr[ m ] = nnz;
+
+	void*  buf_alpha = bli_obj_buffer_at_off( alpha );
+	void*  buf_beta  = bli_obj_buffer_at_off( beta );
+	void*  buf_b     = bli_obj_buffer( &b_r );
+	void*  buf_z     = bli_obj_buffer( &z );
+	inc_t  rs_b      = bli_obj_row_stride( &b_r );
+	inc_t  cs_b      = bli_obj_col_stride( &b_r );
+	inc_t  rs_z      = bli_obj_row_stride( &z );
+	inc_t  cs_z      = bli_obj_col_stride( &z );
+
+	if      ( bli_is_float( dt ) )
+		bli_sspmm( m, n, k, buf_alpha, row_ptr, col_ind, ( float* )val,
+		           buf_b, rs_b, cs_b, buf_beta, buf_z, rs_z, cs_z );
+	else if ( bli_is_double( dt ) )
+		bli_dspmm( m, n, k, buf_alpha, row_ptr, col_ind, ( double* )val,
+		           buf_b, rs_b, cs_b, buf_beta, buf_z, rs_z, cs_z );
+	else if ( bli_is_scomplex( dt ) )
+		bli_cspmm( m, n, k, buf_alpha, row_ptr, col_ind, ( scomplex* )val,
+		           buf_b, rs_b, cs_b, buf_beta, buf_z, rs_z, cs_z );
+	else
+		bli_zspmm( m, n, k, buf_alpha, row_ptr, col_ind, ( dcomplex* )val,
+		           buf_b, rs_b, cs_b, buf_beta, buf_z, rs_z, cs_z );
+
+	libblis_test_gemm_check( params, alpha, &a_d, &b_r, beta, &z, c_orig, resid );
+
+	free( row_ptr );
+	free( col_ind );
+	free( val );
+
+	bli_obj_free( &a_d );
+	bli_obj_free( &b_r );
+	bli_obj_free( &z );
+}
+
+void libblis_test_gemm_tcontract_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c_orig,
+       double*        resid
+     )
+{
+	num_t    dt    = bli_obj_dt( c_orig );
+	dim_t    m     = bli_obj_length( c_orig );
+	dim_t    n     = bli_obj_width( c_orig );
+	dim_t    k     = bli_obj_width_after_trans( a );
+
+	obj_t    a_c, b_r, z;
+
+	//
+	// transa(A) is copied by columns and transb(B) by rows, and k is split
+	// as k = k1 * k2 into two labeled dimensions, "a" (k1) and "b" (k2).
+	// Listing them in opposite orders in A and B causes the offsets along k
+	// to lose their constant stride in one of the two tensors, so that both
+	// the packm kernels and the gather path are exercised in
+	//
+	//   Z := beta * C_orig + alpha * transa(A) * transb(B),
+	//
+	// which is then checked in the same way as gemm.
+	//
+
+	dim_t k1 = 1;
+
+	for ( dim_t d = 2; d * d <= k; ++d )
+		if ( k % d == 0 ) k1 = d;
+
+	dim_t k2 = k / k1;
+
+	bli_obj_create( dt, m, k, 0, 0, &a_c );
+	bli_obj_create( dt, k, n, n, 1, &b_r );
+	bli_obj_create( dt, m, n, bli_obj_row_stride( c_orig ),
+	                bli_obj_col_stride( c_orig ), &z );
+
+	bli_copym( a, &a_c );
+	bli_copym( b, &b_r );
+	bli_copym( c_orig, &z );
+
+	// The element in row i and column l1 + l2*k1 of transa(A) is
+	// a_c[ i + l1*m + l2*k1*m ], and likewise for transb(B).
+	inc_t  cs_a  = bli_obj_col_stride( &a_c );
+	inc_t  rs_b  = bli_obj_row_stride( &b_r );
+
+	dim_t  len_a[ 3 ] = { m,    k2,         k1   };
+	inc_t  str_a[ 3 ] = { 1,    k1*cs_a,    cs_a };
+	dim_t  len_b[ 3 ] = { k1,   k2,         n    };
+	inc_t  str_b[ 3 ] = { rs_b, k1*rs_b,    1    };
+	dim_t  len_c[ 2 ] = { m,    n };
+	inc_t  str_c[ 2 ] = { bli_obj_row_stride( &z ), bli_obj_col_stride( &z ) };
+
+	void*  buf_alpha = bli_obj_buffer_at_off( alpha );
+	void*  buf_beta  = bli_obj_buffer_at_off( beta );
+	void*  buf_a     = bli_obj_buffer( &a_c );
+	void*  buf_b     = bli_obj_buffer( &b_r );
+	void*  buf_z     = bli_obj_buffer( &z );
+
+	if      ( bli_is_float( dt ) )
+		bli_stcontract( buf_alpha, 3, len_a, buf_a, str_a, "mba",
+		                           3, len_b, buf_b, str_b, "abn",
+		                buf_beta,  2, len_c, buf_z, str_c, "mn" );
+	else if ( bli_is_double( dt ) )
+		bli_dtcontract( buf_alpha, 3, len_a, buf_a, str_a, "mba",
+		                           3, len_b, buf_b, str_b, "abn",
+		                buf_beta,  2, len_c, buf_z, str_c, "mn" );
+	else if ( bli_is_scomplex( dt ) )
+		bli_ctcontract( buf_alpha, 3, len_a, buf_a, str_a, "mba",
+		                           3, len_b, buf_b, str_b, "abn",
+		                buf_beta,  2, len_c, buf_z, str_c, "mn" );
+	else
+		bli_ztcontract( buf_alpha, 3, len_a, buf_a, str_a, "mba",
+		                           3, len_b, buf_b, str_b, "abn",
+		                buf_beta,  2, len_c, buf_z, str_c, "mn" );
+
+	libblis_test_gemm_check( params, alpha, &a_c, &b_r, beta, &z, c_orig, resid );
+
+	bli_obj_free( &a_c );
+	bli_obj_free( &b_r );
+	bli_obj_free( &z );
+}
+
 double libblis_test_gemm_flops
      (
        obj_t* a,
@@ -186,9 +186,10 @@ void libblis_test_herk_experiment
 	bli_param_map_char_to_blis_uplo( pc_str[0], &uploc );
 	bli_param_map_char_to_blis_trans( pc_str[1], &transa );
 
-	// Create test scalars.
-	bli_obj_scalar_init_detached( datatype, &alpha );
-	bli_obj_scalar_init_detached( datatype, &beta );
+	// Create test scalars. For herk, alpha and beta are real-valued, so we
+	// store them as real scalars, as the BLAS compatibility layer does.
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( datatype ), &alpha );
+	bli_obj_scalar_init_detached( bli_dt_proj_to_real( datatype ), &beta );
 
 	// Create test operands (vectors and/or matrices).
 	libblis_test_mobj_create( params, datatype, transa,
@@ -252,6 +253,24 @@ void libblis_test_herk_experiment
 	// Perform checks.
 	libblis_test_herk_check( params, &alpha, &a, &beta, &c, &c_save, resid );
 
+	// Repeat the operation with a context whose sup thresholds admit every
+	// problem size, which forces the small/unpacked implementation, and
+	// check that result as well.
+	{
+		cntx_t cntx_sup;
+		double resid_sup;
+
+		libblis_test_init_sup_cntx( &cntx_sup );
+
+		bli_copym( &c_save, &c );
+
+		bli_herk_ex( &alpha, &a, &beta, &c, &cntx_sup, NULL );
+
+		libblis_test_herk_check( params, &alpha, &a, &beta, &c, &c_save, &resid_sup );
+
+		*resid = bli_fmaxabs( *resid, resid_sup );
+	}
+
 	// Zero out performance and residual if output matrix is empty.
 	libblis_test_check_empty_problem( &c, perf, resid );
 
@@ -864,6 +864,7 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "memory pools\n" );
 	libblis_test_fprintf_c( os, "  enabled for packing blocks?  %d\n", ( int )bli_info_get_enable_pba_pools() );
 	libblis_test_fprintf_c( os, "  enabled for small blocks?    %d\n", ( int )bli_info_get_enable_sba_pools() );
+	libblis_test_fprintf_c( os, "  huge pages for packing?      %d\n", ( int )bli_membrk_hugepages_enabled() );
 	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "memory alignment (bytes)         \n" );
 	libblis_test_fprintf_c( os, "  stack address                %d\n", ( int )bli_info_get_stack_buf_align_size() );
@@ -3161,6 +3162,44 @@ void libblis_test_check_empty_problem( obj_t* c, double* perf, double* resid )
 
 
 
+void libblis_test_init_sup_cntx( cntx_t* cntx )
+{
+	// Copy the native context and raise its sup thresholds for every
+	// datatype so that the small/unpacked handlers accept problems of any
+	// size. This allows the level-3 tests to check the sup code paths
+	// regardless of the problem sizes being tested.
+	*cntx = *bli_gks_query_cntx();
+
+	for ( dim_t i = 0; i < BLIS_NUM_THRESH; ++i )
+	{
+		bli_blksz_init_easy( bli_cntx_get_l3_sup_thresh( i, cntx ),
+		                     INT_MAX, INT_MAX, INT_MAX, INT_MAX );
+	}
+
+	// A sub-configuration that never uses sup for some datatype need not
+	// register sup blocksizes for it. Give each such datatype the
+	// conventional cache and register blocksizes so that the sup variants
+	// can run with the reference sup kernels.
+	const bszid_t bszids[] = { BLIS_NC, BLIS_KC, BLIS_MC, BLIS_NR, BLIS_MR };
+	blksz_t*      blkszs   = bli_cntx_l3_sup_blkszs_buf( cntx );
+
+	for ( num_t dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		if ( bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ) > 0 )
+			continue;
+
+		for ( dim_t i = 0; i < 5; ++i )
+		{
+			const dim_t b = bli_cntx_get_blksz_def_dt( dt, bszids[ i ], cntx );
+
+			bli_blksz_set_def( b, dt, &blkszs[ bszids[ i ] ] );
+			bli_blksz_set_max( b, dt, &blkszs[ bszids[ i ] ] );
+		}
+	}
+}
+
+
+
 int libblis_test_op_is_disabled( test_op_t* op )
 {
 	int r_val;
@@ -47,6 +47,9 @@
 // For other string manipulation functions (e.g. isspace()).
 #include <ctype.h>
 
+// For INT_MAX.
+#include <limits.h>
+
 // For POSIX stuff.
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -458,6 +461,7 @@ void libblis_test_parse_command_line( int argc, char** argv );
 // --- Miscellaneous ---
 
 void libblis_test_check_empty_problem( obj_t* c, double* perf, double* resid );
+void libblis_test_init_sup_cntx( cntx_t* cntx );
 int  libblis_test_op_is_disabled( test_op_t* op );
 
 bool libblis_test_op_is_done( test_op_t* op );
@@ -252,6 +252,24 @@ void libblis_test_syrk_experiment
 	// Perform checks.
 	libblis_test_syrk_check( params, &alpha, &a, &beta, &c, &c_save, resid );
 
+	// Repeat the operation with a context whose sup thresholds admit every
+	// problem size, which forces the small/unpacked implementation, and
+	// check that result as well.
+	{
+		cntx_t cntx_sup;
+		double resid_sup;
+
+		libblis_test_init_sup_cntx( &cntx_sup );
+
+		bli_copym( &c_save, &c );
+
+		bli_syrk_ex( &alpha, &a, &beta, &c, &cntx_sup, NULL );
+
+		libblis_test_syrk_check( params, &alpha, &a, &beta, &c, &c_save, &resid_sup );
+
+		*resid = bli_fmaxabs( *resid, resid_sup );
+	}
+
 	// Zero out performance and residual if output matrix is empty.
 	libblis_test_check_empty_problem( &c, perf, resid );
 
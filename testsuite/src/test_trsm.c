@@ -249,6 +249,25 @@ void libblis_test_trsm_experiment
 	// Perform checks.
 	libblis_test_trsm_check( params, side, &alpha, &a, &b, &b_save, resid );
 
+	// Repeat the operation with a context whose sup thresholds admit every
+	// problem size, which forces the small/unpacked implementation for every
+	// combination of side, uploa, transa, and diaga, and check that result
+	// as well.
+	{
+		cntx_t cntx_sup;
+		double resid_sup;
+
+		libblis_test_init_sup_cntx( &cntx_sup );
+
+		bli_copym( &b_save, &b );
+
+		bli_trsm_ex( side, &alpha, &a, &b, &cntx_sup, NULL );
+
+		libblis_test_trsm_check( params, side, &alpha, &a, &b, &b_save, &resid_sup );
+
+		*resid = bli_fmaxabs( *resid, resid_sup );
+	}
+
 	// Zero out performance and residual if output matrix is empty.
 	libblis_test_check_empty_problem( &b, perf, resid );
 